@@ -4,6 +4,7 @@
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb.hpp"
+#include "duckdb/main/rl_model_interface.hpp"
 #include "duckdb_benchmark.hpp"
 #include "interpreted_benchmark.hpp"
 
@@ -193,11 +194,187 @@ void BenchmarkRunner::RunBenchmark(Benchmark *benchmark) {
 	benchmark->Finalize();
 }
 
+static const char *MODEL_EVAL_HEADER =
+    "name\tmodel_on\tmodel_off\tdelta\toperators\trl_qerr_mean\trl_qerr_max\tduck_qerr_mean\tduck_qerr_max";
+
+void BenchmarkRunner::RunModelEvaluation(Benchmark *benchmark) {
+	Profiler profiler;
+	// pass 0 runs with the cardinality model enabled, pass 1 with DuckDB's native estimates only
+	double best_time[2] = {0.0, 0.0};
+	RLQErrorStats stats[2];
+	for (idx_t pass = 0; pass < 2; pass++) {
+		RLModelInterface::SetModelEnabled(pass == 0);
+		duckdb::unique_ptr<BenchmarkState> state;
+		string error;
+		try {
+			state = benchmark->Initialize(configuration);
+			benchmark->Assert(state.get());
+		} catch (std::exception &ex) {
+			error = duckdb::ErrorData(ex).Message();
+		}
+		if (error.empty()) {
+			// one cold run to warm caches, then keep the best hot run
+			RLModelInterface::SnapshotQErrorStats(true);
+			auto nruns = benchmark->NRuns();
+			for (size_t i = 0; i < nruns + 1; i++) {
+				if (i > 0 && benchmark->RequireReinit()) {
+					state = benchmark->Initialize(configuration);
+				}
+				try {
+					profiler.Start();
+					benchmark->Run(state.get());
+					profiler.End();
+				} catch (std::exception &ex) {
+					error = duckdb::ErrorData(ex).Message();
+					break;
+				}
+				auto verify = benchmark->Verify(state.get());
+				if (!verify.empty()) {
+					error = "INCORRECT RESULT: " + verify;
+					break;
+				}
+				if (i > 0 && (best_time[pass] == 0.0 || profiler.Elapsed() < best_time[pass])) {
+					best_time[pass] = profiler.Elapsed();
+				}
+				benchmark->Cleanup(state.get());
+			}
+			stats[pass] = RLModelInterface::SnapshotQErrorStats(true);
+			benchmark->Finalize();
+		}
+		if (!error.empty()) {
+			RLModelInterface::SetModelEnabled(true);
+			Log(StringUtil::Format("%s\t", benchmark->name));
+			LogResult("ERROR");
+			LogLine(error);
+			return;
+		}
+	}
+	RLModelInterface::SetModelEnabled(true);
+
+	// Q-errors of the model-off pass are meaningless for the model, so report the model-on pass
+	auto &on = stats[0];
+	double rl_q_error_mean = on.operator_count ? on.rl_q_error_sum / on.operator_count : 0.0;
+	double duckdb_q_error_mean = on.operator_count ? on.duckdb_q_error_sum / on.operator_count : 0.0;
+	double delta_percent = best_time[1] > 0.0 ? (best_time[0] - best_time[1]) / best_time[1] * 100.0 : 0.0;
+	LogResult(StringUtil::Format("%s\t%.6f\t%.6f\t%+.2f%%\t%llu\t%.3f\t%.3f\t%.3f\t%.3f", benchmark->name,
+	                             best_time[0], best_time[1], delta_percent,
+	                             (unsigned long long)on.operator_count, rl_q_error_mean, on.rl_q_error_max,
+	                             duckdb_q_error_mean, on.duckdb_q_error_max));
+}
+
+static const char *CONCURRENT_HEADER = "name\tclients\truns_per_client\tthroughput\tavg\tp99\tfairness";
+
+void BenchmarkRunner::RunConcurrentBenchmark(Benchmark *benchmark) {
+	auto n_clients = configuration.concurrent_clients;
+	auto runs_per_client = configuration.concurrent_runs;
+
+	duckdb::unique_ptr<BenchmarkState> state;
+	try {
+		state = benchmark->Initialize(configuration);
+		benchmark->Assert(state.get());
+	} catch (std::exception &ex) {
+		Log(StringUtil::Format("%s\t", benchmark->name));
+		LogResult("ERROR");
+		LogLine(duckdb::ErrorData(ex).Message());
+		return;
+	}
+	// open one connection per client against the shared database
+	std::vector<duckdb::unique_ptr<BenchmarkState>> client_states;
+	for (idx_t client_idx = 0; client_idx < n_clients; client_idx++) {
+		auto client_state = benchmark->InitializeClient(state.get());
+		if (!client_state) {
+			Log(StringUtil::Format("%s\t", benchmark->name));
+			LogResult("SKIP (benchmark does not support concurrent clients)");
+			return;
+		}
+		client_states.push_back(std::move(client_state));
+	}
+	std::vector<std::vector<double>> client_timings(n_clients);
+	std::vector<string> client_errors(n_clients);
+	std::vector<std::thread> clients;
+	Profiler total_timer;
+	total_timer.Start();
+	for (idx_t client_idx = 0; client_idx < n_clients; client_idx++) {
+		clients.emplace_back([&, client_idx]() {
+			Profiler profiler;
+			for (idx_t run = 0; run < runs_per_client; run++) {
+				try {
+					profiler.Start();
+					benchmark->RunClient(client_states[client_idx].get());
+					profiler.End();
+				} catch (std::exception &ex) {
+					client_errors[client_idx] = duckdb::ErrorData(ex).Message();
+					return;
+				}
+				client_timings[client_idx].push_back(profiler.Elapsed());
+			}
+		});
+	}
+	for (auto &client : clients) {
+		client.join();
+	}
+	total_timer.End();
+	benchmark->Finalize();
+
+	for (idx_t client_idx = 0; client_idx < n_clients; client_idx++) {
+		if (!client_errors[client_idx].empty()) {
+			Log(StringUtil::Format("%s\t", benchmark->name));
+			LogResult("ERROR");
+			LogLine(client_errors[client_idx]);
+			return;
+		}
+	}
+	// aggregate the per-client samples
+	std::vector<double> all_timings;
+	double min_client_throughput = 0.0;
+	double max_client_throughput = 0.0;
+	for (idx_t client_idx = 0; client_idx < n_clients; client_idx++) {
+		double client_total = 0.0;
+		for (auto timing : client_timings[client_idx]) {
+			all_timings.push_back(timing);
+			client_total += timing;
+		}
+		double client_throughput = client_total > 0.0 ? double(runs_per_client) / client_total : 0.0;
+		if (client_idx == 0 || client_throughput < min_client_throughput) {
+			min_client_throughput = client_throughput;
+		}
+		if (client_throughput > max_client_throughput) {
+			max_client_throughput = client_throughput;
+		}
+	}
+	std::sort(all_timings.begin(), all_timings.end());
+	double avg = 0.0;
+	for (auto timing : all_timings) {
+		avg += timing;
+	}
+	avg /= double(all_timings.size());
+	auto p99_index = (all_timings.size() * 99 + 99) / 100 - 1;
+	double p99 = all_timings[MinValue<idx_t>(p99_index, all_timings.size() - 1)];
+	double throughput = total_timer.Elapsed() > 0.0 ? double(all_timings.size()) / total_timer.Elapsed() : 0.0;
+	// fairness is the throughput ratio between the slowest and the fastest client (1.0 = perfectly fair)
+	double fairness = max_client_throughput > 0.0 ? min_client_throughput / max_client_throughput : 0.0;
+	LogResult(StringUtil::Format("%s\t%llu\t%llu\t%.2f\t%.6f\t%.6f\t%.3f", benchmark->name,
+	                             (unsigned long long)n_clients, (unsigned long long)runs_per_client, throughput, avg,
+	                             p99, fairness));
+}
+
 void BenchmarkRunner::RunBenchmarks() {
 	LogLine("Starting benchmark run.");
-	LogLine("name\trun\ttiming");
+	if (configuration.model_eval) {
+		LogLine(MODEL_EVAL_HEADER);
+	} else if (configuration.concurrent_clients > 0) {
+		LogLine(CONCURRENT_HEADER);
+	} else {
+		LogLine("name\trun\ttiming");
+	}
 	for (auto &benchmark : benchmarks) {
-		RunBenchmark(benchmark);
+		if (configuration.model_eval) {
+			RunModelEvaluation(benchmark);
+		} else if (configuration.concurrent_clients > 0) {
+			RunConcurrentBenchmark(benchmark);
+		} else {
+			RunBenchmark(benchmark);
+		}
 	}
 }
 
@@ -218,6 +395,12 @@ void print_help() {
 	                "look for the 'benchmarks' directory\n");
 	fprintf(stderr, "              --disable-timeout      Disables killing the run after a certain amount of time has "
 	                "passed (30 seconds by default)\n");
+	fprintf(stderr, "              --model-eval           Runs each benchmark with the cardinality model on and off, "
+	                "reporting runtime deltas and Q-error statistics\n");
+	fprintf(stderr, "              --concurrent=n         Runs each benchmark with n concurrent clients against a "
+	                "shared database, reporting throughput, p99 latency and fairness\n");
+	fprintf(stderr, "              --concurrent-runs=n    How often each concurrent client repeats the benchmark "
+	                "query (default: 10)\n");
 	fprintf(stderr,
 	        "              [name_pattern]         Run only the benchmark which names match the specified name pattern, "
 	        "e.g., DS.* for TPC-DS benchmarks\n");
@@ -296,6 +479,16 @@ void parse_arguments(const int arg_counter, char const *const *arg_values) {
 			instance.configuration.meta = BenchmarkMetaType::QUERY;
 		} else if (arg == "--disable-timeout") {
 			instance.configuration.timeout_duration = optional_idx();
+		} else if (arg == "--model-eval") {
+			instance.configuration.model_eval = true;
+		} else if (StringUtil::StartsWith(arg, "--concurrent=")) {
+			auto splits = StringUtil::Split(arg, '=');
+			instance.configuration.concurrent_clients =
+			    Value(splits[1]).DefaultCastAs(LogicalType::UINTEGER).GetValue<uint32_t>();
+		} else if (StringUtil::StartsWith(arg, "--concurrent-runs=")) {
+			auto splits = StringUtil::Split(arg, '=');
+			instance.configuration.concurrent_runs =
+			    Value(splits[1]).DefaultCastAs(LogicalType::UINTEGER).GetValue<uint32_t>();
 		} else if (StringUtil::StartsWith(arg, "--out=") || StringUtil::StartsWith(arg, "--log=")) {
 			auto splits = StringUtil::Split(arg, '=');
 			if (splits.size() != 2) {
@@ -377,9 +570,21 @@ ConfigurationError run_benchmarks() {
 				fprintf(stdout, "%s\n", query.c_str());
 			}
 		} else {
-			instance.LogLine("name\trun\ttiming");
+			if (instance.configuration.model_eval) {
+				instance.LogLine(MODEL_EVAL_HEADER);
+			} else if (instance.configuration.concurrent_clients > 0) {
+				instance.LogLine(CONCURRENT_HEADER);
+			} else {
+				instance.LogLine("name\trun\ttiming");
+			}
 			for (const auto &benchmark_index : benchmark_indices) {
-				instance.RunBenchmark(benchmarks[benchmark_index]);
+				if (instance.configuration.model_eval) {
+					instance.RunModelEvaluation(benchmarks[benchmark_index]);
+				} else if (instance.configuration.concurrent_clients > 0) {
+					instance.RunConcurrentBenchmark(benchmarks[benchmark_index]);
+				} else {
+					instance.RunBenchmark(benchmarks[benchmark_index]);
+				}
 			}
 		}
 	} else {
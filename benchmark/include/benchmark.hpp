@@ -66,6 +66,15 @@ public:
 	virtual string Subgroup() {
 		return string();
 	}
+	//! Open a per-client state against the shared database of "state", for the concurrent
+	//! harness. Returns nullptr if the benchmark cannot be driven by concurrent clients.
+	virtual duckdb::unique_ptr<BenchmarkState> InitializeClient(BenchmarkState *state) {
+		return nullptr;
+	}
+	//! Run one iteration of the workload trace on a client state obtained from InitializeClient
+	virtual void RunClient(BenchmarkState *client_state) {
+		Run(client_state);
+	}
 	//! Interrupt the benchmark because of a timeout
 	virtual void Interrupt(BenchmarkState *state) = 0;
 	//! Returns information about the benchmark
@@ -22,12 +22,21 @@ enum class BenchmarkProfileInfo { NONE, NORMAL, DETAILED };
 struct BenchmarkConfiguration {
 public:
 	constexpr static size_t DEFAULT_TIMEOUT = 30;
+	constexpr static size_t DEFAULT_CONCURRENT_RUNS = 10;
 
 public:
 	string name_pattern {};
 	BenchmarkMetaType meta = BenchmarkMetaType::NONE;
 	BenchmarkProfileInfo profile_info = BenchmarkProfileInfo::NONE;
 	optional_idx timeout_duration = optional_idx(DEFAULT_TIMEOUT);
+	//! Model evaluation mode: run each benchmark with the cardinality model on and off,
+	//! reporting runtime deltas and Q-error statistics per query
+	bool model_eval = false;
+	//! Concurrent mode: number of clients driving the benchmark query against a shared
+	//! database at the same time (0 disables the mode)
+	idx_t concurrent_clients = 0;
+	//! How often each concurrent client repeats the benchmark query
+	idx_t concurrent_runs = DEFAULT_CONCURRENT_RUNS;
 };
 
 } // namespace duckdb
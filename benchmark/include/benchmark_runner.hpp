@@ -46,6 +46,11 @@ public:
 
 	void RunBenchmark(Benchmark *benchmark);
 	void RunBenchmarks();
+	//! Run a benchmark twice - cardinality model on and off - and report runtime and Q-error deltas
+	void RunModelEvaluation(Benchmark *benchmark);
+	//! Run a benchmark with N concurrent clients against a shared database and report
+	//! throughput, tail latency and fairness across the clients
+	void RunConcurrentBenchmark(Benchmark *benchmark);
 
 	vector<Benchmark *> benchmarks;
 	ofstream out_file;
@@ -56,6 +56,15 @@ struct DuckDBBenchmarkState : public BenchmarkState {
 	}
 };
 
+//! State of a single client in the concurrent harness: a connection to the shared database
+struct DuckDBClientState : public BenchmarkState {
+	Connection conn;
+	duckdb::unique_ptr<QueryResult> result;
+
+	explicit DuckDBClientState(DuckDB &db) : conn(db) {
+	}
+};
+
 //! The base Benchmark class is a base class that is used to create and register
 //! new benchmarks
 class DuckDBBenchmark : public Benchmark {
@@ -119,6 +128,23 @@ public:
 		return VerifyResult(state->result.get());
 	}
 
+	duckdb::unique_ptr<BenchmarkState> InitializeClient(BenchmarkState *state_p) override {
+		if (GetQuery().empty()) {
+			// benchmarks that drive their own query mix through RunBenchmark cannot be replayed per client
+			return nullptr;
+		}
+		auto state = (DuckDBBenchmarkState *)state_p;
+		return make_uniq<DuckDBClientState>(state->db);
+	}
+
+	void RunClient(BenchmarkState *client_p) override {
+		auto client = (DuckDBClientState *)client_p;
+		client->result = client->conn.Query(GetQuery());
+		if (client->result->HasError()) {
+			client->result->ThrowError();
+		}
+	}
+
 	string GetLogOutput(BenchmarkState *state_p) override {
 		auto state = (DuckDBBenchmarkState *)state_p;
 		auto &profiler = QueryProfiler::Get(*state->conn.context);
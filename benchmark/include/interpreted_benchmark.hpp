@@ -48,6 +48,10 @@ public:
 	string Verify(BenchmarkState *state) override;
 
 	string GetQuery() override;
+	//! Open a connection of a single concurrent client against the shared database
+	duckdb::unique_ptr<BenchmarkState> InitializeClient(BenchmarkState *state) override;
+	//! Run the benchmark query on a client connection
+	void RunClient(BenchmarkState *client_state) override;
 	//! Interrupt the benchmark because of a timeout
 	void Interrupt(BenchmarkState *state) override;
 	//! Returns information about the benchmark
@@ -65,6 +65,15 @@ struct InterpretedBenchmarkState : public BenchmarkState {
 	}
 };
 
+//! State of a single client in the concurrent harness: a connection to the shared database
+struct InterpretedClientState : public BenchmarkState {
+	Connection con;
+	duckdb::unique_ptr<QueryResult> result;
+
+	explicit InterpretedClientState(DuckDB &db) : con(db) {
+	}
+};
+
 void ProcessReplacements(string &str, const unordered_map<std::string, std::string> &replacement_map) {
 	for (auto &replacement : replacement_map) {
 		str = StringUtil::Replace(str, "${" + replacement.first + "}", replacement.second);
@@ -660,6 +669,23 @@ void InterpretedBenchmark::Run(BenchmarkState *state_p) {
 	}
 }
 
+duckdb::unique_ptr<BenchmarkState> InterpretedBenchmark::InitializeClient(BenchmarkState *state_p) {
+	LoadBenchmark();
+	if (run_query.empty()) {
+		return nullptr;
+	}
+	auto &state = (InterpretedBenchmarkState &)*state_p;
+	return make_uniq<InterpretedClientState>(state.db);
+}
+
+void InterpretedBenchmark::RunClient(BenchmarkState *client_p) {
+	auto &client = (InterpretedClientState &)*client_p;
+	client.result = client.con.Query(run_query);
+	if (client.result->HasError()) {
+		client.result->ThrowError();
+	}
+}
+
 void InterpretedBenchmark::Cleanup(BenchmarkState *state_p) {
 	auto &state = (InterpretedBenchmarkState &)*state_p;
 	if (queries.find("cleanup") != queries.end()) {
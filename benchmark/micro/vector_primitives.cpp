@@ -0,0 +1,229 @@
+#include "benchmark_runner.hpp"
+#include "duckdb_benchmark_macro.hpp"
+#include "duckdb/common/types/selection_vector.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
+
+#include <random>
+
+using namespace duckdb;
+
+#define VECTOR_PRIMITIVE_ITERATIONS 50000
+
+//! State for the vector primitive benchmarks: a populated source vector, a reusable
+//! copy target, and a selection vector picking a subset of the rows
+struct VectorPrimitiveState : public BenchmarkState {
+	VectorPrimitiveState(const LogicalType &type, double null_ratio, double selectivity)
+	    : source(type), target(type), sel(STANDARD_VECTOR_SIZE), sel_count(0) {
+		std::mt19937 gen;
+		gen.seed(42);
+		std::uniform_real_distribution<> ratio_dist(0.0, 1.0);
+		for (idx_t i = 0; i < STANDARD_VECTOR_SIZE; i++) {
+			if (ratio_dist(gen) < null_ratio) {
+				FlatVector::SetNull(source, i, true);
+			} else if (type.id() == LogicalTypeId::VARCHAR) {
+				source.SetValue(i, Value("benchmark_string_payload_" + to_string(i)));
+			} else {
+				source.SetValue(i, Value::INTEGER(NumericCast<int32_t>(i)));
+			}
+			if (ratio_dist(gen) < selectivity) {
+				sel.set_index(sel_count++, i);
+			}
+		}
+	}
+
+	Vector source;
+	Vector target;
+	SelectionVector sel;
+	idx_t sel_count;
+};
+
+//! Base class handling the boilerplate that is identical for all vector primitive benchmarks
+class VectorPrimitiveBenchmark : public Benchmark {
+public:
+	VectorPrimitiveBenchmark(bool register_benchmark, string name)
+	    : Benchmark(register_benchmark, std::move(name), "[vector_primitives]") {
+	}
+
+	virtual LogicalType Type() {
+		return LogicalType::INTEGER;
+	}
+	virtual double NullRatio() {
+		return 0.0;
+	}
+	virtual double Selectivity() {
+		return 1.0;
+	}
+
+	duckdb::unique_ptr<BenchmarkState> Initialize(BenchmarkConfiguration &config) override {
+		return make_uniq<VectorPrimitiveState>(Type(), NullRatio(), Selectivity());
+	}
+	void Cleanup(BenchmarkState *state) override {
+	}
+	string Verify(BenchmarkState *state) override {
+		return string();
+	}
+	void Interrupt(BenchmarkState *state) override {
+	}
+	string GetLogOutput(BenchmarkState *state) override {
+		return string();
+	}
+};
+
+#define VECTOR_PRIMITIVE_BENCHMARK(NAME)                                                                               \
+	class NAME##Benchmark : public VectorPrimitiveBenchmark {                                                          \
+		NAME##Benchmark(bool register_benchmark) : VectorPrimitiveBenchmark(register_benchmark, "" #NAME) {            \
+		}                                                                                                              \
+                                                                                                                       \
+	public:                                                                                                            \
+		static NAME##Benchmark *GetInstance() {                                                                        \
+			static NAME##Benchmark singleton(true);                                                                    \
+			return &singleton;                                                                                         \
+		}
+
+VECTOR_PRIMITIVE_BENCHMARK(VectorCopyInt32)
+void Run(BenchmarkState *state_p) override {
+	auto &state = (VectorPrimitiveState &)*state_p;
+	for (idx_t i = 0; i < VECTOR_PRIMITIVE_ITERATIONS; i++) {
+		VectorOperations::Copy(state.source, state.target, STANDARD_VECTOR_SIZE, 0, 0);
+	}
+}
+string BenchmarkInfo() override {
+	return "Flat-to-flat copy of an INTEGER vector without NULLs";
+}
+FINISH_BENCHMARK(VectorCopyInt32)
+
+VECTOR_PRIMITIVE_BENCHMARK(VectorCopyInt32HalfNull)
+double NullRatio() override {
+	return 0.5;
+}
+void Run(BenchmarkState *state_p) override {
+	auto &state = (VectorPrimitiveState &)*state_p;
+	for (idx_t i = 0; i < VECTOR_PRIMITIVE_ITERATIONS; i++) {
+		VectorOperations::Copy(state.source, state.target, STANDARD_VECTOR_SIZE, 0, 0);
+	}
+}
+string BenchmarkInfo() override {
+	return "Flat-to-flat copy of an INTEGER vector with 50% NULLs";
+}
+FINISH_BENCHMARK(VectorCopyInt32HalfNull)
+
+VECTOR_PRIMITIVE_BENCHMARK(VectorCopyVarchar)
+LogicalType Type() override {
+	return LogicalType::VARCHAR;
+}
+void Run(BenchmarkState *state_p) override {
+	auto &state = (VectorPrimitiveState &)*state_p;
+	for (idx_t i = 0; i < VECTOR_PRIMITIVE_ITERATIONS; i++) {
+		// fresh target: string copies attach heap references that would otherwise pile up
+		Vector target(LogicalType::VARCHAR);
+		VectorOperations::Copy(state.source, target, STANDARD_VECTOR_SIZE, 0, 0);
+	}
+}
+string BenchmarkInfo() override {
+	return "Flat-to-flat copy of a VARCHAR vector without NULLs";
+}
+FINISH_BENCHMARK(VectorCopyVarchar)
+
+VECTOR_PRIMITIVE_BENCHMARK(VectorCopyVarcharHalfNull)
+LogicalType Type() override {
+	return LogicalType::VARCHAR;
+}
+double NullRatio() override {
+	return 0.5;
+}
+void Run(BenchmarkState *state_p) override {
+	auto &state = (VectorPrimitiveState &)*state_p;
+	for (idx_t i = 0; i < VECTOR_PRIMITIVE_ITERATIONS; i++) {
+		Vector target(LogicalType::VARCHAR);
+		VectorOperations::Copy(state.source, target, STANDARD_VECTOR_SIZE, 0, 0);
+	}
+}
+string BenchmarkInfo() override {
+	return "Flat-to-flat copy of a VARCHAR vector with 50% NULLs";
+}
+FINISH_BENCHMARK(VectorCopyVarcharHalfNull)
+
+VECTOR_PRIMITIVE_BENCHMARK(VectorCopySelInt32LowSelectivity)
+double Selectivity() override {
+	return 0.1;
+}
+void Run(BenchmarkState *state_p) override {
+	auto &state = (VectorPrimitiveState &)*state_p;
+	for (idx_t i = 0; i < VECTOR_PRIMITIVE_ITERATIONS; i++) {
+		VectorOperations::Copy(state.source, state.target, state.sel, state.sel_count, 0, 0);
+	}
+}
+string BenchmarkInfo() override {
+	return "Selection-vector copy of an INTEGER vector at 10% selectivity";
+}
+FINISH_BENCHMARK(VectorCopySelInt32LowSelectivity)
+
+VECTOR_PRIMITIVE_BENCHMARK(VectorCopySelInt32HighSelectivity)
+double Selectivity() override {
+	return 0.9;
+}
+void Run(BenchmarkState *state_p) override {
+	auto &state = (VectorPrimitiveState &)*state_p;
+	for (idx_t i = 0; i < VECTOR_PRIMITIVE_ITERATIONS; i++) {
+		VectorOperations::Copy(state.source, state.target, state.sel, state.sel_count, 0, 0);
+	}
+}
+string BenchmarkInfo() override {
+	return "Selection-vector copy of an INTEGER vector at 90% selectivity";
+}
+FINISH_BENCHMARK(VectorCopySelInt32HighSelectivity)
+
+VECTOR_PRIMITIVE_BENCHMARK(VectorSliceFlattenInt32)
+double NullRatio() override {
+	return 0.1;
+}
+double Selectivity() override {
+	return 0.5;
+}
+void Run(BenchmarkState *state_p) override {
+	auto &state = (VectorPrimitiveState &)*state_p;
+	for (idx_t i = 0; i < VECTOR_PRIMITIVE_ITERATIONS; i++) {
+		Vector dict(state.source, state.sel, state.sel_count);
+		dict.Flatten(state.sel_count);
+	}
+}
+string BenchmarkInfo() override {
+	return "Dictionary slice followed by Flatten, as produced by filters at 50% selectivity";
+}
+FINISH_BENCHMARK(VectorSliceFlattenInt32)
+
+VECTOR_PRIMITIVE_BENCHMARK(ValidityMaskCountValid)
+double NullRatio() override {
+	return 0.5;
+}
+void Run(BenchmarkState *state_p) override {
+	auto &state = (VectorPrimitiveState &)*state_p;
+	idx_t total = 0;
+	for (idx_t i = 0; i < VECTOR_PRIMITIVE_ITERATIONS; i++) {
+		total += FlatVector::Validity(state.source).CountValid(STANDARD_VECTOR_SIZE);
+	}
+	if (total == 0) {
+		throw InternalException("ValidityMaskCountValid: expected valid rows");
+	}
+}
+string BenchmarkInfo() override {
+	return "ValidityMask::CountValid over a mask with 50% NULLs";
+}
+FINISH_BENCHMARK(ValidityMaskCountValid)
+
+VECTOR_PRIMITIVE_BENCHMARK(ValidityMaskCombine)
+double NullRatio() override {
+	return 0.5;
+}
+void Run(BenchmarkState *state_p) override {
+	auto &state = (VectorPrimitiveState &)*state_p;
+	for (idx_t i = 0; i < VECTOR_PRIMITIVE_ITERATIONS; i++) {
+		ValidityMask combined(STANDARD_VECTOR_SIZE);
+		combined.Combine(FlatVector::Validity(state.source), STANDARD_VECTOR_SIZE);
+	}
+}
+string BenchmarkInfo() override {
+	return "ValidityMask::Combine of an all-valid mask with a mask with 50% NULLs";
+}
+FINISH_BENCHMARK(ValidityMaskCombine)
@@ -89,6 +89,22 @@ struct AverageSetOperation {
 	}
 };
 
+//! Inverse of AverageSetOperation, used together with the subtract operators to slide window frames
+struct AverageRemoveSetOperation {
+	template <class STATE>
+	static void Initialize(STATE &state) {
+		state.Initialize();
+	}
+	template <class STATE>
+	static void Combine(const STATE &source, STATE &target, AggregateInputData &) {
+		target.Combine(source);
+	}
+	template <class STATE>
+	static void AddValues(STATE &state, idx_t count) {
+		state.count -= count;
+	}
+};
+
 template <class T>
 static T GetAverageDivident(uint64_t count, optional_ptr<FunctionData> bind_data) {
 	T divident = T(count);
@@ -239,23 +255,44 @@ struct TimeTZAverageOperation : public BaseSumOperation<AverageSetOperation, Add
 	}
 };
 
+//! Exact inverses of the integer average operations (the floating point variants would drift)
+struct IntegerAverageRemoveOperation : public BaseSumOperation<AverageRemoveSetOperation, RegularSubtract> {};
+struct IntegerAverageRemoveOperationHugeint : public BaseSumOperation<AverageRemoveSetOperation, SubtractFromHugeint> {
+};
+struct HugeintAverageRemoveOperation : public BaseSumOperation<AverageRemoveSetOperation, HugeintSubtract> {};
+
 AggregateFunction GetAverageAggregate(PhysicalType type) {
 	switch (type) {
 	case PhysicalType::INT16: {
-		return AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
+		auto function = AggregateFunction::UnaryAggregate<AvgState<int64_t>, int16_t, double, IntegerAverageOperation>(
 		    LogicalType::SMALLINT, LogicalType::DOUBLE);
+		function.simple_remove =
+		    AggregateFunction::UnaryUpdate<AvgState<int64_t>, int16_t, IntegerAverageRemoveOperation>;
+		return function;
 	}
 	case PhysicalType::INT32: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::INTEGER, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int32_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::INTEGER, LogicalType::DOUBLE);
+		function.simple_remove =
+		    AggregateFunction::UnaryUpdate<AvgState<hugeint_t>, int32_t, IntegerAverageRemoveOperationHugeint>;
+		return function;
 	}
 	case PhysicalType::INT64: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
-		    LogicalType::BIGINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, int64_t, double, IntegerAverageOperationHugeint>(
+		        LogicalType::BIGINT, LogicalType::DOUBLE);
+		function.simple_remove =
+		    AggregateFunction::UnaryUpdate<AvgState<hugeint_t>, int64_t, IntegerAverageRemoveOperationHugeint>;
+		return function;
 	}
 	case PhysicalType::INT128: {
-		return AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
-		    LogicalType::HUGEINT, LogicalType::DOUBLE);
+		auto function =
+		    AggregateFunction::UnaryAggregate<AvgState<hugeint_t>, hugeint_t, double, HugeintAverageOperation>(
+		        LogicalType::HUGEINT, LogicalType::DOUBLE);
+		function.simple_remove =
+		    AggregateFunction::UnaryUpdate<AvgState<hugeint_t>, hugeint_t, HugeintAverageRemoveOperation>;
+		return function;
 	}
 	case PhysicalType::INTERVAL: {
 		return AggregateFunction::UnaryAggregate<IntervalAvgState, interval_t, interval_t, IntervalAverageOperation>(
@@ -73,6 +73,45 @@ struct HugeintSumOperation : public BaseSumOperation<SumSetOperation, HugeintAdd
 	}
 };
 
+//! Ungrouped SUM over integers: on a flat, all-valid input the partial sum stays in a plain
+//! int64 accumulator and is only promoted into the 128-bit state when it would overflow,
+//! keeping the hot loop free of 128-bit carry propagation
+template <class INPUT_TYPE>
+void SumToHugeintSimpleUpdate(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count,
+                                     data_ptr_t state_p, idx_t count) {
+	D_ASSERT(input_count == 1);
+	auto &input = inputs[0];
+	if (input.GetVectorType() != VectorType::FLAT_VECTOR || !FlatVector::Validity(input).AllValid() || count == 0) {
+		AggregateFunction::UnaryUpdate<SumState<hugeint_t>, INPUT_TYPE, SumToHugeintOperation>(
+		    inputs, aggr_input_data, input_count, state_p, count);
+		return;
+	}
+	const auto data = FlatVector::GetData<INPUT_TYPE>(input);
+	auto &state = *reinterpret_cast<SumState<hugeint_t> *>(state_p);
+	int64_t accumulator = 0;
+	for (idx_t i = 0; i < count; i++) {
+		const auto value = int64_t(data[i]);
+		// wrapping add, with signed overflow detected from the sign bits
+		const auto sum = int64_t(uint64_t(accumulator) + uint64_t(value));
+		if (((accumulator ^ sum) & (value ^ sum)) < 0) {
+			// the int64 partial sum would overflow: promote it into the 128-bit state
+			// (cannot happen for inputs narrower than int64, so this branch never fires there)
+			AddToHugeint::AddValue(state.value, uint64_t(accumulator), accumulator >= 0);
+			accumulator = value;
+		} else {
+			accumulator = sum;
+		}
+	}
+	AddToHugeint::AddValue(state.value, uint64_t(accumulator), accumulator >= 0);
+	state.isset = true;
+}
+
+//! Exact inverses of the sum operations, used to slide window frames incrementally.
+//! They leave 'isset' alone: the window code only uses the state while the frame is non-empty.
+struct IntegerSumRemoveOperation : public BaseSumOperation<SumSetOperation, RegularSubtract> {};
+struct SumToHugeintRemoveOperation : public BaseSumOperation<SumSetOperation, SubtractFromHugeint> {};
+struct HugeintSumRemoveOperation : public BaseSumOperation<SumSetOperation, HugeintSubtract> {};
+
 unique_ptr<FunctionData> SumNoOverflowBind(ClientContext &context, AggregateFunction &function,
                                            vector<unique_ptr<Expression>> &arguments) {
 	throw BinderException("sum_no_overflow is for internal use only!");
@@ -95,6 +134,7 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 		    LogicalType::INTEGER, LogicalType::HUGEINT);
 		function.name = "sum_no_overflow";
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.simple_remove = AggregateFunction::UnaryUpdate<SumState<int64_t>, int32_t, IntegerSumRemoveOperation>;
 		function.bind = SumNoOverflowBind;
 		function.serialize = SumNoOverflowSerialize;
 		function.deserialize = SumNoOverflowDeserialize;
@@ -105,6 +145,7 @@ AggregateFunction GetSumAggregateNoOverflow(PhysicalType type) {
 		    LogicalType::BIGINT, LogicalType::HUGEINT);
 		function.name = "sum_no_overflow";
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.simple_remove = AggregateFunction::UnaryUpdate<SumState<int64_t>, int64_t, IntegerSumRemoveOperation>;
 		function.bind = SumNoOverflowBind;
 		function.serialize = SumNoOverflowSerialize;
 		function.deserialize = SumNoOverflowDeserialize;
@@ -164,12 +205,14 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, bool, hugeint_t, IntegerSumOperation>(
 		    LogicalType::BOOLEAN, LogicalType::HUGEINT);
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.simple_remove = AggregateFunction::UnaryUpdate<SumState<int64_t>, bool, IntegerSumRemoveOperation>;
 		return function;
 	}
 	case PhysicalType::INT16: {
 		auto function = AggregateFunction::UnaryAggregate<SumState<int64_t>, int16_t, hugeint_t, IntegerSumOperation>(
 		    LogicalType::SMALLINT, LogicalType::HUGEINT);
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.simple_remove = AggregateFunction::UnaryUpdate<SumState<int64_t>, int16_t, IntegerSumRemoveOperation>;
 		return function;
 	}
 
@@ -179,6 +222,9 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		        LogicalType::INTEGER, LogicalType::HUGEINT);
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.simple_update = SumToHugeintSimpleUpdate<int32_t>;
+		function.simple_remove =
+		    AggregateFunction::UnaryUpdate<SumState<hugeint_t>, int32_t, SumToHugeintRemoveOperation>;
 		return function;
 	}
 	case PhysicalType::INT64: {
@@ -187,6 +233,9 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		        LogicalType::BIGINT, LogicalType::HUGEINT);
 		function.statistics = SumPropagateStats;
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.simple_update = SumToHugeintSimpleUpdate<int64_t>;
+		function.simple_remove =
+		    AggregateFunction::UnaryUpdate<SumState<hugeint_t>, int64_t, SumToHugeintRemoveOperation>;
 		return function;
 	}
 	case PhysicalType::INT128: {
@@ -194,6 +243,8 @@ AggregateFunction GetSumAggregate(PhysicalType type) {
 		    AggregateFunction::UnaryAggregate<SumState<hugeint_t>, hugeint_t, hugeint_t, HugeintSumOperation>(
 		        LogicalType::HUGEINT, LogicalType::HUGEINT);
 		function.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+		function.simple_remove =
+		    AggregateFunction::UnaryUpdate<SumState<hugeint_t>, hugeint_t, HugeintSumRemoveOperation>;
 		return function;
 	}
 	default:
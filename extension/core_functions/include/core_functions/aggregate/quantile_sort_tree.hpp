@@ -16,6 +16,7 @@
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/function/window/window_index_tree.hpp"
 #include <algorithm>
+#include <cmath>
 #include <stdlib.h>
 #include <utility>
 
@@ -149,6 +150,77 @@ struct QuantileCompare {
 	}
 };
 
+//! Floyd-Rivest SELECT: a drop-in replacement for std::nth_element that needs fewer comparisons
+//! on large inputs by first recursing on a small sample around the requested order statistic.
+//! Quantile finalization only needs a few order statistics of each (potentially huge) group,
+//! so the comparison count of the selection dominates the runtime.
+struct FloydRivestSelect {
+	//! Below this size the sampling step is not worth it (constant from the original paper)
+	static constexpr const int64_t SAMPLING_THRESHOLD = 600;
+
+	template <class V, class COMPARE>
+	static void Select(V *v_t, int64_t left, int64_t right, const int64_t k, const COMPARE &comp) {
+		while (right > left) {
+			if (right - left > SAMPLING_THRESHOLD) {
+				// estimate the bounds of the k-th element from a sample and recurse on that range
+				const auto n = static_cast<double>(right - left + 1);
+				const auto i = static_cast<double>(k - left + 1);
+				const auto z = log(n);
+				const auto s = 0.5 * exp(2.0 * z / 3.0);
+				const auto sign = (i - n / 2.0) < 0 ? -1.0 : 1.0;
+				const auto sd = 0.5 * sqrt(z * s * (n - s) / n) * sign;
+				const auto new_left =
+				    MaxValue<int64_t>(left, static_cast<int64_t>(static_cast<double>(k) - i * s / n + sd));
+				const auto new_right =
+				    MinValue<int64_t>(right, static_cast<int64_t>(static_cast<double>(k) + (n - i) * s / n + sd));
+				Select(v_t, new_left, new_right, k, comp);
+			}
+			// partition around the pivot v_t[k], with v_t[left] and v_t[right] as sentinels
+			V t = v_t[k];
+			auto i_idx = left;
+			auto j_idx = right;
+			std::swap(v_t[left], v_t[k]);
+			if (comp(t, v_t[right])) {
+				std::swap(v_t[right], v_t[left]);
+			}
+			while (i_idx < j_idx) {
+				std::swap(v_t[i_idx], v_t[j_idx]);
+				i_idx++;
+				j_idx--;
+				while (comp(v_t[i_idx], t)) {
+					i_idx++;
+				}
+				while (comp(t, v_t[j_idx])) {
+					j_idx--;
+				}
+			}
+			if (!comp(v_t[left], t) && !comp(t, v_t[left])) {
+				std::swap(v_t[left], v_t[j_idx]);
+			} else {
+				j_idx++;
+				std::swap(v_t[j_idx], v_t[right]);
+			}
+			// narrow the range to the side that still contains k
+			if (j_idx <= k) {
+				left = j_idx + 1;
+			}
+			if (k <= j_idx) {
+				right = j_idx - 1;
+			}
+		}
+	}
+
+	//! std::nth_element-style interface
+	template <class V, class COMPARE>
+	static void Operation(V *first, V *nth, V *last, const COMPARE &comp) {
+		if (first == last) {
+			return;
+		}
+		D_ASSERT(nth < last);
+		Select(first, int64_t(0), static_cast<int64_t>(last - first) - 1, static_cast<int64_t>(nth - first), comp);
+	}
+};
+
 struct QuantileCast {
 	template <class INPUT_TYPE, class TARGET_TYPE>
 	static inline TARGET_TYPE Operation(const INPUT_TYPE &src, Vector &result) {
@@ -186,11 +258,11 @@ struct QuantileInterpolator {
 		using ACCESS_TYPE = typename ACCESSOR::RESULT_TYPE;
 		QuantileCompare<ACCESSOR> comp(accessor, desc);
 		if (CRN == FRN) {
-			std::nth_element(v_t + begin, v_t + FRN, v_t + end, comp);
+			FloydRivestSelect::Operation(v_t + begin, v_t + FRN, v_t + end, comp);
 			return QuantileCast::Operation<ACCESS_TYPE, TARGET_TYPE>(accessor(v_t[FRN]), result);
 		} else {
-			std::nth_element(v_t + begin, v_t + FRN, v_t + end, comp);
-			std::nth_element(v_t + FRN, v_t + CRN, v_t + end, comp);
+			FloydRivestSelect::Operation(v_t + begin, v_t + FRN, v_t + end, comp);
+			FloydRivestSelect::Operation(v_t + FRN, v_t + CRN, v_t + end, comp);
 			auto lo = QuantileCast::Operation<ACCESS_TYPE, TARGET_TYPE>(accessor(v_t[FRN]), result);
 			auto hi = QuantileCast::Operation<ACCESS_TYPE, TARGET_TYPE>(accessor(v_t[CRN]), result);
 			return InterpolateOperator::Operation<TARGET_TYPE>(lo, RN - FRN, hi);
@@ -256,7 +328,7 @@ struct QuantileInterpolator<true> {
 	template <class INPUT_TYPE, typename ACCESSOR = QuantileDirect<INPUT_TYPE>>
 	typename ACCESSOR::RESULT_TYPE InterpolateInternal(INPUT_TYPE *v_t, const ACCESSOR &accessor = ACCESSOR()) const {
 		QuantileCompare<ACCESSOR> comp(accessor, desc);
-		std::nth_element(v_t + begin, v_t + FRN, v_t + end, comp);
+		FloydRivestSelect::Operation(v_t + begin, v_t + FRN, v_t + end, comp);
 		return accessor(v_t[FRN]);
 	}
 
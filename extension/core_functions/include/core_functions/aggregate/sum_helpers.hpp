@@ -68,6 +68,19 @@ struct RegularAdd {
 	}
 };
 
+//! The exact inverse of RegularAdd, used to take values back out of a sliding window frame
+struct RegularSubtract {
+	template <class STATE, class T>
+	static void AddNumber(STATE &state, T input) {
+		state.value -= input;
+	}
+
+	template <class STATE, class T>
+	static void AddConstant(STATE &state, T input, idx_t count) {
+		state.value -= input * int64_t(count);
+	}
+};
+
 struct HugeintAdd {
 	template <class STATE, class T>
 	static void AddNumber(STATE &state, T input) {
@@ -80,6 +93,19 @@ struct HugeintAdd {
 	}
 };
 
+//! The exact inverse of HugeintAdd
+struct HugeintSubtract {
+	template <class STATE, class T>
+	static void AddNumber(STATE &state, T input) {
+		state.value = Hugeint::Subtract(state.value, input);
+	}
+
+	template <class STATE, class T>
+	static void AddConstant(STATE &state, T input, idx_t count) {
+		AddNumber(state, Hugeint::Multiply(input, UnsafeNumericCast<int64_t>(count)));
+	}
+};
+
 struct IntervalAdd {
 	template <class STATE, class T>
 	static void AddNumber(STATE &state, T input) {
@@ -115,14 +141,10 @@ struct AddToHugeint {
 		result.lower += value;
 		// now handle overflows
 		int overflow = result.lower < value;
-		// we consider two situations:
-		// (1) input[idx] is positive, and current value is lower than value: overflow
-		// (2) input[idx] is negative, and current value is higher than value: underflow
-		if (!(overflow ^ positive)) {
-			// in the case of an overflow or underflow we either increment or decrement the upper base
-			// positive: +1, negative: -1
-			result.upper += -1 + 2 * positive;
-		}
+		// this is a sign-extended 128-bit addition: the upper word gets the sign extension
+		// of the value (0 if positive, -1 if negative) plus the carry out of the lower word,
+		// written without a branch so the loop over a vector of values stays branch-free
+		result.upper += (int64_t(positive) - 1) + int64_t(overflow);
 	}
 
 	template <class STATE, class T>
@@ -159,6 +181,20 @@ struct AddToHugeint {
 	}
 };
 
+//! The exact inverse of AddToHugeint: the forward path adds the sign-extended input to the 128-bit value,
+//! so subtracting it again restores the previous state
+struct SubtractFromHugeint {
+	template <class STATE, class T>
+	static void AddNumber(STATE &state, T input) {
+		state.value -= hugeint_t(input);
+	}
+
+	template <class STATE, class T>
+	static void AddConstant(STATE &state, T input, idx_t count) {
+		state.value -= hugeint_t(input) * Hugeint::Convert(count);
+	}
+};
+
 template <class STATEOP, class ADDOP>
 struct BaseSumOperation {
 	template <class STATE>
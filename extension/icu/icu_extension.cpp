@@ -36,6 +36,39 @@
 
 namespace duckdb {
 
+//! Cache of collator prototypes: building a collator from locale data is expensive, and the same
+//! few collations are constructed over and over (every copy of a bind data rebuilds its collator)
+struct IcuCollatorCache {
+	//! Returns a clone of the cached prototype, or nullptr if this collation is not cached
+	duckdb::unique_ptr<icu::Collator> Clone(const string &key) {
+		lock_guard<mutex> guard(lock);
+		auto it = prototypes.find(key);
+		if (it == prototypes.end()) {
+			return nullptr;
+		}
+		return duckdb::unique_ptr<icu::Collator>(it->second->clone());
+	}
+
+	void Store(const string &key, const icu::Collator &collator) {
+		lock_guard<mutex> guard(lock);
+		if (prototypes.size() >= MAX_COLLATORS && prototypes.find(key) == prototypes.end()) {
+			return; // cache is full - workloads use only a handful of collations, so this is unlikely
+		}
+		prototypes[key] = duckdb::unique_ptr<icu::Collator>(collator.clone());
+	}
+
+	static IcuCollatorCache &Get() {
+		static IcuCollatorCache cache;
+		return cache;
+	}
+
+private:
+	static constexpr idx_t MAX_COLLATORS = 32;
+
+	mutex lock;
+	unordered_map<string, duckdb::unique_ptr<icu::Collator>> prototypes;
+};
+
 struct IcuBindData : public FunctionData {
 	duckdb::unique_ptr<icu::Collator> collator;
 	string language;
@@ -46,6 +79,12 @@ struct IcuBindData : public FunctionData {
 	}
 
 	IcuBindData(string language_p, string country_p) : language(std::move(language_p)), country(std::move(country_p)) {
+		auto &cache = IcuCollatorCache::Get();
+		const auto cache_key = "locale:" + language + "_" + country;
+		collator = cache.Clone(cache_key);
+		if (collator) {
+			return;
+		}
 		UErrorCode status = U_ZERO_ERROR;
 		auto locale = icu::Locale(language.c_str(), country.c_str());
 		if (locale.isBogus()) {
@@ -57,9 +96,16 @@ struct IcuBindData : public FunctionData {
 			throw InvalidInputException("Failed to create ICU collator: %s (language: %s, country: %s)", error_name,
 			                            language, country);
 		}
+		cache.Store(cache_key, *collator);
 	}
 
 	explicit IcuBindData(string tag_p) : tag(std::move(tag_p)) {
+		auto &cache = IcuCollatorCache::Get();
+		const auto cache_key = "tag:" + tag;
+		collator = cache.Clone(cache_key);
+		if (collator) {
+			return;
+		}
 		UErrorCode status = U_ZERO_ERROR;
 		UCollator *ucollator = ucol_open(tag.c_str(), &status);
 		if (U_FAILURE(status)) {
@@ -67,6 +113,7 @@ struct IcuBindData : public FunctionData {
 			throw InvalidInputException("Failed to create ICU collator with tag %s: %s", tag, error_name);
 		}
 		collator = unique_ptr<icu::Collator>(icu::Collator::fromUCollator(ucollator));
+		cache.Store(cache_key, *collator);
 	}
 
 	static duckdb::unique_ptr<FunctionData> CreateInstance(string language, string country, string tag) {
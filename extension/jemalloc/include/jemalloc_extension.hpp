@@ -9,6 +9,7 @@
 #pragma once
 
 #include "duckdb.hpp"
+#include "duckdb/common/allocator.hpp"
 
 namespace duckdb {
 
@@ -27,6 +28,10 @@ public:
 	static void ThreadIdle();
 	static void FlushAll();
 	static void SetBackgroundThreads(bool enable);
+	//! Sets the dirty/muzzy page decay delay (in ms) of all arenas; negative values restore the build default
+	static void SetDecay(int64_t dirty_decay_ms, int64_t muzzy_decay_ms);
+	//! Returns jemalloc's global memory statistics
+	static vector<AllocatorStatsEntry> GetStats();
 };
 
 } // namespace duckdb
@@ -103,6 +103,38 @@ void JemallocExtension::FlushAll() {
 	SetJemallocCTL("thread.peak.reset");
 }
 
+static void SetArenaDecay(const char *opt_name, const char *arenas_name, const char *arena_fmt, int64_t decay_ms) {
+	// a negative value restores the build default, which we read back from the (immutable) options
+	auto value = decay_ms < 0 ? GetJemallocCTL<ssize_t>(opt_name) : NumericCast<ssize_t>(decay_ms);
+
+	// set the default for arenas created later, then apply to all existing arenas
+	SetJemallocCTL(arenas_name, value);
+	const auto all_arenas = StringUtil::Format(arena_fmt, idx_t(MALLCTL_ARENAS_ALL));
+	SetJemallocCTL(all_arenas.c_str(), value);
+}
+
+void JemallocExtension::SetDecay(int64_t dirty_decay_ms, int64_t muzzy_decay_ms) {
+	SetArenaDecay("opt.dirty_decay_ms", "arenas.dirty_decay_ms", "arena.%llu.dirty_decay_ms", dirty_decay_ms);
+	SetArenaDecay("opt.muzzy_decay_ms", "arenas.muzzy_decay_ms", "arena.%llu.muzzy_decay_ms", muzzy_decay_ms);
+}
+
+vector<AllocatorStatsEntry> JemallocExtension::GetStats() {
+	// advance the epoch so that the statistics below are refreshed
+	uint64_t epoch = 1;
+	size_t epoch_len = sizeof(epoch);
+	JemallocCTL("epoch", &epoch, &epoch_len, &epoch, sizeof(epoch));
+
+	vector<AllocatorStatsEntry> result;
+	result.push_back({"allocated_bytes", idx_t(GetJemallocCTL<size_t>("stats.allocated"))});
+	result.push_back({"active_bytes", idx_t(GetJemallocCTL<size_t>("stats.active"))});
+	result.push_back({"metadata_bytes", idx_t(GetJemallocCTL<size_t>("stats.metadata"))});
+	result.push_back({"resident_bytes", idx_t(GetJemallocCTL<size_t>("stats.resident"))});
+	result.push_back({"mapped_bytes", idx_t(GetJemallocCTL<size_t>("stats.mapped"))});
+	result.push_back({"retained_bytes", idx_t(GetJemallocCTL<size_t>("stats.retained"))});
+	result.push_back({"arena_count", idx_t(GetJemallocCTL<unsigned>("opt.narenas"))});
+	return result;
+}
+
 void JemallocExtension::SetBackgroundThreads(bool enable) {
 #ifndef __APPLE__
 	SetJemallocCTL("background_thread", enable);
@@ -11,6 +11,7 @@
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/operator/decimal_cast_operators.hpp"
 #include "duckdb/common/operator/string_cast.hpp"
+#include "duckdb/common/string_map_set.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
 #include "yyjson.hpp"
 #include "duckdb/common/types/blob.hpp"
@@ -20,6 +21,7 @@ using namespace duckdb_yyjson; // NOLINT
 namespace duckdb {
 
 class JSONAllocator;
+struct ExpressionState;
 
 class JSONStringVectorBuffer : public VectorBuffer {
 public:
@@ -77,6 +79,34 @@ private:
 	yyjson_alc yyjson_allocator;
 };
 
+//! Caches parsed JSON documents for the duration of one chunk, so that multiple JSON functions evaluated over the
+//! same input (e.g., several json_extract calls in one projection) share a single parse per document
+class JSONDocumentCache {
+public:
+	explicit JSONDocumentCache(Allocator &allocator);
+
+	//! Get the parsed tree for a document, parsing and caching it on a miss.
+	//! Returns nullptr when the cache is full - the caller then parses into its own allocator instead
+	yyjson_doc *GetOrParseDocument(const string_t &input);
+	//! Clear the cache when the first JSON function of a new chunk resets its local state - documents from the
+	//! previous chunk will not be probed again
+	void Reset(ExpressionState &state);
+	//! Attach the cache's arena to a result vector that may reference cached document memory
+	void AddBuffer(Vector &result);
+
+private:
+	//! Maximum number of cached documents per chunk
+	static constexpr idx_t MAX_CACHED_DOCUMENTS = 4096;
+
+private:
+	//! Arena the cached documents (and their key copies) live in
+	shared_ptr<JSONAllocator> json_allocator;
+	//! Cached documents, keyed by the document bytes (copied into the arena)
+	string_map_t<yyjson_doc *> documents;
+	//! The expression state that first reset this cache - seeing it again marks the start of a new chunk
+	optional_ptr<ExpressionState> first_state;
+};
+
 //! JSONKey / json_key_map_t speeds up mapping from JSON key to column ID
 struct JSONKey {
 	const char *ptr;
@@ -28,11 +28,12 @@ public:
 		auto &inputs = args.data[0];
 		UnaryExecutor::ExecuteWithNulls<string_t, T>(
 		    inputs, result, args.size(), [&](string_t input, ValidityMask &mask, idx_t idx) {
-			    auto doc = JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, alc);
+			    auto doc = lstate.ParseDocument(input);
 			    return fun(doc->root, alc, result, mask, idx);
 		    });
 
 		JSONAllocator::AddBuffer(result, alc);
+		lstate.AddCacheBuffer(result);
 	}
 
 	//! Two-argument JSON read function (with path query), i.e. json_type('[1, 2, 3]', '$[0]')
@@ -50,7 +51,7 @@ public:
 			if (info.path_type == JSONCommon::JSONPathType::REGULAR) {
 				UnaryExecutor::ExecuteWithNulls<string_t, T>(
 				    inputs, result, args.size(), [&](string_t input, ValidityMask &mask, idx_t idx) {
-					    auto doc = JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, alc);
+					    auto doc = lstate.ParseDocument(input);
 					    auto val = JSONCommon::GetUnsafe(doc->root, ptr, len);
 					    if (SET_NULL_IF_NOT_FOUND && !val) {
 						    mask.SetInvalid(idx);
@@ -65,7 +66,7 @@ public:
 				UnaryExecutor::Execute<string_t, list_entry_t>(inputs, result, args.size(), [&](string_t input) {
 					vals.clear();
 
-					auto doc = JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, alc);
+					auto doc = lstate.ParseDocument(input);
 					JSONCommon::GetWildcardPath(doc->root, ptr, len, vals);
 
 					auto current_size = ListVector::GetListSize(result);
@@ -100,7 +101,7 @@ public:
 			BinaryExecutor::ExecuteWithNulls<string_t, string_t, T>(
 			    inputs, *casted_paths, result, args.size(),
 			    [&](string_t input, string_t path, ValidityMask &mask, idx_t idx) {
-				    auto doc = JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, alc);
+				    auto doc = lstate.ParseDocument(input);
 				    auto val = JSONCommon::Get(doc->root, path, args.data[1].GetType().IsIntegral());
 				    if (SET_NULL_IF_NOT_FOUND && !val) {
 					    mask.SetInvalid(idx);
@@ -115,6 +116,7 @@ public:
 		}
 
 		JSONAllocator::AddBuffer(result, alc);
+		lstate.AddCacheBuffer(result);
 	}
 
 	//! JSON read function with list of path queries, i.e. json_type('[1, 2, 3]', ['$[0]', '$[1]'])
@@ -152,7 +154,7 @@ public:
 				continue;
 			}
 
-			auto doc = JSONCommon::ReadDocument(inputs[idx], JSONCommon::READ_FLAG, alc);
+			auto doc = lstate.ParseDocument(inputs[idx]);
 			for (idx_t path_i = 0; path_i < num_paths; path_i++) {
 				auto child_idx = offset + path_i;
 				val = JSONCommon::GetUnsafe(doc->root, info.ptrs[path_i], info.lens[path_i]);
@@ -174,6 +176,61 @@ public:
 		}
 
 		JSONAllocator::AddBuffer(result, alc);
+		lstate.AddCacheBuffer(result);
+	}
+
+	//! JSON read function with a list of path queries that walks the parsed tree once per document and emits one
+	//! result vector per path, i.e. json_extract_struct('{...}', ['$.a', '$.b'])
+	template <class T, bool SET_NULL_IF_NOT_FOUND = true>
+	static void ExecuteManyToStruct(DataChunk &args, ExpressionState &state, Vector &result,
+	                                const json_function_t<T> fun) {
+		auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
+		const auto &info = func_expr.bind_info->Cast<JSONReadManyFunctionData>();
+		auto &lstate = JSONFunctionLocalState::ResetAndGet(state);
+		auto alc = lstate.json_allocator->GetYYAlc();
+		D_ASSERT(info.ptrs.size() == info.lens.size());
+
+		const auto count = args.size();
+		const idx_t num_paths = info.ptrs.size();
+
+		UnifiedVectorFormat input_data;
+		auto &input_vector = args.data[0];
+		input_vector.ToUnifiedFormat(count, input_data);
+		auto inputs = UnifiedVectorFormat::GetData<string_t>(input_data);
+
+		auto &entries = StructVector::GetEntries(result);
+		D_ASSERT(entries.size() == num_paths);
+		auto &result_validity = FlatVector::Validity(result);
+
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = input_data.sel->get_index(i);
+			if (!input_data.validity.RowIsValid(idx)) {
+				result_validity.SetInvalid(i);
+				continue;
+			}
+
+			auto doc = lstate.ParseDocument(inputs[idx]);
+			for (idx_t path_i = 0; path_i < num_paths; path_i++) {
+				auto &child = *entries[path_i];
+				auto child_data = FlatVector::GetData<T>(child);
+				auto &child_validity = FlatVector::Validity(child);
+				auto val = JSONCommon::GetUnsafe(doc->root, info.ptrs[path_i], info.lens[path_i]);
+				if (SET_NULL_IF_NOT_FOUND && !val) {
+					child_validity.SetInvalid(i);
+				} else {
+					child_data[i] = fun(val, alc, child, child_validity, i);
+				}
+			}
+		}
+
+		for (auto &entry : entries) {
+			JSONAllocator::AddBuffer(*entry, alc);
+			lstate.AddCacheBuffer(*entry);
+		}
+
+		if (args.AllConstant()) {
+			result.SetVectorType(VectorType::CONSTANT_VECTOR);
+		}
 	}
 };
 
@@ -8,12 +8,14 @@
 
 #pragma once
 
+#include "duckdb/main/client_context_state.hpp"
 #include "duckdb/main/extension/extension_loader.hpp"
 #include "json_common.hpp"
 
 namespace duckdb {
 
 class TableRef;
+class ExpressionExecutor;
 struct ReplacementScanData;
 class CastFunctionSet;
 struct CastParameters;
@@ -53,6 +55,23 @@ public:
 	const vector<idx_t> lens;
 };
 
+//! Client-level registry handing out one JSONDocumentCache per expression executor, so that all JSON functions
+//! evaluated by the same executor (e.g., one projection) share parsed documents
+class JSONDocumentCacheState : public ClientContextState {
+public:
+	//! Key under which this state is registered on the ClientContext
+	static constexpr const char *REGISTRY_KEY = "json_document_cache";
+
+	static shared_ptr<JSONDocumentCache> GetCache(ClientContext &context, ExpressionExecutor &executor);
+
+	void QueryEnd() override;
+
+private:
+	mutex lock;
+	//! Caches keyed by the expression executor they belong to (cleared when the query ends)
+	unordered_map<ExpressionExecutor *, shared_ptr<JSONDocumentCache>> caches;
+};
+
 struct JSONFunctionLocalState : public FunctionLocalState {
 public:
 	explicit JSONFunctionLocalState(Allocator &allocator);
@@ -62,8 +81,15 @@ public:
 	static unique_ptr<FunctionLocalState> InitCastLocalState(CastLocalStateParameters &parameters);
 	static JSONFunctionLocalState &ResetAndGet(ExpressionState &state);
 
+	//! Parse a document, sharing the parsed tree through the document cache when one is available
+	yyjson_doc *ParseDocument(const string_t &input);
+	//! Attach the document cache's arena to a result vector that may reference cached document memory
+	void AddCacheBuffer(Vector &result);
+
 public:
 	shared_ptr<JSONAllocator> json_allocator;
+	//! Parsed-document cache shared with the other JSON functions in the same expression executor
+	shared_ptr<JSONDocumentCache> document_cache;
 };
 
 class JSONFunctions {
@@ -83,6 +109,7 @@ private:
 	// Scalar functions
 	static ScalarFunctionSet GetExtractFunction();
 	static ScalarFunctionSet GetExtractStringFunction();
+	static ScalarFunctionSet GetExtractStructFunction();
 
 	static ScalarFunctionSet GetArrayFunction();
 	static ScalarFunctionSet GetObjectFunction();
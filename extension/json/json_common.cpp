@@ -6,6 +6,44 @@ namespace duckdb {
 
 using JSONPathType = JSONCommon::JSONPathType;
 
+JSONDocumentCache::JSONDocumentCache(Allocator &allocator)
+    : json_allocator(make_shared_ptr<JSONAllocator>(allocator)) {
+}
+
+yyjson_doc *JSONDocumentCache::GetOrParseDocument(const string_t &input) {
+	auto entry = documents.find(input);
+	if (entry != documents.end()) {
+		return entry->second;
+	}
+	if (documents.size() >= MAX_CACHED_DOCUMENTS) {
+		return nullptr;
+	}
+	auto alc = json_allocator->GetYYAlc();
+	auto doc = JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, alc);
+	// copy the key into the arena - the input vector the string_t points into may not outlive the cache entry
+	const auto key_size = input.GetSize();
+	auto key_data = char_ptr_cast(alc->malloc(alc->ctx, MaxValue<size_t>(key_size, 1)));
+	memcpy(key_data, input.GetData(), key_size);
+	documents.emplace(string_t(key_data, UnsafeNumericCast<uint32_t>(key_size)), doc);
+	return doc;
+}
+
+void JSONDocumentCache::Reset(ExpressionState &state) {
+	if (!first_state) {
+		first_state = &state;
+	}
+	if (first_state.get() != &state) {
+		// not the first JSON function of the chunk - keep the documents it parsed around for sharing
+		return;
+	}
+	documents.clear();
+	json_allocator->Reset();
+}
+
+void JSONDocumentCache::AddBuffer(Vector &result) {
+	json_allocator->AddBuffer(result);
+}
+
 string JSONCommon::ValToString(yyjson_val *val, idx_t max_len) {
 	JSONAllocator json_allocator(Allocator::DefaultAllocator());
 	idx_t len;
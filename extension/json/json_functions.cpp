@@ -131,7 +131,11 @@ JSONFunctionLocalState::JSONFunctionLocalState(ClientContext &context)
 
 unique_ptr<FunctionLocalState> JSONFunctionLocalState::Init(ExpressionState &state, const BoundFunctionExpression &expr,
                                                             FunctionData *bind_data) {
-	return make_uniq<JSONFunctionLocalState>(state.GetContext());
+	auto result = make_uniq<JSONFunctionLocalState>(state.GetContext());
+	if (state.root.executor) {
+		result->document_cache = JSONDocumentCacheState::GetCache(state.GetContext(), *state.root.executor);
+	}
+	return std::move(result);
 }
 
 unique_ptr<FunctionLocalState> JSONFunctionLocalState::InitCastLocalState(CastLocalStateParameters &parameters) {
@@ -142,15 +146,56 @@ unique_ptr<FunctionLocalState> JSONFunctionLocalState::InitCastLocalState(CastLo
 JSONFunctionLocalState &JSONFunctionLocalState::ResetAndGet(ExpressionState &state) {
 	auto &lstate = ExecuteFunctionState::GetFunctionState(state)->Cast<JSONFunctionLocalState>();
 	lstate.json_allocator->Reset();
+	if (lstate.document_cache) {
+		lstate.document_cache->Reset(state);
+	}
 	return lstate;
 }
 
+yyjson_doc *JSONFunctionLocalState::ParseDocument(const string_t &input) {
+	if (document_cache) {
+		auto doc = document_cache->GetOrParseDocument(input);
+		if (doc) {
+			return doc;
+		}
+		// the cache is full - parse into the local allocator instead
+	}
+	return JSONCommon::ReadDocument(input, JSONCommon::READ_FLAG, json_allocator->GetYYAlc());
+}
+
+void JSONFunctionLocalState::AddCacheBuffer(Vector &result) {
+	if (!document_cache) {
+		return;
+	}
+	if (result.GetType().InternalType() == PhysicalType::LIST) {
+		document_cache->AddBuffer(ListVector::GetEntry(result));
+	} else {
+		document_cache->AddBuffer(result);
+	}
+}
+
+shared_ptr<JSONDocumentCache> JSONDocumentCacheState::GetCache(ClientContext &context, ExpressionExecutor &executor) {
+	auto state = context.registered_state->GetOrCreate<JSONDocumentCacheState>(REGISTRY_KEY);
+	lock_guard<mutex> guard(state->lock);
+	auto &cache = state->caches[&executor];
+	if (!cache) {
+		cache = make_shared_ptr<JSONDocumentCache>(BufferAllocator::Get(context));
+	}
+	return cache;
+}
+
+void JSONDocumentCacheState::QueryEnd() {
+	lock_guard<mutex> guard(lock);
+	caches.clear();
+}
+
 vector<ScalarFunctionSet> JSONFunctions::GetScalarFunctions() {
 	vector<ScalarFunctionSet> functions;
 
 	// Extract functions
 	AddAliases({"json_extract", "json_extract_path"}, GetExtractFunction(), functions);
 	AddAliases({"json_extract_string", "json_extract_path_text", "->>"}, GetExtractStringFunction(), functions);
+	functions.push_back(GetExtractStructFunction());
 
 	// Create functions
 	functions.push_back(GetArrayFunction());
@@ -53,6 +53,41 @@ ScalarFunctionSet JSONFunctions::GetExtractFunction() {
 	return set;
 }
 
+static void ExtractStructFunction(DataChunk &args, ExpressionState &state, Vector &result) {
+	JSONExecutors::ExecuteManyToStruct<string_t>(args, state, result, ExtractFromVal);
+}
+
+static unique_ptr<FunctionData> ExtractStructBind(ClientContext &context, ScalarFunction &bound_function,
+                                                  vector<unique_ptr<Expression>> &arguments) {
+	auto bind_data = JSONReadManyFunctionData::Bind(context, bound_function, arguments);
+
+	// name the result fields after the original path strings
+	auto paths_val = ExpressionExecutor::EvaluateScalar(context, *arguments[1]);
+	child_list_t<LogicalType> fields;
+	for (auto &path_val : ListValue::GetChildren(paths_val)) {
+		fields.emplace_back(StringValue::Get(path_val), LogicalType::JSON());
+	}
+	if (fields.empty()) {
+		throw BinderException("json_extract_struct requires at least one path");
+	}
+	bound_function.return_type = LogicalType::STRUCT(std::move(fields));
+	return bind_data;
+}
+
+static void GetExtractStructFunctionsInternal(ScalarFunctionSet &set, const LogicalType &input_type) {
+	set.AddFunction(ScalarFunction({input_type, LogicalType::LIST(LogicalType::VARCHAR)},
+	                               LogicalType(LogicalTypeId::STRUCT), ExtractStructFunction, ExtractStructBind,
+	                               nullptr, nullptr, JSONFunctionLocalState::Init));
+}
+
+ScalarFunctionSet JSONFunctions::GetExtractStructFunction() {
+	// Multi-path extract function - walks the parsed tree once and emits one result vector per path
+	ScalarFunctionSet set("json_extract_struct");
+	GetExtractStructFunctionsInternal(set, LogicalType::VARCHAR);
+	GetExtractStructFunctionsInternal(set, LogicalType::JSON());
+	return set;
+}
+
 static void GetExtractStringFunctionsInternal(ScalarFunctionSet &set, const LogicalType &input_type) {
 	set.AddFunction(ScalarFunction({input_type, LogicalType::BIGINT}, LogicalType::VARCHAR, ExtractStringFunction,
 	                               JSONReadFunctionData::Bind, nullptr, nullptr, JSONFunctionLocalState::Init));
@@ -232,7 +232,76 @@ bool ColumnReader::PageIsFilteredOut(PageHeader &page_hdr) {
 	return true;
 }
 
-void ColumnReader::PrepareRead(optional_ptr<const TableFilter> filter, optional_ptr<TableFilterState> filter_state) {
+bool ColumnReader::PageIsPrunedByStats(PageHeader &page_hdr, optional_ptr<const TableFilter> filter,
+                                       optional_ptr<TableFilterState> filter_state) {
+	if (!filter || !filter_state) {
+		return false;
+	}
+	if (page_hdr.type != PageType::DATA_PAGE && page_hdr.type != PageType::DATA_PAGE_V2) {
+		// we can only filter out data pages
+		return false;
+	}
+	if (HasRepeats()) {
+		// for repeated columns num_values counts values rather than rows, so we cannot skip by row count
+		return false;
+	}
+	// the skipped rows are emitted as NULL, so we need a filter that is known to filter out NULL values
+	if (!dictionary_decoder.DictionarySupportsFilter(*filter, *filter_state)) {
+		return false;
+	}
+	bool is_v1 = page_hdr.type == PageType::DATA_PAGE;
+	auto &v1_header = page_hdr.data_page_header;
+	auto &v2_header = page_hdr.data_page_header_v2;
+	if (!(is_v1 ? v1_header.__isset.statistics : v2_header.__isset.statistics)) {
+		return false;
+	}
+	auto num_values = is_v1 ? v1_header.num_values : v2_header.num_values;
+	if (num_values <= 0) {
+		return false;
+	}
+	auto &page_stats = is_v1 ? v1_header.statistics : v2_header.statistics;
+	auto stats = ParquetStatisticsUtils::TransformColumnStatistics(Schema(), page_stats, num_values,
+	                                                               reader.parquet_options.can_have_nan);
+	if (!stats || filter->CheckStatistics(*stats) != FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+		return false;
+	}
+	// the page statistics show that no row in this page can pass the filter!
+	// skip forward
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.Skip(page_hdr.compressed_page_size);
+
+	page_rows_available = NumericCast<idx_t>(num_values);
+	encoding = ColumnEncoding::DICTIONARY;
+	page_is_filtered_out = true;
+	return true;
+}
+
+bool ColumnReader::PageCanBeSkipped(PageHeader &page_hdr, idx_t max_skip) {
+	if (page_hdr.type != PageType::DATA_PAGE && page_hdr.type != PageType::DATA_PAGE_V2) {
+		// we can only skip data pages
+		return false;
+	}
+	if (HasRepeats()) {
+		// for repeated columns num_values counts values rather than rows, so we cannot skip by row count
+		return false;
+	}
+	bool is_v1 = page_hdr.type == PageType::DATA_PAGE;
+	auto num_values = is_v1 ? page_hdr.data_page_header.num_values : page_hdr.data_page_header_v2.num_values;
+	if (num_values <= 0 || NumericCast<idx_t>(num_values) > max_skip) {
+		return false;
+	}
+	// every row in this page is skipped - no need to decompress and decode it
+	auto &trans = reinterpret_cast<ThriftFileTransport &>(*protocol->getTransport());
+	trans.Skip(page_hdr.compressed_page_size);
+
+	page_rows_available = NumericCast<idx_t>(num_values);
+	encoding = ColumnEncoding::DICTIONARY;
+	page_is_filtered_out = true;
+	return true;
+}
+
+void ColumnReader::PrepareRead(optional_ptr<const TableFilter> filter, optional_ptr<TableFilterState> filter_state,
+                               idx_t max_skip) {
 	encoding = ColumnEncoding::INVALID;
 	defined_decoder.reset();
 	page_is_filtered_out = false;
@@ -261,6 +330,16 @@ void ColumnReader::PrepareRead(optional_ptr<const TableFilter> filter, optional_
 		return;
 	}
 
+	if (PageIsPrunedByStats(page_hdr, filter, filter_state)) {
+		// the page statistics show that no row can pass the filter so we don't need to read it
+		return;
+	}
+
+	if (max_skip > 0 && PageCanBeSkipped(page_hdr, max_skip)) {
+		// the page falls entirely within a pending skip so we don't need to decompress it
+		return;
+	}
+
 	switch (page_hdr.type) {
 	case PageType::DATA_PAGE_V2:
 		PreparePageV2(page_hdr);
@@ -522,9 +601,9 @@ void ColumnReader::BeginRead(data_ptr_t define_out, data_ptr_t repeat_out) {
 }
 
 idx_t ColumnReader::ReadPageHeaders(idx_t max_read, optional_ptr<const TableFilter> filter,
-                                    optional_ptr<TableFilterState> filter_state) {
+                                    optional_ptr<TableFilterState> filter_state, idx_t max_skip) {
 	while (page_rows_available == 0) {
-		PrepareRead(filter, filter_state);
+		PrepareRead(filter, filter_state, max_skip);
 	}
 	return MinValue<idx_t>(MinValue<idx_t>(max_read, page_rows_available), STANDARD_VECTOR_SIZE);
 }
@@ -726,7 +805,7 @@ void ColumnReader::ApplyPendingSkips(data_ptr_t define_out, data_ptr_t repeat_ou
 	BeginRead(nullptr, nullptr);
 
 	while (to_skip > 0) {
-		auto skip_now = ReadPageHeaders(to_skip);
+		auto skip_now = ReadPageHeaders(to_skip, nullptr, nullptr, to_skip);
 		if (page_is_filtered_out) {
 			// the page has been filtered out entirely - skip
 			page_rows_available -= skip_now;
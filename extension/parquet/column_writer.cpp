@@ -105,6 +105,9 @@ void ColumnWriterStatistics::WriteGeoStats(duckdb_parquet::GeospatialStatistics
 	D_ASSERT(false); // this should never be called
 }
 
+void ColumnWriterStatistics::Merge(ColumnWriterStatistics &other) {
+}
+
 //===--------------------------------------------------------------------===//
 // ColumnWriter
 //===--------------------------------------------------------------------===//
@@ -181,10 +181,15 @@ protected:
 private:
 	//! Check if a previous table filter has filtered out this page
 	bool PageIsFilteredOut(PageHeader &page_hdr);
+	//! Check if the page statistics show that no row in this page can pass the table filter
+	bool PageIsPrunedByStats(PageHeader &page_hdr, optional_ptr<const TableFilter> filter,
+	                         optional_ptr<TableFilterState> filter_state);
+	//! Check if this page falls entirely within a pending skip, so it can be skipped without decompressing it
+	bool PageCanBeSkipped(PageHeader &page_hdr, idx_t max_skip);
 	void BeginRead(data_ptr_t define_out, data_ptr_t repeat_out);
 	void FinishRead(idx_t read_count);
 	idx_t ReadPageHeaders(idx_t max_read, optional_ptr<const TableFilter> filter = nullptr,
-	                      optional_ptr<TableFilterState> filter_state = nullptr);
+	                      optional_ptr<TableFilterState> filter_state = nullptr, idx_t max_skip = 0);
 	idx_t ReadInternal(uint64_t num_values, data_ptr_t define_out, data_ptr_t repeat_out, Vector &result);
 	//! Prepare a read of up to "max_read" rows and read the defines/repeats.
 	//! Returns whether all values are valid (i.e., not NULL)
@@ -291,7 +296,8 @@ protected:
 
 private:
 	void AllocateBlock(idx_t size);
-	void PrepareRead(optional_ptr<const TableFilter> filter, optional_ptr<TableFilterState> filter_state);
+	void PrepareRead(optional_ptr<const TableFilter> filter, optional_ptr<TableFilterState> filter_state,
+	                 idx_t max_skip = 0);
 	void PreparePage(PageHeader &page_hdr);
 	void PrepareDataPage(PageHeader &page_hdr);
 	void PreparePageV2(PageHeader &page_hdr);
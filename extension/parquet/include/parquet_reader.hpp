@@ -225,6 +225,9 @@ private:
 	// Group span is the distance between the min page offset and the max page offset plus the max page compressed size
 	uint64_t GetGroupSpan(ParquetReaderScanState &state);
 	void PrepareRowGroupBuffer(ParquetReaderScanState &state, idx_t out_col_idx);
+	//! Fetch the column chunks of the row group after the current one, so the data is resident in the
+	//! CachingFileSystem by the time the decode gets there
+	void PrefetchUpcomingGroup(ParquetReaderScanState &state, ThriftFileTransport &trans);
 	ParquetColumnSchema ParseColumnSchema(const SchemaElement &s_ele, idx_t max_define, idx_t max_repeat,
 	                                      idx_t schema_index, idx_t column_index,
 	                                      ParquetColumnSchemaType type = ParquetColumnSchemaType::COLUMN);
@@ -51,6 +51,14 @@ struct ParquetBloomFilterEntry {
 	idx_t column_idx;
 };
 
+struct ParquetPageIndexEntry {
+	//! Per-page min/max statistics (optional - the offset index can be written without it)
+	unique_ptr<duckdb_parquet::ColumnIndex> column_index;
+	duckdb_parquet::OffsetIndex offset_index;
+	idx_t row_group_idx;
+	idx_t column_idx;
+};
+
 enum class ParquetVersion : uint8_t {
 	V1 = 1, //! Excludes DELTA_BINARY_PACKED, DELTA_LENGTH_BYTE_ARRAY, BYTE_STREAM_SPLIT
 	V2 = 2, //! Includes the encodings above
@@ -135,6 +143,8 @@ public:
 	                              optional_ptr<duckdb_parquet::Type::type> type = nullptr);
 
 	void BufferBloomFilter(idx_t col_idx, unique_ptr<ParquetBloomFilter> bloom_filter);
+	void BufferPageIndexes(idx_t col_idx, unique_ptr<duckdb_parquet::ColumnIndex> column_index,
+	                       duckdb_parquet::OffsetIndex offset_index);
 	void SetWrittenStatistics(CopyFunctionFileStatistics &written_stats);
 	void FlushColumnStats(idx_t col_idx, duckdb_parquet::ColumnChunk &chunk,
 	                      optional_ptr<ColumnWriterStatistics> writer_stats);
@@ -174,6 +184,7 @@ private:
 
 	unique_ptr<GeoParquetFileMetadata> geoparquet_data;
 	vector<ParquetBloomFilterEntry> bloom_filters;
+	vector<ParquetPageIndexEntry> page_indexes;
 
 	optional_ptr<CopyFunctionFileStatistics> written_stats;
 	unique_ptr<ParquetStatsAccumulator> stats_accumulator;
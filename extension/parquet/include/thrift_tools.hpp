@@ -112,10 +112,16 @@ struct ReadAheadBuffer {
 
 	// Prefetch all read heads
 	void Prefetch() {
+		// Let the caching file handle plan the reads first: it coalesces the registered ranges beyond ALLOW_GAP
+		// and reads them into the external file cache, so the per-read-head reads below hit the cache
 		for (auto &read_head : read_heads) {
 			if (read_head.GetEnd() > file_handle.GetFileSize()) {
 				throw std::runtime_error("Prefetch registered requested for bytes outside file");
 			}
+			file_handle.RegisterPrefetch(read_head.size, read_head.location);
+		}
+		file_handle.Prefetch();
+		for (auto &read_head : read_heads) {
 			read_head.buffer_handle = file_handle.Read(read_head.buffer_ptr, read_head.size, read_head.location);
 			D_ASSERT(read_head.buffer_handle.IsValid());
 			read_head.data_isset = true;
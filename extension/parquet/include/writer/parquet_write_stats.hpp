@@ -31,6 +31,10 @@ public:
 	virtual optional_ptr<GeometryStatsData> GetGeoStats();
 	virtual void WriteGeoStats(duckdb_parquet::GeospatialStatistics &stats);
 
+	//! Merges the statistics of "other" into this object. "other" must have been created by the
+	//! same InitializeStatsState that created this object (i.e., it has the same dynamic type)
+	virtual void Merge(ColumnWriterStatistics &other);
+
 public:
 	template <class TARGET>
 	TARGET &Cast() {
@@ -70,6 +74,19 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(char_ptr_cast(&max), sizeof(T)) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<NumericStatisticsState<SRC, T, OP>>();
+		if (!other.HasStats()) {
+			return;
+		}
+		if (other.min < min) {
+			min = other.min;
+		}
+		if (other.max > max) {
+			max = other.max;
+		}
+	}
 };
 
 template <class SRC, class T, class OP>
@@ -84,6 +101,11 @@ public:
 	bool HasNaN() override {
 		return has_nan;
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		NumericStatisticsState<SRC, T, OP>::Merge(other_p);
+		has_nan = has_nan || other_p.Cast<FloatingPointStatisticsState<SRC, T, OP>>().has_nan;
+	}
 };
 
 class StringStatisticsState : public ColumnWriterStatistics {
@@ -225,6 +247,28 @@ public:
 	bool MaxIsExact() override {
 		return !max_truncated;
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<StringStatisticsState>();
+		if (other.failed_truncate) {
+			failed_truncate = true;
+			has_stats = false;
+			min = string();
+			max = string();
+		}
+		if (failed_truncate || !other.has_stats) {
+			return;
+		}
+		if (!has_stats || LessThan::Operation(string_t(other.min), string_t(min))) {
+			min = other.min;
+			min_truncated = other.min_truncated;
+		}
+		if (!has_stats || GreaterThan::Operation(string_t(other.max), string_t(max))) {
+			max = other.max;
+			max_truncated = other.max_truncated;
+		}
+		has_stats = true;
+	}
 };
 
 class UUIDStatisticsState : public ColumnWriterStatistics {
@@ -250,6 +294,20 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(char_ptr_cast(max), 16) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<UUIDStatisticsState>();
+		if (!other.has_stats) {
+			return;
+		}
+		if (!has_stats || memcmp(other.min, min, 16) < 0) {
+			memcpy(min, other.min, 16);
+		}
+		if (!has_stats || memcmp(other.max, max, 16) > 0) {
+			memcpy(max, other.max, 16);
+		}
+		has_stats = true;
+	}
 };
 
 class GeoStatisticsState final : public ColumnWriterStatistics {
@@ -300,6 +358,15 @@ public:
 		stats.__isset.geospatial_types = true;
 		stats.geospatial_types = types.ToWKBList();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<GeoStatisticsState>();
+		if (!other.has_stats) {
+			return;
+		}
+		geo_stats.Merge(other.geo_stats);
+		has_stats = true;
+	}
 };
 
 } // namespace duckdb
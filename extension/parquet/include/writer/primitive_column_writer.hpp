@@ -49,6 +49,8 @@ public:
 	vector<PageInformation> page_info;
 	vector<PageWriteInformation> write_info;
 	unique_ptr<ColumnWriterStatistics> stats_state;
+	//! Per-data-page statistics, used to emit the page index (merged into stats_state when finalizing)
+	vector<unique_ptr<ColumnWriterStatistics>> page_stats;
 	idx_t current_page = 0;
 
 	unique_ptr<ParquetBloomFilter> bloom_filter;
@@ -108,6 +110,10 @@ protected:
 	void WriteDictionary(PrimitiveColumnWriterState &state, unique_ptr<MemoryStream> temp_writer, idx_t row_count);
 	virtual void FlushDictionary(PrimitiveColumnWriterState &state, ColumnWriterStatistics *stats);
 
+	//! Builds the column index (per-page min/max values) for the page index.
+	//! Returns nullptr if no valid per-page statistics are available
+	unique_ptr<duckdb_parquet::ColumnIndex> BuildColumnIndex(PrimitiveColumnWriterState &state);
+
 	void SetParquetStatistics(PrimitiveColumnWriterState &state, duckdb_parquet::ColumnChunk &column);
 	void RegisterToRowGroup(duckdb_parquet::RowGroup &row_group);
 };
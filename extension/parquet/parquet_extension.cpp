@@ -992,7 +992,8 @@ static void LoadInternal(ExtensionLoader &loader) {
 	                          "Use the prefetching mechanism for all types of parquet files", LogicalType::BOOLEAN,
 	                          Value(false));
 	config.AddExtensionOption("parquet_metadata_cache",
-	                          "Cache Parquet metadata - useful when reading the same files multiple times",
+	                          "Cache Parquet metadata - useful when reading the same files multiple times. "
+	                          "Metadata of remote files is always cached while the external file cache is enabled",
 	                          LogicalType::BOOLEAN, Value(false));
 	config.AddExtensionOption(
 	    "enable_geoparquet_conversion",
@@ -5,6 +5,7 @@
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "parquet_crypto.hpp"
 #include "duckdb/function/table_function.hpp"
+#include "duckdb/storage/external_file_cache.hpp"
 
 namespace duckdb {
 
@@ -273,7 +274,8 @@ static vector<PartitionStatistics> ParquetGetPartitionStats(ClientContext &conte
 		return result;
 	}
 	// if we are reading multiple files - we check if we have caching enabled
-	if (!ParquetReader::MetadataCacheEnabled(context)) {
+	// (remote files are cached through the external file cache even without the explicit setting)
+	if (!ParquetReader::MetadataCacheEnabled(context) && !ExternalFileCache::Get(context).IsEnabled()) {
 		// no caching - bail
 		return result;
 	}
@@ -25,6 +25,7 @@
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/planner/table_filter.hpp"
+#include "duckdb/storage/external_file_cache.hpp"
 #include "duckdb/storage/object_cache.hpp"
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/table_filter_state.hpp"
@@ -877,7 +878,13 @@ ParquetReader::ParquetReader(ClientContext &context_p, OpenFileInfo file_p, Parq
 	// or if this file has cached metadata
 	// or if the cached version already expired
 	if (!metadata_p) {
-		if (!MetadataCacheEnabled(context_p)) {
+		// Remote files always use the metadata cache when the external file cache is enabled:
+		// re-fetching and re-parsing footers dominates repeated scans over object storage, and the
+		// etag/last-modified validation makes reuse safe across queries and connections.
+		const auto cache_metadata =
+		    MetadataCacheEnabled(context_p) ||
+		    (file_handle->IsRemoteFile() && ExternalFileCache::Get(context_p).IsEnabled());
+		if (!cache_metadata) {
 			metadata = LoadMetadata(context_p, allocator, *file_handle, parquet_options.encryption_config,
 			                        *encryption_util, footer_size);
 		} else {
@@ -1088,6 +1095,46 @@ idx_t ParquetReader::GetGroupOffset(ParquetReaderScanState &state) {
 	return min_offset;
 }
 
+static void RegisterUpcomingColumnChunk(const ParquetColumnSchema &schema, const ParquetRowGroup &group,
+                                        ThriftFileTransport &trans) {
+	for (auto &child : schema.children) {
+		RegisterUpcomingColumnChunk(child, group, trans);
+	}
+	if (!schema.children.empty() || schema.column_index >= group.columns.size()) {
+		return;
+	}
+	if (schema.schema_type != ParquetColumnSchemaType::COLUMN &&
+	    schema.schema_type != ParquetColumnSchemaType::GEOMETRY) {
+		// generated columns have no data in the file
+		return;
+	}
+	auto &meta_data = group.columns[schema.column_index].meta_data;
+	idx_t min_offset = NumericLimits<idx_t>::Maximum();
+	if (meta_data.__isset.dictionary_page_offset) {
+		min_offset = MinValue<idx_t>(min_offset, meta_data.dictionary_page_offset);
+	}
+	if (meta_data.__isset.index_page_offset) {
+		min_offset = MinValue<idx_t>(min_offset, meta_data.index_page_offset);
+	}
+	min_offset = MinValue<idx_t>(min_offset, meta_data.data_page_offset);
+	trans.RegisterPrefetch(min_offset, meta_data.total_compressed_size);
+}
+
+void ParquetReader::PrefetchUpcomingGroup(ParquetReaderScanState &state, ThriftFileTransport &trans) {
+	if ((idx_t)state.current_group + 1 >= state.group_idx_list.size()) {
+		return;
+	}
+	auto &next_group = GetFileMetadata()->row_groups[state.group_idx_list[state.current_group + 1]];
+	auto &root_reader = state.root_reader->Cast<StructColumnReader>();
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		auto col_idx = MultiFileLocalIndex(i);
+		auto file_col_idx = column_ids[col_idx];
+		RegisterUpcomingColumnChunk(root_reader.GetChildReader(file_col_idx).Schema(), next_group, trans);
+	}
+	trans.FinalizeRegistration();
+	trans.PrefetchRegistered();
+}
+
 static FilterPropagateResult CheckParquetStringFilter(BaseStatistics &stats, const Statistics &pq_col_stats,
                                                       TableFilter &filter) {
 	switch (filter.filter_type) {
@@ -1374,6 +1421,11 @@ bool ParquetReader::ScanInternal(ClientContext &context, ParquetReaderScanState
 					trans.PrefetchRegistered();
 				}
 			}
+			if (!filters) {
+				// also fetch the column chunks of the upcoming row group, so the data is already resident in the
+				// CachingFileSystem when the decode of the current group finishes
+				PrefetchUpcomingGroup(state, trans);
+			}
 		}
 		return true;
 	}
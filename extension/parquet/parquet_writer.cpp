@@ -15,6 +15,8 @@
 #include "duckdb/function/table_function.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/create_copy_function_info.hpp"
 #include "duckdb/parser/parsed_data/create_table_function_info.hpp"
 #include "duckdb/common/types/blob.hpp"
@@ -418,6 +420,56 @@ ParquetWriter::ParquetWriter(ClientContext &context, FileSystem &fs, string file
 ParquetWriter::~ParquetWriter() {
 }
 
+//! Runs the full prepare pipeline (analyze, prepare, encode and compress) for a single column chunk.
+//! This only touches the column's own write state and read-only writer settings, so different columns
+//! can be prepared concurrently
+static void PrepareColumnChunk(ColumnDataCollection &buffer, ColumnWriter &col_writer, ColumnWriterState &write_state,
+                               column_t col_idx) {
+	vector<column_t> column_ids {col_idx};
+	if (col_writer.HasAnalyze()) {
+		for (auto &chunk : buffer.Chunks(column_ids)) {
+			col_writer.Analyze(write_state, nullptr, chunk.data[0], chunk.size());
+		}
+		col_writer.FinalizeAnalyze(write_state);
+	}
+
+	// Reserving these once at the start really pays off
+	write_state.definition_levels.reserve(buffer.Count());
+
+	for (auto &chunk : buffer.Chunks(column_ids)) {
+		col_writer.Prepare(write_state, nullptr, chunk.data[0], chunk.size(), true);
+	}
+
+	col_writer.BeginWrite(write_state);
+
+	for (auto &chunk : buffer.Chunks(column_ids)) {
+		col_writer.Write(write_state, chunk.data[0], chunk.size());
+	}
+}
+
+class PrepareColumnChunkTask : public BaseExecutorTask {
+public:
+	PrepareColumnChunkTask(TaskExecutor &executor, ColumnDataCollection &buffer, ColumnWriter &col_writer,
+	                       ColumnWriterState &write_state, column_t col_idx)
+	    : BaseExecutorTask(executor), buffer(buffer), col_writer(col_writer), write_state(write_state),
+	      col_idx(col_idx) {
+	}
+
+	void ExecuteTask() override {
+		PrepareColumnChunk(buffer, col_writer, write_state, col_idx);
+	}
+
+	string TaskType() const override {
+		return "PrepareColumnChunkTask";
+	}
+
+private:
+	ColumnDataCollection &buffer;
+	ColumnWriter &col_writer;
+	ColumnWriterState &write_state;
+	column_t col_idx;
+};
+
 void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGroup &result) {
 	// We write 8 columns at a time so that iterating over ColumnDataCollection is more efficient
 	static constexpr idx_t COLUMNS_PER_PASS = 8;
@@ -431,8 +483,27 @@ void ParquetWriter::PrepareRowGroup(ColumnDataCollection &buffer, PreparedRowGro
 	row_group.__isset.file_offset = true;
 
 	auto &states = result.states;
-	// iterate over each of the columns of the chunk collection and write them
 	D_ASSERT(buffer.ColumnCount() == column_writers.size());
+
+	auto &scheduler = TaskScheduler::GetScheduler(context);
+	if (buffer.ColumnCount() > 1 && scheduler.NumberOfThreads() > 1) {
+		// initializing the write states appends the column chunk metadata to the row group,
+		// so this has to happen serially and in column order
+		for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx++) {
+			states.push_back(column_writers[col_idx]->InitializeWriteState(row_group));
+		}
+		// encode and compress the column chunks in parallel - this is where the bulk of the
+		// CPU time of writing a row group is spent
+		TaskExecutor executor(scheduler);
+		for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx++) {
+			executor.ScheduleTask(make_uniq<PrepareColumnChunkTask>(executor, buffer, *column_writers[col_idx],
+			                                                        *states[col_idx], col_idx));
+		}
+		executor.WorkOnTasks();
+		return;
+	}
+
+	// single-threaded: iterate over each of the columns of the chunk collection and write them
 	for (idx_t col_idx = 0; col_idx < buffer.ColumnCount(); col_idx += COLUMNS_PER_PASS) {
 		const auto next = MinValue<idx_t>(buffer.ColumnCount() - col_idx, COLUMNS_PER_PASS);
 		vector<column_t> column_ids;
@@ -922,6 +993,31 @@ void ParquetWriter::GatherWrittenStatistics() {
 
 void ParquetWriter::Finalize() {
 
+	// dump the page indexes right before the footer, not if stuff is encrypted
+	// write all column indexes first, then all offset indexes (readers locate them via the
+	// offsets in the column chunk metadata either way)
+	for (auto &page_index_entry : page_indexes) {
+		if (!page_index_entry.column_index) {
+			continue;
+		}
+		D_ASSERT(!encryption_config);
+		auto &column_chunk =
+		    file_meta_data.row_groups[page_index_entry.row_group_idx].columns[page_index_entry.column_idx];
+		column_chunk.column_index_offset = NumericCast<int64_t>(writer->GetTotalWritten());
+		column_chunk.__isset.column_index_offset = true;
+		column_chunk.column_index_length = NumericCast<int32_t>(Write(*page_index_entry.column_index));
+		column_chunk.__isset.column_index_length = true;
+	}
+	for (auto &page_index_entry : page_indexes) {
+		D_ASSERT(!encryption_config);
+		auto &column_chunk =
+		    file_meta_data.row_groups[page_index_entry.row_group_idx].columns[page_index_entry.column_idx];
+		column_chunk.offset_index_offset = NumericCast<int64_t>(writer->GetTotalWritten());
+		column_chunk.__isset.offset_index_offset = true;
+		column_chunk.offset_index_length = NumericCast<int32_t>(Write(page_index_entry.offset_index));
+		column_chunk.__isset.offset_index_length = true;
+	}
+
 	// dump the bloom filters right before footer, not if stuff is encrypted
 
 	for (auto &bloom_filter_entry : bloom_filters) {
@@ -1009,6 +1105,19 @@ void ParquetWriter::BufferBloomFilter(idx_t col_idx, unique_ptr<ParquetBloomFilt
 	bloom_filters.push_back(std::move(new_entry));
 }
 
+void ParquetWriter::BufferPageIndexes(idx_t col_idx, unique_ptr<duckdb_parquet::ColumnIndex> column_index,
+                                      duckdb_parquet::OffsetIndex offset_index) {
+	if (encryption_config) {
+		return;
+	}
+	ParquetPageIndexEntry new_entry;
+	new_entry.column_index = std::move(column_index);
+	new_entry.offset_index = std::move(offset_index);
+	new_entry.column_idx = col_idx;
+	new_entry.row_group_idx = file_meta_data.row_groups.size();
+	page_indexes.push_back(std::move(new_entry));
+}
+
 void ParquetWriter::SetWrittenStatistics(CopyFunctionFileStatistics &written_stats_p) {
 	written_stats = written_stats_p;
 	stats_accumulator = make_uniq<ParquetStatsAccumulator>();
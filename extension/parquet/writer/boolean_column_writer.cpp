@@ -27,6 +27,15 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? string(const_char_ptr_cast(&max), sizeof(bool)) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<BooleanStatisticsState>();
+		if (!other.HasStats()) {
+			return;
+		}
+		min = min && other.min;
+		max = max || other.max;
+	}
 };
 
 class BooleanWriterPageState : public ColumnWriterPageState {
@@ -64,6 +64,19 @@ public:
 	string GetMaxValue() override {
 		return HasStats() ? GetStats(max) : string();
 	}
+
+	void Merge(ColumnWriterStatistics &other_p) override {
+		auto &other = other_p.Cast<FixedDecimalStatistics>();
+		if (!other.HasStats()) {
+			return;
+		}
+		if (LessThan::Operation(other.min, min)) {
+			min = other.min;
+		}
+		if (GreaterThan::Operation(other.max, max)) {
+			max = other.max;
+		}
+	}
 };
 
 FixedDecimalColumnWriter::FixedDecimalColumnWriter(ParquetWriter &writer, const ParquetColumnSchema &column_schema,
@@ -130,6 +130,7 @@ void PrimitiveColumnWriter::BeginWrite(ColumnWriterState &state_p) {
 		write_info.compressed_data = nullptr;
 
 		state.write_info.push_back(std::move(write_info));
+		state.page_stats.push_back(InitializeStatsState());
 	}
 
 	// start writing the first page
@@ -247,8 +248,8 @@ void PrimitiveColumnWriter::Write(ColumnWriterState &state_p, Vector &vector, id
 		idx_t write_count = MinValue<idx_t>(remaining, write_info.max_write_count - write_info.write_count);
 		D_ASSERT(write_count > 0);
 
-		WriteVector(temp_writer, state.stats_state.get(), write_info.page_state.get(), vector, offset,
-		            offset + write_count);
+		WriteVector(temp_writer, state.page_stats[state.current_page - 1].get(), write_info.page_state.get(), vector,
+		            offset, offset + write_count);
 
 		write_info.write_count += write_count;
 		if (write_info.write_count == write_info.max_write_count) {
@@ -337,6 +338,39 @@ void PrimitiveColumnWriter::SetParquetStatistics(PrimitiveColumnWriterState &sta
 	}
 }
 
+unique_ptr<duckdb_parquet::ColumnIndex> PrimitiveColumnWriter::BuildColumnIndex(PrimitiveColumnWriterState &state) {
+	if (!state.stats_state->HasStats()) {
+		// no statistics for this column - we cannot emit page-level min/max values
+		return nullptr;
+	}
+	if (state.stats_state->CanHaveNaN() && state.stats_state->HasNaN()) {
+		// NaN values are not represented in the min/max bounds - skip the column index so that
+		// readers cannot incorrectly prune pages that contain NaN
+		return nullptr;
+	}
+	auto column_index = make_uniq<duckdb_parquet::ColumnIndex>();
+	for (idx_t page_idx = 0; page_idx < state.page_stats.size(); page_idx++) {
+		auto &page_stats = *state.page_stats[page_idx];
+		auto &page_info = state.page_info[page_idx];
+		if (page_info.empty_count != 0) {
+			return nullptr;
+		}
+		const bool is_null_page = !page_stats.HasStats();
+		if (is_null_page && page_info.null_count != page_info.row_count) {
+			// the page holds values but there are no page-level statistics for it
+			// (e.g. the writer only computes statistics when flushing the dictionary)
+			return nullptr;
+		}
+		column_index->null_pages.push_back(is_null_page);
+		column_index->min_values.push_back(is_null_page ? string() : page_stats.GetMinValue());
+		column_index->max_values.push_back(is_null_page ? string() : page_stats.GetMaxValue());
+		column_index->null_counts.push_back(UnsafeNumericCast<int64_t>(page_info.null_count));
+	}
+	column_index->boundary_order = duckdb_parquet::BoundaryOrder::UNORDERED;
+	column_index->__isset.null_counts = true;
+	return column_index;
+}
+
 void PrimitiveColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	auto &state = state_p.Cast<PrimitiveColumnWriterState>();
 	auto &column_chunk = state.row_group.columns[state.col_idx];
@@ -344,6 +378,11 @@ void PrimitiveColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 	// flush the last page (if any remains)
 	FlushPage(state);
 
+	// roll up the per-page statistics into the column chunk statistics
+	for (auto &page_stats : state.page_stats) {
+		state.stats_state->Merge(*page_stats);
+	}
+
 	auto &column_writer = writer.GetWriter();
 	auto start_offset = column_writer.GetTotalWritten();
 	// flush the dictionary
@@ -361,10 +400,14 @@ void PrimitiveColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 
 	// write the individual pages to disk
 	idx_t total_uncompressed_size = 0;
+	duckdb_parquet::OffsetIndex offset_index;
+	idx_t data_page_idx = 0;
+	idx_t first_row_index = 0;
 	for (auto &write_info : state.write_info) {
+		const bool is_data_page = write_info.page_header.type == PageType::DATA_PAGE ||
+		                          write_info.page_header.type == PageType::DATA_PAGE_V2;
 		// set the data page offset whenever we see the *first* data page
-		if (column_chunk.meta_data.data_page_offset == 0 && (write_info.page_header.type == PageType::DATA_PAGE ||
-		                                                     write_info.page_header.type == PageType::DATA_PAGE_V2)) {
+		if (column_chunk.meta_data.data_page_offset == 0 && is_data_page) {
 			column_chunk.meta_data.data_page_offset = UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten());
 		}
 		D_ASSERT(write_info.page_header.uncompressed_page_size > 0);
@@ -374,12 +417,30 @@ void PrimitiveColumnWriter::FinalizeWrite(ColumnWriterState &state_p) {
 		total_uncompressed_size += column_writer.GetTotalWritten() - header_start_offset;
 		total_uncompressed_size += write_info.page_header.uncompressed_page_size;
 		writer.WriteData(write_info.compressed_data, write_info.compressed_size);
+		if (is_data_page) {
+			// record the location of the data page for the offset index
+			duckdb_parquet::PageLocation page_location;
+			page_location.offset = UnsafeNumericCast<int64_t>(header_start_offset);
+			page_location.compressed_page_size =
+			    UnsafeNumericCast<int32_t>(column_writer.GetTotalWritten() - header_start_offset);
+			page_location.first_row_index = UnsafeNumericCast<int64_t>(first_row_index);
+			offset_index.page_locations.push_back(std::move(page_location));
+			first_row_index += state.page_info[data_page_idx].row_count;
+			data_page_idx++;
+		}
 	}
 	column_chunk.meta_data.total_compressed_size =
 	    UnsafeNumericCast<int64_t>(column_writer.GetTotalWritten() - start_offset);
 	column_chunk.meta_data.total_uncompressed_size = UnsafeNumericCast<int64_t>(total_uncompressed_size);
 	state.row_group.total_byte_size += column_chunk.meta_data.total_uncompressed_size;
 
+	// emit the page index for flat top-level columns, where pages align with row boundaries and the
+	// per-page accounting is exact
+	if (MaxRepeat() == 0 && schema_path.size() == 1 && !offset_index.page_locations.empty()) {
+		auto column_index = BuildColumnIndex(state);
+		writer.BufferPageIndexes(state.col_idx, std::move(column_index), std::move(offset_index));
+	}
+
 	if (state.bloom_filter) {
 		writer.BufferBloomFilter(state.col_idx, std::move(state.bloom_filter));
 	}
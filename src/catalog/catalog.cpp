@@ -1,6 +1,7 @@
 #include "duckdb/catalog/catalog.hpp"
 
 #include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/catalog/catalog_entry_cache.hpp"
 #include "duckdb/catalog/catalog_entry/list.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/catalog/catalog_set.hpp"
@@ -771,6 +772,16 @@ CatalogEntryLookup Catalog::TryLookupEntryInternal(CatalogTransaction transactio
 	if (lookup_info.GetAtClause() && !SupportsTimeTravel()) {
 		return {nullptr, nullptr, ErrorData(BinderException("Catalog type does not support time travel"))};
 	}
+	// Probe the per-connection entry cache first:
+	// repeated lookups of the same entry skip catalog traversal until a DDL bumps the catalog version
+	optional_ptr<CatalogEntryCache> entry_cache;
+	if (transaction.context && !lookup_info.GetAtClause()) {
+		entry_cache = ClientData::Get(*transaction.context).catalog_entry_cache.get();
+		CatalogEntryCache::CachedEntry cached;
+		if (entry_cache->TryGetEntry(*this, *transaction.context, schema, lookup_info, cached)) {
+			return {cached.schema, cached.entry, ErrorData()};
+		}
+	}
 	auto schema_lookup = EntryLookupInfo::SchemaLookup(lookup_info, schema);
 	auto schema_entry = LookupSchema(transaction, schema_lookup, OnEntryNotFound::RETURN_NULL);
 	if (!schema_entry) {
@@ -780,6 +791,9 @@ CatalogEntryLookup Catalog::TryLookupEntryInternal(CatalogTransaction transactio
 	if (!entry) {
 		return {schema_entry, nullptr, ErrorData()};
 	}
+	if (entry_cache) {
+		entry_cache->InsertEntry(*this, *transaction.context, schema, lookup_info, *schema_entry, *entry);
+	}
 	return {schema_entry, entry, ErrorData()};
 }
 
@@ -0,0 +1,62 @@
+#include "duckdb/catalog/catalog_entry_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/entry_lookup_info.hpp"
+#include "duckdb/common/to_string.hpp"
+
+namespace duckdb {
+
+string CatalogEntryCache::EntryKey(const string &schema, const EntryLookupInfo &lookup_info) {
+	string key;
+	key += to_string(static_cast<uint8_t>(lookup_info.GetCatalogType()));
+	key += '\0';
+	key += schema;
+	key += '\0';
+	key += lookup_info.GetEntryName();
+	return key;
+}
+
+bool CatalogEntryCache::TryGetEntry(Catalog &catalog, ClientContext &context, const string &schema,
+                                    const EntryLookupInfo &lookup_info, CachedEntry &result) {
+	const auto version = catalog.GetCatalogVersion(context);
+	if (!version.IsValid()) {
+		// The catalog does not expose a version - we cannot tell when entries go stale
+		return false;
+	}
+	auto it = catalogs.find(catalog.GetOid());
+	if (it == catalogs.end()) {
+		return false;
+	}
+	auto &catalog_cache = it->second;
+	if (catalog_cache.catalog_version != version.GetIndex()) {
+		// A DDL statement bumped the catalog version - discard the cached entries
+		catalogs.erase(it);
+		return false;
+	}
+	auto entry = catalog_cache.entries.find(EntryKey(schema, lookup_info));
+	if (entry == catalog_cache.entries.end()) {
+		return false;
+	}
+	result = entry->second;
+	return true;
+}
+
+void CatalogEntryCache::InsertEntry(Catalog &catalog, ClientContext &context, const string &schema,
+                                    const EntryLookupInfo &lookup_info, SchemaCatalogEntry &schema_entry,
+                                    CatalogEntry &entry) {
+	const auto version = catalog.GetCatalogVersion(context);
+	if (!version.IsValid()) {
+		return;
+	}
+	auto &catalog_cache = catalogs[catalog.GetOid()];
+	if (catalog_cache.catalog_version != version.GetIndex()) {
+		catalog_cache.entries.clear();
+		catalog_cache.catalog_version = version.GetIndex();
+	}
+	if (catalog_cache.entries.size() >= MAXIMUM_ENTRIES) {
+		return;
+	}
+	catalog_cache.entries[EntryKey(schema, lookup_info)] = CachedEntry {&schema_entry, &entry};
+}
+
+} // namespace duckdb
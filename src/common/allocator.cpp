@@ -7,6 +7,7 @@
 #include "duckdb/common/numeric_utils.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
 #include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/common/types/vector_cache.hpp"
 
 #include <cstdint>
 
@@ -33,6 +34,12 @@
 #include <malloc.h>
 #endif
 
+#if defined(__linux__) && !defined(USE_JEMALLOC)
+#define DUCKDB_MALLOC_HUGE_PAGES
+#include <cstring>
+#include <sys/mman.h>
+#endif
+
 namespace duckdb {
 
 constexpr const idx_t Allocator::MAXIMUM_ALLOC_SIZE;
@@ -103,6 +110,28 @@ PrivateAllocatorData::PrivateAllocatorData() {
 PrivateAllocatorData::~PrivateAllocatorData() {
 }
 
+//===--------------------------------------------------------------------===//
+// Thread Allocation Counters
+//===--------------------------------------------------------------------===//
+//! The counters (if any) that allocations of the current thread are accounted against
+static thread_local ThreadAllocationCounters *thread_allocation_counters = nullptr;
+
+void Allocator::SetThreadAllocationCounters(ThreadAllocationCounters *counters) {
+	thread_allocation_counters = counters;
+}
+
+static inline void CountThreadAllocation(int64_t size_delta, uint64_t allocated) {
+	auto counters = thread_allocation_counters;
+	if (!counters) {
+		return;
+	}
+	counters->allocated_bytes += allocated;
+	counters->live_bytes += size_delta;
+	if (counters->live_bytes > counters->peak_live_bytes) {
+		counters->peak_live_bytes = counters->live_bytes;
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Allocator
 //===--------------------------------------------------------------------===//
@@ -126,6 +155,8 @@ Allocator::Allocator(allocate_function_ptr_t allocate_function_p, free_function_
 }
 
 Allocator::~Allocator() {
+	// release any vector cache buffers pooled for reuse before the allocator goes away
+	VectorCache::PurgePool(*this);
 }
 
 data_ptr_t Allocator::AllocateData(idx_t size) {
@@ -145,6 +176,7 @@ data_ptr_t Allocator::AllocateData(idx_t size) {
 	if (!result) {
 		throw OutOfMemoryException("Failed to allocate block of %llu bytes (bad allocation)", size);
 	}
+	CountThreadAllocation(NumericCast<int64_t>(size), size);
 	return result;
 }
 
@@ -160,6 +192,7 @@ void Allocator::FreeData(data_ptr_t pointer, idx_t size) {
 	}
 #endif
 	free_function(private_data.get(), pointer, size);
+	CountThreadAllocation(-NumericCast<int64_t>(size), 0);
 }
 
 data_ptr_t Allocator::ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t size) {
@@ -182,13 +215,67 @@ data_ptr_t Allocator::ReallocateData(data_ptr_t pointer, idx_t old_size, idx_t s
 	if (!new_pointer) {
 		throw OutOfMemoryException("Failed to re-allocate block of %llu bytes (bad allocation)", size);
 	}
+	CountThreadAllocation(NumericCast<int64_t>(size) - NumericCast<int64_t>(old_size), size);
 	return new_pointer;
 }
 
+//===--------------------------------------------------------------------===//
+// Huge Page Allocations
+//===--------------------------------------------------------------------===//
+#ifdef DUCKDB_MALLOC_HUGE_PAGES
+//! Allocations of at least this size get their own anonymous mapping, advised to use transparent huge pages.
+//! This covers large hash table and sort buffer allocations, which are the main source of TLB misses.
+static constexpr idx_t HUGE_PAGE_THRESHOLD = 1ULL << 21; // 2MB, the (usual) transparent huge page size
+//! The number of bytes currently mapped with a huge page advice
+static atomic<idx_t> HUGE_PAGE_MAPPED_BYTES {0};
+
+static inline idx_t HugePageRoundedSize(idx_t size) {
+	return (size + HUGE_PAGE_THRESHOLD - 1) & ~(HUGE_PAGE_THRESHOLD - 1);
+}
+
+static data_ptr_t HugePageAllocate(idx_t size) {
+	auto rounded_size = HugePageRoundedSize(size);
+	auto ptr = mmap(nullptr, rounded_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (ptr == MAP_FAILED) {
+		return nullptr;
+	}
+#ifdef MADV_HUGEPAGE
+	// ask the kernel to back this mapping with huge pages
+	// if the advice is not honored we still have a working (4KB-backed) mapping
+	madvise(ptr, rounded_size, MADV_HUGEPAGE);
+#endif
+	HUGE_PAGE_MAPPED_BYTES += rounded_size;
+	return data_ptr_cast(ptr);
+}
+
+static void HugePageFree(data_ptr_t pointer, idx_t size) {
+	auto rounded_size = HugePageRoundedSize(size);
+	munmap(pointer, rounded_size);
+	HUGE_PAGE_MAPPED_BYTES -= rounded_size;
+}
+#endif
+
+idx_t Allocator::HugePageBytes() {
+#ifdef DUCKDB_MALLOC_HUGE_PAGES
+	return HUGE_PAGE_MAPPED_BYTES.load(std::memory_order_relaxed);
+#else
+	return 0;
+#endif
+}
+
 data_ptr_t Allocator::DefaultAllocate(PrivateAllocatorData *private_data, idx_t size) {
 #ifdef USE_JEMALLOC
 	return JemallocExtension::Allocate(private_data, size);
 #else
+#ifdef DUCKDB_MALLOC_HUGE_PAGES
+	if (size >= HUGE_PAGE_THRESHOLD) {
+		auto huge_page_result = HugePageAllocate(size);
+		if (!huge_page_result) {
+			throw std::bad_alloc();
+		}
+		return huge_page_result;
+	}
+#endif
 	auto default_allocate_result = malloc(size);
 	if (!default_allocate_result) {
 		throw std::bad_alloc();
@@ -201,6 +288,12 @@ void Allocator::DefaultFree(PrivateAllocatorData *private_data, data_ptr_t point
 #ifdef USE_JEMALLOC
 	JemallocExtension::Free(private_data, pointer, size);
 #else
+#ifdef DUCKDB_MALLOC_HUGE_PAGES
+	if (size >= HUGE_PAGE_THRESHOLD) {
+		HugePageFree(pointer, size);
+		return;
+	}
+#endif
 	free(pointer);
 #endif
 }
@@ -210,6 +303,19 @@ data_ptr_t Allocator::DefaultReallocate(PrivateAllocatorData *private_data, data
 #ifdef USE_JEMALLOC
 	return JemallocExtension::Reallocate(private_data, pointer, old_size, size);
 #else
+#ifdef DUCKDB_MALLOC_HUGE_PAGES
+	if (old_size >= HUGE_PAGE_THRESHOLD || size >= HUGE_PAGE_THRESHOLD) {
+		if (old_size >= HUGE_PAGE_THRESHOLD && size >= HUGE_PAGE_THRESHOLD &&
+		    HugePageRoundedSize(old_size) == HugePageRoundedSize(size)) {
+			// the existing mapping already has enough room
+			return pointer;
+		}
+		auto new_pointer = DefaultAllocate(private_data, size);
+		memcpy(new_pointer, pointer, MinValue<idx_t>(old_size, size));
+		DefaultFree(private_data, pointer, old_size);
+		return new_pointer;
+	}
+#endif
 	return data_ptr_cast(realloc(pointer, size));
 #endif
 }
@@ -289,6 +395,24 @@ void Allocator::SetBackgroundThreads(bool enable) {
 #endif
 }
 
+void Allocator::SetDecay(int64_t dirty_decay_ms, int64_t muzzy_decay_ms) {
+#ifdef USE_JEMALLOC
+	JemallocExtension::SetDecay(dirty_decay_ms, muzzy_decay_ms);
+#endif
+}
+
+vector<AllocatorStatsEntry> Allocator::GetAllocatorStats() {
+#ifdef USE_JEMALLOC
+	return JemallocExtension::GetStats();
+#else
+	vector<AllocatorStatsEntry> result;
+#ifdef DUCKDB_MALLOC_HUGE_PAGES
+	result.push_back({"huge_page_mapped_bytes", HugePageBytes()});
+#endif
+	return result;
+#endif
+}
+
 //===--------------------------------------------------------------------===//
 // Debug Info (extended)
 //===--------------------------------------------------------------------===//
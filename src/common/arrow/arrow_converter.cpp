@@ -1,3 +1,4 @@
+#include "duckdb/common/array.hpp"
 #include "duckdb/common/types/data_chunk.hpp"
 #include "duckdb/common/types/bit.hpp"
 #include "duckdb/common/arrow/arrow.hpp"
@@ -16,9 +17,146 @@
 #include "duckdb/main/client_context.hpp"
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// Zero-Copy Export
+//===--------------------------------------------------------------------===//
+//! Keeps the vector buffer and validity data of a zero-copy exported column alive until the Arrow
+//! consumer releases the ArrowArray
+struct ArrowZeroCopyChildHolder {
+	buffer_ptr<VectorBuffer> data_buffer;
+	ValidityMask validity;
+	array<const void *, 2> buffers;
+};
+
+struct ArrowZeroCopyRootHolder {
+	vector<ArrowArray> child_arrays;
+	vector<ArrowArray *> child_pointers;
+	//! The root is a struct array without nulls, but it still needs a validity buffer slot
+	array<const void *, 1> buffers = {{nullptr}};
+};
+
+static void ReleaseZeroCopyChild(ArrowArray *array) {
+	if (!array || !array->release) {
+		return;
+	}
+	array->release = nullptr;
+	delete static_cast<ArrowZeroCopyChildHolder *>(array->private_data);
+}
+
+static void ReleaseZeroCopyRoot(ArrowArray *array) {
+	if (!array || !array->release) {
+		return;
+	}
+	for (int64_t i = 0; i < array->n_children; i++) {
+		auto child = array->children[i];
+		if (child->release) {
+			child->release(child);
+		}
+	}
+	array->release = nullptr;
+	delete static_cast<ArrowZeroCopyRootHolder *>(array->private_data);
+}
+
+//! Returns whether the vector's in-memory representation is byte-identical to the Arrow representation,
+//! so that its buffer can be handed to the ArrowArray directly instead of being copied
+static bool SupportsZeroCopy(Vector &vec) {
+	switch (vec.GetType().id()) {
+	case LogicalTypeId::TINYINT:
+	case LogicalTypeId::SMALLINT:
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::DATE:
+	case LogicalTypeId::TIME:
+	case LogicalTypeId::TIMESTAMP_SEC:
+	case LogicalTypeId::TIMESTAMP_MS:
+	case LogicalTypeId::TIMESTAMP:
+	case LogicalTypeId::TIMESTAMP_NS:
+	case LogicalTypeId::TIMESTAMP_TZ:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::HUGEINT:
+	case LogicalTypeId::UHUGEINT:
+	case LogicalTypeId::UTINYINT:
+	case LogicalTypeId::USMALLINT:
+	case LogicalTypeId::UINTEGER:
+	case LogicalTypeId::UBIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		break;
+	default:
+		// e.g. booleans are bit-packed in Arrow, and strings/nested types use different layouts
+		return false;
+	}
+	if (vec.GetVectorType() != VectorType::FLAT_VECTOR) {
+		return false;
+	}
+	auto buffer = vec.GetBuffer();
+	if (!buffer || buffer->GetBufferType() != VectorBufferType::STANDARD_BUFFER) {
+		return false;
+	}
+	// the data must live in the buffer we hold a reference to - not in externally owned memory
+	return FlatVector::GetData(vec) == buffer->GetData();
+}
+
+static void ToArrowArrayZeroCopy(DataChunk &input, ArrowArray *out_array) {
+	auto root_holder = make_uniq<ArrowZeroCopyRootHolder>();
+	root_holder->child_arrays.resize(input.ColumnCount());
+	root_holder->child_pointers.resize(input.ColumnCount());
+
+	for (idx_t i = 0; i < input.ColumnCount(); i++) {
+		auto &vec = input.data[i];
+		auto child_holder = make_uniq<ArrowZeroCopyChildHolder>();
+		child_holder->data_buffer = vec.GetBuffer();
+		child_holder->validity = FlatVector::Validity(vec);
+
+		auto &child = root_holder->child_arrays[i];
+		child.length = NumericCast<int64_t>(input.size());
+		child.offset = 0;
+		child.n_children = 0;
+		child.children = nullptr;
+		child.dictionary = nullptr;
+		child.n_buffers = 2;
+		if (child_holder->validity.AllValid()) {
+			child.null_count = 0;
+			child_holder->buffers[0] = nullptr;
+		} else {
+			// DuckDB and Arrow use the same validity bitmask layout, so this buffer is shared as well
+			child.null_count = NumericCast<int64_t>(input.size() - child_holder->validity.CountValid(input.size()));
+			child_holder->buffers[0] = child_holder->validity.GetData();
+		}
+		child_holder->buffers[1] = FlatVector::GetData(vec);
+		child.buffers = child_holder->buffers.data();
+		child.private_data = child_holder.release();
+		child.release = ReleaseZeroCopyChild;
+		root_holder->child_pointers[i] = &child;
+	}
+
+	out_array->length = NumericCast<int64_t>(input.size());
+	out_array->offset = 0;
+	out_array->null_count = 0;
+	out_array->n_children = NumericCast<int64_t>(input.ColumnCount());
+	out_array->children = root_holder->child_pointers.data();
+	out_array->n_buffers = 1;
+	out_array->buffers = root_holder->buffers.data();
+	out_array->dictionary = nullptr;
+	out_array->private_data = root_holder.release();
+	out_array->release = ReleaseZeroCopyRoot;
+}
+
 void ArrowConverter::ToArrowArray(
     DataChunk &input, ArrowArray *out_array, ClientProperties options,
     const unordered_map<idx_t, const shared_ptr<ArrowTypeExtensionData>> &extension_type_cast) {
+	if (options.arrow_zero_copy_export && extension_type_cast.empty() && input.ColumnCount() != 0) {
+		bool zero_copy = true;
+		for (idx_t i = 0; i < input.ColumnCount(); i++) {
+			if (!SupportsZeroCopy(input.data[i])) {
+				zero_copy = false;
+				break;
+			}
+		}
+		if (zero_copy) {
+			ToArrowArrayZeroCopy(input, out_array);
+			return;
+		}
+	}
 	ArrowAppender appender(input.GetTypes(), input.size(), std::move(options), extension_type_cast);
 	appender.Append(input, 0, input.size(), input.size());
 	*out_array = appender.Finalize();
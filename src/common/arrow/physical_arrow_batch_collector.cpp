@@ -14,6 +14,7 @@ unique_ptr<GlobalSinkState> PhysicalArrowBatchCollector::GetGlobalSinkState(Clie
 SinkFinalizeType PhysicalArrowBatchCollector::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                        OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<ArrowBatchGlobalState>();
+	gstate.GatherPartitions();
 
 	auto total_tuple_count = gstate.data.Count();
 	if (total_tuple_count == 0) {
@@ -66,11 +66,24 @@ hash_t ChecksumRemainder(void *ptr, size_t len) noexcept {
 
 uint64_t Checksum(uint8_t *buffer, size_t size) {
 	uint64_t result = 5381;
-	uint64_t *ptr = reinterpret_cast<uint64_t *>(buffer);
-	size_t i;
+	const size_t n_words = size / 8;
+	size_t i = 0;
 	// for efficiency, we first checksum uint64_t values
-	for (i = 0; i < size / 8; i++) {
-		result ^= Checksum(ptr[i]);
+	// XOR accumulation is order-independent, so we can fold four independent lanes and still compute the exact
+	// same checksum - this breaks the dependency chain between iterations and lets the compiler vectorize
+	uint64_t lane0 = 0;
+	uint64_t lane1 = 0;
+	uint64_t lane2 = 0;
+	uint64_t lane3 = 0;
+	for (; i + 4 <= n_words; i += 4) {
+		lane0 ^= Checksum(Load<uint64_t>(buffer + i * 8));
+		lane1 ^= Checksum(Load<uint64_t>(buffer + (i + 1) * 8));
+		lane2 ^= Checksum(Load<uint64_t>(buffer + (i + 2) * 8));
+		lane3 ^= Checksum(Load<uint64_t>(buffer + (i + 3) * 8));
+	}
+	result ^= lane0 ^ lane1 ^ lane2 ^ lane3;
+	for (; i < n_words; i++) {
+		result ^= Checksum(Load<uint64_t>(buffer + i * 8));
 	}
 	if (size - i * 8 > 0) {
 		// the remaining 0-7 bytes we hash using a string hash
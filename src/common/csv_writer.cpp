@@ -31,12 +31,11 @@ CSVWriterState::~CSVWriterState() {
 }
 
 CSVWriterOptions::CSVWriterOptions(const string &delim, const char &quote, const string &write_newline) {
-	requires_quotes = vector<bool>(256, false);
-	requires_quotes['\n'] = true;
-	requires_quotes['\r'] = true;
-	requires_quotes['#'] = true;
-	requires_quotes[NumericCast<idx_t>(delim[0])] = true;
-	requires_quotes[NumericCast<idx_t>(quote)] = true;
+	for (auto c : {'\n', '\r', '#', delim[0], quote}) {
+		if (quote_characters.find(c) == string::npos) {
+			quote_characters += c;
+		}
+	}
 
 	if (!write_newline.empty()) {
 		newline = TransformNewLine(write_newline);
@@ -249,15 +248,33 @@ string CSVWriter::AddEscapes(char to_be_escaped, char escape, const string &val)
 	return new_val;
 }
 
-bool CSVWriter::RequiresQuotes(const char *str, idx_t len, const string &null_str,
-                               const vector<bool> &requires_quotes) {
+static inline uint64_t BroadcastByte(const uint8_t value) {
+	return 0x0101010101010101ULL * value;
+}
+
+static inline bool ContainsZeroByte(const uint64_t value) {
+	return (value - 0x0101010101010101ULL) & ~value & 0x8080808080808080ULL;
+}
+
+bool CSVWriter::RequiresQuotes(const char *str, idx_t len, const string &null_str, const string &quote_characters) {
 	// check if the string is equal to the null string
 	if (len == null_str.size() && memcmp(str, null_str.c_str(), len) == 0) {
 		return true;
 	}
+	// scan eight bytes at a time, testing for all bytes that require quotes in a single pass
 	auto str_data = const_data_ptr_cast(str);
-	for (idx_t i = 0; i < len; i++) {
-		if (requires_quotes[str_data[i]]) {
+	idx_t i = 0;
+	for (; i + sizeof(uint64_t) <= len; i += sizeof(uint64_t)) {
+		const auto word = Load<uint64_t>(str_data + i);
+		for (const auto c : quote_characters) {
+			if (ContainsZeroByte(word ^ BroadcastByte(static_cast<uint8_t>(c)))) {
+				// this byte requires quotes - write a quoted string
+				return true;
+			}
+		}
+	}
+	for (; i < len; i++) {
+		if (quote_characters.find(str[i]) != string::npos) {
 			// this byte requires quotes - write a quoted string
 			return true;
 		}
@@ -270,28 +287,23 @@ bool CSVWriter::RequiresQuotes(const char *str, idx_t len, const string &null_st
 void CSVWriter::WriteQuotedString(WriteStream &writer, const char *str, idx_t len, idx_t col_idx,
                                   CSVReaderOptions &options, CSVWriterOptions &writer_options) {
 	WriteQuotedString(writer, str, len, options.force_quote[col_idx], options.null_str[0],
-	                  writer_options.requires_quotes, options.dialect_options.state_machine_options.quote.GetValue(),
+	                  writer_options.quote_characters, options.dialect_options.state_machine_options.quote.GetValue(),
 	                  options.dialect_options.state_machine_options.escape.GetValue());
 }
 
 void CSVWriter::WriteQuotedString(WriteStream &writer, const char *str, idx_t len, bool force_quote,
-                                  const string &null_str, const vector<bool> &requires_quotes, char quote,
-                                  char escape) {
+                                  const string &null_str, const string &quote_characters, char quote, char escape) {
 	if (!force_quote) {
 		// force quote is disabled: check if we need to add quotes anyway
-		force_quote = RequiresQuotes(str, len, null_str, requires_quotes);
+		force_quote = RequiresQuotes(str, len, null_str, quote_characters);
 	}
 	// If a quote is set to none (i.e., null-terminator) we skip the quotation
 	if (force_quote && quote != '\0') {
 		// quoting is enabled: we might need to escape things in the string
-		bool requires_escape = false;
-		// simple CSV
-		// do a single loop to check for a quote or escape value
-		for (idx_t i = 0; i < len; i++) {
-			if (str[i] == quote || str[i] == escape) {
-				requires_escape = true;
-				break;
-			}
+		// check for a quote or escape value
+		bool requires_escape = memchr(str, quote, len) != nullptr;
+		if (!requires_escape && escape != quote) {
+			requires_escape = memchr(str, escape, len) != nullptr;
 		}
 
 		if (!requires_escape) {
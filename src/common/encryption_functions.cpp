@@ -33,6 +33,28 @@ idx_t EncryptionNonce::size() const {
 EncryptionEngine::EncryptionEngine() {
 }
 
+//! Per-thread cache of the last-used cipher state, so that repeated block encryption/decryption on the same
+//! thread reuses the cipher context instead of allocating a fresh one for every block
+struct CachedEncryptionState {
+	shared_ptr<EncryptionUtil> util;
+	EncryptionTypes::CipherType cipher = EncryptionTypes::INVALID;
+	idx_t key_len = 0;
+	shared_ptr<EncryptionState> state;
+};
+
+static EncryptionState &GetEncryptionState(DatabaseInstance &db, EncryptionTypes::CipherType cipher, idx_t key_len) {
+	static thread_local CachedEncryptionState cache;
+	auto util = db.GetEncryptionUtil();
+	if (cache.state && cache.util.get() == util.get() && cache.cipher == cipher && cache.key_len == key_len) {
+		return *cache.state;
+	}
+	cache.state = util->CreateEncryptionState(cipher, key_len);
+	cache.util = std::move(util);
+	cache.cipher = cipher;
+	cache.key_len = key_len;
+	return *cache.state;
+}
+
 const_data_ptr_t EncryptionEngine::GetKeyFromCache(DatabaseInstance &db, const string &key_name) {
 	auto &keys = EncryptionKeyManager::Get(db);
 	return keys.GetKey(key_name);
@@ -85,31 +107,31 @@ void EncryptionEngine::EncryptBlock(AttachedDatabase &attached_db, const string
 	auto &db = attached_db.GetDatabase();
 	data_ptr_t block_offset_internal = temp_buffer_manager.InternalBuffer();
 	auto encrypt_key = GetKeyFromCache(db, key_id);
-	auto encryption_state = db.GetEncryptionUtil()->CreateEncryptionState(attached_db.GetStorageManager().GetCipher(),
-	                                                                      MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
+	auto &encryption_state = GetEncryptionState(db, attached_db.GetStorageManager().GetCipher(),
+	                                            MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
 
 	EncryptionTag tag;
 	EncryptionNonce nonce;
-	encryption_state->GenerateRandomData(nonce.data(), nonce.size());
+	encryption_state.GenerateRandomData(nonce.data(), nonce.size());
 
 	//! store the nonce at the start of the block
 	memcpy(block_offset_internal, nonce.data(), nonce.size());
-	encryption_state->InitializeEncryption(nonce.data(), nonce.size(), encrypt_key,
-	                                       MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
+	encryption_state.InitializeEncryption(nonce.data(), nonce.size(), encrypt_key,
+	                                      MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
 
 	auto checksum_offset = block.InternalBuffer() + delta;
 	auto encryption_checksum_offset = block_offset_internal + delta;
 	auto size = block.size + Storage::DEFAULT_BLOCK_HEADER_SIZE;
 
 	//! encrypt the data including the checksum
-	auto aes_res = encryption_state->Process(checksum_offset, size, encryption_checksum_offset, size);
+	auto aes_res = encryption_state.Process(checksum_offset, size, encryption_checksum_offset, size);
 
 	if (aes_res != size) {
 		throw IOException("Block encryption failure: in- and output size differ (%llu/%llu)", size, aes_res);
 	}
 
 	//! Finalize and extract the tag
-	encryption_state->Finalize(block.InternalBuffer() + delta, 0, tag.data(), tag.size());
+	encryption_state.Finalize(block.InternalBuffer() + delta, 0, tag.data(), tag.size());
 
 	//! store the generated tag *behind* the nonce (but still at the beginning of the block)
 	memcpy(block_offset_internal + nonce.size(), tag.data(), tag.size());
@@ -121,8 +143,8 @@ void EncryptionEngine::DecryptBlock(AttachedDatabase &attached_db, const string
 	auto &db = attached_db.GetDatabase();
 
 	auto decrypt_key = GetKeyFromCache(db, key_id);
-	auto encryption_state = db.GetEncryptionUtil()->CreateEncryptionState(attached_db.GetStorageManager().GetCipher(),
-	                                                                      MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
+	auto &encryption_state = GetEncryptionState(db, attached_db.GetStorageManager().GetCipher(),
+	                                            MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
 
 	//! load the stored nonce and tag
 	EncryptionTag tag;
@@ -131,21 +153,21 @@ void EncryptionEngine::DecryptBlock(AttachedDatabase &attached_db, const string
 	memcpy(tag.data(), internal_buffer + nonce.size(), tag.size());
 
 	//! Initialize the decryption
-	encryption_state->InitializeDecryption(nonce.data(), nonce.size(), decrypt_key,
-	                                       MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
+	encryption_state.InitializeDecryption(nonce.data(), nonce.size(), decrypt_key,
+	                                      MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
 
 	auto checksum_offset = internal_buffer + delta;
 	auto size = block_size + Storage::DEFAULT_BLOCK_HEADER_SIZE;
 
 	//! decrypt the block including the checksum
-	auto aes_res = encryption_state->Process(checksum_offset, size, checksum_offset, size);
+	auto aes_res = encryption_state.Process(checksum_offset, size, checksum_offset, size);
 
 	if (aes_res != block_size + Storage::DEFAULT_BLOCK_HEADER_SIZE) {
 		throw IOException("Block decryption failure: in- and output size differ (%llu/%llu)", size, aes_res);
 	}
 
 	//! check the tag
-	encryption_state->Finalize(internal_buffer + delta, 0, tag.data(), tag.size());
+	encryption_state.Finalize(internal_buffer + delta, 0, tag.data(), tag.size());
 }
 
 void EncryptionEngine::EncryptTemporaryBuffer(DatabaseInstance &db, data_ptr_t buffer, idx_t buffer_size,
@@ -156,10 +178,8 @@ void EncryptionEngine::EncryptTemporaryBuffer(DatabaseInstance &db, data_ptr_t b
 
 	auto temp_key = GetKeyFromCache(db, "temp_key");
 
-	auto encryption_util = db.GetEncryptionUtil();
 	// we hard-code GCM here for now, it's the safest and we don't know what is configured here
-	auto encryption_state =
-	    encryption_util->CreateEncryptionState(EncryptionTypes::GCM, MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
+	auto &encryption_state = GetEncryptionState(db, EncryptionTypes::GCM, MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
 
 	// zero-out the metadata buffer
 	memset(metadata, 0, DEFAULT_ENCRYPTED_BUFFER_HEADER_SIZE);
@@ -167,15 +187,15 @@ void EncryptionEngine::EncryptTemporaryBuffer(DatabaseInstance &db, data_ptr_t b
 	EncryptionTag tag;
 	EncryptionNonce nonce;
 
-	encryption_state->GenerateRandomData(nonce.data(), nonce.size());
+	encryption_state.GenerateRandomData(nonce.data(), nonce.size());
 
 	//! store the nonce at the start of metadata buffer
 	memcpy(metadata, nonce.data(), nonce.size());
 
-	encryption_state->InitializeEncryption(nonce.data(), nonce.size(), temp_key,
-	                                       MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
+	encryption_state.InitializeEncryption(nonce.data(), nonce.size(), temp_key,
+	                                      MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
 
-	auto aes_res = encryption_state->Process(buffer, buffer_size, buffer, buffer_size);
+	auto aes_res = encryption_state.Process(buffer, buffer_size, buffer, buffer_size);
 
 	if (aes_res != buffer_size) {
 		throw IOException("Temporary buffer encryption failure: in- and output size differ (%llu/%llu)", buffer_size,
@@ -183,7 +203,7 @@ void EncryptionEngine::EncryptTemporaryBuffer(DatabaseInstance &db, data_ptr_t b
 	}
 
 	//! Finalize and extract the tag
-	encryption_state->Finalize(buffer, 0, tag.data(), tag.size());
+	encryption_state.Finalize(buffer, 0, tag.data(), tag.size());
 
 	//! store the generated tag after consequetively the nonce
 	memcpy(metadata + nonce.size(), tag.data(), tag.size());
@@ -217,12 +237,10 @@ static void DecryptBuffer(EncryptionState &encryption_state, const_data_ptr_t te
 void EncryptionEngine::DecryptTemporaryBuffer(DatabaseInstance &db, data_ptr_t buffer, idx_t buffer_size,
                                               data_ptr_t metadata) {
 	//! initialize encryption state
-	auto encryption_util = db.GetEncryptionUtil();
 	auto temp_key = GetKeyFromCache(db, "temp_key");
-	auto encryption_state =
-	    encryption_util->CreateEncryptionState(EncryptionTypes::GCM, MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
+	auto &encryption_state = GetEncryptionState(db, EncryptionTypes::GCM, MainHeader::DEFAULT_ENCRYPTION_KEY_LENGTH);
 
-	DecryptBuffer(*encryption_state, temp_key, buffer, buffer_size, metadata);
+	DecryptBuffer(encryption_state, temp_key, buffer, buffer_size, metadata);
 }
 
 } // namespace duckdb
@@ -340,24 +340,15 @@ LogicalType EnumTypeInfo::CreateType(Vector &ordered_data, idx_t size) {
 	return LogicalType(LogicalTypeId::ENUM, info);
 }
 
-template <class T>
-int64_t TemplatedGetPos(const string_map_t<T> &map, const string_t &key) {
-	auto it = map.find(key);
-	if (it == map.end()) {
-		return -1;
-	}
-	return it->second;
-}
-
 int64_t EnumType::GetPos(const LogicalType &type, const string_t &key) {
 	auto info = type.AuxInfo();
 	switch (type.InternalType()) {
 	case PhysicalType::UINT8:
-		return TemplatedGetPos(info->Cast<EnumTypeInfoTemplated<uint8_t>>().GetValues(), key);
+		return info->Cast<EnumTypeInfoTemplated<uint8_t>>().GetPos(key);
 	case PhysicalType::UINT16:
-		return TemplatedGetPos(info->Cast<EnumTypeInfoTemplated<uint16_t>>().GetValues(), key);
+		return info->Cast<EnumTypeInfoTemplated<uint16_t>>().GetPos(key);
 	case PhysicalType::UINT32:
-		return TemplatedGetPos(info->Cast<EnumTypeInfoTemplated<uint32_t>>().GetValues(), key);
+		return info->Cast<EnumTypeInfoTemplated<uint32_t>>().GetPos(key);
 	default:
 		throw InternalException("ENUM can only have unsigned integers (except UINT64) as physical types");
 	}
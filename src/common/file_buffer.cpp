@@ -31,6 +31,8 @@ void FileBuffer::Init() {
 	size = 0;
 	internal_buffer = nullptr;
 	internal_size = 0;
+	malloc_ptr = nullptr;
+	malloc_size = 0;
 }
 
 FileBuffer::FileBuffer(FileBuffer &source, FileBufferType type_p, idx_t block_header_size)
@@ -40,23 +42,33 @@ FileBuffer::FileBuffer(FileBuffer &source, FileBufferType type_p, idx_t block_he
 	size = source.internal_size - block_header_size;
 	internal_buffer = source.internal_buffer;
 	internal_size = source.internal_size;
+	malloc_ptr = source.malloc_ptr;
+	malloc_size = source.malloc_size;
 
 	source.Init();
 }
 
 FileBuffer::~FileBuffer() {
-	if (!internal_buffer) {
+	if (!malloc_ptr) {
 		return;
 	}
-	allocator.FreeData(internal_buffer, internal_size);
+	allocator.FreeData(malloc_ptr, malloc_size);
 }
 
 void FileBuffer::ReallocBuffer(idx_t new_size) {
+	// over-allocate by a sector so internal_buffer can be sector-aligned within the allocation
+	// DIRECT_IO requires the buffer address - not just the buffer size - to be sector-aligned
+	// tiny buffers are never used for IO and are allocated without the padding
+	idx_t padding = type == FileBufferType::TINY_BUFFER ? 0 : Storage::SECTOR_SIZE;
+	auto old_offset = malloc_ptr ? UnsafeNumericCast<idx_t>(internal_buffer - malloc_ptr) : 0;
+	auto old_internal_size = internal_size;
+
+	auto alloc_size = new_size + padding;
 	data_ptr_t new_buffer;
-	if (internal_buffer) {
-		new_buffer = allocator.ReallocateData(internal_buffer, internal_size, new_size);
+	if (malloc_ptr) {
+		new_buffer = allocator.ReallocateData(malloc_ptr, malloc_size, alloc_size);
 	} else {
-		new_buffer = allocator.AllocateData(new_size);
+		new_buffer = allocator.AllocateData(alloc_size);
 	}
 
 	// FIXME: should we throw one of our exceptions here?
@@ -64,7 +76,19 @@ void FileBuffer::ReallocBuffer(idx_t new_size) {
 		throw std::bad_alloc();
 	}
 
-	internal_buffer = new_buffer;
+	malloc_ptr = new_buffer;
+	malloc_size = alloc_size;
+	if (padding == 0) {
+		internal_buffer = malloc_ptr;
+	} else {
+		internal_buffer = reinterpret_cast<data_ptr_t>(
+		    AlignValue<uintptr_t, Storage::SECTOR_SIZE>(reinterpret_cast<uintptr_t>(malloc_ptr)));
+		auto new_offset = UnsafeNumericCast<idx_t>(internal_buffer - malloc_ptr);
+		if (old_internal_size > 0 && new_offset != old_offset) {
+			// the alignment offset shifted after reallocation - move the contents to the new aligned position
+			memmove(internal_buffer, malloc_ptr + old_offset, MinValue<idx_t>(old_internal_size, new_size));
+		}
+	}
 	internal_size = new_size;
 
 	// The caller must update these.
@@ -419,11 +419,11 @@ unique_ptr<StreamWrapper> GZipFileSystem::CreateStream() {
 }
 
 idx_t GZipFileSystem::InBufferSize() {
-	return BUFFER_SIZE;
+	return IN_BUFFER_SIZE;
 }
 
 idx_t GZipFileSystem::OutBufferSize() {
-	return BUFFER_SIZE;
+	return OUT_BUFFER_SIZE;
 }
 
 } // namespace duckdb
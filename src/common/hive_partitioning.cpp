@@ -164,33 +164,73 @@ void HivePartitioning::ApplyFiltersToFileList(ClientContext &context, vector<Ope
 		return;
 	}
 
+	// files in the same partition directory share their known column values, so the (expensive)
+	// filter evaluation is memoized per distinct set of values - pruning a dataset then costs
+	// one evaluation per partition instead of one per file
+	// when the filename column itself is filtered on, every file has distinct values and the
+	// memoization simply never hits
+	enum class PartitionFilterResult : uint8_t { PASS, PRESERVE, PRUNE };
+	unordered_map<string, vector<PartitionFilterResult>> partition_results;
+
 	for (idx_t i = 0; i < files.size(); i++) {
 		auto &file = files[i];
 		bool should_prune_file = false;
 		auto known_values = GetKnownColumnValues(file.path, filter_info);
 
+		// build a deterministic key for this set of partition values
+		vector<column_t> known_columns;
+		known_columns.reserve(known_values.size());
+		for (auto &entry : known_values) {
+			known_columns.push_back(entry.first);
+		}
+		std::sort(known_columns.begin(), known_columns.end());
+		string partition_key;
+		for (auto &column_id : known_columns) {
+			auto &partition_val = known_values.find(column_id)->second;
+			partition_key += to_string(column_id) + "\x1f" + partition_val.key + "\x1f" + partition_val.value + "\x1e";
+		}
+
+		auto entry = partition_results.find(partition_key);
+		if (entry == partition_results.end()) {
+			vector<PartitionFilterResult> results(filters.size(), PartitionFilterResult::PASS);
+			for (idx_t j = 0; j < filters.size(); j++) {
+				auto &filter = filters[j];
+				unique_ptr<Expression> filter_copy = filter->Copy();
+				ConvertKnownColRefToConstants(context, filter_copy, known_values, table_index);
+				// Evaluate the filter, if it can be evaluated here, we can not prune this filter
+				Value result_value;
+
+				if (!filter_copy->IsScalar() || !filter_copy->IsFoldable() ||
+				    !ExpressionExecutor::TryEvaluateScalar(context, *filter_copy, result_value)) {
+					// can not be evaluated only with the filename/hive columns added, we can not prune this filter
+					results[j] = PartitionFilterResult::PRESERVE;
+				} else if (result_value.IsNull() || !result_value.GetValue<bool>()) {
+					// filter evaluates to false
+					results[j] = PartitionFilterResult::PRUNE;
+				}
+			}
+			entry = partition_results.insert(make_pair(std::move(partition_key), std::move(results))).first;
+		}
+
+		auto &results = entry->second;
 		for (idx_t j = 0; j < filters.size(); j++) {
-			auto &filter = filters[j];
-			unique_ptr<Expression> filter_copy = filter->Copy();
-			ConvertKnownColRefToConstants(context, filter_copy, known_values, table_index);
-			// Evaluate the filter, if it can be evaluated here, we can not prune this filter
-			Value result_value;
-
-			if (!filter_copy->IsScalar() || !filter_copy->IsFoldable() ||
-			    !ExpressionExecutor::TryEvaluateScalar(context, *filter_copy, result_value)) {
-				// can not be evaluated only with the filename/hive columns added, we can not prune this filter
+			switch (results[j]) {
+			case PartitionFilterResult::PRESERVE:
 				if (!have_preserved_filter[j]) {
-					pruned_filters.emplace_back(filter->Copy());
+					pruned_filters.emplace_back(filters[j]->Copy());
 					have_preserved_filter[j] = true;
 				}
-			} else if (result_value.IsNull() || !result_value.GetValue<bool>()) {
-				// filter evaluates to false
+				break;
+			case PartitionFilterResult::PRUNE:
 				should_prune_file = true;
 				// convert the filter to a table filter.
 				if (filters_applied_to_files.find(j) == filters_applied_to_files.end()) {
-					info.extra_info.file_filters += filter->ToString();
+					info.extra_info.file_filters += filters[j]->ToString();
 					filters_applied_to_files.insert(j);
 				}
+				break;
+			default:
+				break;
 			}
 		}
 
@@ -866,6 +866,9 @@ bool MultiFileColumnMapper::EvaluateFilterAgainstConstant(TableFilter &filter, c
 		auto &expr_filter = filter.Cast<ExpressionFilter>();
 		return expr_filter.EvaluateWithConstant(context, constant);
 	}
+	case TableFilterType::BLOOM_FILTER:
+		// we cannot cheaply evaluate the bloom filter against a constant here - assume it passes
+		return true;
 	default:
 		throw NotImplementedException("Can't evaluate TableFilterType (%s) against a constant",
 		                              EnumUtil::ToString(type));
@@ -1022,6 +1025,7 @@ static unique_ptr<TableFilter> TryCastTableFilter(const TableFilter &global_filt
 		return make_uniq<InFilter>(std::move(in_list));
 	}
 	case TableFilterType::EXPRESSION_FILTER:
+	case TableFilterType::BLOOM_FILTER:
 		// unsupported
 		return nullptr;
 	default:
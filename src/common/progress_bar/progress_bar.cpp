@@ -8,12 +8,16 @@ void QueryProgress::Initialize() {
 	percentage = -1;
 	rows_processed = 0;
 	total_rows_to_process = 0;
+	completed_pipelines = 0;
+	total_pipelines = 0;
 }
 
 void QueryProgress::Restart() {
 	percentage = 0;
 	rows_processed = 0;
 	total_rows_to_process = 0;
+	completed_pipelines = 0;
+	total_pipelines = 0;
 }
 
 double QueryProgress::GetPercentage() {
@@ -25,6 +29,12 @@ uint64_t QueryProgress::GetRowsProcesseed() {
 uint64_t QueryProgress::GetTotalRowsToProcess() {
 	return total_rows_to_process;
 }
+uint64_t QueryProgress::GetCompletedPipelines() {
+	return completed_pipelines;
+}
+uint64_t QueryProgress::GetTotalPipelines() {
+	return total_pipelines;
+}
 
 QueryProgress::QueryProgress() {
 	Initialize();
@@ -35,6 +45,8 @@ QueryProgress &QueryProgress::operator=(const QueryProgress &other) {
 		percentage = other.percentage.load();
 		rows_processed = other.rows_processed.load();
 		total_rows_to_process = other.total_rows_to_process.load();
+		completed_pipelines = other.completed_pipelines.load();
+		total_pipelines = other.total_pipelines.load();
 	}
 	return *this;
 }
@@ -43,6 +55,8 @@ QueryProgress::QueryProgress(const QueryProgress &other) {
 	percentage = other.percentage.load();
 	rows_processed = other.rows_processed.load();
 	total_rows_to_process = other.total_rows_to_process.load();
+	completed_pipelines = other.completed_pipelines.load();
+	total_pipelines = other.total_pipelines.load();
 }
 
 void ProgressBar::SystemOverrideCheck(ClientConfig &config) {
@@ -112,6 +126,10 @@ void ProgressBar::Update(bool final) {
 	ProgressData progress;
 	idx_t invalid_pipelines = executor.GetPipelinesProgress(progress);
 
+	// always snapshot the pipeline counters - they are meaningful even when row progress is not
+	query_progress.completed_pipelines = executor.GetCompletedPipelines();
+	query_progress.total_pipelines = executor.GetTotalPipelines();
+
 	double new_percentage = 0.0;
 	if (invalid_pipelines == 0 && progress.IsValid()) {
 		if (progress.total > 1e15) {
@@ -0,0 +1,151 @@
+#include "duckdb/common/row_operations/fused_aggregate_update.hpp"
+
+#include "duckdb/common/operator/comparison_operators.hpp"
+#include "duckdb/common/types/data_chunk.hpp"
+#include "duckdb/common/types/row/tuple_data_layout.hpp"
+#include "duckdb/execution/operator/aggregate/aggregate_object.hpp"
+
+namespace duckdb {
+
+namespace {
+
+//! Mirrors the state of the numeric min/max aggregates (minmax.cpp)
+//! TryCreate verifies that the sizes still line up
+template <class T>
+struct FusedMinMaxState {
+	T value;
+	bool isset;
+};
+
+template <class T, class COMPARATOR>
+static inline void FusedMinMaxUpdate(data_ptr_t state_ptr, const UnifiedVectorFormat &format, idx_t idx) {
+	auto &state = *reinterpret_cast<FusedMinMaxState<T> *>(state_ptr);
+	const auto input = UnifiedVectorFormat::GetData<T>(format)[idx];
+	if (!state.isset) {
+		state.value = input;
+		state.isset = true;
+	} else if (COMPARATOR::template Operation<T>(input, state.value)) {
+		state.value = input;
+	}
+}
+
+} // namespace
+
+unique_ptr<FusedAggregateUpdater> FusedAggregateUpdater::TryCreate(const TupleDataLayout &layout) {
+	auto &aggregates = layout.GetAggregates();
+	if (aggregates.empty() || aggregates.size() > MAXIMUM_FUSED_AGGREGATES) {
+		return nullptr;
+	}
+	vector<FusedAggregate> fused;
+	idx_t payload_idx = 0;
+	for (idx_t i = 0; i < aggregates.size(); i++) {
+		auto &aggr = aggregates[i];
+		FusedAggregate entry;
+		entry.state_offset = layout.GetOffsets()[layout.ColumnCount() + i] - layout.GetAggrOffset();
+		entry.payload_idx = payload_idx;
+		payload_idx += aggr.child_count;
+
+		if (aggr.aggr_type == AggregateType::DISTINCT || aggr.filter) {
+			return nullptr;
+		}
+		auto &function = aggr.function;
+		if (function.destructor) {
+			return nullptr;
+		}
+		const auto state_size = function.state_size(function);
+		if (function.name == "count_star" && aggr.child_count == 0) {
+			if (state_size != sizeof(int64_t)) {
+				return nullptr;
+			}
+			entry.type = FusedAggregateType::COUNT_STAR;
+		} else if (function.name == "count" && aggr.child_count == 1) {
+			if (state_size != sizeof(int64_t)) {
+				return nullptr;
+			}
+			entry.type = FusedAggregateType::COUNT;
+		} else if ((function.name == "min" || function.name == "max") && aggr.child_count == 1 &&
+		           function.arguments.size() == 1) {
+			const auto is_min = function.name == "min";
+			// Note that the ORDER BY-sensitive wrapper keeps the wrapped function name,
+			// but its (much larger) sorted aggregate state does not pass the state size check below
+			switch (function.arguments[0].InternalType()) {
+			case PhysicalType::INT64:
+				if (state_size != sizeof(FusedMinMaxState<int64_t>)) {
+					return nullptr;
+				}
+				entry.type = is_min ? FusedAggregateType::MIN_INT64 : FusedAggregateType::MAX_INT64;
+				break;
+			case PhysicalType::DOUBLE:
+				if (state_size != sizeof(FusedMinMaxState<double>)) {
+					return nullptr;
+				}
+				entry.type = is_min ? FusedAggregateType::MIN_DOUBLE : FusedAggregateType::MAX_DOUBLE;
+				break;
+			default:
+				return nullptr;
+			}
+		} else {
+			return nullptr;
+		}
+		fused.push_back(entry);
+	}
+	auto result = make_uniq<FusedAggregateUpdater>();
+	result->aggregates = std::move(fused);
+	result->formats.resize(result->aggregates.size());
+	return result;
+}
+
+void FusedAggregateUpdater::Update(DataChunk &payload, Vector &addresses, idx_t count) {
+	D_ASSERT(addresses.GetVectorType() == VectorType::FLAT_VECTOR);
+	auto pointers = FlatVector::GetData<data_ptr_t>(addresses);
+
+	// Unify the argument vector of every fused aggregate once
+	for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+		auto &aggr = aggregates[aggr_idx];
+		if (aggr.type == FusedAggregateType::COUNT_STAR) {
+			continue;
+		}
+		payload.data[aggr.payload_idx].ToUnifiedFormat(count, formats[aggr_idx]);
+	}
+
+	// Update all aggregate states of a row before moving on to the next row:
+	// the states of a row are adjacent, so this touches every row just once
+	for (idx_t i = 0; i < count; i++) {
+		const auto row = pointers[i];
+		for (idx_t aggr_idx = 0; aggr_idx < aggregates.size(); aggr_idx++) {
+			auto &aggr = aggregates[aggr_idx];
+			const auto state = row + aggr.state_offset;
+			if (aggr.type == FusedAggregateType::COUNT_STAR) {
+				++*reinterpret_cast<int64_t *>(state);
+				continue;
+			}
+			auto &format = formats[aggr_idx];
+			const auto idx = format.sel->get_index(i);
+			if (!format.validity.RowIsValid(idx)) {
+				// all fused aggregates ignore NULL inputs
+				continue;
+			}
+			switch (aggr.type) {
+			case FusedAggregateType::COUNT:
+				++*reinterpret_cast<int64_t *>(state);
+				break;
+			case FusedAggregateType::MIN_INT64:
+				FusedMinMaxUpdate<int64_t, LessThan>(state, format, idx);
+				break;
+			case FusedAggregateType::MIN_DOUBLE:
+				FusedMinMaxUpdate<double, LessThan>(state, format, idx);
+				break;
+			case FusedAggregateType::MAX_INT64:
+				FusedMinMaxUpdate<int64_t, GreaterThan>(state, format, idx);
+				break;
+			case FusedAggregateType::MAX_DOUBLE:
+				FusedMinMaxUpdate<double, GreaterThan>(state, format, idx);
+				break;
+			default:
+				throw InternalException("Unsupported fused aggregate type");
+			}
+		}
+	}
+}
+
+} // namespace duckdb
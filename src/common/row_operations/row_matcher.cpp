@@ -4,6 +4,11 @@
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/types/row/tuple_data_collection.hpp"
 
+#if defined(__AVX2__) && !defined(DUCKDB_SMALLER_BINARY)
+#include <immintrin.h>
+#include <type_traits>
+#endif
+
 namespace duckdb {
 
 using ValidityBytes = TupleDataLayout::ValidityBytes;
@@ -58,6 +63,124 @@ static idx_t TemplatedMatchLoop(const TupleDataVectorFormat &lhs_format, Selecti
 	return match_count;
 }
 
+#if defined(__AVX2__) && !defined(DUCKDB_SMALLER_BINARY)
+//! Number of keys the gather-based match kernel compares at a time
+static constexpr idx_t SIMD_MATCH_LANES = 4;
+
+//! Whether we have a gather-based match kernel for this type/predicate combination:
+//! equality on 4- and 8-byte integers, i.e., the typical hash join key comparison.
+//! Floating-point equality is excluded because its NULL/NaN semantics do not map to a bitwise compare.
+template <class T, class OP>
+struct SIMDMatchEnabled {
+	static constexpr bool value = false;
+};
+template <>
+struct SIMDMatchEnabled<int32_t, Equals> {
+	static constexpr bool value = true;
+};
+template <>
+struct SIMDMatchEnabled<uint32_t, Equals> {
+	static constexpr bool value = true;
+};
+template <>
+struct SIMDMatchEnabled<int64_t, Equals> {
+	static constexpr bool value = true;
+};
+template <>
+struct SIMDMatchEnabled<uint64_t, Equals> {
+	static constexpr bool value = true;
+};
+
+template <class T, idx_t WIDTH = sizeof(T)>
+struct SIMDEqualsKernel;
+
+template <class T>
+struct SIMDEqualsKernel<T, 4> {
+	//! Compares four probe keys against four gathered row-layout keys, returns a 4-bit match mask
+	static uint32_t Match(const T *lhs_values, const data_ptr_t *rhs_addresses) {
+		const auto addresses = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs_addresses));
+		const auto rhs = _mm256_i64gather_epi32(static_cast<const int *>(nullptr), addresses, 1);
+		const auto lhs = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lhs_values));
+		const auto equal = _mm_cmpeq_epi32(lhs, rhs);
+		return static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(equal)));
+	}
+};
+
+template <class T>
+struct SIMDEqualsKernel<T, 8> {
+	//! Compares four probe keys against four gathered row-layout keys, returns a 4-bit match mask
+	static uint32_t Match(const T *lhs_values, const data_ptr_t *rhs_addresses) {
+		const auto addresses = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(rhs_addresses));
+		const auto rhs = _mm256_i64gather_epi64(static_cast<const long long *>(nullptr), addresses, 1);
+		const auto lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(lhs_values));
+		const auto equal = _mm256_cmpeq_epi64(lhs, rhs);
+		return static_cast<uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(equal)));
+	}
+};
+
+template <bool NO_MATCH_SEL, class T>
+static idx_t TemplatedSIMDMatchEquals(const TupleDataVectorFormat &lhs_format, SelectionVector &sel, const idx_t count,
+                                      const TupleDataLayout &rhs_layout, Vector &rhs_row_locations, const idx_t col_idx,
+                                      SelectionVector *no_match_sel, idx_t &no_match_count) {
+	// LHS
+	const auto &lhs_sel = *lhs_format.unified.sel;
+	const auto lhs_data = UnifiedVectorFormat::GetData<T>(lhs_format.unified);
+
+	// RHS
+	const auto rhs_locations = FlatVector::GetData<data_ptr_t>(rhs_row_locations);
+	const auto rhs_offset_in_row = rhs_layout.GetOffsets()[col_idx];
+
+	idx_t match_count = 0;
+	idx_t i = 0;
+	for (; i + SIMD_MATCH_LANES <= count; i += SIMD_MATCH_LANES) {
+		idx_t idxs[SIMD_MATCH_LANES];
+		T lhs_values[SIMD_MATCH_LANES];
+		data_ptr_t rhs_addresses[SIMD_MATCH_LANES];
+		for (idx_t lane = 0; lane < SIMD_MATCH_LANES; lane++) {
+			const auto idx = sel.get_index(i + lane);
+			idxs[lane] = idx;
+			lhs_values[lane] = lhs_data[lhs_sel.get_index(idx)];
+			rhs_addresses[lane] = rhs_locations[idx] + rhs_offset_in_row;
+		}
+		const auto match_mask = SIMDEqualsKernel<T>::Match(lhs_values, rhs_addresses);
+		for (idx_t lane = 0; lane < SIMD_MATCH_LANES; lane++) {
+			if (match_mask & (1U << lane)) {
+				sel.set_index(match_count++, idxs[lane]);
+			} else if (NO_MATCH_SEL) {
+				no_match_sel->set_index(no_match_count++, idxs[lane]);
+			}
+		}
+	}
+	// scalar tail
+	for (; i < count; i++) {
+		const auto idx = sel.get_index(i);
+		const auto lhs_idx = lhs_sel.get_index(idx);
+		if (lhs_data[lhs_idx] == Load<T>(rhs_locations[idx] + rhs_offset_in_row)) {
+			sel.set_index(match_count++, idx);
+		} else if (NO_MATCH_SEL) {
+			no_match_sel->set_index(no_match_count++, idx);
+		}
+	}
+	return match_count;
+}
+
+template <bool NO_MATCH_SEL, class T, class OP>
+static idx_t MatchLoopAllValid(std::false_type, const TupleDataVectorFormat &lhs_format, SelectionVector &sel,
+                               const idx_t count, const TupleDataLayout &rhs_layout, Vector &rhs_row_locations,
+                               const idx_t col_idx, SelectionVector *no_match_sel, idx_t &no_match_count) {
+	return TemplatedMatchLoop<NO_MATCH_SEL, T, OP, true, true>(lhs_format, sel, count, rhs_layout, rhs_row_locations,
+	                                                           col_idx, no_match_sel, no_match_count);
+}
+
+template <bool NO_MATCH_SEL, class T, class OP>
+static idx_t MatchLoopAllValid(std::true_type, const TupleDataVectorFormat &lhs_format, SelectionVector &sel,
+                               const idx_t count, const TupleDataLayout &rhs_layout, Vector &rhs_row_locations,
+                               const idx_t col_idx, SelectionVector *no_match_sel, idx_t &no_match_count) {
+	return TemplatedSIMDMatchEquals<NO_MATCH_SEL, T>(lhs_format, sel, count, rhs_layout, rhs_row_locations, col_idx,
+	                                                 no_match_sel, no_match_count);
+}
+#endif
+
 template <bool NO_MATCH_SEL, class T, class OP>
 static idx_t TemplatedMatch(Vector &, const TupleDataVectorFormat &lhs_format, SelectionVector &sel, const idx_t count,
                             const TupleDataLayout &rhs_layout, Vector &rhs_row_locations, const idx_t col_idx,
@@ -68,8 +191,15 @@ static idx_t TemplatedMatch(Vector &, const TupleDataVectorFormat &lhs_format, S
 #else
 	if (lhs_format.unified.validity.AllValid()) {
 		if (rhs_layout.AllValid()) {
+#if defined(__AVX2__)
+			// use the gather-based kernel for type/predicate combinations that have one
+			return MatchLoopAllValid<NO_MATCH_SEL, T, OP>(
+			    std::integral_constant<bool, SIMDMatchEnabled<T, OP>::value>(), lhs_format, sel, count, rhs_layout,
+			    rhs_row_locations, col_idx, no_match_sel, no_match_count);
+#else
 			return TemplatedMatchLoop<NO_MATCH_SEL, T, OP, true, true>(
 			    lhs_format, sel, count, rhs_layout, rhs_row_locations, col_idx, no_match_sel, no_match_count);
+#endif
 		} else {
 			return TemplatedMatchLoop<NO_MATCH_SEL, T, OP, true, false>(
 			    lhs_format, sel, count, rhs_layout, rhs_row_locations, col_idx, no_match_sel, no_match_count);
@@ -615,16 +615,30 @@ void HashedSortMaterializeEvent::Schedule() {
 	const auto num_threads = NumericCast<idx_t>(ts.NumberOfThreads());
 	auto &sort = *gstate.hashed_sort.sort;
 
-	vector<shared_ptr<Task>> tasks;
+	// Initialize the sources and estimate the work per group
+	vector<reference<HashedSortGroup>> scheduled_groups;
 	for (auto &hash_group : gstate.hash_groups) {
 		if (!hash_group) {
 			continue;
 		}
 		auto &global_sink = *hash_group->sort_global;
 		hash_group->sort_source = sort.GetGlobalSourceState(client, global_sink);
-		const auto tasks_scheduled = MinValue<idx_t>(num_threads, hash_group->sort_source->MaxThreads());
+		scheduled_groups.emplace_back(*hash_group);
+	}
+
+	// Schedule the largest groups first: group sizes can be heavily skewed, and if a large group
+	// starts late it finishes late while the threads that are done with the small groups sit idle
+	std::stable_sort(scheduled_groups.begin(), scheduled_groups.end(),
+	                 [](const reference<HashedSortGroup> &lhs, const reference<HashedSortGroup> &rhs) {
+		                 return lhs.get().sort_source->MaxThreads() > rhs.get().sort_source->MaxThreads();
+	                 });
+
+	vector<shared_ptr<Task>> tasks;
+	for (auto &scheduled_group : scheduled_groups) {
+		auto &hash_group = scheduled_group.get();
+		const auto tasks_scheduled = MinValue<idx_t>(num_threads, hash_group.sort_source->MaxThreads());
 		for (idx_t t = 0; t < tasks_scheduled; ++t) {
-			tasks.emplace_back(make_uniq<HashedSortMaterializeTask>(*pipeline, shared_from_this(), op, *hash_group,
+			tasks.emplace_back(make_uniq<HashedSortMaterializeTask>(*pipeline, shared_from_this(), op, hash_group,
 			                                                        tasks_scheduled, build_runs));
 		}
 	}
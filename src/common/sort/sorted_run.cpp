@@ -165,7 +165,7 @@ SortedRun::SortedRun(ClientContext &context_p, const Sort &sort_p, bool is_index
       payload_data(sort.payload_layout && sort.payload_layout->ColumnCount() != 0
                        ? make_uniq<TupleDataCollection>(context, sort.payload_layout)
                        : nullptr),
-      is_index_sort(is_index_sort_p), finalized(false) {
+      is_index_sort(is_index_sort_p), keys_sorted(true), last_key(nullptr), finalized(false) {
 	key_data->InitializeAppend(key_append_state, TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
 	if (payload_data) {
 		payload_data->InitializeAppend(payload_append_state, TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
@@ -176,6 +176,7 @@ unique_ptr<SortedRun> SortedRun::CreateRunForMaterialization() const {
 	auto res = make_uniq<SortedRun>(context, sort, is_index_sort);
 	res->key_append_state.pin_state.properties = TupleDataPinProperties::UNPIN_AFTER_DONE;
 	res->payload_append_state.pin_state.properties = TupleDataPinProperties::UNPIN_AFTER_DONE;
+	res->keys_sorted = false; // Blocks get unpinned, so we cannot keep comparing against the last key
 	res->finalized = true;
 	return res;
 }
@@ -211,6 +212,49 @@ static void SetPayloadPointer(Vector &key_locations, Vector &payload_locations,
 	}
 }
 
+template <SortKeyType SORT_KEY_TYPE>
+static bool TemplatedKeysStillSorted(const Vector &key_locations, const idx_t count, data_ptr_t &last_key) {
+	using SORT_KEY = SortKey<SORT_KEY_TYPE>;
+
+	const auto keys = FlatVector::GetData<SORT_KEY *const>(key_locations);
+	std::less<SORT_KEY> comp;
+	auto prev = reinterpret_cast<SORT_KEY *>(last_key);
+	for (idx_t i = 0; i < count; i++) {
+		if (prev && comp(*keys[i], *prev)) {
+			return false;
+		}
+		prev = keys[i];
+	}
+	last_key = reinterpret_cast<data_ptr_t>(prev);
+	return true;
+}
+
+static bool KeysStillSorted(const Vector &key_locations, const idx_t count, data_ptr_t &last_key,
+                            const SortKeyType &sort_key_type) {
+	switch (sort_key_type) {
+	case SortKeyType::NO_PAYLOAD_FIXED_8:
+		return TemplatedKeysStillSorted<SortKeyType::NO_PAYLOAD_FIXED_8>(key_locations, count, last_key);
+	case SortKeyType::NO_PAYLOAD_FIXED_16:
+		return TemplatedKeysStillSorted<SortKeyType::NO_PAYLOAD_FIXED_16>(key_locations, count, last_key);
+	case SortKeyType::NO_PAYLOAD_FIXED_24:
+		return TemplatedKeysStillSorted<SortKeyType::NO_PAYLOAD_FIXED_24>(key_locations, count, last_key);
+	case SortKeyType::NO_PAYLOAD_FIXED_32:
+		return TemplatedKeysStillSorted<SortKeyType::NO_PAYLOAD_FIXED_32>(key_locations, count, last_key);
+	case SortKeyType::NO_PAYLOAD_VARIABLE_32:
+		return TemplatedKeysStillSorted<SortKeyType::NO_PAYLOAD_VARIABLE_32>(key_locations, count, last_key);
+	case SortKeyType::PAYLOAD_FIXED_16:
+		return TemplatedKeysStillSorted<SortKeyType::PAYLOAD_FIXED_16>(key_locations, count, last_key);
+	case SortKeyType::PAYLOAD_FIXED_24:
+		return TemplatedKeysStillSorted<SortKeyType::PAYLOAD_FIXED_24>(key_locations, count, last_key);
+	case SortKeyType::PAYLOAD_FIXED_32:
+		return TemplatedKeysStillSorted<SortKeyType::PAYLOAD_FIXED_32>(key_locations, count, last_key);
+	case SortKeyType::PAYLOAD_VARIABLE_32:
+		return TemplatedKeysStillSorted<SortKeyType::PAYLOAD_VARIABLE_32>(key_locations, count, last_key);
+	default:
+		throw NotImplementedException("KeysStillSorted for %s", EnumUtil::ToString(sort_key_type));
+	}
+}
+
 void SortedRun::Sink(DataChunk &key, DataChunk &payload) {
 	D_ASSERT(!finalized);
 	key_data->Append(key_append_state, key);
@@ -220,6 +264,12 @@ void SortedRun::Sink(DataChunk &key, DataChunk &payload) {
 		SetPayloadPointer(key_append_state.chunk_state.row_locations, payload_append_state.chunk_state.row_locations,
 		                  key.size(), key_data->GetLayout().GetSortKeyType());
 	}
+	if (keys_sorted) {
+		// Keep checking whether the input is arriving in sorted order (bails out at the first inversion),
+		// so Finalize can skip the sort for pre-sorted inputs such as append-mostly time series
+		keys_sorted = KeysStillSorted(key_append_state.chunk_state.row_locations, key.size(), last_key,
+		                              key_data->GetLayout().GetSortKeyType());
+	}
 }
 
 template <class SORT_KEY>
@@ -443,8 +493,10 @@ void SortedRun::Finalize(bool external) {
 		payload_data->VerifyEverythingPinned();
 	}
 
-	// Sort the fixed-size portion of the keys
-	SortSwitch(context, *key_data, is_index_sort);
+	// Sort the fixed-size portion of the keys (unless the input already arrived in sorted order)
+	if (!keys_sorted) {
+		SortSwitch(context, *key_data, is_index_sort);
+	}
 
 	if (external) {
 		// Reorder variable-size portion of keys and/or payload data (if necessary)
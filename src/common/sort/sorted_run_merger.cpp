@@ -617,6 +617,120 @@ void SortedRunMergerLocalState::MergePartitionSwitch(SortedRunMergerGlobalState
 	}
 }
 
+//! From this many active runs onwards we merge with a tournament tree instead of vergesort:
+//! below it, vergesort's pairwise run merging is competitive and needs no extra buffer
+static constexpr idx_t LOSER_TREE_MERGE_THRESHOLD = 16;
+
+//! Merges the sorted segments of a partition using a tournament (loser) tree.
+//! Selecting the next segment costs log2(k) comparisons regardless of how many segments there are,
+//! and after every selection we keep copying from the winning segment for as long as its keys beat
+//! the best key of the segments it defeated, so long winning streaks cost one comparison per element.
+template <class SORT_KEY>
+class SortedRunLoserTree {
+public:
+	struct Segment {
+		SORT_KEY *current;
+		SORT_KEY *end;
+	};
+
+public:
+	explicit SortedRunLoserTree(unsafe_vector<Segment> &segments_p) : segments(segments_p) {
+		// pad the segment count to a power of two with exhausted segments to get a complete tree
+		const auto k = NextPowerOfTwo(segments.size());
+		segments.resize(k, Segment {nullptr, nullptr});
+		tree.resize(k, 0);
+
+		// play the tournament bottom-up: leaf i maps to tree position k + i,
+		// internal nodes store the run index of the loser, the winner moves up
+		unsafe_vector<idx_t> winners(2 * k);
+		for (idx_t i = 0; i < k; i++) {
+			winners[k + i] = i;
+		}
+		for (idx_t node = k - 1; node >= 1; node--) {
+			const auto left = winners[2 * node];
+			const auto right = winners[2 * node + 1];
+			const auto left_beats_right = Beats(left, right);
+			winners[node] = left_beats_right ? left : right;
+			tree[node] = left_beats_right ? right : left;
+		}
+		winner = winners[1];
+	}
+
+public:
+	//! Merge up to "total" elements into the output buffer
+	void Merge(SORT_KEY *output, const idx_t total) {
+		const auto k = tree.size();
+		idx_t out_count = 0;
+		while (out_count < total) {
+			auto &segment = segments[winner];
+			if (segment.current == segment.end) {
+				break; // all segments exhausted
+			}
+			const auto challenger = ComputeChallenger(k);
+			if (!challenger) {
+				// the winning segment is the only one left: copy the remainder
+				while (out_count < total && segment.current != segment.end) {
+					output[out_count++] = *segment.current++;
+				}
+				break;
+			}
+			// copy from the winning segment while it keeps beating the challenger
+			do {
+				output[out_count++] = *segment.current++;
+			} while (out_count < total && segment.current != segment.end && !(*challenger < *segment.current));
+			Replay(k);
+		}
+		D_ASSERT(out_count == total);
+	}
+
+private:
+	//! Whether segment a wins against segment b (exhausted segments always lose)
+	bool Beats(const idx_t &a, const idx_t &b) const {
+		const auto &segment_a = segments[a];
+		const auto &segment_b = segments[b];
+		if (segment_a.current == segment_a.end) {
+			return false;
+		}
+		if (segment_b.current == segment_b.end) {
+			return true;
+		}
+		return !(*segment_b.current < *segment_a.current);
+	}
+
+	//! The best key among the segments the winner defeated on its way to the root,
+	//! i.e., the key the winner has to beat to keep its streak going
+	SORT_KEY *ComputeChallenger(const idx_t &k) const {
+		SORT_KEY *challenger = nullptr;
+		for (auto node = (k + winner) / 2; node >= 1; node /= 2) {
+			const auto &segment = segments[tree[node]];
+			if (segment.current == segment.end) {
+				continue;
+			}
+			if (!challenger || *segment.current < *challenger) {
+				challenger = segment.current;
+			}
+		}
+		return challenger;
+	}
+
+	//! Replay the matches along the winner's path after its segment has advanced
+	void Replay(const idx_t &k) {
+		for (auto node = (k + winner) / 2; node >= 1; node /= 2) {
+			if (Beats(tree[node], winner)) {
+				std::swap(tree[node], winner);
+			}
+		}
+	}
+
+private:
+	//! The segments being merged (padded to a power of two)
+	unsafe_vector<Segment> &segments;
+	//! Internal tree nodes, holding the run index of the match's loser
+	unsafe_vector<idx_t> tree;
+	//! The run index of the current overall winner
+	idx_t winner;
+};
+
 template <class STATE, SortKeyType SORT_KEY_TYPE>
 void SortedRunMergerLocalState::TemplatedMergePartition(SortedRunMergerGlobalState &gstate,
                                                         unsafe_vector<STATE> &states) {
@@ -631,6 +745,9 @@ void SortedRunMergerLocalState::TemplatedMergePartition(SortedRunMergerGlobalSta
 	merged_partition_count = 0;
 	merged_partition_index = 0;
 
+	unsafe_vector<typename SortedRunLoserTree<SORT_KEY>::Segment> segments;
+	segments.reserve(gstate.num_runs);
+
 	idx_t active_runs = 0;
 	for (idx_t run_idx = 0; run_idx < gstate.num_runs; run_idx++) {
 		auto &state = states[run_idx];
@@ -644,15 +761,28 @@ void SortedRunMergerLocalState::TemplatedMergePartition(SortedRunMergerGlobalSta
 		}
 		active_runs++;
 
+		const auto segment_start = merged_partition_count;
 		for (auto it = BLOCK_ITERATOR(state, run_boundary.begin); it != BLOCK_ITERATOR(state, run_boundary.end); ++it) {
 			merged_partition_keys[merged_partition_count++] = *it;
 		}
+		segments.push_back({merged_partition_keys + segment_start, merged_partition_keys + merged_partition_count});
 	}
 
 	if (active_runs == 1 || gstate.merger.is_index_sort) {
 		return; // Only one active run, no need to sort (or index sort, which is approximate sorting)
 	}
 
+	if (active_runs >= LOSER_TREE_MERGE_THRESHOLD) {
+		// Wide merge: a single tournament tree pass over the gathered runs beats the
+		// log2(k) pairwise merge passes the sort below would do
+		auto merge_output =
+		    BufferAllocator::Get(gstate.context).Allocate(gstate.merger.partition_size * sizeof(SORT_KEY));
+		SortedRunLoserTree<SORT_KEY> loser_tree(segments);
+		loser_tree.Merge(reinterpret_cast<SORT_KEY *>(merge_output.get()), merged_partition_count);
+		merged_partition = std::move(merge_output);
+		return;
+	}
+
 	// Seems counter-intuitive to re-sort instead of merging, but modern sorting algorithms detect and merge
 	static const auto fallback = [](SORT_KEY *begin, SORT_KEY *end) {
 		duckdb_pdqsort::pdqsort_branchless(begin, end);
@@ -53,6 +53,9 @@ void BatchedDataCollection::Merge(BatchedDataCollection &other) {
 		data[entry.first] = std::move(entry.second);
 	}
 	other.data.clear();
+	// reset the append cache - the collection it points into is now owned by this collection
+	other.last_collection.batch_index = DConstants::INVALID_INDEX;
+	other.last_collection.collection = nullptr;
 }
 
 void BatchedDataCollection::InitializeScan(BatchedChunkScanState &state, const BatchedChunkIteratorRange &range) {
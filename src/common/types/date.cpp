@@ -187,6 +187,27 @@ bool Date::ParseDoubleDigit(const char *buf, idx_t len, idx_t &pos, int32_t &res
 	return false;
 }
 
+bool Date::TryParseISODate(const char *buf, idx_t len, date_t &result) {
+	if (len != 10 || buf[4] != '-' || buf[7] != '-') {
+		return false;
+	}
+	// convert all eight digit positions branch-free; a non-digit clears "all_digits"
+	static constexpr uint8_t DIGIT_POSITIONS[] = {0, 1, 2, 3, 5, 6, 8, 9};
+	uint32_t digits[8];
+	bool all_digits = true;
+	for (idx_t i = 0; i < 8; i++) {
+		digits[i] = static_cast<uint32_t>(static_cast<uint8_t>(buf[DIGIT_POSITIONS[i]])) - '0';
+		all_digits &= digits[i] <= 9;
+	}
+	if (!all_digits) {
+		return false;
+	}
+	const auto year = static_cast<int32_t>(digits[0] * 1000 + digits[1] * 100 + digits[2] * 10 + digits[3]);
+	const auto month = static_cast<int32_t>(digits[4] * 10 + digits[5]);
+	const auto day = static_cast<int32_t>(digits[6] * 10 + digits[7]);
+	return Date::TryFromDate(year, month, day, result);
+}
+
 bool Date::TryConvertDateSpecial(const char *buf, idx_t len, idx_t &pos, const DateSpecial &s) {
 	auto p = pos;
 	auto special = s.str;
@@ -503,42 +503,33 @@ hugeint_t Hugeint::Modulo<false>(hugeint_t lhs, hugeint_t rhs) {
 // Add/Subtract
 //===--------------------------------------------------------------------===//
 bool Hugeint::TryAddInPlace(hugeint_t &lhs, hugeint_t rhs) {
-	int overflow = lhs.lower + rhs.lower < lhs.lower;
-	if (rhs.upper >= 0) {
-		// RHS is positive: check for overflow
-		if (lhs.upper > (std::numeric_limits<int64_t>::max() - rhs.upper - overflow)) {
-			return false;
-		}
-		lhs.upper = lhs.upper + overflow + rhs.upper;
-	} else {
-		// RHS is negative: check for underflow
-		if (lhs.upper < std::numeric_limits<int64_t>::min() - rhs.upper - overflow) {
-			return false;
-		}
-		lhs.upper = lhs.upper + (overflow + rhs.upper);
+	// 64-bit lane addition: add the lower words, propagate the carry into the upper words,
+	// and detect signed overflow from the sign bits alone - no data-dependent branches
+	const uint64_t new_lower = lhs.lower + rhs.lower;
+	const uint64_t carry = new_lower < lhs.lower ? 1 : 0;
+	const uint64_t new_upper = uint64_t(lhs.upper) + uint64_t(rhs.upper) + carry;
+	// overflow iff both operands have the same sign and the result sign differs
+	const uint64_t overflow = ~(uint64_t(lhs.upper) ^ uint64_t(rhs.upper)) & (uint64_t(lhs.upper) ^ new_upper);
+	if (overflow >> 63) {
+		return false;
 	}
-	lhs.lower += rhs.lower;
+	lhs.lower = new_lower;
+	lhs.upper = int64_t(new_upper);
 	return true;
 }
 
 bool Hugeint::TrySubtractInPlace(hugeint_t &lhs, hugeint_t rhs) {
-	// underflow
-	int underflow = lhs.lower - rhs.lower > lhs.lower;
-	if (rhs.upper >= 0) {
-		// RHS is positive: check for underflow
-		if (lhs.upper < (std::numeric_limits<int64_t>::min() + rhs.upper + underflow)) {
-			return false;
-		}
-		lhs.upper = (lhs.upper - rhs.upper) - underflow;
-	} else {
-		// RHS is negative: check for overflow
-		if (lhs.upper > std::numeric_limits<int64_t>::min() &&
-		    lhs.upper - 1 >= (std::numeric_limits<int64_t>::max() + rhs.upper + underflow)) {
-			return false;
-		}
-		lhs.upper = lhs.upper - (rhs.upper + underflow);
+	// mirror image of TryAddInPlace: subtract with borrow propagation,
+	// overflow iff the operand signs differ and the result sign differs from the LHS
+	const uint64_t new_lower = lhs.lower - rhs.lower;
+	const uint64_t borrow = lhs.lower < rhs.lower ? 1 : 0;
+	const uint64_t new_upper = uint64_t(lhs.upper) - uint64_t(rhs.upper) - borrow;
+	const uint64_t overflow = (uint64_t(lhs.upper) ^ uint64_t(rhs.upper)) & (uint64_t(lhs.upper) ^ new_upper);
+	if (overflow >> 63) {
+		return false;
 	}
-	lhs.lower -= rhs.lower;
+	lhs.lower = new_lower;
+	lhs.upper = int64_t(new_upper);
 	return true;
 }
 
@@ -8,6 +8,12 @@
 
 #include <math.h>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace duckdb_hll {
 struct robj; // NOLINT
 }
@@ -22,9 +28,25 @@ idx_t HyperLogLog::Count() const {
 
 //! Algorithm 2
 void HyperLogLog::Merge(const HyperLogLog &other) {
+	// merging is just an element-wise max over the register arrays,
+	// which maps directly onto the unsigned byte max instructions
+#if defined(__AVX2__)
+	static_assert(M % 32 == 0, "register count must be a multiple of the AVX2 width");
+	for (idx_t i = 0; i < M; i += 32) {
+		const auto lhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(k + i));
+		const auto rhs = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(other.k + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(k + i), _mm256_max_epu8(lhs, rhs));
+	}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	static_assert(M % 16 == 0, "register count must be a multiple of the NEON width");
+	for (idx_t i = 0; i < M; i += 16) {
+		vst1q_u8(k + i, vmaxq_u8(vld1q_u8(k + i), vld1q_u8(other.k + i)));
+	}
+#else
 	for (idx_t i = 0; i < M; ++i) {
 		Update(i, other.k[i]);
 	}
+#endif
 }
 
 //! Algorithm 4
@@ -82,6 +104,31 @@ int64_t HyperLogLog::EstimateCardinality(uint32_t *c) {
 	return llroundl(ALPHA * M * M / z);
 }
 
+void HyperLogLog::InsertElements(const hash_t *hashes, const idx_t count) {
+	static constexpr idx_t BATCH_SIZE = 32;
+	idx_t i = 0;
+	for (; i + BATCH_SIZE <= count; i += BATCH_SIZE) {
+		// decompose the hashes into register index and trailing-zero count first:
+		// this loop has no data dependencies and unrolls/vectorizes,
+		// while the register max below is a scatter and has to stay scalar
+		idx_t indices[BATCH_SIZE];
+		uint8_t zeros[BATCH_SIZE];
+		for (idx_t j = 0; j < BATCH_SIZE; j++) {
+			auto h = hashes[i + j];
+			indices[j] = h & ((1 << P) - 1);
+			h >>= P;
+			h |= hash_t(1) << Q;
+			zeros[j] = UnsafeNumericCast<uint8_t>(CountZeros<hash_t>::Trailing(h) + 1);
+		}
+		for (idx_t j = 0; j < BATCH_SIZE; j++) {
+			Update(indices[j], zeros[j]);
+		}
+	}
+	for (; i < count; ++i) {
+		InsertElement(hashes[i]);
+	}
+}
+
 void HyperLogLog::Update(Vector &input, Vector &hash_vec, const idx_t count) {
 	UnifiedVectorFormat idata;
 	input.ToUnifiedFormat(count, idata);
@@ -97,10 +144,7 @@ void HyperLogLog::Update(Vector &input, Vector &hash_vec, const idx_t count) {
 	} else {
 		D_ASSERT(hash_vec.GetVectorType() == VectorType::FLAT_VECTOR);
 		if (idata.validity.AllValid()) {
-			for (idx_t i = 0; i < count; ++i) {
-				const auto hash = hashes[i];
-				InsertElement(hash);
-			}
+			InsertElements(hashes, count);
 		} else {
 			for (idx_t i = 0; i < count; ++i) {
 				if (idata.validity.RowIsValid(idata.sel->get_index(i))) {
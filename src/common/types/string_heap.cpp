@@ -1,5 +1,6 @@
 #include "duckdb/common/types/string_heap.hpp"
 
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/common/types/string_type.hpp"
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
@@ -14,10 +15,16 @@ StringHeap::StringHeap(Allocator &allocator) : allocator(allocator) {
 
 void StringHeap::Destroy() {
 	allocator.Destroy();
+	// the intern table points into the destroyed heap
+	intern_table.clear();
+	intern_count = 0;
 }
 
 void StringHeap::Move(StringHeap &other) {
 	other.allocator.Move(allocator);
+	// the interned strings are now owned by the other heap
+	intern_table.clear();
+	intern_count = 0;
 }
 
 string_t StringHeap::AddString(const char *data, idx_t len) {
@@ -38,10 +45,63 @@ string_t StringHeap::AddString(const string_t &data) {
 }
 
 string_t StringHeap::AddBlob(const char *data, idx_t len) {
+	if (deduplicate) {
+		return AddBlobDeduplicated(data, len);
+	}
+	auto insert_string = EmptyString(len);
+	auto insert_pos = insert_string.GetDataWriteable();
+	memcpy(insert_pos, data, len);
+	insert_string.Finalize();
+	return insert_string;
+}
+
+void StringHeap::EnableDeduplication() {
+	deduplicate = true;
+}
+
+void StringHeap::GrowInternTable() {
+	auto old_table = std::move(intern_table);
+	intern_table = vector<string_t>(old_table.size() * 2);
+	const auto capacity_mask = intern_table.size() - 1;
+	for (auto &entry : old_table) {
+		if (entry.GetSize() == 0) {
+			continue;
+		}
+		auto slot = Hash(entry.GetData(), entry.GetSize()) & capacity_mask;
+		while (intern_table[slot].GetSize() != 0) {
+			slot = (slot + 1) & capacity_mask;
+		}
+		intern_table[slot] = entry;
+	}
+}
+
+string_t StringHeap::AddBlobDeduplicated(const char *data, idx_t len) {
+	if (intern_table.empty()) {
+		intern_table = vector<string_t>(INTERN_TABLE_INITIAL_CAPACITY);
+	} else if (intern_count * 2 >= intern_table.size() && intern_table.size() < INTERN_TABLE_MAXIMUM_CAPACITY) {
+		GrowInternTable();
+	}
+	const auto capacity_mask = intern_table.size() - 1;
+	auto slot = Hash(data, len) & capacity_mask;
+	while (intern_table[slot].GetSize() != 0) {
+		auto &entry = intern_table[slot];
+		if (entry.GetSize() == len && memcmp(entry.GetData(), data, len) == 0) {
+			// we already hold this string - share the heap entry
+			return entry;
+		}
+		slot = (slot + 1) & capacity_mask;
+	}
+	// not seen before: copy it into the heap
 	auto insert_string = EmptyString(len);
 	auto insert_pos = insert_string.GetDataWriteable();
 	memcpy(insert_pos, data, len);
 	insert_string.Finalize();
+	if (intern_count * 2 < intern_table.size()) {
+		// only intern while the table is at most half full, so probe sequences stay short
+		// and a full table degrades to regular copies instead of endless probing
+		intern_table[slot] = insert_string;
+		intern_count++;
+	}
 	return insert_string;
 }
 
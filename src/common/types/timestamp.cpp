@@ -149,6 +149,52 @@ TimestampCastResult Timestamp::TryConvertTimestampTZ(const char *str, idx_t len,
 	return TimestampCastResult::SUCCESS;
 }
 
+bool Timestamp::TryParseISOTimestamp(const char *str, idx_t len, timestamp_t &result) {
+	if (len < 19 || (str[10] != ' ' && str[10] != 'T') || str[13] != ':' || str[16] != ':') {
+		return false;
+	}
+	date_t date;
+	if (!Date::TryParseISODate(str, 10, date)) {
+		return false;
+	}
+	// convert the six time digit positions branch-free; a non-digit clears "all_digits"
+	static constexpr uint8_t TIME_DIGIT_POSITIONS[] = {11, 12, 14, 15, 17, 18};
+	uint32_t digits[6];
+	bool all_digits = true;
+	for (idx_t i = 0; i < 6; i++) {
+		digits[i] = static_cast<uint32_t>(static_cast<uint8_t>(str[TIME_DIGIT_POSITIONS[i]])) - '0';
+		all_digits &= digits[i] <= 9;
+	}
+	if (!all_digits) {
+		return false;
+	}
+	const auto hour = static_cast<int32_t>(digits[0] * 10 + digits[1]);
+	const auto minute = static_cast<int32_t>(digits[2] * 10 + digits[3]);
+	const auto second = static_cast<int32_t>(digits[4] * 10 + digits[5]);
+
+	int32_t micros = 0;
+	if (len > 19) {
+		// only a fractional part of up to six digits fits the fixed layout; offsets and time
+		// zones are left to the general parser
+		if (str[19] != '.' || len == 20 || len > 26) {
+			return false;
+		}
+		int32_t multiplier = 100000;
+		for (idx_t pos = 20; pos < len; pos++) {
+			const auto digit = static_cast<uint32_t>(static_cast<uint8_t>(str[pos])) - '0';
+			if (digit > 9) {
+				return false;
+			}
+			micros += static_cast<int32_t>(digit) * multiplier;
+			multiplier /= 10;
+		}
+	}
+	if (!Time::IsValidTime(hour, minute, second, micros)) {
+		return false;
+	}
+	return Timestamp::TryFromDatetime(date, Time::FromTime(hour, minute, second, micros), result);
+}
+
 TimestampCastResult Timestamp::TryConvertTimestamp(const char *str, idx_t len, timestamp_t &result, bool use_offset,
                                                    optional_ptr<int32_t> nanos, bool strict) {
 	string_t tz(nullptr, 0);
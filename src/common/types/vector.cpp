@@ -1954,14 +1954,20 @@ const Vector &DictionaryVector::GetCachedHashes(Vector &input) {
 	D_ASSERT(CanCacheHashes(input));
 
 	auto &child = input.auxiliary->Cast<VectorChildBuffer>();
-	lock_guard<mutex> guard(child.cached_hashes_lock);
+	if (child.cached_hashes_valid.load(std::memory_order_acquire)) {
+		// Already filled: the hashes are immutable from here on, no need to take the lock
+		// This is the hot path, as e.g. join probes hash the same dictionary once per chunk
+		return child.cached_hashes;
+	}
 
-	if (!child.cached_hashes.data) {
+	lock_guard<mutex> guard(child.cached_hashes_lock);
+	if (!child.cached_hashes_valid.load(std::memory_order_relaxed)) {
 		// Uninitialized: hash the dictionary
 		const auto dictionary_size = DictionarySize(input).GetIndex();
 		D_ASSERT(!child.size.IsValid() || child.size.GetIndex() == dictionary_size);
 		child.cached_hashes.Initialize(false, dictionary_size);
 		VectorOperations::Hash(child.data, child.cached_hashes, dictionary_size);
+		child.cached_hashes_valid.store(true, std::memory_order_release);
 	}
 	return child.cached_hashes;
 }
@@ -1,10 +1,132 @@
 #include "duckdb/common/types/vector_cache.hpp"
 
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/unordered_map.hpp"
 
 namespace duckdb {
 
+//! A per-thread pool of the flat buffers backing VectorCacheBuffers. Vector caches are created per
+//! operator per query, and at high query rates the alloc/free churn of these fixed-size buffers
+//! dominates allocator traffic. Buffers are binned by their exact allocation size (standard vectors
+//! only come in a handful of sizes) and returned to the destroying thread's pool for reuse.
+struct VectorCacheBufferPool {
+	//! Maximum number of buffers a thread keeps pooled - beyond this, buffers are freed as before
+	static constexpr idx_t MAXIMUM_POOLED_BUFFERS = 64;
+	//! Buffers larger than this are never pooled
+	static constexpr idx_t MAXIMUM_POOLED_BUFFER_SIZE = 1ULL << 20;
+
+	VectorCacheBufferPool();
+	~VectorCacheBufferPool();
+
+	//! The pool lock: the pool is filled and drained by its owning thread, but an allocator that is
+	//! being torn down purges its buffers from every registered pool
+	mutex lock;
+	//! The pooled buffers, binned by allocation size
+	unordered_map<idx_t, vector<AllocatedData>> size_classes;
+	//! The total number of pooled buffers over all size classes
+	idx_t total_buffers = 0;
+
+	static AllocatedData Acquire(Allocator &allocator, idx_t size);
+	static void Release(AllocatedData data);
+	static void PurgeAllocator(Allocator &allocator);
+
+private:
+	static VectorCacheBufferPool &Get();
+	static mutex &PoolRegistryLock();
+	static vector<VectorCacheBufferPool *> &PoolRegistry();
+};
+
+mutex &VectorCacheBufferPool::PoolRegistryLock() {
+	// deliberately leaked: static allocators purge their pooled buffers on destruction at program
+	// exit, which must not race with the destruction order of these globals
+	static mutex *pool_registry_lock = new mutex();
+	return *pool_registry_lock;
+}
+
+vector<VectorCacheBufferPool *> &VectorCacheBufferPool::PoolRegistry() {
+	static vector<VectorCacheBufferPool *> *pool_registry = new vector<VectorCacheBufferPool *>();
+	return *pool_registry;
+}
+
+VectorCacheBufferPool::VectorCacheBufferPool() {
+	lock_guard<mutex> registry_guard(PoolRegistryLock());
+	PoolRegistry().push_back(this);
+}
+
+VectorCacheBufferPool::~VectorCacheBufferPool() {
+	lock_guard<mutex> registry_guard(PoolRegistryLock());
+	auto &registry = PoolRegistry();
+	for (idx_t i = 0; i < registry.size(); i++) {
+		if (registry[i] == this) {
+			registry.erase(registry.begin() + UnsafeNumericCast<int64_t>(i));
+			break;
+		}
+	}
+}
+
+VectorCacheBufferPool &VectorCacheBufferPool::Get() {
+	static thread_local VectorCacheBufferPool pool;
+	return pool;
+}
+
+AllocatedData VectorCacheBufferPool::Acquire(Allocator &allocator, idx_t size) {
+	if (size <= MAXIMUM_POOLED_BUFFER_SIZE) {
+		auto &pool = Get();
+		lock_guard<mutex> guard(pool.lock);
+		auto entry = pool.size_classes.find(size);
+		if (entry != pool.size_classes.end()) {
+			auto &buffers = entry->second;
+			// only reuse buffers that came from the same allocator
+			for (idx_t i = buffers.size(); i > 0; i--) {
+				if (buffers[i - 1].GetAllocator().get() == &allocator) {
+					std::swap(buffers[i - 1], buffers.back());
+					auto result = std::move(buffers.back());
+					buffers.pop_back();
+					pool.total_buffers--;
+					return result;
+				}
+			}
+		}
+	}
+	return allocator.Allocate(size);
+}
+
+void VectorCacheBufferPool::Release(AllocatedData data) {
+	if (!data.IsSet() || data.GetSize() > MAXIMUM_POOLED_BUFFER_SIZE) {
+		// not pooled - the AllocatedData frees itself as before
+		return;
+	}
+	auto &pool = Get();
+	lock_guard<mutex> guard(pool.lock);
+	if (pool.total_buffers >= MAXIMUM_POOLED_BUFFERS) {
+		return;
+	}
+	pool.size_classes[data.GetSize()].push_back(std::move(data));
+	pool.total_buffers++;
+}
+
+void VectorCacheBufferPool::PurgeAllocator(Allocator &allocator) {
+	// collect the purged buffers first so the frees happen while the allocator is still alive
+	vector<AllocatedData> purged;
+	lock_guard<mutex> registry_guard(PoolRegistryLock());
+	for (auto &pool : PoolRegistry()) {
+		lock_guard<mutex> guard(pool->lock);
+		for (auto &size_class : pool->size_classes) {
+			auto &buffers = size_class.second;
+			for (idx_t i = buffers.size(); i > 0; i--) {
+				if (buffers[i - 1].GetAllocator().get() == &allocator) {
+					std::swap(buffers[i - 1], buffers.back());
+					purged.push_back(std::move(buffers.back()));
+					buffers.pop_back();
+					pool->total_buffers--;
+				}
+			}
+		}
+	}
+}
+
 class VectorCacheBuffer : public VectorBuffer {
 public:
 	explicit VectorCacheBuffer(Allocator &allocator, const LogicalType &type_p, idx_t capacity_p = STANDARD_VECTOR_SIZE)
@@ -13,7 +135,7 @@ public:
 		switch (internal_type) {
 		case PhysicalType::LIST: {
 			// memory for the list offsets
-			owned_data = allocator.Allocate(capacity * GetTypeIdSize(internal_type));
+			owned_data = VectorCacheBufferPool::Acquire(allocator, capacity * GetTypeIdSize(internal_type));
 			// child data of the list
 			auto &child_type = ListType::GetChildType(type);
 			child_caches.push_back(make_buffer<VectorCacheBuffer>(allocator, child_type, capacity));
@@ -39,11 +161,16 @@ public:
 			break;
 		}
 		default:
-			owned_data = allocator.Allocate(capacity * GetTypeIdSize(internal_type));
+			owned_data = VectorCacheBufferPool::Acquire(allocator, capacity * GetTypeIdSize(internal_type));
 			break;
 		}
 	}
 
+	~VectorCacheBuffer() override {
+		// hand the flat buffer back to this thread's pool for reuse
+		VectorCacheBufferPool::Release(std::move(owned_data));
+	}
+
 	void ResetFromCache(Vector &result, const buffer_ptr<VectorBuffer> &buffer) {
 		D_ASSERT(type == result.GetType());
 		auto internal_type = type.InternalType();
@@ -143,4 +270,8 @@ const LogicalType &VectorCache::GetType() const {
 	return vector_cache.GetType();
 }
 
+void VectorCache::PurgePool(Allocator &allocator) {
+	VectorCacheBufferPool::PurgeAllocator(allocator);
+}
+
 } // namespace duckdb
@@ -213,6 +213,96 @@ static void NestedComparisonExecutor(Vector &left, Vector &right, Vector &result
 	}
 }
 
+//! Strings up to this length are memcmp'd in the same batch during the second comparison phase
+static constexpr idx_t SHORT_STRING_CLASS_LENGTH = 32;
+
+//! Loads the first 16 bytes of a string_t: the length + 4-byte inlined prefix, followed by either
+//! the remaining inlined bytes or the data pointer
+static inline void LoadStringWords(const string_t &str, uint64_t &head, uint64_t &tail) {
+	memcpy(&head, const_data_ptr_cast(&str), sizeof(uint64_t));
+	memcpy(&tail, const_data_ptr_cast(&str) + sizeof(uint64_t), sizeof(uint64_t));
+}
+
+template <bool NEGATE>
+static void TemplatedStringEquality(Vector &left, Vector &right, Vector &result, idx_t count) {
+	auto ldata = FlatVector::GetData<string_t>(left);
+	auto rdata = FlatVector::GetData<string_t>(right);
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<bool>(result);
+	// both inputs are fully valid, so the result is as well
+	FlatVector::SetValidity(result, FlatVector::Validity(left));
+
+	SelectionVector short_sel(count);
+	SelectionVector long_sel(count);
+	idx_t short_count = 0;
+	idx_t long_count = 0;
+
+	// Phase 1: compare the length + 4-byte inlined prefix of every pair branch-free; for inlined
+	// strings the second word settles the comparison as well, for non-inlined strings an equal
+	// second word means an equal data pointer, so the strings are equal either way
+	for (idx_t i = 0; i < count; i++) {
+		uint64_t l_head, l_tail, r_head, r_tail;
+		LoadStringWords(ldata[i], l_head, l_tail);
+		LoadStringWords(rdata[i], r_head, r_tail);
+		const bool head_equal = l_head == r_head;
+		const bool tail_equal = l_tail == r_tail;
+		result_data[i] = NEGATE ? !(head_equal && tail_equal) : (head_equal && tail_equal);
+
+		// only non-inlined strings with matching length + prefix but different pointers survive
+		// to the memcmp phase: partition them by length class
+		const bool needs_memcmp = head_equal && !tail_equal && !ldata[i].IsInlined();
+		const bool is_short = ldata[i].GetSize() <= SHORT_STRING_CLASS_LENGTH;
+		short_sel.set_index(short_count, i);
+		short_count += needs_memcmp && is_short;
+		long_sel.set_index(long_count, i);
+		long_count += needs_memcmp && !is_short;
+	}
+
+	// Phase 2: memcmp the remainder of the survivors, one length class at a time
+	for (idx_t i = 0; i < short_count; i++) {
+		const auto idx = short_sel.get_index(i);
+		const bool equal = memcmp(ldata[idx].GetData(), rdata[idx].GetData(), ldata[idx].GetSize()) == 0;
+		result_data[idx] = NEGATE ? !equal : equal;
+	}
+	for (idx_t i = 0; i < long_count; i++) {
+		const auto idx = long_sel.get_index(i);
+		const bool equal = memcmp(ldata[idx].GetData(), rdata[idx].GetData(), ldata[idx].GetSize()) == 0;
+		result_data[idx] = NEGATE ? !equal : equal;
+	}
+}
+
+static inline bool FlatStringKernelApplies(Vector &left, Vector &right) {
+	return left.GetVectorType() == VectorType::FLAT_VECTOR && right.GetVectorType() == VectorType::FLAT_VECTOR &&
+	       FlatVector::Validity(left).AllValid() && FlatVector::Validity(right).AllValid();
+}
+
+struct StringComparisonExecutor {
+	template <class OP>
+	static inline void Execute(Vector &left, Vector &right, Vector &result, idx_t count) {
+		BinaryExecutor::Execute<string_t, string_t, bool, OP>(left, right, result, count);
+	}
+};
+
+template <>
+inline void StringComparisonExecutor::Execute<duckdb::Equals>(Vector &left, Vector &right, Vector &result,
+                                                              idx_t count) {
+	if (FlatStringKernelApplies(left, right)) {
+		TemplatedStringEquality<false>(left, right, result, count);
+		return;
+	}
+	BinaryExecutor::Execute<string_t, string_t, bool, duckdb::Equals>(left, right, result, count);
+}
+
+template <>
+inline void StringComparisonExecutor::Execute<duckdb::NotEquals>(Vector &left, Vector &right, Vector &result,
+                                                                 idx_t count) {
+	if (FlatStringKernelApplies(left, right)) {
+		TemplatedStringEquality<true>(left, right, result, count);
+		return;
+	}
+	BinaryExecutor::Execute<string_t, string_t, bool, duckdb::NotEquals>(left, right, result, count);
+}
+
 struct ComparisonExecutor {
 private:
 	template <class T, class OP>
@@ -268,7 +358,7 @@ public:
 			TemplatedExecute<interval_t, OP>(left, right, result, count);
 			break;
 		case PhysicalType::VARCHAR:
-			TemplatedExecute<string_t, OP>(left, right, result, count);
+			StringComparisonExecutor::Execute<OP>(left, right, result, count);
 			break;
 		case PhysicalType::LIST:
 		case PhysicalType::STRUCT:
@@ -23,6 +23,13 @@ static void IsNullLoop(Vector &input, Vector &result, idx_t count) {
 
 		result.SetVectorType(VectorType::FLAT_VECTOR);
 		auto result_data = FlatVector::GetData<bool>(result);
+		if (data.validity.AllValid()) {
+			// branch-free all-valid path: no need to inspect the mask row-by-row
+			for (idx_t i = 0; i < count; i++) {
+				result_data[i] = INVERSE;
+			}
+			return;
+		}
 		for (idx_t i = 0; i < count; i++) {
 			auto idx = data.sel->get_index(i);
 			result_data[i] = INVERSE ? data.validity.RowIsValid(idx) : !data.validity.RowIsValid(idx);
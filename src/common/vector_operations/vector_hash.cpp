@@ -44,6 +44,31 @@ template <bool HAS_RSEL, bool HAS_SEL_VECTOR, class T, bool INPUT_IS_ALREADY_HAS
 void TightLoopHash(const T *__restrict ldata, hash_t *__restrict result_data, const SelectionVector *rsel, idx_t count,
                    const SelectionVector *__restrict sel_vector, const ValidityMask &mask) {
 	if (!mask.AllValid()) {
+		if (!HAS_RSEL && !HAS_SEL_VECTOR && !INPUT_IS_ALREADY_HASH) {
+			// no selection vectors: process the validity mask one entry (64 rows) at a time,
+			// so mostly-valid data is hashed in the same tight (vectorizable) loop as all-valid data
+			const auto entry_count = ValidityMask::EntryCount(count);
+			idx_t base_idx = 0;
+			for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+				const auto next = MinValue<idx_t>(base_idx + ValidityMask::BITS_PER_VALUE, count);
+				const auto validity_entry = mask.GetValidityEntry(entry_idx);
+				if (ValidityMask::AllValid(validity_entry)) {
+					for (; base_idx < next; base_idx++) {
+						result_data[base_idx] = duckdb::Hash<T>(ldata[base_idx]);
+					}
+				} else if (ValidityMask::NoneValid(validity_entry)) {
+					for (; base_idx < next; base_idx++) {
+						result_data[base_idx] = HashOp::NULL_HASH;
+					}
+				} else {
+					for (idx_t entry_offset = 0; base_idx < next; base_idx++, entry_offset++) {
+						result_data[base_idx] = HashOp::Operation(
+						    ldata[base_idx], !ValidityMask::RowIsValid(validity_entry, entry_offset));
+					}
+				}
+			}
+			return;
+		}
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index_unsafe(i) : i;
 			auto idx = HAS_SEL_VECTOR ? sel_vector->get_index_unsafe(ridx) : ridx;
@@ -366,6 +391,31 @@ static inline void TightLoopCombineHash(const T *__restrict ldata, hash_t *__res
                                         const SelectionVector *__restrict const rsel, const idx_t count,
                                         const SelectionVector *__restrict const sel_vector, const ValidityMask &mask) {
 	if (!mask.AllValid()) {
+		if (!HAS_RSEL && !HAS_SEL && !INPUT_IS_ALREADY_HASH) {
+			// no selection vectors: same entry-at-a-time scheme as TightLoopHash
+			const auto entry_count = ValidityMask::EntryCount(count);
+			idx_t base_idx = 0;
+			for (idx_t entry_idx = 0; entry_idx < entry_count; entry_idx++) {
+				const auto next = MinValue<idx_t>(base_idx + ValidityMask::BITS_PER_VALUE, count);
+				const auto validity_entry = mask.GetValidityEntry(entry_idx);
+				if (ValidityMask::AllValid(validity_entry)) {
+					for (; base_idx < next; base_idx++) {
+						hash_data[base_idx] = CombineHashScalar(hash_data[base_idx], duckdb::Hash<T>(ldata[base_idx]));
+					}
+				} else if (ValidityMask::NoneValid(validity_entry)) {
+					for (; base_idx < next; base_idx++) {
+						hash_data[base_idx] = CombineHashScalar(hash_data[base_idx], HashOp::NULL_HASH);
+					}
+				} else {
+					for (idx_t entry_offset = 0; base_idx < next; base_idx++, entry_offset++) {
+						auto other_hash = HashOp::Operation(
+						    ldata[base_idx], !ValidityMask::RowIsValid(validity_entry, entry_offset));
+						hash_data[base_idx] = CombineHashScalar(hash_data[base_idx], other_hash);
+					}
+				}
+			}
+			return;
+		}
 		for (idx_t i = 0; i < count; i++) {
 			auto ridx = HAS_RSEL ? rsel->get_index_unsafe(i) : i;
 			auto idx = HAS_SEL ? sel_vector->get_index_unsafe(ridx) : ridx;
@@ -4,6 +4,7 @@
 #include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/radix_partitioning.hpp"
+#include "duckdb/common/row_operations/fused_aggregate_update.hpp"
 #include "duckdb/common/row_operations/row_operations.hpp"
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/row/tuple_data_iterator.hpp"
@@ -56,6 +57,9 @@ GroupedAggregateHashTable::GroupedAggregateHashTable(ClientContext &context_p, A
 	layout->Initialize(std::move(group_types_p), std::move(aggregate_objects_p), group_validity);
 	layout_ptr = std::move(layout);
 
+	// check if we can use the fused update path for this combination of aggregates
+	fused_update = FusedAggregateUpdater::TryCreate(*layout_ptr);
+
 	hash_offset = layout_ptr->GetOffsets()[layout_ptr->ColumnCount() - 1];
 
 	// Partitioned data and pointer table
@@ -139,6 +143,14 @@ void GroupedAggregateHashTable::Abandon() {
 	}
 
 	// Start over
+	if (old_entries) {
+		// the groups are abandoned, so there is no point in migrating the old pointer table
+		old_hash_map.Reset();
+		old_entries = nullptr;
+		old_capacity = 0;
+		old_bitmask = 0;
+		migration_cursor = 0;
+	}
 	ClearPointerTable();
 	count = 0;
 
@@ -224,6 +236,10 @@ void GroupedAggregateHashTable::Verify() {
 	if (skip_lookups) {
 		return;
 	}
+	if (old_entries) {
+		// during an incremental resize the new pointer table only holds the migrated entries
+		return;
+	}
 	idx_t total_count = 0;
 	for (idx_t i = 0; i < capacity; i++) {
 		const auto &entry = entries[i];
@@ -287,19 +303,27 @@ void GroupedAggregateHashTable::Resize(idx_t size) {
 	}
 	D_ASSERT(Count() == 0 || Count() == GetMaterializedCount());
 
+	if (old_entries) {
+		// a previous incremental resize is still in progress - drain it before starting a new one
+		FinishIncrementalResize();
+	}
+
+	if (Count() != 0) {
+		// non-empty: resize incrementally - keep the old pointer table around and migrate its entries
+		// on demand and in bounded per-chunk steps instead of rehashing everything in one go
+		old_hash_map = std::move(hash_map);
+		old_entries = entries;
+		old_capacity = capacity;
+		old_bitmask = bitmask;
+		migration_cursor = 0;
+	}
+
 	capacity = size;
 	hash_map = buffer_manager.GetBufferAllocator().Allocate(capacity * sizeof(ht_entry_t));
 	entries = reinterpret_cast<ht_entry_t *>(hash_map.get());
 	ClearPointerTable();
 	bitmask = capacity - 1;
 
-	if (Count() != 0) {
-		ReinsertTuples(*partitioned_data);
-		if (radix_bits >= UNPARTITIONED_RADIX_BITS_THRESHOLD) {
-			ReinsertTuples(*unpartitioned_data);
-		}
-	}
-
 	Verify();
 }
 
@@ -531,9 +555,79 @@ idx_t GroupedAggregateHashTable::AddChunk(DataChunk &groups, DataChunk &payload,
 	return AddChunk(groups, state.hashes, payload, filter);
 }
 
+void GroupedAggregateHashTable::InsertMigratedEntry(const ht_entry_t &old_entry) {
+	D_ASSERT(old_entry.IsOccupied());
+	const auto row_location = old_entry.GetPointer();
+	const auto hash = Load<hash_t>(row_location + hash_offset);
+	const auto salt = ht_entry_t::ExtractSalt(hash);
+
+	auto ht_offset = ApplyBitMask(hash);
+	while (entries[ht_offset].IsOccupied()) {
+		if (entries[ht_offset].GetPointer() == row_location) {
+			// already migrated on demand by an earlier chunk
+			return;
+		}
+		SaltIncrementAndWrap(ht_offset, salt, bitmask);
+	}
+	auto &entry = entries[ht_offset];
+	entry.SetSalt(salt);
+	entry.SetPointer(row_location);
+}
+
+void GroupedAggregateHashTable::MigrateChunkGroups(const hash_t *hashes, idx_t chunk_size) {
+	D_ASSERT(old_entries);
+	for (idx_t i = 0; i < chunk_size; i++) {
+		const auto &hash = hashes[i];
+		const auto salt = ht_entry_t::ExtractSalt(hash);
+		auto old_offset = hash & old_bitmask;
+		// If a group with this hash exists in the old pointer table, it lives on this probe chain
+		// before the first unoccupied entry (entries are never removed). Migrating every salt match
+		// along the chain guarantees the regular probe of the new table will find the group.
+		while (old_entries[old_offset].IsOccupied()) {
+			if (old_entries[old_offset].GetSalt() == salt) {
+				InsertMigratedEntry(old_entries[old_offset]);
+			}
+			SaltIncrementAndWrap(old_offset, salt, old_bitmask);
+		}
+	}
+}
+
+void GroupedAggregateHashTable::IncrementalResizeStep() {
+	if (!old_entries) {
+		return;
+	}
+	const auto end = MinValue<idx_t>(migration_cursor + MIGRATION_STEP, old_capacity);
+	for (; migration_cursor < end; migration_cursor++) {
+		if (old_entries[migration_cursor].IsOccupied()) {
+			InsertMigratedEntry(old_entries[migration_cursor]);
+		}
+	}
+	if (migration_cursor == old_capacity) {
+		// fully migrated - drop the old pointer table
+		old_hash_map.Reset();
+		old_entries = nullptr;
+		old_capacity = 0;
+		old_bitmask = 0;
+		migration_cursor = 0;
+		Verify();
+	}
+}
+
+void GroupedAggregateHashTable::FinishIncrementalResize() {
+	while (old_entries) {
+		IncrementalResizeStep();
+	}
+}
+
 void GroupedAggregateHashTable::UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter) {
 	// Now every cell has an entry, update the aggregates
 	auto &aggregates = layout_ptr->GetAggregates();
+	if (fused_update && filter.size() == aggregates.size()) {
+		// All aggregates are updated and the layout supports it - update them in a single fused pass
+		fused_update->Update(payload, state.addresses, payload.size());
+		Verify();
+		return;
+	}
 	idx_t filter_idx = 0;
 	idx_t payload_idx = 0;
 	for (idx_t i = 0; i < aggregates.size(); i++) {
@@ -656,6 +750,11 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 	}
 	D_ASSERT(capacity - Count() >= chunk_size); // we need to be able to fit at least one vector of data
 
+	if (DUCKDB_UNLIKELY(old_entries != nullptr)) {
+		// incremental resize in progress: migrate a bounded batch of old pointer table entries
+		IncrementalResizeStep();
+	}
+
 	// we start out with all entries [0, 1, 2, ..., chunk_size]
 	const SelectionVector *sel_vector = FlatVector::IncrementalSelectionVector();
 
@@ -702,6 +801,12 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroupsInternal(DataChunk &groups, V
 		return chunk_size;
 	}
 
+	if (DUCKDB_UNLIKELY(old_entries != nullptr)) {
+		// make sure every group of this chunk that still lives in the old pointer table is
+		// present in the new one before we probe, otherwise we would create duplicate groups
+		MigrateChunkGroups(hashes, chunk_size);
+	}
+
 	// Compute the entry in the table based on the hash using a modulo,
 	// and precompute the hash salts for faster comparison below
 	const auto ht_offsets = FlatVector::GetData<uint64_t>(state.ht_offsets);
@@ -833,7 +938,8 @@ idx_t GroupedAggregateHashTable::FindOrCreateGroups(DataChunk &groups, Vector &a
 }
 
 struct FlushMoveState {
-	explicit FlushMoveState(TupleDataCollection &collection_p)
+	explicit FlushMoveState(TupleDataCollection &collection_p,
+	                        TupleDataPinProperties properties = TupleDataPinProperties::DESTROY_AFTER_DONE)
 	    : collection(collection_p), hashes(LogicalType::HASH), group_addresses(LogicalType::POINTER),
 	      new_groups_sel(STANDARD_VECTOR_SIZE) {
 		const auto &layout = collection.GetLayout();
@@ -842,7 +948,7 @@ struct FlushMoveState {
 		for (idx_t col_idx = 0; col_idx < layout.ColumnCount() - 1; col_idx++) {
 			column_ids.emplace_back(col_idx);
 		}
-		collection.InitializeScan(scan_state, column_ids, TupleDataPinProperties::DESTROY_AFTER_DONE);
+		collection.InitializeScan(scan_state, column_ids, properties);
 		collection.InitializeScanChunk(scan_state, groups);
 		hash_col_idx = layout.ColumnCount() - 1;
 	}
@@ -916,6 +1022,57 @@ void GroupedAggregateHashTable::Combine(TupleDataCollection &other_data, optiona
 	Verify();
 }
 
+void GroupedAggregateHashTable::CombineFromFinerGrouping(TupleDataCollection &finer_data,
+                                                         const vector<idx_t> &group_map,
+                                                         optional_ptr<Vector> constant_group) {
+	const auto &finer_layout = finer_data.GetLayout();
+	D_ASSERT(finer_layout.GetAggrWidth() == layout_ptr->GetAggrWidth());
+	D_ASSERT(constant_group ? group_map.empty() : group_map.size() == layout_ptr->ColumnCount() - 1);
+
+	if (finer_data.Count() == 0) {
+		return;
+	}
+
+	// The aggregate states start at a different offset within the finer rows
+	const auto aggr_offset_delta =
+	    UnsafeNumericCast<int64_t>(finer_layout.GetAggrOffset()) - UnsafeNumericCast<int64_t>(layout_ptr->GetAggrOffset());
+
+	// Scan the finer data without destroying it: its own grouping still has to produce output from it
+	FlushMoveState fm_state(finer_data, TupleDataPinProperties::UNPIN_AFTER_DONE);
+
+	DataChunk groups;
+	auto group_types = layout_ptr->GetTypes();
+	group_types.pop_back(); // Drop the HASH column
+	groups.InitializeEmpty(group_types);
+
+	while (fm_state.Scan()) {
+		// Check for interrupts with each chunk
+		if (context.interrupted.load(std::memory_order_relaxed)) {
+			throw InterruptException();
+		}
+		const auto input_chunk_size = fm_state.groups.size();
+		if (constant_group) {
+			groups.data[0].Reference(*constant_group);
+		} else {
+			for (idx_t col_idx = 0; col_idx < group_map.size(); col_idx++) {
+				groups.data[col_idx].Reference(fm_state.groups.data[group_map[col_idx]]);
+			}
+		}
+		groups.SetCardinality(input_chunk_size);
+
+		FindOrCreateGroups(groups, fm_state.group_addresses, fm_state.new_groups_sel);
+
+		// Point the sources at the finer rows such that CombineStates finds the aggregate states,
+		// and combine non-destructively: the same states may feed multiple coarser groupings
+		auto &source_addresses = fm_state.scan_state.chunk_state.row_locations;
+		VectorOperations::AddInPlace(source_addresses, aggr_offset_delta, input_chunk_size);
+		RowOperations::CombineStates(state.row_state, *layout_ptr, source_addresses, fm_state.group_addresses,
+		                             input_chunk_size, AggregateCombineType::PRESERVE_INPUT);
+	}
+
+	Verify();
+}
+
 void GroupedAggregateHashTable::InitializeScan(AggregateHTScanState &scan_state) {
 	scan_state.partition_idx = 0;
 	vector<idx_t> group_indexes(layout_ptr->ColumnCount() - 1);
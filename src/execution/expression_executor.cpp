@@ -7,6 +7,7 @@
 #include "duckdb/main/settings.hpp"
 #include "duckdb/function/cast/cast_function_set.hpp"
 #include "duckdb/common/type_visitor.hpp"
+#include "duckdb/storage/arena_allocator.hpp"
 
 namespace duckdb {
 
@@ -43,6 +44,9 @@ ExpressionExecutor::ExpressionExecutor(const vector<unique_ptr<Expression>> &exp
 ExpressionExecutor::ExpressionExecutor() : context(nullptr) {
 }
 
+ExpressionExecutor::~ExpressionExecutor() {
+}
+
 bool ExpressionExecutor::HasContext() {
 	return context;
 }
@@ -58,6 +62,13 @@ Allocator &ExpressionExecutor::GetAllocator() {
 	return context ? Allocator::Get(*context) : Allocator::DefaultAllocator();
 }
 
+Allocator &ExpressionExecutor::GetStateAllocator() {
+	if (!state_arena) {
+		state_arena = make_uniq<ArenaAllocator>(GetAllocator());
+	}
+	return state_arena->GetAllocator();
+}
+
 void ExpressionExecutor::AddExpression(const Expression &expr) {
 	expressions.push_back(&expr);
 	auto state = make_uniq<ExpressionExecutorState>();
@@ -69,6 +80,10 @@ void ExpressionExecutor::AddExpression(const Expression &expr) {
 void ExpressionExecutor::ClearExpressions() {
 	states.clear();
 	expressions.clear();
+	if (state_arena) {
+		// all intermediate chunks are gone - recycle the arena blocks for the next set of expressions
+		state_arena->Reset();
+	}
 }
 
 void ExpressionExecutor::Initialize(const Expression &expression, ExpressionExecutorState &state) {
@@ -1,3 +1,6 @@
+#include "duckdb/common/operator/add.hpp"
+#include "duckdb/common/operator/multiply.hpp"
+#include "duckdb/common/operator/subtract.hpp"
 #include "duckdb/common/type_visitor.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/planner/expression/bound_function_expression.hpp"
@@ -5,6 +8,206 @@
 
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// Fused Arithmetic
+//===--------------------------------------------------------------------===//
+//! Evaluates a nested pair of arithmetic functions like (a + b) * c in a single pass over the leaf
+//! vectors, eliminating the materialization of the inner intermediate vector
+struct FusedFunctionInfo {
+	using fused_kernel_t = void (*)(Vector &a, Vector &b, Vector &c, Vector &result, idx_t count);
+
+	//! The kernel evaluating both operations in one loop
+	fused_kernel_t kernel;
+	//! The flattened leaf expressions: the inner function's arguments followed by the outer's other argument
+	vector<reference<Expression>> leaves;
+
+	static unique_ptr<FusedFunctionInfo> TryBind(const BoundFunctionExpression &expr);
+};
+
+namespace {
+
+enum class FusableOp : uint8_t { ADD, SUB, MUL };
+
+//! The operators the scalar arithmetic functions bind for each type (see AddFunction::GetFunction c.s.);
+//! integer arithmetic uses the overflow-checking operators, which remain result-equivalent even when
+//! statistics propagation replaced the checked function with the plain one
+template <class T>
+struct FusedArithmeticOps {
+	using ADD = AddOperatorOverflowCheck;
+	using SUB = SubtractOperatorOverflowCheck;
+	using MUL = MultiplyOperatorOverflowCheck;
+};
+
+template <>
+struct FusedArithmeticOps<float> {
+	using ADD = AddOperator;
+	using SUB = SubtractOperator;
+	using MUL = MultiplyOperator;
+};
+
+template <>
+struct FusedArithmeticOps<double> {
+	using ADD = AddOperator;
+	using SUB = SubtractOperator;
+	using MUL = MultiplyOperator;
+};
+
+//! OTHER_IS_LEFT: whether the outer function's non-nested argument (c) is its left argument
+template <class T, class INNER_OP, class OUTER_OP, bool OTHER_IS_LEFT>
+void FusedFunction(Vector &a, Vector &b, Vector &c, Vector &result, idx_t count) {
+	UnifiedVectorFormat adata;
+	UnifiedVectorFormat bdata;
+	UnifiedVectorFormat cdata;
+	a.ToUnifiedFormat(count, adata);
+	b.ToUnifiedFormat(count, bdata);
+	c.ToUnifiedFormat(count, cdata);
+	auto avals = UnifiedVectorFormat::GetData<T>(adata);
+	auto bvals = UnifiedVectorFormat::GetData<T>(bdata);
+	auto cvals = UnifiedVectorFormat::GetData<T>(cdata);
+
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto rdata = FlatVector::GetData<T>(result);
+	auto &rmask = FlatVector::Validity(result);
+
+	if (adata.validity.AllValid() && bdata.validity.AllValid() && cdata.validity.AllValid()) {
+		for (idx_t i = 0; i < count; i++) {
+			const auto inner = INNER_OP::template Operation<T, T, T>(avals[adata.sel->get_index(i)],
+			                                                         bvals[bdata.sel->get_index(i)]);
+			const auto other = cvals[cdata.sel->get_index(i)];
+			rdata[i] = OTHER_IS_LEFT ? OUTER_OP::template Operation<T, T, T>(other, inner)
+			                         : OUTER_OP::template Operation<T, T, T>(inner, other);
+		}
+	} else {
+		for (idx_t i = 0; i < count; i++) {
+			const auto aidx = adata.sel->get_index(i);
+			const auto bidx = bdata.sel->get_index(i);
+			const auto cidx = cdata.sel->get_index(i);
+			if (!adata.validity.RowIsValid(aidx) || !bdata.validity.RowIsValid(bidx) ||
+			    !cdata.validity.RowIsValid(cidx)) {
+				rmask.SetInvalid(i);
+				continue;
+			}
+			const auto inner = INNER_OP::template Operation<T, T, T>(avals[aidx], bvals[bidx]);
+			rdata[i] = OTHER_IS_LEFT ? OUTER_OP::template Operation<T, T, T>(cvals[cidx], inner)
+			                         : OUTER_OP::template Operation<T, T, T>(inner, cvals[cidx]);
+		}
+	}
+}
+
+template <class T, class INNER_OP>
+FusedFunctionInfo::fused_kernel_t GetFusedKernelOuter(FusableOp outer, bool other_is_left) {
+	using OPS = FusedArithmeticOps<T>;
+	switch (outer) {
+	case FusableOp::ADD:
+		return other_is_left ? FusedFunction<T, INNER_OP, typename OPS::ADD, true>
+		                     : FusedFunction<T, INNER_OP, typename OPS::ADD, false>;
+	case FusableOp::SUB:
+		return other_is_left ? FusedFunction<T, INNER_OP, typename OPS::SUB, true>
+		                     : FusedFunction<T, INNER_OP, typename OPS::SUB, false>;
+	default:
+		return other_is_left ? FusedFunction<T, INNER_OP, typename OPS::MUL, true>
+		                     : FusedFunction<T, INNER_OP, typename OPS::MUL, false>;
+	}
+}
+
+template <class T>
+FusedFunctionInfo::fused_kernel_t GetFusedKernelForType(FusableOp inner, FusableOp outer, bool other_is_left) {
+	using OPS = FusedArithmeticOps<T>;
+	switch (inner) {
+	case FusableOp::ADD:
+		return GetFusedKernelOuter<T, typename OPS::ADD>(outer, other_is_left);
+	case FusableOp::SUB:
+		return GetFusedKernelOuter<T, typename OPS::SUB>(outer, other_is_left);
+	default:
+		return GetFusedKernelOuter<T, typename OPS::MUL>(outer, other_is_left);
+	}
+}
+
+bool TryGetFusableOp(const Expression &expr, FusableOp &op) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_FUNCTION) {
+		return false;
+	}
+	auto &func = expr.Cast<BoundFunctionExpression>();
+	if (func.children.size() != 2 || func.bind_info || func.function.init_local_state) {
+		return false;
+	}
+	if (func.function.name == "+") {
+		op = FusableOp::ADD;
+	} else if (func.function.name == "-") {
+		op = FusableOp::SUB;
+	} else if (func.function.name == "*") {
+		op = FusableOp::MUL;
+	} else {
+		return false;
+	}
+	return true;
+}
+
+} // namespace
+
+unique_ptr<FusedFunctionInfo> FusedFunctionInfo::TryBind(const BoundFunctionExpression &expr) {
+	FusableOp outer;
+	if (!TryGetFusableOp(expr, outer)) {
+		return nullptr;
+	}
+	// the kernels are instantiated for the common numeric types without implicit casts -
+	// all arguments and results must have the exact same type
+	const auto &type = expr.return_type;
+	switch (type.id()) {
+	case LogicalTypeId::INTEGER:
+	case LogicalTypeId::BIGINT:
+	case LogicalTypeId::FLOAT:
+	case LogicalTypeId::DOUBLE:
+		break;
+	default:
+		return nullptr;
+	}
+	for (auto &child : expr.children) {
+		if (child->return_type != type) {
+			return nullptr;
+		}
+	}
+	for (idx_t inner_idx = 0; inner_idx < expr.children.size(); inner_idx++) {
+		auto &inner_expr = *expr.children[inner_idx];
+		FusableOp inner;
+		if (!TryGetFusableOp(inner_expr, inner)) {
+			continue;
+		}
+		auto &inner_func = inner_expr.Cast<BoundFunctionExpression>();
+		bool types_match = true;
+		for (auto &inner_child : inner_func.children) {
+			if (inner_child->return_type != type) {
+				types_match = false;
+				break;
+			}
+		}
+		if (!types_match) {
+			continue;
+		}
+		auto result = make_uniq<FusedFunctionInfo>();
+		const bool other_is_left = inner_idx == 1;
+		switch (type.id()) {
+		case LogicalTypeId::INTEGER:
+			result->kernel = GetFusedKernelForType<int32_t>(inner, outer, other_is_left);
+			break;
+		case LogicalTypeId::BIGINT:
+			result->kernel = GetFusedKernelForType<int64_t>(inner, outer, other_is_left);
+			break;
+		case LogicalTypeId::FLOAT:
+			result->kernel = GetFusedKernelForType<float>(inner, outer, other_is_left);
+			break;
+		default:
+			result->kernel = GetFusedKernelForType<double>(inner, outer, other_is_left);
+			break;
+		}
+		result->leaves.emplace_back(*inner_func.children[0]);
+		result->leaves.emplace_back(*inner_func.children[1]);
+		result->leaves.emplace_back(*expr.children[1 - inner_idx]);
+		return result;
+	}
+	return nullptr;
+}
+
 ExecuteFunctionState::ExecuteFunctionState(const Expression &expr, ExpressionExecutorState &root)
     : ExpressionState(expr, root) {
 	// Check if the expression is eligible for dictionary optimization
@@ -119,8 +322,16 @@ bool ExecuteFunctionState::TryExecuteDictionaryExpression(const BoundFunctionExp
 unique_ptr<ExpressionState> ExpressionExecutor::InitializeState(const BoundFunctionExpression &expr,
                                                                 ExpressionExecutorState &root) {
 	auto result = make_uniq<ExecuteFunctionState>(expr, root);
-	for (auto &child : expr.children) {
-		result->AddChild(*child);
+	result->fused = FusedFunctionInfo::TryBind(expr);
+	if (result->fused) {
+		// evaluate the flattened leaves instead of the nested function pair
+		for (auto &leaf : result->fused->leaves) {
+			result->AddChild(leaf.get());
+		}
+	} else {
+		for (auto &child : expr.children) {
+			result->AddChild(*child);
+		}
 	}
 
 	result->Finalize();
@@ -167,6 +378,20 @@ void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, Expression
                                  const SelectionVector *sel, idx_t count, Vector &result) {
 	state->intermediate_chunk.Reset();
 	auto &arguments = state->intermediate_chunk;
+	auto &execute_function_state = state->Cast<ExecuteFunctionState>();
+	if (execute_function_state.fused) {
+		// evaluate the leaves and run both operations in a single fused pass
+		auto &fused = *execute_function_state.fused;
+		for (idx_t i = 0; i < fused.leaves.size(); i++) {
+			Execute(fused.leaves[i].get(), state->child_states[i].get(), sel, count, arguments.data[i]);
+		}
+		arguments.SetCardinality(count);
+		arguments.Verify();
+		fused.kernel(arguments.data[0], arguments.data[1], arguments.data[2], result, count);
+		VerifyNullHandling(expr, arguments, result);
+		D_ASSERT(result.GetType() == expr.return_type);
+		return;
+	}
 	if (!state->types.empty()) {
 		for (idx_t i = 0; i < expr.children.size(); i++) {
 			D_ASSERT(state->types[i] == expr.children[i]->return_type);
@@ -182,7 +407,6 @@ void ExpressionExecutor::Execute(const BoundFunctionExpression &expr, Expression
 	arguments.Verify();
 
 	D_ASSERT(expr.function.function);
-	auto &execute_function_state = state->Cast<ExecuteFunctionState>();
 	if (!execute_function_state.TryExecuteDictionaryExpression(expr, arguments, *state, result)) {
 		expr.function.function(arguments, *state, result);
 	}
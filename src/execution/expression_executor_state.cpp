@@ -21,7 +21,8 @@ void ExpressionState::Finalize() {
 	if (types.empty()) {
 		return;
 	}
-	intermediate_chunk.Initialize(GetAllocator(), types, initialize);
+	// the intermediates live exactly as long as the executor, so they come out of its arena
+	intermediate_chunk.Initialize(root.executor->GetStateAllocator(), types, initialize);
 }
 
 Allocator &ExpressionState::GetAllocator() {
@@ -1,5 +1,6 @@
 #include "duckdb/execution/index/art/art.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/types/conflict_manager.hpp"
 #include "duckdb/common/unordered_map.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
@@ -477,14 +478,26 @@ ErrorData ART::Insert(IndexLock &l, DataChunk &chunk, Vector &row_ids, IndexAppe
 	optional_idx conflict_idx;
 	auto was_empty = !tree.HasMetadata();
 
-	// Insert the entries into the index.
+	// Insert the entries in sorted key order: adjacent keys share path prefixes, so the
+	// descent stays cache-resident and node growth clusters instead of revisiting cold paths.
+	unsafe_vector<idx_t> insert_order(row_count);
 	for (idx_t i = 0; i < row_count; i++) {
+		insert_order[i] = i;
+	}
+	std::sort(insert_order.begin(), insert_order.end(),
+	          [&keys](const idx_t lhs, const idx_t rhs) { return keys[rhs] > keys[lhs]; });
+
+	// Insert the entries into the index.
+	optional_idx conflict_pos;
+	for (idx_t pos = 0; pos < row_count; pos++) {
+		const auto i = insert_order[pos];
 		if (keys[i].Empty()) {
 			continue;
 		}
 		conflict_type = ARTOperator::Insert(arena, *this, tree, keys[i], 0, row_id_keys[i], GateStatus::GATE_NOT_SET,
 		                                    delete_art, info.append_mode);
 		if (conflict_type != ARTConflictType::NO_CONFLICT) {
+			conflict_pos = pos;
 			conflict_idx = i;
 			break;
 		}
@@ -492,8 +505,9 @@ ErrorData ART::Insert(IndexLock &l, DataChunk &chunk, Vector &row_ids, IndexAppe
 
 	// Remove any previously inserted entries.
 	if (conflict_type != ARTConflictType::NO_CONFLICT) {
-		D_ASSERT(conflict_idx.IsValid());
-		for (idx_t i = 0; i < conflict_idx.GetIndex(); i++) {
+		D_ASSERT(conflict_pos.IsValid());
+		for (idx_t pos = 0; pos < conflict_pos.GetIndex(); pos++) {
+			const auto i = insert_order[pos];
 			if (keys[i].Empty()) {
 				continue;
 			}
@@ -854,6 +868,11 @@ void ART::VerifyConstraint(DataChunk &chunk, IndexAppendInfo &info, ConflictMana
 		delete_art = info.delete_index->Cast<ART>();
 	}
 
+	// Look up the leaves of all keys in one batch,
+	// which amortizes node visits across duplicate keys and shared prefixes.
+	unsafe_vector<unsafe_optional_ptr<const Node>> leaves(expr_chunk.size());
+	ARTOperator::LookupBatch(*this, tree, keys, expr_chunk.size(), leaves);
+
 	optional_idx conflict_idx;
 	for (idx_t i = 0; !conflict_idx.IsValid() && i < chunk.size(); i++) {
 		if (keys[i].Empty()) {
@@ -863,7 +882,7 @@ void ART::VerifyConstraint(DataChunk &chunk, IndexAppendInfo &info, ConflictMana
 			continue;
 		}
 
-		auto leaf = ARTOperator::Lookup(*this, tree, keys[i], 0);
+		auto &leaf = leaves[i];
 		if (!leaf) {
 			continue;
 		}
@@ -1167,7 +1186,7 @@ void ART::InitializeMerge(Node &node, unsafe_vector<idx_t> &upper_bounds) {
 	scanner.Scan(handler);
 }
 
-bool ART::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
+bool ART::MergeIndexes(IndexLock &state, BoundIndex &other_index, optional_ptr<atomic<bool>> interrupted) {
 	auto &other_art = other_index.Cast<ART>();
 	if (!other_art.tree.HasMetadata()) {
 		return true;
@@ -1191,7 +1210,7 @@ bool ART::MergeIndexes(IndexLock &state, BoundIndex &other_index) {
 	D_ASSERT(tree.GetGateStatus() == other_art.tree.GetGateStatus());
 	if (tree.HasMetadata()) {
 		ArenaAllocator arena(Allocator::Get(db));
-		ARTMerger merger(arena, *this);
+		ARTMerger merger(arena, *this, interrupted);
 		merger.Init(tree, other_art.tree);
 		return merger.Merge() == ARTConflictType::NO_CONFLICT;
 	}
@@ -17,7 +17,16 @@ void ARTMerger::Init(Node &left, Node &right) {
 }
 
 ARTConflictType ARTMerger::Merge() {
+	idx_t entries_since_check = 0;
 	while (!s.empty()) {
+		// Poll the interrupt flag at bounded intervals, so that cancelling a long merge takes effect quickly.
+		if (interrupted && ++entries_since_check >= INTERRUPT_CHECK_INTERVAL) {
+			entries_since_check = 0;
+			if (interrupted->load(std::memory_order_relaxed)) {
+				throw InterruptException();
+			}
+		}
+
 		// Copy the entry so we can pop it.
 		auto entry = s.top();
 		s.pop();
@@ -73,10 +73,10 @@ ErrorData BoundIndex::Insert(IndexLock &l, DataChunk &chunk, Vector &row_ids, In
 	throw NotImplementedException("this implementation of Insert does not exist.");
 }
 
-bool BoundIndex::MergeIndexes(BoundIndex &other_index) {
+bool BoundIndex::MergeIndexes(BoundIndex &other_index, optional_ptr<atomic<bool>> interrupted) {
 	IndexLock state;
 	InitializeLock(state);
-	return MergeIndexes(state, other_index);
+	return MergeIndexes(state, other_index, interrupted);
 }
 
 string BoundIndex::VerifyAndToString(const bool only_verify) {
@@ -55,6 +55,7 @@ IndexPointer FixedSizeAllocator::New() {
 		// Set and initialize the bitmask of the new buffer.
 		D_ASSERT(buffers.find(buffer_id) != buffers.end());
 		auto &buffer = buffers.find(buffer_id)->second;
+		free_space_buffer = buffer.get();
 
 		// Get a handle to the buffer's validity mask (offset 0).
 		SegmentHandle handle(*buffer, 0);
@@ -66,17 +67,19 @@ IndexPointer FixedSizeAllocator::New() {
 	// Extract an index pointer to a free segment.
 
 	D_ASSERT(buffer_with_free_space.IsValid());
+	D_ASSERT(free_space_buffer);
 	auto buffer_id = buffer_with_free_space.GetIndex();
 
-	D_ASSERT(buffers.find(buffer_id) != buffers.end());
-	auto &buffer = buffers.find(buffer_id)->second;
-	auto offset = buffer->GetOffset(bitmask_count, available_segments_per_buffer);
+	// The buffer pointer is cached alongside buffer_with_free_space,
+	// so allocations do not pay for a hash lookup per segment.
+	auto &buffer = *free_space_buffer;
+	auto offset = buffer.GetOffset(bitmask_count, available_segments_per_buffer);
 
 	total_segment_count++;
-	buffer->segment_count++;
+	buffer.segment_count++;
 
 	// If the buffer is full, we cache the next buffer that we're going to fill.
-	if (buffer->segment_count == available_segments_per_buffer) {
+	if (buffer.segment_count == available_segments_per_buffer) {
 		buffers_with_free_space.erase(buffer_id);
 		NextBufferWithFreeSpace();
 	}
@@ -102,6 +105,10 @@ void FixedSizeAllocator::Free(const IndexPointer ptr) {
 		mask.SetValid(offset);
 	}
 
+	// Move the buffer's free-bit cursor back, if the freed segment precedes it.
+	auto entry_idx = offset / (sizeof(validity_t) * 8);
+	buffer->first_free_entry = MinValue<idx_t>(buffer->first_free_entry, entry_idx);
+
 	D_ASSERT(total_segment_count > 0);
 	D_ASSERT(buffer->segment_count > 0);
 
@@ -114,6 +121,7 @@ void FixedSizeAllocator::Free(const IndexPointer ptr) {
 		buffers_with_free_space.insert(buffer_id);
 		if (!buffer_with_free_space.IsValid()) {
 			buffer_with_free_space = buffer_id;
+			free_space_buffer = buffer.get();
 		}
 		return;
 	}
@@ -141,6 +149,7 @@ void FixedSizeAllocator::Reset() {
 	buffers.clear();
 	buffers_with_free_space.clear();
 	buffer_with_free_space.SetInvalid();
+	free_space_buffer = nullptr;
 	total_segment_count = 0;
 }
 
@@ -412,9 +421,12 @@ void FixedSizeAllocator::VerifyBuffers() {
 void FixedSizeAllocator::NextBufferWithFreeSpace() {
 	if (!buffers_with_free_space.empty()) {
 		buffer_with_free_space = *buffers_with_free_space.begin();
+		D_ASSERT(buffers.find(buffer_with_free_space.GetIndex()) != buffers.end());
+		free_space_buffer = buffers.find(buffer_with_free_space.GetIndex())->second.get();
 		return;
 	}
 	buffer_with_free_space.SetInvalid();
+	free_space_buffer = nullptr;
 }
 
 } // namespace duckdb
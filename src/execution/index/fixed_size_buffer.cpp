@@ -36,8 +36,8 @@ constexpr idx_t FixedSizeBuffer::BASE[];
 constexpr uint8_t FixedSizeBuffer::SHIFT[];
 
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, MemoryTag memory_tag)
-    : block_manager(block_manager), readers(0), segment_count(0), allocation_size(0), dirty(false), vacuum(false),
-      loaded(false), block_pointer(), block_handle(nullptr) {
+    : block_manager(block_manager), readers(0), segment_count(0), allocation_size(0), first_free_entry(0),
+      dirty(false), vacuum(false), loaded(false), block_pointer(), block_handle(nullptr) {
 
 	auto &buffer_manager = block_manager.buffer_manager;
 	buffer_handle = buffer_manager.Allocate(memory_tag, &block_manager, false);
@@ -51,7 +51,7 @@ FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, MemoryTag memory_t
 FixedSizeBuffer::FixedSizeBuffer(BlockManager &block_manager, const idx_t segment_count, const idx_t allocation_size,
                                  const BlockPointer &block_pointer)
     : block_manager(block_manager), readers(0), segment_count(segment_count), allocation_size(allocation_size),
-      dirty(false), vacuum(false), loaded(false), block_pointer(block_pointer) {
+      first_free_entry(0), dirty(false), vacuum(false), loaded(false), block_pointer(block_pointer) {
 
 	D_ASSERT(block_pointer.IsValid());
 	block_handle = block_manager.RegisterBlock(block_pointer.block_id);
@@ -173,7 +173,9 @@ uint32_t FixedSizeBuffer::GetOffset(const idx_t bitmask_count, const idx_t avail
 		return UnsafeNumericCast<uint32_t>(segment_count);
 	}
 
-	for (idx_t entry_idx = 0; entry_idx < bitmask_count; entry_idx++) {
+	// resume the search at the first entry that can contain a free bit,
+	// instead of rescanning fully allocated entries on every allocation
+	for (idx_t entry_idx = first_free_entry; entry_idx < bitmask_count; entry_idx++) {
 		// get an entry with free bits
 		if (data[entry_idx] == 0) {
 			continue;
@@ -203,6 +205,7 @@ uint32_t FixedSizeBuffer::GetOffset(const idx_t bitmask_count, const idx_t avail
 		auto prev_bits = entry_idx * sizeof(validity_t) * 8;
 		D_ASSERT(mask.RowIsValid(prev_bits + first_valid_bit));
 		mask.SetInvalid(prev_bits + first_valid_bit);
+		first_free_entry = entry_idx;
 		return UnsafeNumericCast<uint32_t>(prev_bits + first_valid_bit);
 	}
 
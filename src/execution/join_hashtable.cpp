@@ -110,6 +110,8 @@ JoinHashTable::JoinHashTable(ClientContext &context_p, const PhysicalOperator &o
 	dead_end = make_unsafe_uniq_array_uninitialized<data_t>(layout_ptr->GetRowWidth());
 	memset(dead_end.get(), 0, layout_ptr->GetRowWidth());
 
+	hash_histogram.resize(HASH_HISTOGRAM_SIZE, 0);
+
 	if (join_type == JoinType::SINGLE) {
 		single_join_error_on_multiple_rows = DBConfig::GetSetting<ScalarSubqueryErrorOnMultipleRowsSetting>(context);
 	}
@@ -129,6 +131,9 @@ void JoinHashTable::Merge(JoinHashTable &other) {
 	{
 		lock_guard<mutex> guard(data_lock);
 		data_collection->Combine(*other.data_collection);
+		for (idx_t i = 0; i < HASH_HISTOGRAM_SIZE; i++) {
+			hash_histogram[i] += other.hash_histogram[i];
+		}
 	}
 
 	if (join_type == JoinType::MARK) {
@@ -170,6 +175,17 @@ idx_t GetOptionalIndex(const SelectionVector *sel, const idx_t idx) {
 	return HAS_SEL ? sel->get_index(idx) : idx;
 }
 
+//! The number of probes we keep in flight ahead of the one currently being processed:
+//! the entry cache line of probe i + PROBE_PREFETCH_DISTANCE is prefetched before probe i
+//! is inspected, so pointer chasing overlaps the DRAM latency of later probes
+static constexpr idx_t PROBE_PREFETCH_DISTANCE = 16;
+
+static inline void PrefetchProbe(const void *ptr) {
+#if defined(__GNUC__) || defined(__clang__)
+	__builtin_prefetch(ptr, 0, 3);
+#endif
+}
+
 static void AddPointerToCompare(JoinHashTable::ProbeState &state, const ht_entry_t &entry, Vector &pointers_result_v,
                                 idx_t row_ht_offset, idx_t &keys_to_compare_count, const idx_t &row_index) {
 
@@ -178,6 +194,8 @@ static void AddPointerToCompare(JoinHashTable::ProbeState &state, const ht_entry
 
 	state.keys_to_compare_sel.set_index(keys_to_compare_count, row_index);
 	row_ptr_insert_to[row_index] = entry.GetPointer();
+	// start pulling in the tuple line now - it is only dereferenced in the Match call after this loop
+	PrefetchProbe(entry.GetPointer());
 
 	// If the key does not match, we have to continue linear probing, we need to store the ht_offset and the salt
 	// for this element based on the row_index. We can't get the offset from the hash as we already might have
@@ -194,7 +212,17 @@ static idx_t ProbeForPointersInternal(JoinHashTable::ProbeState &state, JoinHash
 
 	idx_t keys_to_compare_count = 0;
 
+	// prime the probe pipeline: prefetch the entry lines of the first probes up front
+	const idx_t prime_count = MinValue<idx_t>(count, PROBE_PREFETCH_DISTANCE);
+	for (idx_t i = 0; i < prime_count; i++) {
+		PrefetchProbe(&entries[hashes_dense[i] & ht.bitmask]);
+	}
+
 	for (idx_t i = 0; i < count; i++) {
+		// keep PROBE_PREFETCH_DISTANCE probes in flight
+		if (i + PROBE_PREFETCH_DISTANCE < count) {
+			PrefetchProbe(&entries[hashes_dense[i + PROBE_PREFETCH_DISTANCE] & ht.bitmask]);
+		}
 
 		auto row_hash = hashes_dense[i]; // hashes have been flattened before -> always access dense
 		auto row_ht_offset = row_hash & ht.bitmask;
@@ -445,6 +473,16 @@ void JoinHashTable::Build(PartitionedTupleDataAppendState &append_state, DataChu
 	// note that we only hash the keys used in the equality comparison
 	Hash(keys, *current_sel, added_count, hash_values);
 
+	// update the histogram over the low hash bits (this HT is thread-local during the sink)
+	// all duplicates of a key land in the same bucket, which lets us estimate key skew later on
+	UnifiedVectorFormat hash_data;
+	hash_values.ToUnifiedFormat(source_chunk.size(), hash_data);
+	auto hashes = UnifiedVectorFormat::GetData<hash_t>(hash_data);
+	for (idx_t i = 0; i < added_count; i++) {
+		auto row_idx = hash_data.sel->get_index(current_sel->get_index(i));
+		hash_histogram[hashes[row_idx] & (HASH_HISTOGRAM_SIZE - 1)]++;
+	}
+
 	// Re-reference and ToUnifiedFormat the hash column after computing it
 	source_chunk.data[col_offset].Reference(hash_values);
 	hash_values.ToUnifiedFormat(source_chunk.size(), append_state.chunk_state.vector_data.back().unified);
@@ -783,6 +821,10 @@ void JoinHashTable::Finalize(idx_t chunk_idx_from, idx_t chunk_idx_to, bool para
 
 	InsertState insert_state(*this);
 	do {
+		// Check for interrupts with each chunk
+		if (context.interrupted.load(std::memory_order_relaxed)) {
+			throw InterruptException();
+		}
 		const auto count = iterator.GetCurrentChunkCount();
 		for (idx_t i = 0; i < count; i++) {
 			hash_data[i] = Load<hash_t>(row_locations[i] + pointer_offset);
@@ -1516,8 +1558,30 @@ void JoinHashTable::Unpartition() {
 	data_collection = sink_collection->GetUnpartitioned();
 }
 
+idx_t JoinHashTable::GetLargestKeyCountEstimate(const vector<unique_ptr<JoinHashTable>> &local_hts) const {
+	unsafe_vector<idx_t> histogram(hash_histogram.begin(), hash_histogram.end());
+	for (auto &local_ht : local_hts) {
+		for (idx_t i = 0; i < HASH_HISTOGRAM_SIZE; i++) {
+			histogram[i] += local_ht->hash_histogram[i];
+		}
+	}
+
+	idx_t total_count = 0;
+	idx_t largest_bucket = 0;
+	for (idx_t i = 0; i < HASH_HISTOGRAM_SIZE; i++) {
+		total_count += histogram[i];
+		largest_bucket = MaxValue<idx_t>(largest_bucket, histogram[i]);
+	}
+	if (largest_bucket == 0) {
+		return 0;
+	}
+	// subtract the expected uniform share of the other keys from the largest bucket
+	const auto background_count = (total_count - largest_bucket) / (HASH_HISTOGRAM_SIZE - 1);
+	return largest_bucket - MinValue<idx_t>(largest_bucket, background_count);
+}
+
 void JoinHashTable::SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
-                                            const idx_t max_partition_count) {
+                                            const idx_t max_partition_count, const idx_t largest_key_count) {
 	D_ASSERT(max_partition_size + PointerTableSize(max_partition_count) > max_ht_size);
 
 	const auto max_added_bits = RadixPartitioning::MAX_RADIX_BITS - radix_bits;
@@ -1534,6 +1598,12 @@ void JoinHashTable::SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t
 			// Aim for an estimated partition size of max_ht_size / 4
 			break;
 		}
+		if (new_estimated_count <= static_cast<double>(largest_key_count)) {
+			// The largest partition is dominated by a single heavily-repeated key, which always hashes to the
+			// same partition: adding more bits cannot shrink it further, so don't pay for partitioning we
+			// cannot benefit from
+			break;
+		}
 	}
 	radix_bits += added_bits;
 	sink_collection =
@@ -1659,9 +1729,14 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &prob
 	const auto false_count = probe_keys.size() - true_count;
 
 	// can't probe these values right now, append to spill
+	// only the spill columns are kept - the other columns are not needed for the next probe round
 	spill_chunk.Reset();
-	spill_chunk.Reference(probe_chunk);
+	auto &spill_column_ids = probe_spill.spill_column_ids;
+	for (idx_t col_idx = 0; col_idx < spill_column_ids.size(); col_idx++) {
+		spill_chunk.data[col_idx].Reference(probe_chunk.data[spill_column_ids[col_idx]]);
+	}
 	spill_chunk.data.back().Reference(hashes);
+	spill_chunk.SetCardinality(probe_chunk);
 	spill_chunk.Slice(false_sel, false_count);
 	probe_spill.Append(spill_chunk, spill_state);
 
@@ -1681,8 +1756,9 @@ void JoinHashTable::ProbeAndSpill(ScanStructure &scan_structure, DataChunk &prob
 	               scan_structure.pointers, scan_structure.sel_vector, scan_structure.has_null_value_filter);
 }
 
-ProbeSpill::ProbeSpill(JoinHashTable &ht, ClientContext &context, const vector<LogicalType> &probe_types)
-    : ht(ht), context(context), probe_types(probe_types) {
+ProbeSpill::ProbeSpill(JoinHashTable &ht, ClientContext &context, const vector<LogicalType> &probe_types,
+                       vector<column_t> spill_column_ids)
+    : spill_column_ids(std::move(spill_column_ids)), ht(ht), context(context), probe_types(probe_types) {
 	global_partitions =
 	    make_uniq<RadixPartitionedColumnData>(context, probe_types, ht.radix_bits, probe_types.size() - 1);
 	column_ids.reserve(probe_types.size());
@@ -117,29 +117,41 @@ DistinctAggregateData::DistinctAggregateData(const DistinctAggregateCollectionIn
 
 using aggr_ref_t = reference<BoundAggregateExpression>;
 
-struct FindMatchingAggregate {
-	explicit FindMatchingAggregate(const aggr_ref_t &aggr) : aggr_r(aggr) {
+//! Checks whether "aggr" can share the deduplication table owned by "other": the filters must
+//! match and the aggregates must read the same (multi)set of input columns, though not
+//! necessarily in the same order. On a match, "column_map" holds for every child of "aggr" the
+//! column of the shared table that contains the child's data.
+static bool CanShareTable(const BoundAggregateExpression &aggr, const BoundAggregateExpression &other,
+                          vector<idx_t> &column_map) {
+	if (other.children.size() != aggr.children.size()) {
+		return false;
 	}
-	bool operator()(const aggr_ref_t other_r) {
-		auto &other = other_r.get();
-		auto &aggr = aggr_r.get();
-		if (other.children.size() != aggr.children.size()) {
-			return false;
+	if (!Expression::Equals(aggr.filter, other.filter)) {
+		return false;
+	}
+	column_map.clear();
+	vector<bool> used(other.children.size(), false);
+	for (idx_t i = 0; i < aggr.children.size(); i++) {
+		auto &aggr_child = aggr.children[i]->Cast<BoundReferenceExpression>();
+		bool found = false;
+		for (idx_t j = 0; j < other.children.size(); j++) {
+			if (used[j]) {
+				continue;
+			}
+			auto &other_child = other.children[j]->Cast<BoundReferenceExpression>();
+			if (other_child.index == aggr_child.index) {
+				column_map.push_back(j);
+				used[j] = true;
+				found = true;
+				break;
+			}
 		}
-		if (!Expression::Equals(aggr.filter, other.filter)) {
+		if (!found) {
 			return false;
 		}
-		for (idx_t i = 0; i < aggr.children.size(); i++) {
-			auto &other_child = other.children[i]->Cast<BoundReferenceExpression>();
-			auto &aggr_child = aggr.children[i]->Cast<BoundReferenceExpression>();
-			if (other_child.index != aggr_child.index) {
-				return false;
-			}
-		}
-		return true;
 	}
-	const aggr_ref_t aggr_r;
-};
+	return true;
+}
 
 idx_t DistinctAggregateCollectionInfo::CreateTableIndexMap() {
 	vector<aggr_ref_t> table_inputs;
@@ -149,16 +161,27 @@ idx_t DistinctAggregateCollectionInfo::CreateTableIndexMap() {
 		D_ASSERT(agg_idx < aggregates.size());
 		auto &aggregate = aggregates[agg_idx]->Cast<BoundAggregateExpression>();
 
-		auto matching_inputs =
-		    std::find_if(table_inputs.begin(), table_inputs.end(), FindMatchingAggregate(std::ref(aggregate)));
-		if (matching_inputs != table_inputs.end()) {
-			//! Assign the existing table to the aggregate
-			auto found_idx = NumericCast<idx_t>(std::distance(table_inputs.begin(), matching_inputs));
-			table_map[agg_idx] = found_idx;
+		vector<idx_t> column_map;
+		bool shares_table = false;
+		for (idx_t table_idx = 0; table_idx < table_inputs.size(); table_idx++) {
+			if (CanShareTable(aggregate, table_inputs[table_idx].get(), column_map)) {
+				//! Assign the existing table to the aggregate
+				table_map[agg_idx] = table_idx;
+				column_maps[agg_idx] = std::move(column_map);
+				shares_table = true;
+				break;
+			}
+		}
+		if (shares_table) {
 			continue;
 		}
-		//! Create a new table and assign its index to the aggregate
+		//! Create a new table and assign its index to the aggregate (identity column map)
+		column_map.clear();
+		for (idx_t i = 0; i < aggregate.children.size(); i++) {
+			column_map.push_back(i);
+		}
 		table_map[agg_idx] = table_inputs.size();
+		column_maps[agg_idx] = std::move(column_map);
 		table_inputs.push_back(std::ref(aggregate));
 	}
 	//! Every distinct aggregate needs to be assigned an index
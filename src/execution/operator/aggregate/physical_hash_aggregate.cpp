@@ -185,6 +185,38 @@ PhysicalHashAggregate::PhysicalHashAggregate(PhysicalPlan &physical_plan, Client
 		groupings.emplace_back(grouping_sets[i], grouped_aggregate_data, distinct_collection_info, group_validity,
 		                       distinct_validity);
 	}
+
+	if (grouping_sets.size() > 1 && !distinct_collection_info) {
+		// Single-pass GROUPING SETS: if one grouping set is a superset of all others, we can sink the input into
+		// just that grouping and fill the coarser ones by combining its aggregate states at Finalize
+		idx_t finest_idx = 0;
+		for (idx_t i = 1; i < grouping_sets.size(); i++) {
+			if (grouping_sets[i].size() > grouping_sets[finest_idx].size()) {
+				finest_idx = i;
+			}
+		}
+		bool can_replay = true;
+		auto &finest_set = grouping_sets[finest_idx];
+		for (idx_t i = 0; i < grouping_sets.size(); i++) {
+			for (auto &entry : grouping_sets[i]) {
+				if (finest_set.find(entry) == finest_set.end()) {
+					can_replay = false;
+					break;
+				}
+			}
+		}
+		// All aggregate states have to support being combined
+		for (auto &aggregate : aggregates) {
+			auto &aggr = aggregate->Cast<BoundAggregateExpression>();
+			if (!aggr.function.combine) {
+				can_replay = false;
+				break;
+			}
+		}
+		if (can_replay) {
+			finest_grouping_idx = finest_idx;
+		}
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -397,6 +429,10 @@ SinkResultType PhysicalHashAggregate::Sink(ExecutionContext &context, DataChunk
 
 	// For every grouping set there is one radix_table
 	for (idx_t i = 0; i < groupings.size(); i++) {
+		if (finest_grouping_idx.IsValid() && i != finest_grouping_idx.GetIndex()) {
+			// This grouping is filled from the finest grouping at Finalize instead
+			continue;
+		}
 		auto &grouping_global_state = global_state.grouping_states[i];
 		auto &grouping_local_state = local_state.grouping_states[i];
 		InterruptState interrupt_state;
@@ -740,9 +776,12 @@ TaskExecutionResult HashAggregateDistinctFinalizeTask::AggregateDistinctGrouping
 			}
 			group_chunk.SetCardinality(output_chunk);
 
+			// The column map translates child positions to table columns - they differ when this
+			// aggregate shares its table with an aggregate reading the same inputs in another order
+			auto &column_map = distinct_data.info.column_maps.at(agg_idx);
 			for (idx_t child_idx = 0; child_idx < grouped_aggregate_data.groups.size() - group_by_size; child_idx++) {
 				aggregate_input_chunk.data[payload_idx + child_idx].Reference(
-				    output_chunk.data[group_by_size + child_idx]);
+				    output_chunk.data[group_by_size + column_map[child_idx]]);
 			}
 			aggregate_input_chunk.SetCardinality(output_chunk);
 
@@ -790,6 +829,21 @@ SinkFinalizeType PhysicalHashAggregate::FinalizeInternal(Pipeline &pipeline, Eve
 		return FinalizeDistinct(pipeline, event, context, gstate_p);
 	}
 
+	if (finest_grouping_idx.IsValid()) {
+		// The input was only sunk into the finest grouping: fill the coarser groupings by re-grouping its
+		// combined data before any of the tables is finalized
+		auto &finest_table = groupings[finest_grouping_idx.GetIndex()].table_data;
+		auto &finest_gstate = *gstate.grouping_states[finest_grouping_idx.GetIndex()].table_state;
+		for (idx_t i = 0; i < groupings.size(); i++) {
+			if (i == finest_grouping_idx.GetIndex()) {
+				continue;
+			}
+			auto &grouping_gstate = gstate.grouping_states[i];
+			groupings[i].table_data.CombineFromFinerTable(context, *grouping_gstate.table_state, finest_table,
+			                                              finest_gstate);
+		}
+	}
+
 	for (idx_t i = 0; i < groupings.size(); i++) {
 		auto &grouping = groupings[i];
 		auto &grouping_gstate = gstate.grouping_states[i];
@@ -2,6 +2,7 @@
 
 #include "duckdb/execution/aggregate_hashtable.hpp"
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/execution/operator/order/physical_order.hpp"
 #include "duckdb/function/aggregate_function.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_window_expression.hpp"
@@ -257,6 +258,108 @@ public:
 		Vector temp;
 	};
 
+	struct RankState {
+		RankState(ClientContext &client, BoundWindowExpression &wexpr, Allocator &allocator) : executor(client) {
+			vector<LogicalType> order_types;
+			for (auto &order : wexpr.orders) {
+				order_types.push_back(order.expression->return_type);
+				executor.AddExpression(*order.expression);
+			}
+			order_chunk.Initialize(allocator, order_types);
+			prev_row.Initialize(allocator, order_types);
+			shift_sel.Initialize();
+			candidate_sel.Initialize();
+			peer_sel.Initialize();
+		}
+
+		void Execute(ExecutionContext &context, DataChunk &input, Vector &result, bool dense) {
+			const idx_t count = input.size();
+			order_chunk.Reset();
+			executor.Execute(input, order_chunk);
+			order_chunk.Flatten();
+
+			//	Mark the rows that start a new peer group: rows are peers if their ORDER BY values match
+			ValidityMask new_group_mask;
+			new_group_mask.Initialize(count);
+			if (count > 1) {
+				//	Compare each row with its predecessor, one ORDER BY column at a time
+				for (idx_t i = 0; i < count; i++) {
+					shift_sel.set_index(i, i == 0 ? 0 : i - 1);
+				}
+				idx_t candidate_count = count - 1;
+				for (idx_t i = 0; i < candidate_count; i++) {
+					candidate_sel.set_index(i, i + 1);
+				}
+				optional_ptr<const SelectionVector> candidates(&candidate_sel);
+				for (idx_t col_idx = 0; col_idx < order_chunk.ColumnCount() && candidate_count; col_idx++) {
+					Vector prev_vec(order_chunk.data[col_idx]);
+					prev_vec.Slice(shift_sel, count);
+					candidate_count = VectorOperations::NotDistinctFrom(order_chunk.data[col_idx], prev_vec,
+					                                                    candidates, candidate_count, &peer_sel, nullptr);
+					candidates = &peer_sel;
+				}
+				//	The rows that survived all comparisons are peers of their predecessor
+				for (idx_t i = 0; i < candidate_count; i++) {
+					new_group_mask.SetInvalid(peer_sel.get_index(i));
+				}
+			}
+			//	The first row is compared against the last row of the previous chunk
+			if (has_prev) {
+				bool is_peer = true;
+				for (idx_t col_idx = 0; col_idx < order_chunk.ColumnCount(); col_idx++) {
+					if (!Value::NotDistinctFrom(prev_row.GetValue(col_idx, 0), order_chunk.GetValue(col_idx, 0))) {
+						is_peer = false;
+						break;
+					}
+				}
+				if (is_peer) {
+					new_group_mask.SetInvalid(0);
+				}
+			}
+
+			auto rdata = FlatVector::GetData<int64_t>(result);
+			for (idx_t i = 0; i < count; i++) {
+				if (new_group_mask.RowIsValid(i)) {
+					if (row_number) {
+						++dense_rank;
+					}
+					rank = row_number + 1;
+				}
+				++row_number;
+				rdata[i] = dense ? dense_rank : rank;
+			}
+
+			//	Remember the last row for the next chunk
+			prev_row.Reset();
+			for (idx_t col_idx = 0; col_idx < order_chunk.ColumnCount(); col_idx++) {
+				VectorOperations::Copy(order_chunk.data[col_idx], prev_row.data[col_idx], count, count - 1, 0);
+			}
+			prev_row.SetCardinality(1);
+			has_prev = true;
+		}
+
+		//! Executor for the ORDER BY expressions
+		ExpressionExecutor executor;
+		//! The ORDER BY values of the current chunk
+		DataChunk order_chunk;
+		//! The ORDER BY values of the last row of the previous chunk
+		DataChunk prev_row;
+		//! Whether we have seen any rows yet
+		bool has_prev = false;
+		//! The number of rows produced so far
+		int64_t row_number = 0;
+		//! The current RANK value
+		int64_t rank = 1;
+		//! The current DENSE_RANK value
+		int64_t dense_rank = 1;
+		//! Selection vector mapping each row to its predecessor
+		SelectionVector shift_sel;
+		//! The rows still matching their predecessor
+		SelectionVector candidate_sel;
+		//! The rows that are peers of their predecessor
+		SelectionVector peer_sel;
+	};
+
 	explicit StreamingWindowState(ClientContext &client) : initialized(false), allocator(Allocator::Get(client)) {
 	}
 
@@ -267,6 +370,7 @@ public:
 		const_vectors.resize(expressions.size());
 		aggregate_states.resize(expressions.size());
 		lead_lag_states.resize(expressions.size());
+		rank_states.resize(expressions.size());
 
 		for (idx_t expr_idx = 0; expr_idx < expressions.size(); expr_idx++) {
 			auto &expr = *expressions[expr_idx];
@@ -292,7 +396,12 @@ public:
 			}
 			case ExpressionType::WINDOW_RANK:
 			case ExpressionType::WINDOW_RANK_DENSE: {
-				const_vectors[expr_idx] = make_uniq<Vector>(Value((int64_t)1));
+				if (wexpr.orders.empty()) {
+					// Without an ORDER BY all rows are peers, so the rank is constant
+					const_vectors[expr_idx] = make_uniq<Vector>(Value((int64_t)1));
+				} else {
+					rank_states[expr_idx] = make_uniq<RankState>(context, wexpr, allocator);
+				}
 				break;
 			}
 			case ExpressionType::WINDOW_LAG:
@@ -332,6 +441,8 @@ public:
 	Allocator &allocator;
 	//! Lead/Lag states
 	vector<unique_ptr<LeadLagState>> lead_lag_states;
+	//! Rank states for ordered inputs
+	vector<unique_ptr<RankState>> rank_states;
 	//! The number of rows ahead to buffer for LEAD
 	idx_t lead_count = 0;
 	//! A buffer for delayed input
@@ -340,12 +451,58 @@ public:
 	DataChunk shifted;
 };
 
-bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr) {
+//! Does the physical input provably produce its rows in the ordering required by the OVER clause?
+static bool InputProvidesOrdering(PhysicalOperator &child, const vector<BoundOrderByNode> &orders) {
+	reference<PhysicalOperator> current(child);
+	while (current.get().type != PhysicalOperatorType::ORDER_BY) {
+		switch (current.get().type) {
+		case PhysicalOperatorType::STREAMING_LIMIT:
+		case PhysicalOperatorType::STREAMING_WINDOW:
+			// These pass the input columns through in place and in order
+			current = current.get().children[0];
+			break;
+		default:
+			return false;
+		}
+	}
+	auto &order_by = current.get().Cast<PhysicalOrder>();
+	// The sort must keep all payload columns in place, otherwise the window references do not line up
+	if (order_by.projections.size() != order_by.children[0].get().GetTypes().size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < order_by.projections.size(); i++) {
+		if (order_by.projections[i] != i) {
+			return false;
+		}
+	}
+	// The OVER ordering must be a prefix of the sort ordering
+	if (order_by.orders.size() < orders.size()) {
+		return false;
+	}
+	for (idx_t i = 0; i < orders.size(); i++) {
+		auto &provided = order_by.orders[i];
+		auto &required = orders[i];
+		if (provided.type != required.type || provided.null_order != required.null_order) {
+			return false;
+		}
+		if (!provided.expression->Equals(*required.expression)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, PhysicalOperator &child,
+                                                  unique_ptr<Expression> &expr) {
 	auto &wexpr = expr->Cast<BoundWindowExpression>();
-	if (!wexpr.partitions.empty() || !wexpr.orders.empty() || wexpr.ignore_nulls || !wexpr.arg_orders.empty() ||
+	if (!wexpr.partitions.empty() || wexpr.ignore_nulls || !wexpr.arg_orders.empty() ||
 	    wexpr.exclude_clause != WindowExcludeMode::NO_OTHER) {
 		return false;
 	}
+	// An ordered OVER clause can stream if the input already arrives in a matching order
+	if (!wexpr.orders.empty() && !InputProvidesOrdering(child, wexpr.orders)) {
+		return false;
+	}
 	switch (wexpr.GetExpressionType()) {
 	// TODO: add more expression types here?
 	case ExpressionType::WINDOW_AGGREGATE:
@@ -356,7 +513,11 @@ bool PhysicalStreamingWindow::IsStreamingFunction(ClientContext &context, unique
 		// We can stream aggregates if they are "running totals"
 		return wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING && wexpr.end == WindowBoundary::CURRENT_ROW_ROWS;
 	case ExpressionType::WINDOW_FIRST_VALUE:
+		// With an ORDER BY, the frame must start at the first row for first_value to be the first input row
+		return wexpr.orders.empty() || wexpr.start == WindowBoundary::UNBOUNDED_PRECEDING;
 	case ExpressionType::WINDOW_PERCENT_RANK:
+		// percent_rank needs the total row count, which a streaming operator cannot know
+		return wexpr.orders.empty();
 	case ExpressionType::WINDOW_RANK:
 	case ExpressionType::WINDOW_RANK_DENSE:
 	case ExpressionType::WINDOW_ROW_NUMBER:
@@ -502,13 +663,23 @@ void PhysicalStreamingWindow::ExecuteFunctions(ExecutionContext &context, DataCh
 			state.aggregate_states[expr_idx]->Execute(context, output, result);
 			break;
 		case ExpressionType::WINDOW_FIRST_VALUE:
-		case ExpressionType::WINDOW_PERCENT_RANK:
-		case ExpressionType::WINDOW_RANK:
-		case ExpressionType::WINDOW_RANK_DENSE: {
+		case ExpressionType::WINDOW_PERCENT_RANK: {
 			// Reference constant vector
 			output.data[col_idx].Reference(*state.const_vectors[expr_idx]);
 			break;
 		}
+		case ExpressionType::WINDOW_RANK:
+		case ExpressionType::WINDOW_RANK_DENSE: {
+			auto &rank_state = state.rank_states[expr_idx];
+			if (rank_state) {
+				rank_state->Execute(context, output, result,
+				                    expr.GetExpressionType() == ExpressionType::WINDOW_RANK_DENSE);
+			} else {
+				// Reference constant vector
+				output.data[col_idx].Reference(*state.const_vectors[expr_idx]);
+			}
+			break;
+		}
 		case ExpressionType::WINDOW_ROW_NUMBER: {
 			// Set row numbers
 			int64_t start_row = gstate.row_number;
@@ -573,9 +573,12 @@ TaskExecutionResult UngroupedDistinctAggregateFinalizeTask::AggregateDistinct()
 			}
 
 			// We dont need to resolve the filter, we already did this in Sink
+			// The column map translates child positions to table columns - they differ when this
+			// aggregate shares its table with an aggregate reading the same inputs in another order
+			auto &column_map = distinct_data.info.column_maps.at(agg_idx);
 			idx_t payload_cnt = aggregate.children.size();
 			for (idx_t i = 0; i < payload_cnt; i++) {
-				payload_chunk.data[i].Reference(output_chunk.data[i]);
+				payload_chunk.data[i].Reference(output_chunk.data[column_map[i]]);
 			}
 			payload_chunk.SetCardinality(output_chunk);
 
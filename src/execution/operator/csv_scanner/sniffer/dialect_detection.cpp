@@ -2,6 +2,7 @@
 #include "duckdb/execution/operator/csv_scanner/sniffer/csv_sniffer.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/execution/operator/csv_scanner/csv_reader_options.hpp"
+#include "duckdb/parallel/task_executor.hpp"
 
 namespace duckdb {
 
@@ -499,9 +500,50 @@ bool CSVSniffer::RefineCandidateNextChunk(ColumnCountScanner &candidate) const {
 	return true;
 }
 
+bool CSVSniffer::RefineCandidateFully(ColumnCountScanner &candidate, idx_t &sniffed_lines) const {
+	for (idx_t i = 1; i <= options.sample_size_chunks; i++) {
+		sniffed_lines += candidate.GetResult().result_position;
+		if (candidate.FinishedFile() || i == options.sample_size_chunks) {
+			// we finished the file or our chunk sample successfully
+			return !candidate.GetResult().error;
+		}
+		if (!RefineCandidateNextChunk(candidate) || candidate.GetResult().error) {
+			return false;
+		}
+	}
+	return false;
+}
+
+//! The result of refining one dialect candidate over the sample
+struct CandidateRefinement {
+	bool success = false;
+	idx_t sniffed_lines = 0;
+};
+
+class CSVRefineCandidateTask : public BaseExecutorTask {
+public:
+	CSVRefineCandidateTask(TaskExecutor &executor, const CSVSniffer &sniffer, ColumnCountScanner &candidate,
+	                       CandidateRefinement &refinement)
+	    : BaseExecutorTask(executor), sniffer(sniffer), candidate(candidate), refinement(refinement) {
+	}
+
+	void ExecuteTask() override {
+		refinement.success = sniffer.RefineCandidateFully(candidate, refinement.sniffed_lines);
+	}
+
+	string TaskType() const override {
+		return "CSVRefineCandidateTask";
+	}
+
+private:
+	const CSVSniffer &sniffer;
+	ColumnCountScanner &candidate;
+	CandidateRefinement &refinement;
+};
+
 void CSVSniffer::RefineCandidates() {
-	// It's very frequent that more than one dialect can parse a csv file; hence here we run one state machine
-	// fully on the whole sample dataset, when/if it fails, we go to the next one.
+	// It's very frequent that more than one dialect can parse a csv file; hence here we run every state machine
+	// fully on the whole sample dataset, when/if it fails, we drop the candidate.
 	if (candidates.empty()) {
 		// No candidates to refine
 		return;
@@ -511,31 +553,34 @@ void CSVSniffer::RefineCandidates() {
 		return;
 	}
 
-	for (idx_t i = 1; i <= options.sample_size_chunks; i++) {
-		vector<unique_ptr<ColumnCountScanner>> successful_candidates;
-		bool done = candidates.empty();
-		for (auto &cur_candidate : candidates) {
-			const bool finished_file = cur_candidate->FinishedFile();
-			if (successful_candidates.empty()) {
-				lines_sniffed += cur_candidate->GetResult().result_position;
-			}
-			if (finished_file || i == options.sample_size_chunks) {
-				// we finished the file or our chunk sample successfully
-				if (!cur_candidate->GetResult().error) {
-					successful_candidates.push_back(std::move(cur_candidate));
-				}
-				done = true;
-				continue;
-			}
-			if (RefineCandidateNextChunk(*cur_candidate) && !cur_candidate->GetResult().error) {
-				successful_candidates.push_back(std::move(cur_candidate));
-			}
+	// refine the candidates concurrently - every candidate scans its own chunks through the (thread-safe)
+	// buffer manager, so the sniffing latency is bound by the slowest candidate instead of the sum of all
+	TaskExecutor task_executor(buffer_manager->context);
+	vector<CandidateRefinement> refinements(candidates.size());
+	for (idx_t i = 0; i < candidates.size(); i++) {
+		task_executor.ScheduleTask(
+		    make_uniq<CSVRefineCandidateTask>(task_executor, *this, *candidates[i], refinements[i]));
+	}
+	task_executor.WorkOnTasks();
+
+	vector<unique_ptr<ColumnCountScanner>> refined_candidates;
+	bool counted_lines = false;
+	for (idx_t i = 0; i < candidates.size(); i++) {
+		if (!refinements[i].success) {
+			continue;
 		}
-		candidates = std::move(successful_candidates);
-		if (done) {
-			break;
+		if (!counted_lines) {
+			// the sniffed line count follows the first surviving candidate
+			lines_sniffed += refinements[i].sniffed_lines;
+			counted_lines = true;
 		}
+		refined_candidates.push_back(std::move(candidates[i]));
+	}
+	if (!counted_lines) {
+		// no candidate survived the sample - still account for the lines the first candidate sniffed
+		lines_sniffed += refinements[0].sniffed_lines;
 	}
+	candidates = std::move(refined_candidates);
 	// If we have multiple candidates with quotes set, we will give the preference to ones
 	// that have actually quoted values, otherwise we will choose quotes = \0
 	vector<unique_ptr<ColumnCountScanner>> successful_candidates = std::move(candidates);
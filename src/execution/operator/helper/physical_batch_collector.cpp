@@ -17,13 +17,22 @@ SinkResultType PhysicalBatchCollector::Sink(ExecutionContext &context, DataChunk
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+SinkNextBatchType PhysicalBatchCollector::NextBatch(ExecutionContext &context,
+                                                    OperatorSinkNextBatchInput &input) const {
+	auto &gstate = input.global_state.Cast<BatchCollectorGlobalState>();
+	auto &state = input.local_state.Cast<BatchCollectorLocalState>();
+
+	// the previous batch is complete - hand it to its merge partition while the other threads keep producing
+	gstate.MergeBatches(state.data);
+	return SinkNextBatchType::READY;
+}
+
 SinkCombineResultType PhysicalBatchCollector::Combine(ExecutionContext &context,
                                                       OperatorSinkCombineInput &input) const {
 	auto &gstate = input.global_state.Cast<BatchCollectorGlobalState>();
 	auto &state = input.local_state.Cast<BatchCollectorLocalState>();
 
-	lock_guard<mutex> lock(gstate.glock);
-	gstate.data.Merge(state.data);
+	gstate.MergeBatches(state.data);
 
 	return SinkCombineResultType::FINISHED;
 }
@@ -31,6 +40,7 @@ SinkCombineResultType PhysicalBatchCollector::Combine(ExecutionContext &context,
 SinkFinalizeType PhysicalBatchCollector::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                   OperatorSinkFinalizeInput &input) const {
 	auto &gstate = input.global_state.Cast<BatchCollectorGlobalState>();
+	gstate.GatherPartitions();
 	auto collection = gstate.data.FetchCollection();
 	D_ASSERT(collection);
 	auto result = make_uniq<MaterializedQueryResult>(statement_type, properties, names, std::move(collection),
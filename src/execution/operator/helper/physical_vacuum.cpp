@@ -2,11 +2,96 @@
 
 #include "duckdb/planner/operator/logical_get.hpp"
 #include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/statistics/base_statistics.hpp"
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
+#include "duckdb/storage/statistics/string_stats.hpp"
 #include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 
 namespace duckdb {
 
+//! Whether ANALYZE can rebuild min/max statistics for this column type
+static bool AnalyzeSupportsMinMax(const LogicalType &type) {
+	switch (BaseStatistics::GetStatsType(type)) {
+	case StatisticsType::NUMERIC_STATS:
+	case StatisticsType::STRING_STATS:
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class T>
+static void TemplatedUpdateMinMax(BaseStatistics &stats, UnifiedVectorFormat &vdata, idx_t count) {
+	auto data = UnifiedVectorFormat::GetData<T>(vdata);
+	for (idx_t i = 0; i < count; i++) {
+		auto idx = vdata.sel->get_index(i);
+		if (!vdata.validity.RowIsValid(idx)) {
+			stats.SetHasNullFast();
+			continue;
+		}
+		stats.SetHasNoNullFast();
+		stats.UpdateNumericStats<T>(data[idx]);
+	}
+}
+
+static void UpdateMinMaxStats(BaseStatistics &stats, Vector &input, idx_t count) {
+	UnifiedVectorFormat vdata;
+	input.ToUnifiedFormat(count, vdata);
+	switch (input.GetType().InternalType()) {
+	case PhysicalType::INT8:
+		TemplatedUpdateMinMax<int8_t>(stats, vdata, count);
+		break;
+	case PhysicalType::INT16:
+		TemplatedUpdateMinMax<int16_t>(stats, vdata, count);
+		break;
+	case PhysicalType::INT32:
+		TemplatedUpdateMinMax<int32_t>(stats, vdata, count);
+		break;
+	case PhysicalType::INT64:
+		TemplatedUpdateMinMax<int64_t>(stats, vdata, count);
+		break;
+	case PhysicalType::UINT8:
+		TemplatedUpdateMinMax<uint8_t>(stats, vdata, count);
+		break;
+	case PhysicalType::UINT16:
+		TemplatedUpdateMinMax<uint16_t>(stats, vdata, count);
+		break;
+	case PhysicalType::UINT32:
+		TemplatedUpdateMinMax<uint32_t>(stats, vdata, count);
+		break;
+	case PhysicalType::UINT64:
+		TemplatedUpdateMinMax<uint64_t>(stats, vdata, count);
+		break;
+	case PhysicalType::INT128:
+		TemplatedUpdateMinMax<hugeint_t>(stats, vdata, count);
+		break;
+	case PhysicalType::UINT128:
+		TemplatedUpdateMinMax<uhugeint_t>(stats, vdata, count);
+		break;
+	case PhysicalType::FLOAT:
+		TemplatedUpdateMinMax<float>(stats, vdata, count);
+		break;
+	case PhysicalType::DOUBLE:
+		TemplatedUpdateMinMax<double>(stats, vdata, count);
+		break;
+	case PhysicalType::VARCHAR: {
+		auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
+		for (idx_t i = 0; i < count; i++) {
+			auto idx = vdata.sel->get_index(i);
+			if (!vdata.validity.RowIsValid(idx)) {
+				stats.SetHasNullFast();
+				continue;
+			}
+			stats.SetHasNoNullFast();
+			StringStats::Update(stats, data[idx]);
+		}
+		break;
+	}
+	default:
+		throw InternalException("Unsupported type for ANALYZE min/max statistics");
+	}
+}
+
 PhysicalVacuum::PhysicalVacuum(PhysicalPlan &physical_plan, unique_ptr<VacuumInfo> info_p,
                                optional_ptr<TableCatalogEntry> table, unordered_map<idx_t, idx_t> column_id_map,
                                idx_t estimated_cardinality)
@@ -24,10 +109,16 @@ public:
 			} else {
 				column_distinct_stats.push_back(nullptr);
 			}
+			if (AnalyzeSupportsMinMax(column.GetType())) {
+				column_minmax_stats.push_back(BaseStatistics::CreateEmpty(column.GetType()).ToUnique());
+			} else {
+				column_minmax_stats.push_back(nullptr);
+			}
 		}
 	};
 
 	vector<unique_ptr<DistinctStatistics>> column_distinct_stats;
+	vector<unique_ptr<BaseStatistics>> column_minmax_stats;
 	Vector hashes;
 };
 
@@ -45,11 +136,17 @@ public:
 			} else {
 				column_distinct_stats.push_back(nullptr);
 			}
+			if (AnalyzeSupportsMinMax(column.GetType())) {
+				column_minmax_stats.push_back(BaseStatistics::CreateEmpty(column.GetType()).ToUnique());
+			} else {
+				column_minmax_stats.push_back(nullptr);
+			}
 		}
 	};
 
 	mutex stats_lock;
 	vector<unique_ptr<DistinctStatistics>> column_distinct_stats;
+	vector<unique_ptr<BaseStatistics>> column_minmax_stats;
 };
 
 unique_ptr<GlobalSinkState> PhysicalVacuum::GetGlobalSinkState(ClientContext &context) const {
@@ -61,6 +158,9 @@ SinkResultType PhysicalVacuum::Sink(ExecutionContext &context, DataChunk &chunk,
 	D_ASSERT(lstate.column_distinct_stats.size() == column_id_map.size());
 
 	for (idx_t col_idx = 0; col_idx < chunk.data.size(); col_idx++) {
+		if (lstate.column_minmax_stats[col_idx]) {
+			UpdateMinMaxStats(*lstate.column_minmax_stats[col_idx], chunk.data[col_idx], chunk.size());
+		}
 		if (!DistinctStatistics::TypeIsSupported(chunk.data[col_idx].GetType())) {
 			continue;
 		}
@@ -82,6 +182,10 @@ SinkCombineResultType PhysicalVacuum::Combine(ExecutionContext &context, Operato
 			D_ASSERT(l_state.column_distinct_stats[col_idx]);
 			g_state.column_distinct_stats[col_idx]->Merge(*l_state.column_distinct_stats[col_idx]);
 		}
+		if (g_state.column_minmax_stats[col_idx]) {
+			D_ASSERT(l_state.column_minmax_stats[col_idx]);
+			g_state.column_minmax_stats[col_idx]->Merge(*l_state.column_minmax_stats[col_idx]);
+		}
 	}
 
 	return SinkCombineResultType::FINISHED;
@@ -96,6 +200,12 @@ SinkFinalizeType PhysicalVacuum::Finalize(Pipeline &pipeline, Event &event, Clie
 
 	auto tbl = table;
 	for (idx_t col_idx = 0; col_idx < sink.column_distinct_stats.size(); col_idx++) {
+		// like the distinct statistics below, this trusts the ANALYZE scan to have seen every row of
+		// the table: the freshly computed min/max replace the stale table-level bounds wholesale,
+		// which is what shrinks them back after bulk deletes and in-place updates
+		if (sink.column_minmax_stats[col_idx]) {
+			tbl->GetStorage().SetStatistics(column_id_map.at(col_idx), *sink.column_minmax_stats[col_idx]);
+		}
 		tbl->GetStorage().SetDistinct(column_id_map.at(col_idx), std::move(sink.column_distinct_stats[col_idx]));
 	}
 	if (tbl) {
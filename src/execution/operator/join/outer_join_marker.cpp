@@ -1,8 +1,10 @@
 #include "duckdb/execution/operator/join/outer_join_marker.hpp"
 
+#include "duckdb/common/bit_utils.hpp"
+
 namespace duckdb {
 
-OuterJoinMarker::OuterJoinMarker(bool enabled_p) : enabled(enabled_p), count(0) {
+OuterJoinMarker::OuterJoinMarker(bool enabled_p) : enabled(enabled_p), count(0), word_count(0) {
 }
 
 void OuterJoinMarker::Initialize(idx_t count_p) {
@@ -10,7 +12,8 @@ void OuterJoinMarker::Initialize(idx_t count_p) {
 		return;
 	}
 	this->count = count_p;
-	found_match = make_unsafe_uniq_array_uninitialized<bool>(count);
+	this->word_count = (count_p + BITS_PER_WORD - 1) / BITS_PER_WORD;
+	match_bitmap = make_unsafe_uniq_array_uninitialized<atomic<uint64_t>>(word_count);
 	Reset();
 }
 
@@ -18,7 +21,9 @@ void OuterJoinMarker::Reset() {
 	if (!enabled) {
 		return;
 	}
-	memset(found_match.get(), 0, sizeof(bool) * count);
+	for (idx_t i = 0; i < word_count; i++) {
+		match_bitmap[i].store(0, std::memory_order_relaxed);
+	}
 }
 
 void OuterJoinMarker::SetMatch(idx_t position) {
@@ -26,7 +31,12 @@ void OuterJoinMarker::SetMatch(idx_t position) {
 		return;
 	}
 	D_ASSERT(position < count);
-	found_match[position] = true;
+	auto &word = match_bitmap[position / BITS_PER_WORD];
+	const uint64_t bit = uint64_t(1) << (position % BITS_PER_WORD);
+	// check before the atomic OR so that repeatedly matching the same build rows does not cause write contention
+	if (!(word.load(std::memory_order_relaxed) & bit)) {
+		word.fetch_or(bit, std::memory_order_relaxed);
+	}
 }
 
 void OuterJoinMarker::SetMatches(const SelectionVector &sel, idx_t count, idx_t base_idx) {
@@ -35,10 +45,33 @@ void OuterJoinMarker::SetMatches(const SelectionVector &sel, idx_t count, idx_t
 	}
 	for (idx_t i = 0; i < count; i++) {
 		auto idx = sel.get_index(i);
-		auto pos = base_idx + idx;
-		D_ASSERT(pos < this->count);
-		found_match[pos] = true;
+		SetMatch(base_idx + idx);
+	}
+}
+
+idx_t OuterJoinMarker::FindUnmatched(idx_t base, idx_t scan_count, SelectionVector &sel) const {
+	const idx_t end = base + scan_count;
+	D_ASSERT(end <= count);
+	idx_t result_count = 0;
+	idx_t position = base;
+	while (position < end) {
+		const idx_t word_idx = position / BITS_PER_WORD;
+		const idx_t word_base = word_idx * BITS_PER_WORD;
+		auto unmatched = ~match_bitmap[word_idx].load(std::memory_order_relaxed);
+		// mask off the bits below the scan range in the first word and beyond it in the last
+		unmatched &= ~uint64_t(0) << (position - word_base);
+		if (end - word_base < BITS_PER_WORD) {
+			unmatched &= (uint64_t(1) << (end - word_base)) - 1;
+		}
+		// every remaining set bit is an unmatched row - fully matched words are skipped in a single comparison
+		while (unmatched) {
+			const auto bit = CountZeros<uint64_t>::Trailing(unmatched);
+			sel.set_index(result_count++, word_base + bit - base);
+			unmatched &= unmatched - 1;
+		}
+		position = word_base + BITS_PER_WORD;
 	}
+	return result_count;
 }
 
 void OuterJoinMarker::ConstructLeftJoinResult(DataChunk &left, DataChunk &result) {
@@ -47,12 +80,7 @@ void OuterJoinMarker::ConstructLeftJoinResult(DataChunk &left, DataChunk &result
 	}
 	D_ASSERT(count == STANDARD_VECTOR_SIZE);
 	SelectionVector remaining_sel(STANDARD_VECTOR_SIZE);
-	idx_t remaining_count = 0;
-	for (idx_t i = 0; i < left.size(); i++) {
-		if (!found_match[i]) {
-			remaining_sel.set_index(remaining_count++, i);
-		}
-	}
+	idx_t remaining_count = FindUnmatched(0, left.size(), remaining_sel);
 	if (remaining_count > 0) {
 		result.Slice(left, remaining_sel, remaining_count);
 		for (idx_t idx = left.ColumnCount(); idx < result.ColumnCount(); idx++) {
@@ -81,13 +109,9 @@ void OuterJoinMarker::Scan(OuterJoinGlobalScanState &gstate, OuterJoinLocalScanS
 	D_ASSERT(gstate.data);
 	// fill in NULL values for the LHS
 	while (gstate.data->Scan(gstate.global_scan, lstate.local_scan, lstate.scan_chunk)) {
-		idx_t result_count = 0;
 		// figure out which tuples didn't find a match in the RHS
-		for (idx_t i = 0; i < lstate.scan_chunk.size(); i++) {
-			if (!found_match[lstate.local_scan.current_row_index + i]) {
-				lstate.match_sel.set_index(result_count++, i);
-			}
-		}
+		idx_t result_count =
+		    FindUnmatched(lstate.local_scan.current_row_index, lstate.scan_chunk.size(), lstate.match_sel);
 		if (result_count > 0) {
 			// if there were any tuples that didn't find a match, output them
 			idx_t left_column_count = result.ColumnCount() - lstate.scan_chunk.ColumnCount();
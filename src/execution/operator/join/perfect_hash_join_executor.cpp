@@ -1,6 +1,8 @@
 #include "duckdb/execution/operator/join/perfect_hash_join_executor.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/operator/subtract.hpp"
+#include "duckdb/common/pair.hpp"
 #include "duckdb/execution/operator/join/physical_hash_join.hpp"
 
 namespace duckdb {
@@ -99,21 +101,29 @@ bool PerfectHashJoinExecutor::CanDoPerfectHashJoin(const PhysicalHashJoin &op, c
 		return false; // Empty table
 	}
 
-	hugeint_t build_range;
-	if (!TrySubtractOperator::Operation(max_value, min_value, build_range)) {
-		return false;
-	}
-
 	// The max size our build must have to run the perfect HJ
 	static constexpr idx_t MAX_BUILD_SIZE = 1048576;
-	if (build_range > Hugeint::Convert(MAX_BUILD_SIZE)) {
-		return false;
-	}
-	perfect_join_statistics.build_range = NumericCast<idx_t>(build_range);
+	//! The max build count for which we remap sparse keys to their rank instead of bailing out on the range check
+	static constexpr idx_t MAX_REMAP_BUILD_SIZE = 4096;
 
-	// If count is larger than range (duplicates), we bail out
-	if (ht.Count() > perfect_join_statistics.build_range) {
-		return false;
+	hugeint_t build_range;
+	const bool range_fits = TrySubtractOperator::Operation(max_value, min_value, build_range) &&
+	                        build_range <= Hugeint::Convert(MAX_BUILD_SIZE);
+	if (range_fits) {
+		perfect_join_statistics.build_range = NumericCast<idx_t>(build_range);
+
+		// If count is larger than range (duplicates), we bail out
+		if (ht.Count() > perfect_join_statistics.build_range) {
+			return false;
+		}
+	} else {
+		// The key range is too large for a direct lookup table, but if the build side is tiny we can still
+		// take the array-lookup fast path by remapping the keys to their rank in the sorted key domain
+		if (ht.Count() == 0 || ht.Count() > MAX_REMAP_BUILD_SIZE) {
+			return false;
+		}
+		perfect_join_statistics.is_remapped = true;
+		perfect_join_statistics.build_range = ht.Count() - 1;
 	}
 
 	perfect_join_statistics.is_build_small = true;
@@ -223,6 +233,9 @@ bool PerfectHashJoinExecutor::FillSelectionVectorSwitchBuild(Vector &source, Sel
 template <typename T>
 bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec,
                                                                 SelectionVector &seq_sel_vec, idx_t count) {
+	if (perfect_join_statistics.is_remapped) {
+		return TemplatedFillSelectionVectorBuildRemap<T>(source, sel_vec, seq_sel_vec, count);
+	}
 	if (perfect_join_statistics.build_min.IsNull() || perfect_join_statistics.build_max.IsNull()) {
 		return false;
 	}
@@ -251,6 +264,41 @@ bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuild(Vector &source,
 	return true;
 }
 
+template <typename T>
+bool PerfectHashJoinExecutor::TemplatedFillSelectionVectorBuildRemap(Vector &source, SelectionVector &sel_vec,
+                                                                     SelectionVector &seq_sel_vec, idx_t count) {
+	UnifiedVectorFormat vector_data;
+	source.ToUnifiedFormat(count, vector_data);
+	const auto data = vector_data.GetData<T>();
+
+	// sort the (key, row) pairs so that each key is mapped to its rank in the key domain
+	vector<pair<T, idx_t>> keys;
+	keys.reserve(count);
+	for (idx_t i = 0; i < count; ++i) {
+		keys.emplace_back(data[vector_data.sel->get_index(i)], i);
+	}
+	std::sort(keys.begin(), keys.end());
+
+	// bail out on duplicate keys - the regular hash join handles those
+	for (idx_t i = 1; i < count; ++i) {
+		if (keys[i].first == keys[i - 1].first) {
+			return false;
+		}
+	}
+
+	// store the sorted keys so the probe can look up the rank of each probe key
+	remap_keys = make_uniq<Vector>(source.GetType(), count);
+	const auto key_data = FlatVector::GetData<T>(*remap_keys);
+	for (idx_t i = 0; i < count; ++i) {
+		key_data[i] = keys[i].first;
+		sel_vec.set_index(i, i);
+		seq_sel_vec.set_index(i, keys[i].second);
+		bitmap_build_idx.SetValidUnsafe(i);
+	}
+	unique_keys = count;
+	return true;
+}
+
 //===--------------------------------------------------------------------===//
 // Probe
 //===--------------------------------------------------------------------===//
@@ -353,6 +401,9 @@ template <typename T>
 void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
                                                                 SelectionVector &probe_sel_vec, idx_t count,
                                                                 idx_t &probe_sel_count) {
+	if (perfect_join_statistics.is_remapped) {
+		return TemplatedFillSelectionVectorProbeRemap<T>(source, build_sel_vec, probe_sel_vec, count, probe_sel_count);
+	}
 	auto min_value = perfect_join_statistics.build_min.GetValueUnsafe<T>();
 	auto max_value = perfect_join_statistics.build_max.GetValueUnsafe<T>();
 
@@ -399,4 +450,39 @@ void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbe(Vector &source,
 	}
 }
 
+template <typename T>
+void PerfectHashJoinExecutor::TemplatedFillSelectionVectorProbeRemap(Vector &source, SelectionVector &build_sel_vec,
+                                                                     SelectionVector &probe_sel_vec, idx_t count,
+                                                                     idx_t &probe_sel_count) {
+	D_ASSERT(remap_keys && unique_keys > 0);
+	const auto keys_begin = FlatVector::GetData<T>(*remap_keys);
+	const auto keys_end = keys_begin + unique_keys;
+	// the sorted keys give us the actual min/max of the build side for the range pre-filter
+	const auto min_value = keys_begin[0];
+	const auto max_value = keys_begin[unique_keys - 1];
+
+	UnifiedVectorFormat vector_data;
+	source.ToUnifiedFormat(count, vector_data);
+	const auto data = vector_data.GetData<T>();
+	auto &validity_mask = vector_data.validity;
+	for (idx_t i = 0, sel_idx = 0; i < count; ++i) {
+		const auto data_idx = vector_data.sel->get_index(i);
+		if (!validity_mask.RowIsValid(data_idx)) {
+			continue;
+		}
+		const auto input_value = data[data_idx];
+		if (input_value < min_value || max_value < input_value) {
+			continue;
+		}
+		// binary search for the rank of the probe key - the build keys are few enough to stay cache-resident
+		const auto it = std::lower_bound(keys_begin, keys_end, input_value);
+		if (*it != input_value) {
+			continue;
+		}
+		build_sel_vec.set_index(sel_idx, UnsafeNumericCast<idx_t>(it - keys_begin));
+		probe_sel_vec.set_index(sel_idx++, i);
+		probe_sel_count++;
+	}
+}
+
 } // namespace duckdb
@@ -958,7 +958,7 @@ public:
 	//! The right outer slicer
 	SelectionVector rsel;
 	//! Pointer to the right marker
-	const bool *rhs_matches = {};
+	optional_ptr<const OuterJoinMarker> rhs_matches;
 };
 
 AsOfLocalSourceState::AsOfLocalSourceState(ExecutionContext &context, AsOfGlobalSourceState &gsource,
@@ -983,7 +983,7 @@ idx_t AsOfLocalSourceState::BeginRightScan(const idx_t hash_bin_p) {
 	auto &gsink = gsource.op.sink_state->Cast<AsOfGlobalSinkState>();
 	scanner = make_uniq<AsOfPayloadScanner>(*hash_group, *gsink.hashed_sorts[1]);
 
-	rhs_matches = gsource.right_outers[hash_bin].GetMatches();
+	rhs_matches = &gsource.right_outers[hash_bin];
 
 	return scanner->Remaining();
 }
@@ -1102,12 +1102,7 @@ void AsOfLocalSourceState::ExecuteOuterTask(DataChunk &chunk) {
 		}
 
 		// figure out which tuples didn't find a match in the RHS
-		result_count = 0;
-		for (idx_t i = 0; i < count; i++) {
-			if (!rhs_matches[rhs_position + i]) {
-				rsel.set_index(result_count++, i);
-			}
-		}
+		result_count = rhs_matches->FindUnmatched(rhs_position, count, rsel);
 	}
 
 	// if there were any tuples that didn't find a match, output them
@@ -7,6 +7,9 @@
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
 #include "duckdb/execution/operator/join/physical_cross_product.hpp"
 #include "duckdb/common/enum_util.hpp"
+#include "duckdb/planner/expression/bound_comparison_expression.hpp"
+#include "duckdb/planner/expression/bound_conjunction_expression.hpp"
+#include "duckdb/planner/expression/bound_reference_expression.hpp"
 
 namespace duckdb {
 
@@ -76,6 +79,87 @@ SinkFinalizeType PhysicalBlockwiseNLJoin::Finalize(Pipeline &pipeline, Event &ev
 //===--------------------------------------------------------------------===//
 // Operator
 //===--------------------------------------------------------------------===//
+//! A comparison of the form "left_ref CMP right_ref" extracted from the join condition, where both operands are bare
+//! column references into the combined (LHS + RHS) schema. Used to short-circuit entire scanned rows against per-tile
+//! min/max bounds of the constant-side chunk before the condition is evaluated.
+struct BlockwiseRangeCheck {
+	ExpressionType comparison;
+	idx_t left_ref;
+	idx_t right_ref;
+};
+
+//! Per-tile state for a range check: the bounds of the constant-side column for the current chunk pair
+struct BlockwiseTileBound {
+	//! Whether one operand lies in the constant chunk and the other in the scanned chunk for this tile
+	bool applicable = false;
+	//! Whether the constant side is the left operand of the comparison
+	bool constant_on_left = false;
+	//! The combined-schema column index of the scanned operand
+	idx_t scan_ref = 0;
+	//! Whether the constant-side column has any non-NULL values in this tile
+	bool has_values = false;
+	Value min_val;
+	Value max_val;
+};
+
+static bool TryExtractRangeCheck(const Expression &expr, vector<BlockwiseRangeCheck> &checks) {
+	if (expr.GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
+		return false;
+	}
+	switch (expr.GetExpressionType()) {
+	case ExpressionType::COMPARE_LESSTHAN:
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+	case ExpressionType::COMPARE_GREATERTHAN:
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		break;
+	default:
+		return false;
+	}
+	auto &comparison = expr.Cast<BoundComparisonExpression>();
+	if (comparison.left->GetExpressionClass() != ExpressionClass::BOUND_REF ||
+	    comparison.right->GetExpressionClass() != ExpressionClass::BOUND_REF) {
+		return false;
+	}
+	BlockwiseRangeCheck check;
+	check.comparison = expr.GetExpressionType();
+	check.left_ref = comparison.left->Cast<BoundReferenceExpression>().index;
+	check.right_ref = comparison.right->Cast<BoundReferenceExpression>().index;
+	checks.push_back(check);
+	return true;
+}
+
+//! Returns true if "constant CMP scanned" (or "scanned CMP constant") can hold for ANY constant-side row,
+//! given the min/max of the constant-side column
+static bool ComparisonPossiblyTrue(const ExpressionType comparison, const BlockwiseTileBound &bound,
+                                   const Value &scan_value) {
+	if (bound.constant_on_left) {
+		switch (comparison) {
+		case ExpressionType::COMPARE_LESSTHAN:
+			return bound.min_val < scan_value;
+		case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+			return !(scan_value < bound.min_val);
+		case ExpressionType::COMPARE_GREATERTHAN:
+			return scan_value < bound.max_val;
+		case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+			return !(bound.max_val < scan_value);
+		default:
+			throw InternalException("Unsupported comparison type for blockwise range check");
+		}
+	}
+	switch (comparison) {
+	case ExpressionType::COMPARE_LESSTHAN:
+		return scan_value < bound.max_val;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return !(bound.max_val < scan_value);
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return bound.min_val < scan_value;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return !(scan_value < bound.min_val);
+	default:
+		throw InternalException("Unsupported comparison type for blockwise range check");
+	}
+}
+
 class BlockwiseNLJoinState : public CachingOperatorState {
 public:
 	explicit BlockwiseNLJoinState(ExecutionContext &context, ColumnDataCollection &rhs,
@@ -84,6 +168,7 @@ public:
 	      executor(context.client, *op.condition) {
 		left_outer.Initialize(STANDARD_VECTOR_SIZE);
 		ResetMatches();
+		ExtractRangeChecks();
 	}
 
 	const PhysicalBlockwiseNLJoin &op;
@@ -93,6 +178,12 @@ public:
 	ExpressionExecutor executor;
 	DataChunk intermediate_chunk;
 	bool found_match[STANDARD_VECTOR_SIZE];
+	//! Range comparisons extracted from the condition for per-tile min/max short-circuiting
+	vector<BlockwiseRangeCheck> range_checks;
+	//! Whether the condition is a disjunction consisting exactly of the extracted checks
+	bool checks_are_disjunctive = false;
+	//! Constant-side bounds per check, refreshed whenever a new chunk pair is scanned
+	vector<BlockwiseTileBound> tile_bounds;
 
 	void ResetMatches() {
 		if (op.join_type != JoinType::SEMI && op.join_type != JoinType::ANTI) {
@@ -102,6 +193,99 @@ public:
 			found_match[i] = false;
 		}
 	}
+
+	void ExtractRangeChecks() {
+		auto &condition = *op.condition;
+		if (condition.GetExpressionClass() == ExpressionClass::BOUND_CONJUNCTION) {
+			auto &conjunction = condition.Cast<BoundConjunctionExpression>();
+			if (conjunction.GetExpressionType() == ExpressionType::CONJUNCTION_AND) {
+				// for a conjunction any disproved conjunct rules out the row, so we take whatever checks we find
+				for (auto &child : conjunction.children) {
+					TryExtractRangeCheck(*child, range_checks);
+				}
+			} else {
+				// for a disjunction we can only skip if every disjunct is disproved, so all of them must be checks
+				for (auto &child : conjunction.children) {
+					if (!TryExtractRangeCheck(*child, range_checks)) {
+						range_checks.clear();
+						return;
+					}
+				}
+				checks_are_disjunctive = true;
+			}
+		} else {
+			TryExtractRangeCheck(condition, range_checks);
+		}
+		tile_bounds.resize(range_checks.size());
+	}
+
+	//! Recompute the constant-side bounds from the combined chunk for the current chunk pair
+	void UpdateTileBounds(DataChunk &combined, const idx_t lhs_width) {
+		const idx_t scan_begin = cross_product.ScanLHS() ? 0 : lhs_width;
+		const idx_t scan_end = cross_product.ScanLHS() ? lhs_width : combined.ColumnCount();
+		for (idx_t check_idx = 0; check_idx < range_checks.size(); check_idx++) {
+			auto &check = range_checks[check_idx];
+			auto &bound = tile_bounds[check_idx];
+			const bool left_scanned = check.left_ref >= scan_begin && check.left_ref < scan_end;
+			const bool right_scanned = check.right_ref >= scan_begin && check.right_ref < scan_end;
+			bound.applicable = left_scanned != right_scanned;
+			if (!bound.applicable) {
+				continue;
+			}
+			bound.constant_on_left = right_scanned;
+			bound.scan_ref = left_scanned ? check.left_ref : check.right_ref;
+			const auto constant_ref = left_scanned ? check.right_ref : check.left_ref;
+			// the constant-side columns of the combined chunk reference the constant chunk in its entirety
+			auto &constant_vector = combined.data[constant_ref];
+			bound.has_values = false;
+			for (idx_t row_idx = 0; row_idx < combined.size(); row_idx++) {
+				auto value = constant_vector.GetValue(row_idx);
+				if (value.IsNull()) {
+					continue;
+				}
+				if (!bound.has_values) {
+					bound.min_val = value;
+					bound.max_val = std::move(value);
+					bound.has_values = true;
+				} else if (value < bound.min_val) {
+					bound.min_val = std::move(value);
+				} else if (bound.max_val < value) {
+					bound.max_val = std::move(value);
+				}
+			}
+		}
+	}
+
+	//! Returns true if the currently scanned row cannot satisfy the condition against any constant-side row
+	bool TileRowCannotMatch(DataChunk &combined) const {
+		for (idx_t check_idx = 0; check_idx < range_checks.size(); check_idx++) {
+			auto &check = range_checks[check_idx];
+			auto &bound = tile_bounds[check_idx];
+			if (!bound.applicable) {
+				if (checks_are_disjunctive) {
+					return false;
+				}
+				continue;
+			}
+			bool disproved;
+			if (!bound.has_values) {
+				disproved = true;
+			} else {
+				// the scanned-side columns of the combined chunk are constant vectors holding the scanned row
+				auto scan_value = combined.data[bound.scan_ref].GetValue(0);
+				disproved = scan_value.IsNull() || !ComparisonPossiblyTrue(check.comparison, bound, scan_value);
+			}
+			if (checks_are_disjunctive) {
+				if (!disproved) {
+					return false;
+				}
+			} else if (disproved) {
+				return true;
+			}
+		}
+		// for a disjunction reaching this point means every disjunct was disproved
+		return checks_are_disjunctive;
+	}
 };
 
 unique_ptr<OperatorState> PhysicalBlockwiseNLJoin::GetOperatorState(ExecutionContext &context) const {
@@ -171,6 +355,17 @@ OperatorResultType PhysicalBlockwiseNLJoin::ExecuteInternal(ExecutionContext &co
 		return OperatorResultType::NEED_MORE_INPUT;
 	}
 
+	if (!state.range_checks.empty()) {
+		// per-tile short-circuit: skip the scanned row if the constant chunk's bounds disprove the condition
+		if (state.cross_product.PositionInChunk() == 0) {
+			state.UpdateTileBounds(*intermediate_chunk, input.ColumnCount());
+		}
+		if (state.TileRowCannotMatch(*intermediate_chunk)) {
+			intermediate_chunk->Reset();
+			return OperatorResultType::HAVE_MORE_OUTPUT;
+		}
+	}
+
 	// now perform the computation
 	result_count = state.executor.SelectExpression(*intermediate_chunk, state.match_sel);
 
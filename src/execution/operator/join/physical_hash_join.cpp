@@ -2,6 +2,7 @@
 
 #include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/types/value_map.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/operator/aggregate/ungrouped_aggregate_state.hpp"
 #include "duckdb/function/aggregate/distributive_function_utils.hpp"
@@ -17,6 +18,8 @@
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/planner/expression/bound_aggregate_expression.hpp"
 #include "duckdb/planner/expression/bound_reference_expression.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/optional_filter.hpp"
@@ -131,6 +134,26 @@ unique_ptr<JoinFilterGlobalState> JoinFilterPushdownInfo::GetGlobalState(ClientC
 	return result;
 }
 
+//! Collect the indices of all columns referenced by the given (physical) expression
+static void CollectColumnReferences(Expression &expr, unordered_set<idx_t> &column_ids) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		column_ids.insert(expr.Cast<BoundReferenceExpression>().index);
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { CollectColumnReferences(child, column_ids); });
+}
+
+//! Remap all column references in the given (physical) expression through the given column map
+static void RemapColumnReferences(Expression &expr, const unordered_map<idx_t, idx_t> &column_map) {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_REF) {
+		auto &ref = expr.Cast<BoundReferenceExpression>();
+		D_ASSERT(column_map.find(ref.index) != column_map.end());
+		ref.index = column_map.find(ref.index)->second;
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) { RemapColumnReferences(child, column_map); });
+}
+
 class HashJoinGlobalSinkState : public GlobalSinkState {
 public:
 	HashJoinGlobalSinkState(const PhysicalHashJoin &op_p, ClientContext &context_p)
@@ -151,10 +174,37 @@ public:
 		}
 		// For external hash join
 		external = ClientConfig::GetConfig(context).force_external;
-		// Set probe types
-		probe_types = op.children[0].get().GetTypes();
+		// Set probe types: we only spill the columns needed for the next probe round - the join key inputs and the
+		// columns the join outputs - so unreferenced probe columns do not round-trip through the temporary files
+		auto &lhs_input_types = op.children[0].get().GetTypes();
+		unordered_set<idx_t> spill_columns;
+		for (auto &cond : op.conditions) {
+			CollectColumnReferences(*cond.left, spill_columns);
+		}
+		for (const auto &col_idx : op.lhs_output_columns.col_idxs) {
+			spill_columns.insert(col_idx);
+		}
+		probe_spill_column_ids.insert(probe_spill_column_ids.end(), spill_columns.begin(), spill_columns.end());
+		std::sort(probe_spill_column_ids.begin(), probe_spill_column_ids.end());
+
+		unordered_map<idx_t, idx_t> spill_column_map;
+		probe_types.reserve(probe_spill_column_ids.size() + 1);
+		for (idx_t col_idx = 0; col_idx < probe_spill_column_ids.size(); col_idx++) {
+			spill_column_map[probe_spill_column_ids[col_idx]] = col_idx;
+			probe_types.push_back(lhs_input_types[probe_spill_column_ids[col_idx]]);
+		}
 		probe_types.emplace_back(LogicalType::HASH);
 
+		// remap the join key expressions and the output columns to the spilled columns
+		for (auto &cond : op.conditions) {
+			auto probe_spill_key = cond.left->Copy();
+			RemapColumnReferences(*probe_spill_key, spill_column_map);
+			probe_spill_key_expressions.push_back(std::move(probe_spill_key));
+		}
+		for (const auto &col_idx : op.lhs_output_columns.col_idxs) {
+			probe_spill_output_col_idxs.push_back(spill_column_map[col_idx]);
+		}
+
 		if (op.filter_pushdown) {
 			if (op.filter_pushdown->probe_info.empty() && use_perfect_hash) {
 				// Only computing min/max to check for perfect HJ, but we already can
@@ -197,6 +247,12 @@ public:
 	//! Excess probe data gathered during Sink
 	vector<LogicalType> probe_types;
 	unique_ptr<JoinHashTable::ProbeSpill> probe_spill;
+	//! The probe input columns that are spilled (join key inputs and output columns)
+	vector<column_t> probe_spill_column_ids;
+	//! The join key expressions, remapped to reference the spilled columns
+	vector<unique_ptr<Expression>> probe_spill_key_expressions;
+	//! lhs_output_columns.col_idxs, remapped to reference the spilled columns
+	vector<column_t> probe_spill_output_col_idxs;
 
 	//! Whether or not we have started scanning data using GetData
 	atomic<bool> scanned_data;
@@ -385,7 +441,14 @@ static bool KeysAreSkewed(const HashJoinGlobalSinkState &sink) {
 	const auto max_partition_ht_size =
 	    sink.max_partition_size + sink.hash_table->PointerTableSize(sink.max_partition_count);
 	const auto skew = static_cast<double>(max_partition_ht_size) / static_cast<double>(sink.total_size);
-	return skew > SKEW_SINGLE_THREADED_THRESHOLD;
+	if (skew > SKEW_SINGLE_THREADED_THRESHOLD) {
+		return true;
+	}
+	// also consult the hash histograms: a single heavily-repeated key slams the same atomics
+	// during a parallel finalize regardless of how the partitions are balanced
+	const auto largest_key_count = sink.hash_table->GetLargestKeyCountEstimate(sink.local_hash_tables);
+	const auto key_skew = static_cast<double>(largest_key_count) / static_cast<double>(sink.hash_table->Count());
+	return key_skew > SKEW_SINGLE_THREADED_THRESHOLD;
 }
 
 //! If we have only one thread, always finalize single-threaded. Otherwise, we finalize in parallel if we
@@ -599,7 +662,7 @@ void HashJoinGlobalSinkState::ScheduleFinalize(Pipeline &pipeline, Event &event)
 void HashJoinGlobalSinkState::InitializeProbeSpill() {
 	auto guard = Lock();
 	if (!probe_spill) {
-		probe_spill = make_uniq<JoinHashTable::ProbeSpill>(*hash_table, context, probe_types);
+		probe_spill = make_uniq<JoinHashTable::ProbeSpill>(*hash_table, context, probe_types, probe_spill_column_ids);
 	}
 }
 
@@ -746,6 +809,39 @@ void JoinFilterPushdownInfo::PushInFilter(const JoinFilterPushdownFilter &info,
 	return;
 }
 
+void JoinFilterPushdownInfo::PushBloomFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht,
+                                             const PhysicalOperator &op, idx_t filter_idx,
+                                             idx_t filter_col_idx) const {
+	// scan the build keys (same way as PushInFilter, but we only need their hashes)
+	auto build_idx = join_condition[filter_idx];
+	auto &data_collection = ht.GetDataCollection();
+
+	Vector tuples_addresses(LogicalType::POINTER, ht.Count()); // allocate space for all the tuples
+
+	JoinHTScanState join_ht_state(data_collection, 0, data_collection.ChunkCount(),
+	                              TupleDataPinProperties::KEEP_EVERYTHING_PINNED);
+
+	// Go through all the blocks and fill the keys addresses
+	idx_t key_count = ht.FillWithHTOffsets(join_ht_state, tuples_addresses);
+
+	// Scan the build keys in the hash table
+	Vector build_vector(ht.layout_ptr->GetTypes()[build_idx], key_count);
+	data_collection.Gather(tuples_addresses, *FlatVector::IncrementalSelectionVector(), key_count, build_idx,
+	                       build_vector, *FlatVector::IncrementalSelectionVector(), nullptr);
+
+	// hash the keys and insert them into a bloom filter shared by all scan threads
+	// note that the probe column has the same type as the build key, as the pushdown optimizer only
+	// creates probe info for bare column references - so the probe side hashes the same way
+	Vector hashes(LogicalType::HASH, key_count);
+	VectorOperations::Hash(build_vector, hashes, key_count);
+
+	auto bloom_data = make_shared_ptr<BloomFilterData>(key_count);
+	bloom_data->Insert(hashes, key_count);
+
+	auto bloom_filter = make_uniq<BloomFilter>(std::move(bloom_data));
+	info.dynamic_filters->PushFilter(op, filter_col_idx, std::move(bloom_filter));
+}
+
 unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, optional_ptr<JoinHashTable> ht,
                                                        JoinFilterGlobalState &gstate,
                                                        const PhysicalComparisonJoin &op) const {
@@ -785,6 +881,10 @@ unique_ptr<DataChunk> JoinFilterPushdownInfo::Finalize(ClientContext &context, o
 			if (ht && ht->Count() > 1 && ht->Count() <= dynamic_or_filter_threshold &&
 			    cmp == ExpressionType::COMPARE_EQUAL) {
 				PushInFilter(info, *ht, op, filter_idx, filter_col_idx);
+			} else if (ht && ht->Count() > dynamic_or_filter_threshold &&
+			           ht->Count() <= BLOOM_FILTER_MAX_BUILD_COUNT && cmp == ExpressionType::COMPARE_EQUAL) {
+				// too large for an IN filter, but we can still filter probe rows on the build key hashes
+				PushBloomFilter(info, *ht, op, filter_idx, filter_col_idx);
 			}
 
 			if (Value::NotDistinctFrom(min_val, max_val)) {
@@ -870,7 +970,8 @@ SinkFinalizeType PhysicalHashJoin::Finalize(Pipeline &pipeline, Event &event, Cl
 			// We have to repartition
 			const auto radix_bits_before = ht.GetRadixBits();
 			ht.SetRepartitionRadixBits(sink.temporary_memory_state->GetReservation(), sink.max_partition_size,
-			                           sink.max_partition_count);
+			                           sink.max_partition_count,
+			                           ht.GetLargestKeyCountEstimate(sink.local_hash_tables));
 			DUCKDB_LOG(context, PhysicalOperatorLogType, *this, "PhysicalHashJoin", "Repartition",
 			           {{"partitions_before", to_string(RadixPartitioning::NumberOfPartitions(radix_bits_before))},
 			            {"partitions_after", to_string(RadixPartitioning::NumberOfPartitions(ht.GetRadixBits()))}});
@@ -1334,8 +1435,9 @@ HashJoinLocalSourceState::HashJoinLocalSourceState(const PhysicalHashJoin &op, c
 	lhs_output.Initialize(allocator, op.lhs_output_columns.col_types);
 	TupleDataCollection::InitializeChunkState(join_key_state, op.condition_types);
 
-	for (auto &cond : op.conditions) {
-		lhs_join_key_executor.AddExpression(*cond.left);
+	// the spilled probe data only contains the spill columns, so use the remapped join key expressions
+	for (auto &probe_spill_key : sink.probe_spill_key_expressions) {
+		lhs_join_key_executor.AddExpression(*probe_spill_key);
 	}
 }
 
@@ -1408,7 +1510,7 @@ void HashJoinLocalSourceState::ExternalProbe(HashJoinGlobalSinkState &sink, Hash
 	// Get the probe chunk columns/hashes
 	lhs_join_keys.Reset();
 	lhs_join_key_executor.Execute(lhs_probe_chunk, lhs_join_keys);
-	lhs_output.ReferenceColumns(lhs_probe_chunk, sink.op.lhs_output_columns.col_idxs);
+	lhs_output.ReferenceColumns(lhs_probe_chunk, sink.probe_spill_output_col_idxs);
 
 	if (sink.hash_table->Count() == 0 && !gstate.op.EmptyResultIfRHSIsEmpty()) {
 		gstate.op.ConstructEmptyJoinResult(sink.hash_table->join_type, sink.hash_table->has_null, lhs_output, chunk);
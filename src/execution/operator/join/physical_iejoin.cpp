@@ -825,9 +825,11 @@ public:
 		pair_count = left_ranges * right_ranges;
 	}
 
-	void Initialize();
+	void Initialize(ExecutionContext &context);
 	bool TryPrepareNextStage();
 	bool AssignTask(ExecutionContext &context, IEJoinLocalSourceState &lstate);
+	//! Whether the secondary key bounds of this pair of ranges allow any matches
+	bool RangePairCanMatch(idx_t l_range, idx_t r_range) const;
 
 public:
 	idx_t MaxThreads() override;
@@ -850,6 +852,13 @@ public:
 	atomic<size_t> next_pair;
 	atomic<size_t> completed;
 
+	//! Per-range min/max bounds of the secondary (L2) join key, used to skip range pairs
+	//! whose bounds cannot intersect (empty if there is only a single pair)
+	vector<Value> left_range_min;
+	vector<Value> left_range_max;
+	vector<Value> right_range_min;
+	vector<Value> right_range_max;
+
 	// Outer joins
 	atomic<idx_t> left_outers;
 	atomic<idx_t> next_left;
@@ -1078,7 +1087,87 @@ void IEJoinLocalSourceState::ResolveComplexJoin(ExecutionContext &context, DataC
 	} while (result.size() == 0);
 }
 
-void IEJoinGlobalSourceState::Initialize() {
+//! Compute per-range min/max bounds of the secondary (L2) join key by scanning the sorted payload,
+//! so range pairs whose bounds cannot intersect can be skipped without running the merge
+static void ComputeRangeBounds(ExecutionContext &context, const Expression &expr,
+                               PhysicalRangeJoin::GlobalSortedTable &table, const idx_t ranges,
+                               const idx_t blocks_per_range, vector<Value> &mins, vector<Value> &maxs) {
+	mins.assign(ranges, Value(expr.return_type));
+	maxs.assign(ranges, Value(expr.return_type));
+
+	ExpressionExecutor executor(context.client);
+	executor.AddExpression(expr);
+
+	auto &source = *table.sorted->payload_data;
+	TupleDataScanState scanner;
+	source.InitializeScan(scanner);
+
+	DataChunk scanned;
+	source.InitializeScanChunk(scanner, scanned);
+
+	DataChunk keys;
+	const vector<LogicalType> types {expr.return_type};
+	keys.Initialize(Allocator::DefaultAllocator(), types);
+
+	// NULLs in any join key sort to the end and can never match, so only the valid prefix matters
+	const auto valid = table.count - table.has_null;
+	idx_t table_idx = 0;
+	for (idx_t chunk_idx = 0; table_idx < valid && source.Scan(scanner, scanned); ++chunk_idx) {
+		auto scan_count = scanned.size();
+		if (table_idx + scan_count > valid) {
+			scan_count = valid - table_idx;
+			scanned.SetCardinality(scan_count);
+		}
+		table_idx += scan_count;
+
+		keys.Reset();
+		executor.Execute(scanned, keys);
+
+		auto &min = mins[chunk_idx / blocks_per_range];
+		auto &max = maxs[chunk_idx / blocks_per_range];
+		for (idx_t i = 0; i < scan_count; ++i) {
+			const auto value = keys.data[0].GetValue(i);
+			if (value.IsNull()) {
+				continue;
+			}
+			if (min.IsNull() || value < min) {
+				min = value;
+			}
+			if (max.IsNull() || max < value) {
+				max = value;
+			}
+		}
+	}
+}
+
+bool IEJoinGlobalSourceState::RangePairCanMatch(idx_t l_range, idx_t r_range) const {
+	if (left_range_min.empty() || right_range_min.empty()) {
+		// No bounds were computed
+		return true;
+	}
+	const auto &l_min = left_range_min[l_range];
+	const auto &l_max = left_range_max[l_range];
+	const auto &r_min = right_range_min[r_range];
+	const auto &r_max = right_range_max[r_range];
+	if (l_min.IsNull() || r_min.IsNull()) {
+		// One of the ranges has no valid secondary keys at all
+		return false;
+	}
+	switch (op.conditions[1].comparison) {
+	case ExpressionType::COMPARE_LESSTHAN:
+		return l_min < r_max;
+	case ExpressionType::COMPARE_LESSTHANOREQUALTO:
+		return l_min <= r_max;
+	case ExpressionType::COMPARE_GREATERTHAN:
+		return r_min < l_max;
+	case ExpressionType::COMPARE_GREATERTHANOREQUALTO:
+		return r_min <= l_max;
+	default:
+		return true;
+	}
+}
+
+void IEJoinGlobalSourceState::Initialize(ExecutionContext &context) {
 	auto guard = Lock();
 	if (stage != IEJoinSourceStage::INIT) {
 		return;
@@ -1100,6 +1189,15 @@ void IEJoinGlobalSourceState::Initialize() {
 		right_outers = right_blocks;
 	}
 
+	// Compute per-range bounds of the secondary key so AssignTask can skip range pairs
+	// that cannot contain matches (only worth the extra scan if there are multiple pairs)
+	if (pair_count > 1) {
+		ComputeRangeBounds(context, *op.lhs_orders[1].expression, left_table, left_ranges, left_per_thread,
+		                   left_range_min, left_range_max);
+		ComputeRangeBounds(context, *op.rhs_orders[1].expression, right_table, right_ranges, right_per_thread,
+		                   right_range_min, right_range_max);
+	}
+
 	// Ready for action
 	stage = IEJoinSourceStage::INNER;
 }
@@ -1141,8 +1239,13 @@ bool IEJoinGlobalSourceState::AssignTask(ExecutionContext &context, IEJoinLocalS
 	// Regular block
 	switch (stage.load()) {
 	case IEJoinSourceStage::INNER:
-		if (next_pair < pair_count) {
+		while (next_pair < pair_count) {
 			const auto i = next_pair++;
+			if (!RangePairCanMatch(i / right_ranges, i % right_ranges)) {
+				// The secondary key bounds prove this pair of ranges cannot produce matches
+				++completed;
+				continue;
+			}
 			const auto b1 = (i / right_ranges) * left_per_thread;
 			const auto b2 = (i % right_ranges) * right_per_thread;
 
@@ -1233,7 +1336,7 @@ SourceResultType PhysicalIEJoin::GetData(ExecutionContext &context, DataChunk &r
 	auto &gsource = input.global_state.Cast<IEJoinGlobalSourceState>();
 	auto &lsource = input.local_state.Cast<IEJoinLocalSourceState>();
 
-	gsource.Initialize();
+	gsource.Initialize(context);
 
 	// Any call to GetData must produce tuples, otherwise the pipeline executor thinks that we're done
 	// Therefore, we loop until we've produced tuples, or until the operator is actually done
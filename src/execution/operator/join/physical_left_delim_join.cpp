@@ -6,6 +6,7 @@
 #include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
 #include "duckdb/parallel/meta_pipeline.hpp"
 #include "duckdb/parallel/pipeline.hpp"
+#include "duckdb/parallel/thread_context.hpp"
 
 namespace duckdb {
 
@@ -61,7 +62,6 @@ public:
 		lhs_data.InitializeAppend(append_state);
 	}
 
-	unique_ptr<LocalSinkState> distinct_state;
 	ColumnDataCollection lhs_data;
 	ColumnDataAppendState append_state;
 
@@ -80,17 +80,16 @@ unique_ptr<GlobalSinkState> PhysicalLeftDelimJoin::GetGlobalSinkState(ClientCont
 }
 
 unique_ptr<LocalSinkState> PhysicalLeftDelimJoin::GetLocalSinkState(ExecutionContext &context) const {
-	auto state = make_uniq<LeftDelimJoinLocalState>(context.client, *this);
-	state->distinct_state = distinct.GetLocalSinkState(context);
-	return std::move(state);
+	return make_uniq<LeftDelimJoinLocalState>(context.client, *this);
 }
 
 SinkResultType PhysicalLeftDelimJoin::Sink(ExecutionContext &context, DataChunk &chunk,
                                            OperatorSinkInput &input) const {
+	// fused duplicate elimination: the sink only materializes the LHS data here - the distinct
+	// delim set is built from the cached collection in a single pass during Finalize, instead of
+	// pushing every chunk through the distinct aggregate a second time
 	auto &lstate = input.local_state.Cast<LeftDelimJoinLocalState>();
 	lstate.lhs_data.Append(lstate.append_state, chunk);
-	OperatorSinkInput distinct_sink_input {*distinct.sink_state, *lstate.distinct_state, input.interrupt_state};
-	distinct.Sink(context, chunk, distinct_sink_input);
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
@@ -98,11 +97,6 @@ SinkCombineResultType PhysicalLeftDelimJoin::Combine(ExecutionContext &context,
 	auto &lstate = input.local_state.Cast<LeftDelimJoinLocalState>();
 	auto &gstate = input.global_state.Cast<LeftDelimJoinGlobalState>();
 	gstate.Merge(lstate.lhs_data);
-
-	OperatorSinkCombineInput distinct_combine_input {*distinct.sink_state, *lstate.distinct_state,
-	                                                 input.interrupt_state};
-	distinct.Combine(context, distinct_combine_input);
-
 	return SinkCombineResultType::FINISHED;
 }
 
@@ -112,6 +106,27 @@ void PhysicalLeftDelimJoin::PrepareFinalize(ClientContext &context, GlobalSinkSt
 
 SinkFinalizeType PhysicalLeftDelimJoin::Finalize(Pipeline &pipeline, Event &event, ClientContext &client,
                                                  OperatorSinkFinalizeInput &input) const {
+	auto &gstate = input.global_state.Cast<LeftDelimJoinGlobalState>();
+
+	// Build the distinct hash table from the cached LHS collection. The delim set is typically a
+	// handful of distinct correlated values, so a single scan here is cheaper than the per-thread
+	// aggregate states and combine round the per-chunk sink used to pay for.
+	ThreadContext thread_context(client);
+	ExecutionContext execution_context(client, thread_context, &pipeline);
+	auto distinct_local_state = distinct.GetLocalSinkState(execution_context);
+
+	ColumnDataScanState scan_state;
+	gstate.lhs_data.InitializeScan(scan_state);
+	DataChunk scan_chunk;
+	gstate.lhs_data.InitializeScanChunk(scan_chunk);
+	while (gstate.lhs_data.Scan(scan_state, scan_chunk)) {
+		OperatorSinkInput distinct_sink_input {*distinct.sink_state, *distinct_local_state, input.interrupt_state};
+		distinct.Sink(execution_context, scan_chunk, distinct_sink_input);
+	}
+	OperatorSinkCombineInput distinct_combine_input {*distinct.sink_state, *distinct_local_state,
+	                                                 input.interrupt_state};
+	distinct.Combine(execution_context, distinct_combine_input);
+
 	// Finalize the distinct hash table.
 	OperatorSinkFinalizeInput finalize_input {*distinct.sink_state, input.interrupt_state};
 	distinct.Finalize(pipeline, event, client, finalize_input);
@@ -552,6 +552,68 @@ static idx_t MergeJoinComplexBlocks(const SortKeyType &sort_key_type, ChunkMerge
 	}
 }
 
+template <SortKeyType SORT_KEY_TYPE>
+static idx_t TemplatedFirstMatchingRightEntry(PiecewiseMergeJoinState &lstate, MergeJoinGlobalState &gstate,
+                                              const bool strict) {
+	using SORT_KEY = SortKey<SORT_KEY_TYPE>;
+	using BLOCK_ITERATOR = block_iterator_t<ExternalBlockIteratorState, SORT_KEY>;
+
+	auto &lhs_table = *lstate.lhs_global_table;
+	const auto lhs_not_null = lhs_table.count - lhs_table.has_null;
+	if (lhs_not_null == 0) {
+		// no LHS key can match anything - skip the entire RHS
+		return gstate.table->count;
+	}
+	auto &rhs_table = *gstate.table;
+	const auto rhs_not_null = rhs_table.count - rhs_table.has_null;
+
+	BLOCK_ITERATOR lhs_itr(*lstate.lhs_iterator);
+	BLOCK_ITERATOR rhs_itr(*lstate.rhs_iterator);
+
+	// Binary search for the first RHS entry that matches the smallest LHS key.
+	// Both sides are sorted on the same key encoding, so no entry before it can match any LHS row,
+	// and each probe chunk only merges its own disjoint range of the RHS.
+	idx_t begin = 0;
+	idx_t end = rhs_not_null;
+	while (begin < end) {
+		const auto mid = begin + (end - begin) / 2;
+		if (MergeJoinBefore(lhs_itr[idx_t(0)], rhs_itr[mid], strict)) {
+			end = mid;
+		} else {
+			begin = mid + 1;
+		}
+	}
+	return begin;
+}
+
+static idx_t FirstMatchingRightEntry(PiecewiseMergeJoinState &lstate, MergeJoinGlobalState &gstate,
+                                     const ExpressionType comparison) {
+	const auto strict = MergeJoinStrictComparison(comparison);
+
+	switch (lstate.sort_key_type) {
+	case SortKeyType::NO_PAYLOAD_FIXED_8:
+		return TemplatedFirstMatchingRightEntry<SortKeyType::NO_PAYLOAD_FIXED_8>(lstate, gstate, strict);
+	case SortKeyType::NO_PAYLOAD_FIXED_16:
+		return TemplatedFirstMatchingRightEntry<SortKeyType::NO_PAYLOAD_FIXED_16>(lstate, gstate, strict);
+	case SortKeyType::NO_PAYLOAD_FIXED_24:
+		return TemplatedFirstMatchingRightEntry<SortKeyType::NO_PAYLOAD_FIXED_24>(lstate, gstate, strict);
+	case SortKeyType::NO_PAYLOAD_FIXED_32:
+		return TemplatedFirstMatchingRightEntry<SortKeyType::NO_PAYLOAD_FIXED_32>(lstate, gstate, strict);
+	case SortKeyType::NO_PAYLOAD_VARIABLE_32:
+		return TemplatedFirstMatchingRightEntry<SortKeyType::NO_PAYLOAD_VARIABLE_32>(lstate, gstate, strict);
+	case SortKeyType::PAYLOAD_FIXED_16:
+		return TemplatedFirstMatchingRightEntry<SortKeyType::PAYLOAD_FIXED_16>(lstate, gstate, strict);
+	case SortKeyType::PAYLOAD_FIXED_24:
+		return TemplatedFirstMatchingRightEntry<SortKeyType::PAYLOAD_FIXED_24>(lstate, gstate, strict);
+	case SortKeyType::PAYLOAD_FIXED_32:
+		return TemplatedFirstMatchingRightEntry<SortKeyType::PAYLOAD_FIXED_32>(lstate, gstate, strict);
+	case SortKeyType::PAYLOAD_VARIABLE_32:
+		return TemplatedFirstMatchingRightEntry<SortKeyType::PAYLOAD_VARIABLE_32>(lstate, gstate, strict);
+	default:
+		throw NotImplementedException("FirstMatchingRightEntry for %s", EnumUtil::ToString(lstate.sort_key_type));
+	}
+}
+
 OperatorResultType PhysicalPiecewiseMergeJoin::ResolveComplexJoin(ExecutionContext &context, DataChunk &input,
                                                                   DataChunk &chunk, OperatorState &state_p) const {
 	auto &state = state_p.Cast<PiecewiseMergeJoinState>();
@@ -564,13 +626,15 @@ OperatorResultType PhysicalPiecewiseMergeJoin::ResolveComplexJoin(ExecutionConte
 			state.ResolveJoinKeys(context, input);
 			state.lhs_payload.Verify();
 
-			state.right_chunk_index = 0;
-			state.right_base = 0;
+			// skip the prefix of the RHS that cannot match any row of this (sorted) probe chunk
+			const auto rhs_begin = FirstMatchingRightEntry(state, gstate, conditions[0].comparison);
+			state.right_chunk_index = rhs_begin / STANDARD_VECTOR_SIZE;
+			state.right_base = state.right_chunk_index * STANDARD_VECTOR_SIZE;
 			state.left_position = 0;
 			state.prev_left_index = 0;
-			state.right_position = 0;
+			state.right_position = rhs_begin % STANDARD_VECTOR_SIZE;
 			state.first_fetch = false;
-			state.finished = false;
+			state.finished = state.right_chunk_index >= gstate.table->BlockCount();
 		}
 		if (state.finished) {
 			if (state.left_outer.Enabled()) {
@@ -3,6 +3,7 @@
 #include "duckdb/catalog/catalog_entry/duck_table_entry.hpp"
 #include "duckdb/execution/operator/persistent/batch_memory_manager.hpp"
 #include "duckdb/execution/operator/persistent/batch_task_manager.hpp"
+#include "duckdb/main/settings.hpp"
 #include "duckdb/parallel/thread_context.hpp"
 #include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/table/append_state.hpp"
@@ -151,6 +152,7 @@ public:
 	    : memory_manager(context, minimum_memory_per_thread), table(table), insert_count(0),
 	      optimistically_written(false), minimum_memory_per_thread(minimum_memory_per_thread) {
 		row_group_size = table.GetStorage().GetRowGroupSize();
+		direct_flush = DBConfig::GetSetting<BatchInsertDirectFlushSetting>(context);
 		table.GetStorage().BindIndexes(context);
 	}
 
@@ -164,6 +166,9 @@ public:
 	idx_t next_start = 0;
 	atomic<bool> optimistically_written;
 	idx_t minimum_memory_per_thread;
+	//! Whether each batch is flushed to disk directly by the inserting thread (batch_insert_direct_flush),
+	//! instead of merging neighboring batches into full row groups before flushing
+	bool direct_flush;
 
 	bool ReadyToMerge(const idx_t count) const;
 	void ScheduleMergeTasks(ClientContext &context, const idx_t min_batch_index);
@@ -379,8 +384,15 @@ void BatchInsertGlobalState::AddCollection(ClientContext &context, const idx_t b
 	auto &collection = *optimistic_collection.collection;
 	auto new_count = collection.GetTotalRows();
 	auto batch_type = new_count < row_group_size ? RowGroupBatchType::NOT_FLUSHED : RowGroupBatchType::FLUSHED;
+	if (direct_flush && writer && new_count > 0) {
+		// direct flush - every batch is written to disk by the thread that produced it, even if it is smaller
+		// than a row group, so that no cross-batch merging is required and only the ordered linking of the row
+		// groups into the table remains for the finalize phase
+		batch_type = RowGroupBatchType::FLUSHED;
+	}
 	if (batch_type == RowGroupBatchType::FLUSHED && writer) {
 		writer->WriteLastRowGroup(optimistic_collection);
+		optimistically_written = true;
 	}
 	lock_guard<mutex> l(lock);
 	insert_count += new_count;
@@ -2,6 +2,7 @@
 
 #include "duckdb/common/file_opener.hpp"
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/common/hive_partitioning.hpp"
 #include "duckdb/common/string_util.hpp"
 #include "duckdb/common/types/uuid.hpp"
@@ -104,6 +105,7 @@ public:
 
 	string GetOrCreateDirectory(const vector<idx_t> &cols, bool hive_file_pattern, const vector<string> &names,
 	                            const vector<Value> &values, string path, FileSystem &fs) {
+		lock_guard<mutex> guard(directory_lock);
 		CreateDir(path, fs);
 		if (hive_file_pattern) {
 			for (idx_t i = 0; i < cols.size(); i++) {
@@ -145,38 +147,46 @@ public:
 
 	void FinalizePartitions(ClientContext &context, const PhysicalCopyToFile &op) {
 		// finalize any remaining partitions
-		for (auto &entry : active_partitioned_writes) {
-			FinalizePartition(context, op, *entry.second);
+		for (auto &shard : partition_shards) {
+			lock_guard<mutex> shard_guard(shard.lock);
+			for (auto &entry : shard.active_partitioned_writes) {
+				FinalizePartition(context, op, *entry.second);
+			}
 		}
 	}
 
 	PartitionWriteInfo &GetPartitionWriteInfo(ExecutionContext &context, const PhysicalCopyToFile &op,
 	                                          const vector<Value> &values) {
-		auto global_lock = lock.GetExclusiveLock();
+		// partitions are sharded by the hash of their key: threads flushing different partitions
+		// only contend within their shard, so file creation and flushing proceed in parallel
+		auto &shard = GetShard(values);
+		lock_guard<mutex> shard_guard(shard.lock);
 		// check if we have already started writing this partition
-		auto active_write_entry = active_partitioned_writes.find(values);
-		if (active_write_entry != active_partitioned_writes.end()) {
+		auto active_write_entry = shard.active_partitioned_writes.find(values);
+		if (active_write_entry != shard.active_partitioned_writes.end()) {
 			// we have - continue writing in this partition
 			active_write_entry->second->active_writes++;
 			return *active_write_entry->second;
 		}
 		// check if we need to close any writers before we can continue
-		if (active_partitioned_writes.size() >= max_open_files) {
-			// we need to! try to close writers
-			for (auto &entry : active_partitioned_writes) {
+		if (open_partition_files.load() >= max_open_files) {
+			// we need to! try to close writers in our own shard (other shards evict their own,
+			// so the cap is approximate under contention - as it was with the single map)
+			for (auto &entry : shard.active_partitioned_writes) {
 				if (entry.second->active_writes == 0) {
 					// we can evict this entry - evict the partition
 					FinalizePartition(context.client, op, *entry.second);
-					++previous_partitions[entry.first];
-					active_partitioned_writes.erase(entry.first);
+					--open_partition_files;
+					++shard.previous_partitions[entry.first];
+					shard.active_partitioned_writes.erase(entry.first);
 					break;
 				}
 			}
 		}
 		idx_t offset = 0;
 		if (op.hive_file_pattern) {
-			auto prev_offset = previous_partitions.find(values);
-			if (prev_offset != previous_partitions.end()) {
+			auto prev_offset = shard.previous_partitions.find(values);
+			if (prev_offset != shard.previous_partitions.end()) {
 				offset = prev_offset->second;
 			}
 		} else {
@@ -200,6 +210,8 @@ public:
 		}
 		optional_ptr<CopyToFileInfo> written_file_info;
 		if (op.return_type != CopyFunctionReturnType::CHANGED_ROWS) {
+			// the written file list is global - take the global lock just for registering the file
+			auto global_lock = lock.GetExclusiveLock();
 			written_file_info = AddFile(*global_lock, full_path, op.return_type);
 		}
 		// initialize writes
@@ -228,20 +240,40 @@ public:
 		auto &result = *info;
 		info->active_writes = 1;
 		// store in active write map
-		active_partitioned_writes.insert(make_pair(values, std::move(info)));
+		++open_partition_files;
+		shard.active_partitioned_writes.insert(make_pair(values, std::move(info)));
 		return result;
 	}
 
-	void FinishPartitionWrite(PartitionWriteInfo &info) {
-		auto global_lock = lock.GetExclusiveLock();
+	void FinishPartitionWrite(const vector<Value> &values, PartitionWriteInfo &info) {
+		auto &shard = GetShard(values);
+		lock_guard<mutex> shard_guard(shard.lock);
 		info.active_writes--;
 	}
 
 private:
-	//! The active writes per partition (for partitioned write)
-	vector_of_value_map_t<unique_ptr<PartitionWriteInfo>> active_partitioned_writes;
-	vector_of_value_map_t<idx_t> previous_partitions;
-	idx_t global_offset = 0;
+	//! A shard of the partitioned write state - see GetPartitionWriteInfo
+	struct PartitionWriteShard {
+		mutex lock;
+		//! The active writes per partition (for partitioned write)
+		vector_of_value_map_t<unique_ptr<PartitionWriteInfo>> active_partitioned_writes;
+		vector_of_value_map_t<idx_t> previous_partitions;
+	};
+
+	PartitionWriteShard &GetShard(const vector<Value> &values) {
+		return partition_shards[VectorOfValuesHashFunction()(values) % PARTITION_WRITE_SHARD_COUNT];
+	}
+
+private:
+	static constexpr idx_t PARTITION_WRITE_SHARD_COUNT = 64;
+
+	//! The sharded partition write state
+	PartitionWriteShard partition_shards[PARTITION_WRITE_SHARD_COUNT];
+	//! Protects "created_directories"
+	mutex directory_lock;
+	//! The total number of open partition files across all shards
+	atomic<idx_t> open_partition_files {0};
+	atomic<idx_t> global_offset {0};
 };
 
 string PhysicalCopyToFile::GetTrimmedPath(ClientContext &context) const {
@@ -344,7 +376,7 @@ public:
 			op.function.copy_to_combine(context, *op.bind_data, *info.global_state, *local_copy_state);
 			local_copy_state.reset();
 			partitions[i].reset();
-			g.FinishPartitionWrite(info);
+			g.FinishPartitionWrite(entry->second->values, info);
 		}
 		ResetAppendState();
 	}
@@ -124,25 +124,6 @@ unique_ptr<LocalSinkState> PhysicalInsert::GetLocalSinkState(ExecutionContext &c
 	return make_uniq<InsertLocalState>(context.client, insert_types, bound_constraints);
 }
 
-bool AllConflictsMeetCondition(DataChunk &result) {
-	result.Flatten();
-	auto data = FlatVector::GetData<bool>(result.data[0]);
-	for (idx_t i = 0; i < result.size(); i++) {
-		if (!data[i]) {
-			return false;
-		}
-	}
-	return true;
-}
-
-void CheckOnConflictCondition(ExecutionContext &context, DataChunk &conflicts, const unique_ptr<Expression> &condition,
-                              DataChunk &result) {
-	ExpressionExecutor executor(context.client, *condition);
-	result.Initialize(context.client, {LogicalType::BOOLEAN});
-	executor.Execute(conflicts, result);
-	result.SetCardinality(conflicts.size());
-}
-
 static void CombineExistingAndInsertTuples(DataChunk &result, DataChunk &scan_chunk, DataChunk &input_chunk,
                                            ClientContext &client, const PhysicalInsert &op) {
 	auto &types_to_fetch = op.types_to_fetch;
@@ -196,23 +177,9 @@ static void CreateUpdateChunk(ExecutionContext &context, DataChunk &chunk, Table
 
 	// Check the optional condition for the DO UPDATE clause, to filter which rows will be updated
 	if (do_update_condition) {
-		DataChunk do_update_filter_result;
-		do_update_filter_result.Initialize(context.client, {LogicalType::BOOLEAN});
 		ExpressionExecutor where_executor(context.client, *do_update_condition);
-		where_executor.Execute(chunk, do_update_filter_result);
-		do_update_filter_result.SetCardinality(chunk.size());
-		do_update_filter_result.Flatten();
-
 		SelectionVector sel(chunk.size());
-		idx_t count = 0;
-
-		auto where_data = FlatVector::GetData<bool>(do_update_filter_result.data[0]);
-		for (idx_t i = 0; i < chunk.size(); i++) {
-			if (where_data[i]) {
-				sel.set_index(count, i);
-				count++;
-			}
-		}
+		const auto count = where_executor.SelectExpression(chunk, sel);
 		if (count != chunk.size()) {
 			// Filter any conflicts not meeting the condition.
 			chunk.Slice(sel, count);
@@ -395,26 +362,19 @@ static void VerifyOnConflictCondition(ExecutionContext &context, DataChunk &comb
 	if (!on_conflict_condition) {
 		return;
 	}
-	DataChunk conflict_condition_result;
-	CheckOnConflictCondition(context, combined_chunk, on_conflict_condition, conflict_condition_result);
-	bool conditions_met = AllConflictsMeetCondition(conflict_condition_result);
-	if (conditions_met) {
+	// Evaluate the ON CONFLICT condition over the whole chunk at once, tracking the violating tuples.
+	ExpressionExecutor condition_executor(context.client, *on_conflict_condition);
+	SelectionVector passing_sel(combined_chunk.size());
+	SelectionVector violating_sel(combined_chunk.size());
+	const auto passing_count = condition_executor.SelectExpression(combined_chunk, &passing_sel, &violating_sel,
+	                                                               nullptr, combined_chunk.size());
+	if (passing_count == combined_chunk.size()) {
 		return;
 	}
 
 	// We need to throw.
 	// Filter any passing tuples and verify again with those violating the constraint.
-	SelectionVector sel(combined_chunk.size());
-	idx_t count = 0;
-	auto data = FlatVector::GetData<bool>(conflict_condition_result.data[0]);
-	for (idx_t i = 0; i < combined_chunk.size(); i++) {
-		if (!data[i]) {
-			// The tuple does not meet the condition.
-			sel.set_index(count, i);
-			count++;
-		}
-	}
-	combined_chunk.Slice(sel, count);
+	combined_chunk.Slice(violating_sel, combined_chunk.size() - passing_count);
 
 	// Verify and throw.
 	if (GLOBAL) {
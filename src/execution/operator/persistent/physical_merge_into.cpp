@@ -305,6 +305,26 @@ void PhysicalMergeInto::ComputeMatches(MergeIntoLocalState &local_state, DataChu
 				matched.sel.set_index(matched.count++, i);
 			}
 		}
+	} else if (!row_id_data.sel->IsSet()) {
+		// no source marker and no selection on the row-ids - count the valid row-ids in one pass over the mask
+		const auto valid_count = row_id_data.validity.CountValid(chunk.size());
+		if (valid_count == chunk.size()) {
+			// all rows have a target match - no need to build selection vectors
+			matched.count = chunk.size();
+		} else if (valid_count == 0) {
+			// no row has a target match
+			not_matched.count = chunk.size();
+		} else {
+			for (idx_t i = 0; i < chunk.size(); i++) {
+				if (row_id_data.validity.RowIsValid(i)) {
+					// match
+					matched.sel.set_index(matched.count++, i);
+				} else {
+					// no match
+					not_matched.sel.set_index(not_matched.count++, i);
+				}
+			}
+		}
 	} else {
 		// no source marker - only check row-ids
 		for (idx_t i = 0; i < chunk.size(); i++) {
@@ -325,6 +345,11 @@ void PhysicalMergeInto::ComputeMatches(MergeIntoLocalState &local_state, DataChu
 			continue;
 		}
 		match.chunk->Reset();
+		if (match.count == chunk.size()) {
+			// every row falls into this match class - reference the chunk instead of slicing it
+			match.chunk->Reference(chunk);
+			continue;
+		}
 		match.chunk->Slice(chunk, match.sel, match.count);
 	}
 }
@@ -0,0 +1,374 @@
+#include "duckdb/execution/operator/projection/physical_parallel_unnest.hpp"
+
+#include "duckdb/common/algorithm.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/planner/expression/bound_unnest_expression.hpp"
+
+namespace duckdb {
+
+PhysicalParallelUnnest::PhysicalParallelUnnest(PhysicalPlan &physical_plan, vector<LogicalType> types,
+                                               vector<unique_ptr<Expression>> select_list, idx_t estimated_cardinality)
+    : PhysicalOperator(physical_plan, PhysicalOperatorType::UNNEST, std::move(types), estimated_cardinality),
+      select_list(std::move(select_list)) {
+	D_ASSERT(!this->select_list.empty());
+}
+
+//===--------------------------------------------------------------------===//
+// Sink
+//===--------------------------------------------------------------------===//
+class ParallelUnnestGlobalSinkState : public GlobalSinkState {
+public:
+	ParallelUnnestGlobalSinkState(ClientContext &context, vector<LogicalType> types)
+	    : collection(context, std::move(types)) {
+	}
+
+	mutex glock;
+	//! The materialized input of the operator
+	ColumnDataCollection collection;
+};
+
+class ParallelUnnestLocalSinkState : public LocalSinkState {
+public:
+	ParallelUnnestLocalSinkState(ClientContext &context, vector<LogicalType> types)
+	    : collection(context, std::move(types)) {
+	}
+
+	ColumnDataCollection collection;
+};
+
+unique_ptr<GlobalSinkState> PhysicalParallelUnnest::GetGlobalSinkState(ClientContext &context) const {
+	return make_uniq<ParallelUnnestGlobalSinkState>(context, children[0].get().GetTypes());
+}
+
+unique_ptr<LocalSinkState> PhysicalParallelUnnest::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<ParallelUnnestLocalSinkState>(context.client, children[0].get().GetTypes());
+}
+
+SinkResultType PhysicalParallelUnnest::Sink(ExecutionContext &context, DataChunk &chunk,
+                                            OperatorSinkInput &input) const {
+	auto &lstate = input.local_state.Cast<ParallelUnnestLocalSinkState>();
+	lstate.collection.Append(chunk);
+	return SinkResultType::NEED_MORE_INPUT;
+}
+
+SinkCombineResultType PhysicalParallelUnnest::Combine(ExecutionContext &context,
+                                                      OperatorSinkCombineInput &input) const {
+	auto &gstate = input.global_state.Cast<ParallelUnnestGlobalSinkState>();
+	auto &lstate = input.local_state.Cast<ParallelUnnestLocalSinkState>();
+
+	lock_guard<mutex> guard(gstate.glock);
+	gstate.collection.Combine(lstate.collection);
+	return SinkCombineResultType::FINISHED;
+}
+
+//===--------------------------------------------------------------------===//
+// Source
+//===--------------------------------------------------------------------===//
+//! A range of output rows of a single input chunk, handed out to one thread
+struct ParallelUnnestTask {
+	//! The index of the input chunk in the collection
+	idx_t chunk_idx = DConstants::INVALID_INDEX;
+	//! The input row to start unnesting at
+	idx_t row_idx = 0;
+	//! The position within the first row's unnest to start at (non-zero when a large list is split)
+	idx_t list_position = 0;
+	//! The number of output rows covered by this task
+	idx_t count = 0;
+};
+
+//! Compute the unnest length of every row in the executed list data (the longest list of the row)
+static void ComputeUnnestLengths(DataChunk &list_data, vector<UnifiedVectorFormat> &list_vector_data,
+                                 unsafe_vector<idx_t> &unnest_lengths) {
+	if (list_data.size() > unnest_lengths.size()) {
+		unnest_lengths.resize(list_data.size());
+	}
+	for (idx_t r = 0; r < list_data.size(); r++) {
+		unnest_lengths[r] = 0;
+	}
+	for (idx_t col_idx = 0; col_idx < list_data.ColumnCount(); col_idx++) {
+		auto &list_vector = list_data.data[col_idx];
+		list_vector.ToUnifiedFormat(list_data.size(), list_vector_data[col_idx]);
+		if (list_vector.GetType() == LogicalType::SQLNULL) {
+			continue;
+		}
+		auto &vector_data = list_vector_data[col_idx];
+		auto list_data_entries = UnifiedVectorFormat::GetData<list_entry_t>(vector_data);
+		for (idx_t r = 0; r < list_data.size(); r++) {
+			auto current_idx = vector_data.sel->get_index(r);
+			if (!vector_data.validity.RowIsValid(current_idx)) {
+				continue;
+			}
+			auto list_entry = list_data_entries[current_idx];
+			if (list_entry.length > unnest_lengths[r]) {
+				unnest_lengths[r] = list_entry.length;
+			}
+		}
+	}
+}
+
+class ParallelUnnestGlobalSourceState : public GlobalSourceState {
+public:
+	ParallelUnnestGlobalSourceState(ClientContext &context, const PhysicalParallelUnnest &op,
+	                                ColumnDataCollection &collection)
+	    : collection(collection), executor(context), chunk_idx(0), row_idx(0), list_position(0), lengths_valid(false) {
+		vector<LogicalType> list_data_types;
+		for (auto &exp : op.select_list) {
+			D_ASSERT(exp->GetExpressionType() == ExpressionType::BOUND_UNNEST);
+			auto &bue = exp->Cast<BoundUnnestExpression>();
+			list_data_types.push_back(bue.child->return_type);
+			executor.AddExpression(*bue.child);
+		}
+		auto &allocator = Allocator::Get(context);
+		input_chunk.Initialize(allocator, collection.Types());
+		list_data.Initialize(allocator, list_data_types);
+		list_vector_data.resize(list_data.ColumnCount());
+	}
+
+	//! Hand out the next range of output rows - returns false if all input has been assigned
+	bool AssignTask(ParallelUnnestTask &task) {
+		lock_guard<mutex> guard(lock);
+		while (chunk_idx < collection.ChunkCount()) {
+			if (!lengths_valid) {
+				// entering a new chunk: evaluate the UNNEST expressions to get the list lengths
+				collection.FetchChunk(chunk_idx, input_chunk);
+				list_data.Reset();
+				executor.Execute(input_chunk, list_data);
+				ComputeUnnestLengths(list_data, list_vector_data, unnest_lengths);
+				lengths_valid = true;
+			}
+
+			// cover up to MORSEL_SIZE output rows, splitting large lists mid-row if necessary
+			task.chunk_idx = chunk_idx;
+			task.row_idx = row_idx;
+			task.list_position = list_position;
+			task.count = 0;
+			idx_t budget = PhysicalParallelUnnest::MORSEL_SIZE;
+			while (budget > 0 && row_idx < input_chunk.size()) {
+				auto take = MinValue<idx_t>(unnest_lengths[row_idx] - list_position, budget);
+				task.count += take;
+				budget -= take;
+				list_position += take;
+				if (list_position == unnest_lengths[row_idx]) {
+					row_idx++;
+					list_position = 0;
+				}
+			}
+			if (row_idx == input_chunk.size()) {
+				// finished handing out this chunk
+				chunk_idx++;
+				row_idx = 0;
+				list_position = 0;
+				lengths_valid = false;
+			}
+			if (task.count > 0) {
+				return true;
+			}
+			// this range only contained empty lists: move on
+		}
+		return false;
+	}
+
+	idx_t MaxThreads() override {
+		// every input row could hold a large list, so overestimate and let idle threads finish early
+		return collection.Count();
+	}
+
+	ColumnDataCollection &collection;
+
+private:
+	mutex lock;
+	ExpressionExecutor executor;
+	DataChunk input_chunk;
+	DataChunk list_data;
+	vector<UnifiedVectorFormat> list_vector_data;
+	unsafe_vector<idx_t> unnest_lengths;
+	//! Assignment cursor: the next (chunk, row, position) to hand out
+	idx_t chunk_idx;
+	idx_t row_idx;
+	idx_t list_position;
+	bool lengths_valid;
+};
+
+class ParallelUnnestLocalSourceState : public LocalSourceState {
+public:
+	ParallelUnnestLocalSourceState(ClientContext &context, const PhysicalParallelUnnest &op,
+	                               const vector<LogicalType> &input_types)
+	    : executor(context), current_chunk_idx(DConstants::INVALID_INDEX), input_sel(STANDARD_VECTOR_SIZE) {
+		vector<LogicalType> list_data_types;
+		for (auto &exp : op.select_list) {
+			auto &bue = exp->Cast<BoundUnnestExpression>();
+			list_data_types.push_back(bue.child->return_type);
+			executor.AddExpression(*bue.child);
+
+			unnest_sels.emplace_back(STANDARD_VECTOR_SIZE);
+			null_sels.emplace_back(STANDARD_VECTOR_SIZE);
+		}
+		null_counts.resize(list_data_types.size());
+
+		auto &allocator = Allocator::Get(context);
+		input_chunk.Initialize(allocator, input_types);
+		list_data.Initialize(allocator, list_data_types);
+
+		list_vector_data.resize(list_data.ColumnCount());
+		list_child_data.resize(list_data.ColumnCount());
+	}
+
+	ExpressionExecutor executor;
+	//! The task currently being processed (count is decremented as output is produced)
+	ParallelUnnestTask task;
+	//! The chunk the fetched input data belongs to
+	idx_t current_chunk_idx;
+	DataChunk input_chunk;
+	DataChunk list_data;
+	vector<UnifiedVectorFormat> list_vector_data;
+	vector<UnifiedVectorFormat> list_child_data;
+	unsafe_vector<idx_t> unnest_lengths;
+	SelectionVector input_sel;
+	vector<SelectionVector> unnest_sels;
+	vector<SelectionVector> null_sels;
+	vector<idx_t> null_counts;
+
+public:
+	//! Fetch the input chunk of the current task and prepare the list data for unnesting
+	void PrepareChunk(ColumnDataCollection &collection) {
+		collection.FetchChunk(task.chunk_idx, input_chunk);
+		list_data.Reset();
+		executor.Execute(input_chunk, list_data);
+		ComputeUnnestLengths(list_data, list_vector_data, unnest_lengths);
+		for (idx_t col_idx = 0; col_idx < list_data.ColumnCount(); col_idx++) {
+			auto &list_vector = list_data.data[col_idx];
+			if (list_vector.GetType() == LogicalType::SQLNULL) {
+				// UNNEST(NULL): SQLNULL vectors don't have child vectors, but we need to point to the child vector of
+				// each vector, so we just get the UnifiedVectorFormat of the vector itself
+				auto &child_vector = list_vector;
+				child_vector.ToUnifiedFormat(0, list_child_data[col_idx]);
+			} else {
+				auto list_size = ListVector::GetListSize(list_vector);
+				auto &child_vector = ListVector::GetEntry(list_vector);
+				child_vector.ToUnifiedFormat(list_size, list_child_data[col_idx]);
+			}
+		}
+		current_chunk_idx = task.chunk_idx;
+	}
+};
+
+unique_ptr<GlobalSourceState> PhysicalParallelUnnest::GetGlobalSourceState(ClientContext &context) const {
+	auto &gsink = sink_state->Cast<ParallelUnnestGlobalSinkState>();
+	return make_uniq<ParallelUnnestGlobalSourceState>(context, *this, gsink.collection);
+}
+
+unique_ptr<LocalSourceState> PhysicalParallelUnnest::GetLocalSourceState(ExecutionContext &context,
+                                                                         GlobalSourceState &gstate) const {
+	return make_uniq<ParallelUnnestLocalSourceState>(context.client, *this, children[0].get().GetTypes());
+}
+
+SourceResultType PhysicalParallelUnnest::GetData(ExecutionContext &context, DataChunk &chunk,
+                                                 OperatorSourceInput &input) const {
+	auto &gstate = input.global_state.Cast<ParallelUnnestGlobalSourceState>();
+	auto &state = input.local_state.Cast<ParallelUnnestLocalSourceState>();
+
+	if (state.task.count == 0 && !gstate.AssignTask(state.task)) {
+		return SourceResultType::FINISHED;
+	}
+	if (state.current_chunk_idx != state.task.chunk_idx) {
+		state.PrepareChunk(gstate.collection);
+	}
+	auto &task = state.task;
+	auto &input_chunk = state.input_chunk;
+
+	// fill the selection vectors for the next vector of output rows, advancing the task cursor
+	// this mirrors PhysicalUnnest::ExecuteInternal, except that the task bounds the range
+	idx_t result_length = 0;
+	idx_t unnest_list_count = 0;
+	auto initial_row = task.row_idx;
+	for (idx_t col_idx = 0; col_idx < state.list_data.ColumnCount(); col_idx++) {
+		state.null_counts[col_idx] = 0;
+	}
+	const auto target_length = MinValue<idx_t>(task.count, STANDARD_VECTOR_SIZE);
+	while (result_length < target_length) {
+		auto current_row_length =
+		    MinValue<idx_t>(target_length - result_length, state.unnest_lengths[task.row_idx] - task.list_position);
+
+		if (current_row_length > 0) {
+			// set up the selection vectors
+			for (idx_t r = 0; r < current_row_length; r++) {
+				state.input_sel.set_index(result_length + r, task.row_idx);
+			}
+			for (idx_t col_idx = 0; col_idx < state.list_data.ColumnCount(); col_idx++) {
+				auto &vector_data = state.list_vector_data[col_idx];
+				auto current_idx = vector_data.sel->get_index(task.row_idx);
+				idx_t list_length = 0;
+				idx_t list_offset = 0;
+				if (vector_data.validity.RowIsValid(current_idx)) {
+					auto list_data = UnifiedVectorFormat::GetData<list_entry_t>(vector_data);
+					auto list_entry = list_data[current_idx];
+					list_length = list_entry.length;
+					list_offset = list_entry.offset;
+				}
+				// unnest any entries we can
+				idx_t unnest_length = MinValue<idx_t>(
+				    list_length - MinValue<idx_t>(list_length, task.list_position), current_row_length);
+				auto &unnest_sel = state.unnest_sels[col_idx];
+				for (idx_t r = 0; r < unnest_length; r++) {
+					unnest_sel.set_index(result_length + r, list_offset + task.list_position + r);
+				}
+				// for any remaining entries (if any) - set them in the null selection
+				auto &null_sel = state.null_sels[col_idx];
+				for (idx_t r = unnest_length; r < current_row_length; r++) {
+					unnest_sel.set_index(result_length + r, 0);
+					null_sel.set_index(state.null_counts[col_idx]++, result_length + r);
+				}
+			}
+
+			// move to the next row
+			result_length += current_row_length;
+			task.list_position += current_row_length;
+		}
+		unnest_list_count++;
+		if (task.list_position == state.unnest_lengths[task.row_idx]) {
+			task.row_idx++;
+			task.list_position = 0;
+		}
+	}
+	task.count -= result_length;
+
+	chunk.SetCardinality(result_length);
+	for (idx_t col_idx = 0; col_idx < input_chunk.ColumnCount(); col_idx++) {
+		if (unnest_list_count == 1) {
+			// everything belongs to the same row - we can do a constant reference
+			ConstantVector::Reference(chunk.data[col_idx], input_chunk.data[col_idx], initial_row, input_chunk.size());
+		} else {
+			// input values come from different rows - we need to slice
+			chunk.data[col_idx].Slice(input_chunk.data[col_idx], state.input_sel, result_length);
+		}
+	}
+	auto col_offset = input_chunk.ColumnCount();
+	for (idx_t col_idx = 0; col_idx < state.list_data.ColumnCount(); col_idx++) {
+		auto &list_vector = state.list_data.data[col_idx];
+		auto &result_vector = chunk.data[col_offset + col_idx];
+		if (list_vector.GetType() == LogicalType::SQLNULL ||
+		    ListType::GetChildType(list_vector.GetType()) == LogicalType::SQLNULL ||
+		    ListVector::GetListSize(list_vector) == 0) {
+			// UNNEST(NULL) or UNNEST([])
+			// we cannot slice empty lists - but if our child list is empty we can only return NULL anyway
+			result_vector.SetVectorType(VectorType::CONSTANT_VECTOR);
+			ConstantVector::SetNull(result_vector, true);
+			continue;
+		}
+		auto &child_vector = ListVector::GetEntry(list_vector);
+		result_vector.Slice(child_vector, state.unnest_sels[col_idx], result_length);
+		if (state.null_counts[col_idx] > 0) {
+			// we have NULL values that we need to set - flatten
+			result_vector.Flatten(result_length);
+			auto &null_sel = state.null_sels[col_idx];
+			for (idx_t idx = 0; idx < state.null_counts[col_idx]; idx++) {
+				auto null_index = null_sel.get_index(idx);
+				FlatVector::SetNull(result_vector, null_index, true);
+			}
+		}
+	}
+	return SourceResultType::HAVE_MORE_OUTPUT;
+}
+
+} // namespace duckdb
@@ -10,7 +10,9 @@
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table/append_state.hpp"
 #include "duckdb/common/exception/transaction_exception.hpp"
+#include "duckdb/common/mutex.hpp"
 #include "duckdb/execution/index/art/art_operator.hpp"
+#include "duckdb/parallel/task_executor.hpp"
 
 namespace duckdb {
 
@@ -38,6 +40,10 @@ class CreateARTIndexGlobalSinkState : public GlobalSinkState {
 public:
 	//! We merge the local indexes into one global index.
 	unique_ptr<BoundIndex> global_index;
+	//! Lock protecting the local indexes.
+	mutex index_lock;
+	//! The local indexes of all finished sink states, merged pairwise in parallel during Finalize.
+	vector<unique_ptr<BoundIndex>> local_indexes;
 };
 
 class CreateARTIndexLocalSinkState : public LocalSinkState {
@@ -157,19 +163,71 @@ SinkCombineResultType PhysicalCreateARTIndex::Combine(ExecutionContext &context,
                                                       OperatorSinkCombineInput &input) const {
 	auto &g_state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 
-	// Merge the local index into the global index.
+	// Collect the local index: merging here would serialize the (expensive) merges on the last thread to finish.
+	// Instead, we merge all local indexes pairwise in parallel during Finalize.
 	auto &l_state = input.local_state.Cast<CreateARTIndexLocalSinkState>();
-	if (!g_state.global_index->MergeIndexes(*l_state.local_index)) {
-		throw ConstraintException("Data contains duplicates on indexed column(s)");
-	}
+	lock_guard<mutex> guard(g_state.index_lock);
+	g_state.local_indexes.push_back(std::move(l_state.local_index));
 
 	return SinkCombineResultType::FINISHED;
 }
 
+//! Merges one local index into another as part of a pairwise merge round.
+class ARTMergeTask : public BaseExecutorTask {
+public:
+	ARTMergeTask(TaskExecutor &executor, BoundIndex &target, BoundIndex &source, atomic<bool> &interrupted)
+	    : BaseExecutorTask(executor), target(target), source(source), interrupted(interrupted) {
+	}
+
+	void ExecuteTask() override {
+		if (!target.MergeIndexes(source, interrupted)) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+	}
+
+	string TaskType() const override {
+		return "ARTMergeTask";
+	}
+
+private:
+	BoundIndex &target;
+	BoundIndex &source;
+	//! The interrupt flag of the query, polled during the merge
+	atomic<bool> &interrupted;
+};
+
 SinkFinalizeType PhysicalCreateARTIndex::Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
                                                   OperatorSinkFinalizeInput &input) const {
 	auto &state = input.global_state.Cast<CreateARTIndexGlobalSinkState>();
 
+	// Merge the local indexes into the global index. Every round merges disjoint pairs of
+	// indexes in parallel, halving the number of remaining indexes.
+	auto &local_indexes = state.local_indexes;
+	TaskExecutor executor(context);
+	while (local_indexes.size() > 1) {
+		auto merge_count = local_indexes.size() / 2;
+		for (idx_t i = 0; i < merge_count; i++) {
+			executor.ScheduleTask(make_uniq<ARTMergeTask>(executor, *local_indexes[2 * i], *local_indexes[2 * i + 1],
+			                                              context.interrupted));
+		}
+		executor.WorkOnTasks();
+
+		vector<unique_ptr<BoundIndex>> next_round;
+		for (idx_t i = 0; i < merge_count; i++) {
+			next_round.push_back(std::move(local_indexes[2 * i]));
+		}
+		if (local_indexes.size() % 2 != 0) {
+			next_round.push_back(std::move(local_indexes.back()));
+		}
+		local_indexes = std::move(next_round);
+	}
+	if (!local_indexes.empty()) {
+		if (!state.global_index->MergeIndexes(*local_indexes[0], context.interrupted)) {
+			throw ConstraintException("Data contains duplicates on indexed column(s)");
+		}
+		local_indexes.clear();
+	}
+
 	// Vacuum excess memory and verify.
 	state.global_index->Vacuum();
 	D_ASSERT(!state.global_index->VerifyAndToString(true).empty());
@@ -1,5 +1,6 @@
 #include "duckdb/execution/operator/set/physical_recursive_cte.hpp"
 
+#include "duckdb/common/radix_partitioning.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/execution/aggregate_hashtable.hpp"
@@ -30,46 +31,115 @@ PhysicalRecursiveCTE::~PhysicalRecursiveCTE() {
 //===--------------------------------------------------------------------===//
 // Sink
 //===--------------------------------------------------------------------===//
+//! The number of radix bits used for partitioned duplicate elimination (16 partitions)
+static constexpr idx_t CTE_DEDUP_RADIX_BITS = 4;
+
+//! A radix partition of the duplicate elimination hash table - sinks lock individual partitions
+//! instead of serializing on a single global hash table
+struct CTEDedupPartition {
+	CTEDedupPartition(ClientContext &context, const PhysicalRecursiveCTE &op)
+	    : new_rows(context, op.GetTypes()), new_groups(STANDARD_VECTOR_SIZE) {
+		ht = make_uniq<GroupedAggregateHashTable>(context, BufferAllocator::Get(context), op.distinct_types,
+		                                          op.payload_types, vector<BoundAggregateExpression *>());
+	}
+
+	mutex lock;
+	//! Groups seen in any iteration so far
+	unique_ptr<GroupedAggregateHashTable> ht;
+	//! Rows first seen in the current iteration
+	ColumnDataCollection new_rows;
+	SelectionVector new_groups;
+};
+
 class RecursiveCTEState : public GlobalSinkState {
 public:
 	explicit RecursiveCTEState(ClientContext &context, const PhysicalRecursiveCTE &op)
-	    : intermediate_table(context, op.GetTypes()), new_groups(STANDARD_VECTOR_SIZE) {
+	    : intermediate_table(context, op.GetTypes()) {
+		if (op.using_key) {
+			vector<BoundAggregateExpression *> payload_aggregates_ptr;
+			for (idx_t i = 0; i < op.payload_aggregates.size(); i++) {
+				auto &dat = op.payload_aggregates[i];
+				payload_aggregates_ptr.push_back(dat.get());
+			}
 
-		vector<BoundAggregateExpression *> payload_aggregates_ptr;
-		for (idx_t i = 0; i < op.payload_aggregates.size(); i++) {
-			auto &dat = op.payload_aggregates[i];
-			payload_aggregates_ptr.push_back(dat.get());
+			ht = make_uniq<GroupedAggregateHashTable>(context, BufferAllocator::Get(context), op.distinct_types,
+			                                          op.payload_types, payload_aggregates_ptr);
+		} else if (!op.union_all) {
+			// UNION (with duplicate elimination): radix-partition the hash table by the group hash so that
+			// parallel sinks only contend on individual partitions
+			const auto n_threads = NumericCast<idx_t>(TaskScheduler::GetScheduler(context).NumberOfThreads());
+			const auto n_partitions = n_threads > 1 ? RadixPartitioning::NumberOfPartitions(CTE_DEDUP_RADIX_BITS) : 1;
+			for (idx_t i = 0; i < n_partitions; i++) {
+				partitions.push_back(make_uniq<CTEDedupPartition>(context, op));
+			}
 		}
+	}
 
-		ht = make_uniq<GroupedAggregateHashTable>(context, BufferAllocator::Get(context), op.distinct_types,
-		                                          op.payload_types, payload_aggregates_ptr);
+	//! Merges the per-partition results of the current iteration into the intermediate table
+	void MergeDedupPartitions() {
+		for (auto &partition : partitions) {
+			if (partition->new_rows.Count() != 0) {
+				intermediate_table.Combine(partition->new_rows);
+			}
+		}
 	}
 
+	//! The hash table of the using-key variant
 	unique_ptr<GroupedAggregateHashTable> ht;
+	//! The partitioned duplicate elimination tables (for UNION without key columns)
+	vector<unique_ptr<CTEDedupPartition>> partitions;
 
 	mutex intermediate_table_lock;
 	ColumnDataCollection intermediate_table;
 	ColumnDataScanState scan_state;
 	bool initialized = false;
 	bool finished_scan = false;
-	SelectionVector new_groups;
 	AggregateHTScanState ht_scan_state;
 };
 
+class RecursiveCTELocalState : public LocalSinkState {
+public:
+	explicit RecursiveCTELocalState(ClientContext &context, const PhysicalRecursiveCTE &op)
+	    : intermediate_chunks(context, op.GetTypes()), hashes(LogicalType::HASH) {
+		intermediate_chunks.InitializeAppend(append_state);
+		if (!op.using_key && !op.union_all) {
+			partition_sels.resize(RadixPartitioning::NumberOfPartitions(CTE_DEDUP_RADIX_BITS));
+			for (auto &sel : partition_sels) {
+				sel.Initialize(STANDARD_VECTOR_SIZE);
+			}
+			partition_chunk.Initialize(context, op.GetTypes());
+		}
+	}
+
+	//! Chunks collected by this thread - merged into the global intermediate table on Combine
+	ColumnDataCollection intermediate_chunks;
+	ColumnDataAppendState append_state;
+	//! Scratch space for partitioned duplicate elimination
+	Vector hashes;
+	vector<SelectionVector> partition_sels;
+	DataChunk partition_chunk;
+};
+
 unique_ptr<GlobalSinkState> PhysicalRecursiveCTE::GetGlobalSinkState(ClientContext &context) const {
 	return make_uniq<RecursiveCTEState>(context, *this);
 }
 
-idx_t PhysicalRecursiveCTE::ProbeHT(DataChunk &chunk, RecursiveCTEState &state) const {
+unique_ptr<LocalSinkState> PhysicalRecursiveCTE::GetLocalSinkState(ExecutionContext &context) const {
+	return make_uniq<RecursiveCTELocalState>(context.client, *this);
+}
+
+//! Probes the partition's hash table and appends the rows that have not been seen before
+static void ProbeAndAppend(DataChunk &chunk, CTEDedupPartition &partition) {
 	Vector dummy_addresses(LogicalType::POINTER);
 
+	lock_guard<mutex> guard(partition.lock);
 	// Use the HT to eliminate duplicate rows
-	idx_t new_group_count = state.ht->FindOrCreateGroups(chunk, dummy_addresses, state.new_groups);
-
-	// we only return entries we have not seen before (i.e. new groups)
-	chunk.Slice(state.new_groups, new_group_count);
-
-	return new_group_count;
+	idx_t new_group_count = partition.ht->FindOrCreateGroups(chunk, dummy_addresses, partition.new_groups);
+	if (new_group_count > 0) {
+		// we only keep entries we have not seen before (i.e. new groups)
+		chunk.Slice(partition.new_groups, new_group_count);
+		partition.new_rows.Append(chunk);
+	}
 }
 
 void PopulateChunk(DataChunk &group_chunk, DataChunk &input_chunk, const vector<idx_t> &idx_set, bool reference) {
@@ -90,35 +160,78 @@ void PopulateChunk(DataChunk &group_chunk, DataChunk &input_chunk, const vector<
 SinkResultType PhysicalRecursiveCTE::Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const {
 	auto &gstate = input.global_state.Cast<RecursiveCTEState>();
 
-	lock_guard<mutex> guard(gstate.intermediate_table_lock);
+	if (!using_key && union_all) {
+		// UNION ALL does not de-duplicate - each thread appends to its own collection so that the
+		// recursive pipeline does not serialize on the global intermediate table lock
+		auto &lstate = input.local_state.Cast<RecursiveCTELocalState>();
+		lstate.intermediate_chunks.Append(lstate.append_state, chunk);
+		return SinkResultType::NEED_MORE_INPUT;
+	}
+
 	if (!using_key) {
-		if (!union_all) {
-			idx_t match_count = ProbeHT(chunk, gstate);
-			if (match_count > 0) {
-				gstate.intermediate_table.Append(chunk);
-			}
-		} else {
-			gstate.intermediate_table.Append(chunk);
+		auto &lstate = input.local_state.Cast<RecursiveCTELocalState>();
+		if (gstate.partitions.size() == 1) {
+			ProbeAndAppend(chunk, *gstate.partitions[0]);
+			return SinkResultType::NEED_MORE_INPUT;
+		}
+		// hash all columns and assign each row to a radix partition of the hash
+		const auto count = chunk.size();
+		auto &hashes = lstate.hashes;
+		VectorOperations::Hash(chunk.data[0], hashes, count);
+		for (idx_t col_idx = 1; col_idx < chunk.ColumnCount(); col_idx++) {
+			VectorOperations::CombineHash(hashes, chunk.data[col_idx], count);
 		}
-	} else {
-		// Split incoming DataChunk into payload and keys
-		DataChunk distinct_rows;
-		distinct_rows.Initialize(Allocator::DefaultAllocator(), distinct_types);
-		PopulateChunk(distinct_rows, chunk, distinct_idx, true);
-		DataChunk payload_rows;
-		if (!payload_types.empty()) {
-			payload_rows.Initialize(Allocator::DefaultAllocator(), payload_types);
+		hashes.Flatten(count);
+		const auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		const auto shift = RadixPartitioning::Shift(CTE_DEDUP_RADIX_BITS);
+		const auto mask = RadixPartitioning::Mask(CTE_DEDUP_RADIX_BITS);
+		idx_t partition_counts[RadixPartitioning::NumberOfPartitions(CTE_DEDUP_RADIX_BITS)] = {};
+		for (idx_t i = 0; i < count; i++) {
+			const auto partition_idx = (hash_data[i] & mask) >> shift;
+			lstate.partition_sels[partition_idx].set_index(partition_counts[partition_idx]++, i);
 		}
-		PopulateChunk(payload_rows, chunk, payload_idx, true);
+		// de-duplicate each partition's rows under that partition's lock only
+		for (idx_t partition_idx = 0; partition_idx < gstate.partitions.size(); partition_idx++) {
+			if (partition_counts[partition_idx] == 0) {
+				continue;
+			}
+			lstate.partition_chunk.Reset();
+			lstate.partition_chunk.Slice(chunk, lstate.partition_sels[partition_idx],
+			                             partition_counts[partition_idx]);
+			ProbeAndAppend(lstate.partition_chunk, *gstate.partitions[partition_idx]);
+		}
+		return SinkResultType::NEED_MORE_INPUT;
+	}
 
-		// Add the chunk to the hash table and append it to the intermediate table
-		gstate.ht->AddChunk(distinct_rows, payload_rows, AggregateType::NON_DISTINCT);
-		gstate.intermediate_table.Append(chunk);
+	lock_guard<mutex> guard(gstate.intermediate_table_lock);
+	// Split incoming DataChunk into payload and keys
+	DataChunk distinct_rows;
+	distinct_rows.Initialize(Allocator::DefaultAllocator(), distinct_types);
+	PopulateChunk(distinct_rows, chunk, distinct_idx, true);
+	DataChunk payload_rows;
+	if (!payload_types.empty()) {
+		payload_rows.Initialize(Allocator::DefaultAllocator(), payload_types);
 	}
+	PopulateChunk(payload_rows, chunk, payload_idx, true);
+
+	// Add the chunk to the hash table and append it to the intermediate table
+	gstate.ht->AddChunk(distinct_rows, payload_rows, AggregateType::NON_DISTINCT);
+	gstate.intermediate_table.Append(chunk);
 
 	return SinkResultType::NEED_MORE_INPUT;
 }
 
+SinkCombineResultType PhysicalRecursiveCTE::Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const {
+	auto &lstate = input.local_state.Cast<RecursiveCTELocalState>();
+	if (lstate.intermediate_chunks.Count() != 0) {
+		auto &gstate = input.global_state.Cast<RecursiveCTEState>();
+		lock_guard<mutex> guard(gstate.intermediate_table_lock);
+		gstate.intermediate_table.Combine(lstate.intermediate_chunks);
+	}
+
+	return SinkCombineResultType::FINISHED;
+}
+
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
@@ -127,6 +240,8 @@ SourceResultType PhysicalRecursiveCTE::GetData(ExecutionContext &context, DataCh
 	auto &gstate = sink_state->Cast<RecursiveCTEState>();
 	if (!gstate.initialized) {
 		if (!using_key) {
+			// gather the rows that survived duplicate elimination in the initial iteration
+			gstate.MergeDedupPartitions();
 			gstate.intermediate_table.InitializeScan(gstate.scan_state);
 		} else {
 			gstate.ht->InitializeScan(gstate.ht_scan_state);
@@ -187,6 +302,9 @@ SourceResultType PhysicalRecursiveCTE::GetData(ExecutionContext &context, DataCh
 			// now we need to re-execute all of the pipelines that depend on the recursion
 			ExecuteRecursivePipelines(context);
 
+			// gather the rows that survived duplicate elimination in this iteration
+			gstate.MergeDedupPartitions();
+
 			// check if we obtained any results
 			// if not, we are done
 			if (gstate.intermediate_table.Count() == 0) {
@@ -80,34 +80,77 @@ static void ComputeGroupLocationTemplated(UnifiedVectorFormat &group_data, Value
 	}
 }
 
-static void ComputeGroupLocation(Vector &group, Value &min, uintptr_t *address_data, idx_t current_shift, idx_t count) {
+template <class T>
+static void ComputeGroupLocationFlat(Vector &group, Value &min, uintptr_t *address_data, idx_t current_shift,
+                                     idx_t count) {
+	// flat vector without NULL values: pack the keys without any selection or validity indirection
+	auto data = FlatVector::GetData<T>(group);
+	auto min_val = min.GetValueUnsafe<T>();
+	for (idx_t i = 0; i < count; i++) {
+		D_ASSERT(data[i] >= min_val);
+		auto adjusted_value = UnsafeNumericCast<uintptr_t>((data[i] - min_val) + 1);
+		address_data[i] += adjusted_value << current_shift;
+	}
+}
+
+template <class T>
+static void ComputeGroupLocationDispatch(Vector &group, Value &min, uintptr_t *address_data, idx_t current_shift,
+                                         idx_t count) {
+	switch (group.GetVectorType()) {
+	case VectorType::CONSTANT_VECTOR: {
+		if (ConstantVector::IsNull(group)) {
+			// a constant NULL group contributes 0 to every address
+			return;
+		}
+		// constant group: compute the packed key once and add it to every address
+		auto value = ConstantVector::GetData<T>(group)[0];
+		auto min_val = min.GetValueUnsafe<T>();
+		D_ASSERT(value >= min_val);
+		auto adjusted_value = UnsafeNumericCast<uintptr_t>((value - min_val) + 1) << current_shift;
+		for (idx_t i = 0; i < count; i++) {
+			address_data[i] += adjusted_value;
+		}
+		return;
+	}
+	case VectorType::FLAT_VECTOR:
+		if (FlatVector::Validity(group).AllValid()) {
+			ComputeGroupLocationFlat<T>(group, min, address_data, current_shift, count);
+			return;
+		}
+		break;
+	default:
+		break;
+	}
 	UnifiedVectorFormat vdata;
 	group.ToUnifiedFormat(count, vdata);
+	ComputeGroupLocationTemplated<T>(vdata, min, address_data, current_shift, count);
+}
 
+static void ComputeGroupLocation(Vector &group, Value &min, uintptr_t *address_data, idx_t current_shift, idx_t count) {
 	switch (group.GetType().InternalType()) {
 	case PhysicalType::INT8:
-		ComputeGroupLocationTemplated<int8_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationDispatch<int8_t>(group, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::INT16:
-		ComputeGroupLocationTemplated<int16_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationDispatch<int16_t>(group, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::INT32:
-		ComputeGroupLocationTemplated<int32_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationDispatch<int32_t>(group, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::INT64:
-		ComputeGroupLocationTemplated<int64_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationDispatch<int64_t>(group, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::UINT8:
-		ComputeGroupLocationTemplated<uint8_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationDispatch<uint8_t>(group, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::UINT16:
-		ComputeGroupLocationTemplated<uint16_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationDispatch<uint16_t>(group, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::UINT32:
-		ComputeGroupLocationTemplated<uint32_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationDispatch<uint32_t>(group, min, address_data, current_shift, count);
 		break;
 	case PhysicalType::UINT64:
-		ComputeGroupLocationTemplated<uint64_t>(vdata, min, address_data, current_shift, count);
+		ComputeGroupLocationDispatch<uint64_t>(group, min, address_data, current_shift, count);
 		break;
 	default:
 		throw InternalException("Unsupported group type for perfect aggregate hash table");
@@ -199,14 +242,14 @@ void PerfectAggregateHashTable::Combine(PerfectAggregateHashTable &other) {
 }
 
 template <class T>
-static void ReconstructGroupVectorTemplated(uint32_t group_values[], Value &min, idx_t mask, idx_t shift,
+static void ReconstructGroupVectorTemplated(uint64_t group_values[], Value &min, idx_t mask, idx_t shift,
                                             idx_t entry_count, Vector &result) {
 	auto data = FlatVector::GetData<T>(result);
 	auto &validity_mask = FlatVector::Validity(result);
 	auto min_data = min.GetValueUnsafe<T>();
 	for (idx_t i = 0; i < entry_count; i++) {
 		// extract the value of this group from the total group index
-		auto group_index = UnsafeNumericCast<int32_t>((group_values[i] >> shift) & mask);
+		auto group_index = UnsafeNumericCast<int64_t>((group_values[i] >> shift) & mask);
 		if (group_index == 0) {
 			// if it is 0, the value is NULL
 			validity_mask.SetInvalid(i);
@@ -218,7 +261,7 @@ static void ReconstructGroupVectorTemplated(uint32_t group_values[], Value &min,
 	}
 }
 
-static void ReconstructGroupVector(uint32_t group_values[], Value &min, idx_t required_bits, idx_t shift,
+static void ReconstructGroupVector(uint64_t group_values[], Value &min, idx_t required_bits, idx_t shift,
                                    idx_t entry_count, Vector &result) {
 	// construct the mask for this entry
 	idx_t mask = ((uint64_t)1 << required_bits) - 1;
@@ -254,7 +297,7 @@ static void ReconstructGroupVector(uint32_t group_values[], Value &min, idx_t re
 
 void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 	auto data_pointers = FlatVector::GetData<data_ptr_t>(addresses);
-	uint32_t group_values[STANDARD_VECTOR_SIZE];
+	uint64_t group_values[STANDARD_VECTOR_SIZE];
 
 	// iterate over the HT until we either have exhausted the entire HT, or
 	idx_t entry_count = 0;
@@ -262,7 +305,7 @@ void PerfectAggregateHashTable::Scan(idx_t &scan_position, DataChunk &result) {
 		if (group_is_set[scan_position]) {
 			// this group is set: add it to the set of groups to extract
 			data_pointers[entry_count] = data + tuple_size * scan_position;
-			group_values[entry_count] = NumericCast<uint32_t>(scan_position);
+			group_values[entry_count] = NumericCast<uint64_t>(scan_position);
 			entry_count++;
 			if (entry_count == STANDARD_VECTOR_SIZE) {
 				scan_position++;
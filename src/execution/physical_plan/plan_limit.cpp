@@ -1,12 +1,44 @@
 #include "duckdb/execution/operator/helper/physical_limit.hpp"
 #include "duckdb/execution/operator/helper/physical_streaming_limit.hpp"
 #include "duckdb/execution/operator/helper/physical_limit_percent.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
+#include "duckdb/function/table/table_scan.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/planner/operator/logical_limit.hpp"
 
 namespace duckdb {
 
+static void TryPushdownLimitIntoScan(PhysicalOperator &child_node, BoundLimitNode &limit_val,
+                                     BoundLimitNode &offset_val) {
+	if (child_node.type != PhysicalOperatorType::TABLE_SCAN) {
+		return;
+	}
+	if (limit_val.Type() != LimitNodeType::CONSTANT_VALUE) {
+		return;
+	}
+	idx_t limit_rows = limit_val.GetConstantValue();
+	switch (offset_val.Type()) {
+	case LimitNodeType::UNSET:
+		break;
+	case LimitNodeType::CONSTANT_VALUE:
+		// rows covered by a constant offset still need to be produced before the limit kicks in
+		limit_rows += offset_val.GetConstantValue();
+		break;
+	default:
+		// expression offsets are not known up-front
+		return;
+	}
+	auto &scan = child_node.Cast<PhysicalTableScan>();
+	if (scan.function.name != "seq_scan" || !scan.bind_data) {
+		return;
+	}
+	// install a shared row budget on the scan - parallel scan tasks check the budget per vector and stop
+	// handing out and scanning row groups once the limit has been produced
+	auto &bind_data = scan.bind_data->Cast<TableScanBindData>();
+	bind_data.limit_rows = limit_rows;
+}
+
 bool UseBatchLimit(PhysicalOperator &child_node, BoundLimitNode &limit_val, BoundLimitNode &offset_val) {
 #ifdef DUCKDB_ALTERNATIVE_VERIFY
 	return true;
@@ -59,6 +91,7 @@ PhysicalOperator &PhysicalPlanGenerator::CreatePlan(LogicalLimit &op) {
 		return limit;
 	}
 	default: {
+		TryPushdownLimitIntoScan(plan, op.limit_val, op.offset_val);
 		if (!PreserveInsertionOrder(plan)) {
 			// use parallel streaming limit if insertion order is not important
 			auto &limit = Make<PhysicalStreamingLimit>(op.types, std::move(op.limit_val), std::move(op.offset_val),
@@ -0,0 +1,123 @@
+#include "duckdb/common/enums/physical_operator_type.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/execution/operator/scan/physical_column_data_scan.hpp"
+#include "duckdb/execution/operator/scan/physical_table_scan.hpp"
+#include "duckdb/execution/operator/set/physical_cte.hpp"
+#include "duckdb/execution/physical_plan_generator.hpp"
+
+namespace duckdb {
+
+namespace {
+
+//! Compute a structural identity key for a hash join build side
+//! Returns false if the subplan contains operators we cannot (or do not want to) identify structurally
+//! We are deliberately conservative here: only operators whose ParamsToString fully captures their behavior qualify
+static bool TryGetBuildKey(const PhysicalOperator &op, string &key) {
+	switch (op.type) {
+	case PhysicalOperatorType::TABLE_SCAN:
+		if (op.Cast<PhysicalTableScan>().dynamic_filters) {
+			// dynamic filters are created per consumer - these scans are not interchangeable
+			return false;
+		}
+		break;
+	case PhysicalOperatorType::FILTER:
+	case PhysicalOperatorType::PROJECTION:
+		break;
+	default:
+		return false;
+	}
+	key += PhysicalOperatorToString(op.type);
+	for (auto &type : op.types) {
+		key += type.ToString();
+		key += ',';
+	}
+	for (auto &entry : op.ParamsToString()) {
+		key += entry.first;
+		key += '=';
+		key += entry.second;
+		key += ';';
+	}
+	for (auto &child : op.children) {
+		key += '(';
+		if (!TryGetBuildKey(child.get(), key)) {
+			return false;
+		}
+		key += ')';
+	}
+	return true;
+}
+
+static void CollectHashJoins(PhysicalOperator &op, vector<reference<PhysicalOperator>> &joins) {
+	if (op.type == PhysicalOperatorType::RECURSIVE_CTE) {
+		// pipelines below a recursive CTE are executed repeatedly - leave them alone
+		return;
+	}
+	for (auto &child : op.children) {
+		CollectHashJoins(child.get(), joins);
+	}
+	if (op.type == PhysicalOperatorType::HASH_JOIN && op.children.size() == 2) {
+		joins.push_back(op);
+	}
+}
+
+} // namespace
+
+PhysicalOperator &PhysicalPlanGenerator::ShareDuplicateJoinBuilds(PhysicalOperator &plan) {
+	vector<reference<PhysicalOperator>> joins;
+	CollectHashJoins(plan, joins);
+	if (joins.size() < 2) {
+		return plan;
+	}
+
+	// group the joins by the structural key of their build side (preserving first-occurrence order)
+	vector<pair<string, vector<reference<PhysicalOperator>>>> groups;
+	unordered_map<string, idx_t> group_index;
+	for (auto &join : joins) {
+		auto &build = join.get().children[1].get();
+		if (build.type == PhysicalOperatorType::TABLE_SCAN) {
+			// re-scanning a table is cheaper than materializing it
+			continue;
+		}
+		string key;
+		if (!TryGetBuildKey(build, key)) {
+			continue;
+		}
+		auto entry = group_index.find(key);
+		if (entry == group_index.end()) {
+			group_index.emplace(std::move(key), groups.size());
+			groups.emplace_back(string(), vector<reference<PhysicalOperator>> {join});
+		} else {
+			groups[entry->second].second.push_back(join);
+		}
+	}
+
+	reference<PhysicalOperator> root(plan);
+	idx_t shared_build_index = 0;
+	for (auto &group : groups) {
+		auto &group_joins = group.second;
+		if (group_joins.size() < 2) {
+			continue;
+		}
+		// the build sides are structurally identical - materialize the first one and scan it in every join
+		auto &build = group_joins[0].get().children[1].get();
+		auto working_table = make_shared_ptr<ColumnDataCollection>(context, build.types);
+		vector<const_reference<PhysicalOperator>> cte_scans;
+		for (auto &join : group_joins) {
+			auto &scan = Make<PhysicalColumnDataScan>(build.types, PhysicalOperatorType::CTE_SCAN,
+			                                          build.estimated_cardinality, shared_build_index);
+			scan.Cast<PhysicalColumnDataScan>().collection = working_table.get();
+			cte_scans.push_back(scan);
+			join.get().children[1] = scan;
+		}
+		auto &cte = Make<PhysicalCTE>("shared_join_build", shared_build_index, root.get().types, build, root.get(),
+		                              root.get().estimated_cardinality);
+		auto &cast_cte = cte.Cast<PhysicalCTE>();
+		cast_cte.working_table = std::move(working_table);
+		cast_cte.cte_scans = std::move(cte_scans);
+		root = cte;
+		shared_build_index++;
+	}
+	return root;
+}
+
+} // namespace duckdb
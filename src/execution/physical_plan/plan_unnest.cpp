@@ -1,3 +1,4 @@
+#include "duckdb/execution/operator/projection/physical_parallel_unnest.hpp"
 #include "duckdb/execution/operator/projection/physical_unnest.hpp"
 #include "duckdb/execution/physical_plan_generator.hpp"
 #include "duckdb/planner/operator/logical_unnest.hpp"
@@ -7,6 +8,14 @@ namespace duckdb {
 PhysicalOperator &PhysicalPlanGenerator::CreatePlan(LogicalUnnest &op) {
 	D_ASSERT(op.children.size() == 1);
 	auto &plan = CreatePlan(*op.children[0]);
+	if (!PreserveInsertionOrder(plan)) {
+		// the plan does not require the input order to be preserved:
+		// use the parallel unnest, which splits large lists into ranges that are unnested by multiple threads
+		auto &parallel_unnest =
+		    Make<PhysicalParallelUnnest>(op.types, std::move(op.expressions), op.estimated_cardinality);
+		parallel_unnest.children.push_back(plan);
+		return parallel_unnest;
+	}
 	auto &unnest = Make<PhysicalUnnest>(op.types, std::move(op.expressions), op.estimated_cardinality);
 	unnest.children.push_back(plan);
 	return unnest;
@@ -7,6 +7,7 @@
 #include "duckdb/planner/expression/bound_window_expression.hpp"
 #include "duckdb/planner/operator/logical_window.hpp"
 
+#include <algorithm>
 #include <numeric>
 
 namespace duckdb {
@@ -34,13 +35,30 @@ PhysicalOperator &PhysicalPlanGenerator::CreatePlan(LogicalWindow &op) {
 	vector<idx_t> blocking_windows;
 	vector<idx_t> streaming_windows;
 	for (idx_t expr_idx = 0; expr_idx < op.expressions.size(); expr_idx++) {
-		if (enable_optimizer && PhysicalStreamingWindow::IsStreamingFunction(context, op.expressions[expr_idx])) {
+		if (enable_optimizer &&
+		    PhysicalStreamingWindow::IsStreamingFunction(context, plan.get(), op.expressions[expr_idx])) {
 			streaming_windows.push_back(expr_idx);
 		} else {
 			blocking_windows.push_back(expr_idx);
 		}
 	}
 
+	// Blocking window operators are chained below the streaming ones and do not preserve the input ordering,
+	// so window functions that stream only because of a matching input ordering have to block as well
+	if (!blocking_windows.empty()) {
+		vector<idx_t> still_streaming;
+		for (const auto &expr_idx : streaming_windows) {
+			auto &wexpr = op.expressions[expr_idx]->Cast<BoundWindowExpression>();
+			if (wexpr.orders.empty()) {
+				still_streaming.push_back(expr_idx);
+			} else {
+				blocking_windows.push_back(expr_idx);
+			}
+		}
+		std::sort(blocking_windows.begin(), blocking_windows.end());
+		streaming_windows = std::move(still_streaming);
+	}
+
 	// Process the window functions by sharing the partition/order definitions
 	unordered_map<idx_t, idx_t> projection_map;
 	vector<vector<idx_t>> window_expressions;
@@ -56,6 +56,8 @@ unique_ptr<PhysicalPlan> PhysicalPlanGenerator::PlanInternal(LogicalOperator &op
 	}
 	op.estimated_cardinality = op.EstimateCardinality(context);
 	physical_plan->SetRoot(CreatePlan(op));
+	// Materialize structurally identical hash join build sides once and share them
+	physical_plan->SetRoot(ShareDuplicateJoinBuilds(physical_plan->Root()));
 	// IMPORTANT: Don't overwrite the physical operator's cardinality!
 	// The RL model has already set the correct cardinality during CreatePlan()
 	// physical_plan->Root().estimated_cardinality = op.estimated_cardinality;
@@ -419,6 +419,10 @@ void DecideAdaptation(RadixHTGlobalSinkState &gstate, RadixHTLocalSinkState &lst
 	if (hll_percentage > SKIP_LOOKUP_UNIQUE_PERCENTAGE_THRESHOLD) {
 		// Almost everything is unique, skip lookups, just append, defer deduplication to GetData phase
 		ht.SkipLookups();
+		// The group count scales with the input, so we'll end up at the maximum fan-out anyway:
+		// repartition to it in one go rather than in multiple block-fill-triggered steps
+		gstate.config.SetRadixBits(gstate.config.GetMaximumSinkRadixBits());
+		ht.EnableHLL(false); // Can be disabled now (costs 5-10% performance in worst case, single column distinct)
 		return;
 	}
 
@@ -432,6 +436,8 @@ void DecideAdaptation(RadixHTGlobalSinkState &gstate, RadixHTLocalSinkState &lst
 		ht.Abandon();
 		ht.Resize(lstate.local_sink_capacity);
 	}
+	// Keep the HLL alive: MaybeRepartition uses it to estimate the deduplicated data size,
+	// so we don't repartition data that mostly consists of duplicates
 }
 
 void MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, RadixHTLocalSinkState &lstate) {
@@ -485,11 +491,21 @@ void MaybeRepartition(ClientContext &context, RadixHTGlobalSinkState &gstate, Ra
 	D_ASSERT(current_radix_bits <= config.GetRadixBits());
 
 	const auto block_size = BufferManager::GetBufferManager(context).GetBlockSize();
-	const auto row_size_per_partition =
-	    ht.GetMaterializedCount() * ht.GetPartitionedData().GetLayout().GetRowWidth() / partition_count;
-	if (row_size_per_partition > LossyNumericCast<idx_t>(config.BLOCK_FILL_FACTOR * static_cast<double>(block_size))) {
+	const auto repartition_threshold = LossyNumericCast<idx_t>(config.BLOCK_FILL_FACTOR * static_cast<double>(block_size));
+	const auto row_width = ht.GetPartitionedData().GetLayout().GetRowWidth();
+	const auto row_size_per_partition = ht.GetMaterializedCount() * row_width / partition_count;
+	if (row_size_per_partition > repartition_threshold) {
 		// We crossed our block filling threshold, try to increment radix bits
-		config.SetRadixBits(current_radix_bits + config.REPARTITION_RADIX_BITS);
+		bool repartition = true;
+		if (ht.HLLEnabled()) {
+			// The materialized size can be dominated by duplicates of a small set of groups, which collapse
+			// during Finalize: estimate the deduplicated size before committing to a higher fan-out
+			const auto hll_count = MinValue(ht.GetHLLUpperBound(), ht.GetMaterializedCount());
+			repartition = hll_count * row_width / partition_count > repartition_threshold;
+		}
+		if (repartition) {
+			config.SetRadixBits(current_radix_bits + config.REPARTITION_RADIX_BITS);
+		}
 	}
 
 	const auto global_radix_bits = config.GetRadixBits();
@@ -527,8 +543,8 @@ void RadixPartitionedHashTable::Sink(ExecutionContext &context, DataChunk &chunk
 
 	// Decide whether we should adapt our strategy to the data
 	if (!lstate.adapted && lstate.ht->GetSinkCount() >= RadixHTLocalSinkState::ADAPTIVITY_THRESHOLD) {
+		// DecideAdaptation disables the HLL if it won't be needed for repartitioning decisions anymore
 		DecideAdaptation(gstate, lstate);
-		ht.EnableHLL(false); // Can be disabled now (costs 5-10% performance in worst case, single column distinct)
 		lstate.adapted = true;
 	}
 
@@ -631,6 +647,52 @@ void RadixPartitionedHashTable::Finalize(ClientContext &context, GlobalSinkState
 	gstate.finalized = true;
 }
 
+void RadixPartitionedHashTable::CombineFromFinerTable(ClientContext &context, GlobalSinkState &gstate_p,
+                                                      const RadixPartitionedHashTable &finer,
+                                                      GlobalSinkState &finer_gstate_p) const {
+	auto &gstate = gstate_p.Cast<RadixHTGlobalSinkState>();
+	auto &finer_gstate = finer_gstate_p.Cast<RadixHTGlobalSinkState>();
+	D_ASSERT(!gstate.finalized && !finer_gstate.finalized);
+	if (!finer_gstate.uncombined_data) {
+		return;
+	}
+
+	// Map every group column of this table to the finer table's column that holds the same group
+	// (both tables lay out their group columns in sorted grouping set order)
+	vector<idx_t> group_map;
+	for (auto &entry : grouping_set) {
+		idx_t finer_idx = 0;
+		for (auto &finer_entry : finer.grouping_set) {
+			if (finer_entry == entry) {
+				break;
+			}
+			finer_idx++;
+		}
+		D_ASSERT(finer_idx < finer.grouping_set.size());
+		group_map.push_back(finer_idx);
+	}
+	// An empty grouping set has the fake constant group instead of real group columns
+	Vector constant_group(Value::TINYINT(42));
+	optional_ptr<Vector> constant_group_ptr = grouping_set.empty() ? &constant_group : nullptr;
+
+	// Re-group the finer data into a fresh HT, leaving the finer data intact for its own Finalize
+	auto ht = CreateHT(context, GroupedAggregateHashTable::InitialCapacity(), gstate.config.GetRadixBits());
+	for (auto &partition : finer_gstate.uncombined_data->GetPartitions()) {
+		ht->CombineFromFinerGrouping(*partition, group_map, constant_group_ptr);
+	}
+
+	auto ht_data = ht->AcquirePartitionedData();
+	auto guard = gstate.Lock();
+	gstate.any_combined = true;
+	if (gstate.uncombined_data) {
+		gstate.uncombined_data->Combine(*ht_data);
+	} else {
+		gstate.uncombined_data = std::move(ht_data);
+	}
+	gstate.stored_allocators.emplace_back(ht->GetAggregateAllocator());
+	gstate.stored_allocators_size += gstate.stored_allocators.back()->AllocationSize();
+}
+
 //===--------------------------------------------------------------------===//
 // Source
 //===--------------------------------------------------------------------===//
@@ -210,6 +210,14 @@ struct CountFunction : public BaseCountFunction {
 		}
 		}
 	}
+
+	static void CountRemove(Vector inputs[], AggregateInputData &aggr_input_data, idx_t input_count, data_ptr_t state_p,
+	                        idx_t count) {
+		// inverse of CountUpdate: take the counted rows back out of the state
+		STATE removed = 0;
+		CountUpdate(inputs, aggr_input_data, input_count, reinterpret_cast<data_ptr_t>(&removed), count);
+		*reinterpret_cast<STATE *>(state_p) -= removed;
+	}
 };
 
 unique_ptr<BaseStatistics> CountPropagateStats(ClientContext &context, BoundAggregateExpression &expr,
@@ -233,6 +241,7 @@ AggregateFunction CountFunctionBase::GetFunction() {
 	                      FunctionNullHandling::SPECIAL_HANDLING, CountFunction::CountUpdate);
 	fun.name = "count";
 	fun.order_dependent = AggregateOrderDependent::NOT_ORDER_DEPENDENT;
+	fun.simple_remove = CountFunction::CountRemove;
 	return fun;
 }
 
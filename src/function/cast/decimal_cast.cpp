@@ -31,6 +31,88 @@ static bool FromDecimalCast(Vector &source, Vector &result, idx_t count, CastPar
 	}
 }
 
+//===--------------------------------------------------------------------===//
+// Decimal -> Float/Double batch kernels
+//===--------------------------------------------------------------------===//
+//! The largest integer that a float/double can represent exactly (2^24 / 2^53),
+//! mirroring the per-value representability check in cast_operators.cpp
+template <class DST>
+struct ExactRepresentableLimit;
+
+template <>
+struct ExactRepresentableLimit<float> {
+	static constexpr int64_t MAXIMUM = 0x001000000LL;
+};
+
+template <>
+struct ExactRepresentableLimit<double> {
+	static constexpr int64_t MAXIMUM = 0x0020000000000000LL;
+};
+
+template <class SRC, class DST>
+static void DecimalToFloatingPointBatch(Vector &source, Vector &result, idx_t count, uint8_t scale) {
+	// a single branch-free divide per value, which the compiler can vectorize
+	const auto divisor = DST(NumericHelper::DOUBLE_POWERS_OF_TEN[scale]);
+	UnaryExecutor::Execute<SRC, DST>(
+	    source, result, count, [divisor](SRC input) { return Cast::Operation<SRC, DST>(input) / divisor; });
+}
+
+template <class SRC, class DST>
+static bool TryDecimalToFloatingPointBatch(Vector &source, Vector &result, idx_t count, uint8_t width, uint8_t scale) {
+	const auto exact_limit = ExactRepresentableLimit<DST>::MAXIMUM;
+	if (scale == 0 || NumericHelper::POWERS_OF_TEN[width] <= exact_limit) {
+		// every value of this decimal width is exactly representable in the target type:
+		// the whole vector can take the batch kernel, matching the per-value fast path bit-for-bit
+		DecimalToFloatingPointBatch<SRC, DST>(source, result, count, scale);
+		return true;
+	}
+	if (source.GetVectorType() != VectorType::FLAT_VECTOR) {
+		return false;
+	}
+	// range analysis over the vector itself:
+	// if all values happen to be exactly representable the batch kernel still applies
+	auto data = FlatVector::GetData<SRC>(source);
+	SRC min_value = 0;
+	SRC max_value = 0;
+	for (idx_t i = 0; i < count; i++) {
+		min_value = MinValue(min_value, data[i]);
+		max_value = MaxValue(max_value, data[i]);
+	}
+	if (int64_t(max_value) > exact_limit || int64_t(min_value) < -exact_limit) {
+		return false;
+	}
+	DecimalToFloatingPointBatch<SRC, DST>(source, result, count, scale);
+	return true;
+}
+
+template <class DST>
+static bool DecimalToFloatingPointCast(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	auto &source_type = source.GetType();
+	const auto width = DecimalType::GetWidth(source_type);
+	const auto scale = DecimalType::GetScale(source_type);
+	switch (source_type.InternalType()) {
+	case PhysicalType::INT16:
+		if (TryDecimalToFloatingPointBatch<int16_t, DST>(source, result, count, width, scale)) {
+			return true;
+		}
+		break;
+	case PhysicalType::INT32:
+		if (TryDecimalToFloatingPointBatch<int32_t, DST>(source, result, count, width, scale)) {
+			return true;
+		}
+		break;
+	case PhysicalType::INT64:
+		if (TryDecimalToFloatingPointBatch<int64_t, DST>(source, result, count, width, scale)) {
+			return true;
+		}
+		break;
+	default:
+		break;
+	}
+	// hugeint decimals, and vectors holding values beyond the exactly-representable range, take the generic path
+	return FromDecimalCast<DST>(source, result, count, parameters);
+}
+
 template <class LIMIT_TYPE, class FACTOR_TYPE = LIMIT_TYPE>
 struct DecimalScaleInput {
 	DecimalScaleInput(Vector &result_p, FACTOR_TYPE factor_p, CastParameters &parameters)
@@ -299,9 +381,9 @@ BoundCastInfo DefaultCasts::DecimalCastSwitch(BindCastInput &input, const Logica
 		}
 	}
 	case LogicalTypeId::FLOAT:
-		return FromDecimalCast<float>;
+		return DecimalToFloatingPointCast<float>;
 	case LogicalTypeId::DOUBLE:
-		return FromDecimalCast<double>;
+		return DecimalToFloatingPointCast<double>;
 	case LogicalTypeId::VARCHAR: {
 		switch (source.InternalType()) {
 		case PhysicalType::INT16:
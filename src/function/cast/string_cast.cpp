@@ -459,11 +459,58 @@ static bool StringToNestedTypeCast(Vector &source, Vector &result, idx_t count,
 	}
 }
 
+//! Fast path for casting uniformly formatted ISO date/timestamp strings: if the first row of a
+//! flat, NULL-free vector matches the fixed layout, the whole vector is parsed with the
+//! fixed-layout kernel, falling back per value only on a layout mismatch
+template <class T, bool (*FIXED_PARSE)(const char *, idx_t, T &)>
+static bool TryFixedLayoutParse(Vector &source, Vector &result, idx_t count) {
+	if (count == 0 || source.GetVectorType() != VectorType::FLAT_VECTOR ||
+	    !FlatVector::Validity(source).AllValid()) {
+		return false;
+	}
+	auto source_data = FlatVector::GetData<string_t>(source);
+	T first;
+	if (!FIXED_PARSE(source_data[0].GetData(), source_data[0].GetSize(), first)) {
+		// the input is not in the fixed layout: use the general loop
+		return false;
+	}
+	result.SetVectorType(VectorType::FLAT_VECTOR);
+	auto result_data = FlatVector::GetData<T>(result);
+	FlatVector::Validity(result).SetAllValid(count);
+	for (idx_t i = 0; i < count; i++) {
+		if (DUCKDB_LIKELY(FIXED_PARSE(source_data[i].GetData(), source_data[i].GetSize(), result_data[i]))) {
+			continue;
+		}
+		if (!TryCast::Operation<string_t, T>(source_data[i], result_data[i])) {
+			// a value does not cast at all: redo the vector with the general loop so that the
+			// error and NULL handling of the cast parameters applies
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool VectorStringToDateCast(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	if (TryFixedLayoutParse<date_t, Date::TryParseISODate>(source, result, count)) {
+		return true;
+	}
+	return VectorCastHelpers::TryCastErrorLoop<string_t, date_t, duckdb::TryCastErrorMessage>(source, result, count,
+	                                                                                         parameters);
+}
+
+static bool VectorStringToTimestampCast(Vector &source, Vector &result, idx_t count, CastParameters &parameters) {
+	if (TryFixedLayoutParse<timestamp_t, Timestamp::TryParseISOTimestamp>(source, result, count)) {
+		return true;
+	}
+	return VectorCastHelpers::TryCastErrorLoop<string_t, timestamp_t, duckdb::TryCastErrorMessage>(source, result,
+	                                                                                              count, parameters);
+}
+
 BoundCastInfo DefaultCasts::StringCastSwitch(BindCastInput &input, const LogicalType &source,
                                              const LogicalType &target) {
 	switch (target.id()) {
 	case LogicalTypeId::DATE:
-		return BoundCastInfo(&VectorCastHelpers::TryCastErrorLoop<string_t, date_t, duckdb::TryCastErrorMessage>);
+		return BoundCastInfo(&VectorStringToDateCast);
 	case LogicalTypeId::TIME:
 		return BoundCastInfo(&VectorCastHelpers::TryCastErrorLoop<string_t, dtime_t, duckdb::TryCastErrorMessage>);
 	case LogicalTypeId::TIME_NS:
@@ -471,7 +518,7 @@ BoundCastInfo DefaultCasts::StringCastSwitch(BindCastInput &input, const Logical
 	case LogicalTypeId::TIME_TZ:
 		return BoundCastInfo(&VectorCastHelpers::TryCastErrorLoop<string_t, dtime_tz_t, duckdb::TryCastErrorMessage>);
 	case LogicalTypeId::TIMESTAMP:
-		return BoundCastInfo(&VectorCastHelpers::TryCastErrorLoop<string_t, timestamp_t, duckdb::TryCastErrorMessage>);
+		return BoundCastInfo(&VectorStringToTimestampCast);
 	case LogicalTypeId::TIMESTAMP_TZ:
 		return BoundCastInfo(
 		    &VectorCastHelpers::TryCastErrorLoop<string_t, timestamp_tz_t, duckdb::TryCastErrorMessage>);
@@ -1,15 +1,22 @@
 #include "duckdb/function/pragma/pragma_functions.hpp"
 
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
 #include "duckdb/common/enums/output_type.hpp"
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/common/operator/cast_operators.hpp"
+#include "duckdb/main/cost_calibration.hpp"
 #include "duckdb/function/function_set.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/expression_binder.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
+#include "duckdb/storage/data_table.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/common/encryption_functions.hpp"
 #include "duckdb/logging/log_manager.hpp"
@@ -95,6 +102,10 @@ static void PragmaForceCheckpoint(ClientContext &context, const FunctionParamete
 	DBConfig::GetConfig(context).options.force_checkpoint = true;
 }
 
+static void PragmaCalibrateCostModel(ClientContext &context, const FunctionParameters &parameters) {
+	CostCalibration::Calibrate(FileSystem::GetFileSystem(context));
+}
+
 static void PragmaDisableForceParallelism(ClientContext &context, const FunctionParameters &parameters) {
 	ClientConfig::GetConfig(context).verify_parallelism = false;
 }
@@ -121,6 +132,26 @@ static void PragmaDisableOptimizer(ClientContext &context, const FunctionParamet
 	ClientConfig::GetConfig(context).enable_optimizer = false;
 }
 
+static void PragmaSetTableBlocksPinned(ClientContext &context, const FunctionParameters &parameters, bool pinned) {
+	auto qname = QualifiedName::Parse(parameters.values[0].ToString());
+
+	// look up the table name in the catalog
+	Binder::BindSchemaOrCatalog(context, qname.catalog, qname.schema);
+	auto &table_entry = Catalog::GetEntry<TableCatalogEntry>(context, qname.catalog, qname.schema, qname.name);
+	if (!table_entry.IsDuckTable()) {
+		throw NotImplementedException("Pinning table blocks is only supported for DuckDB tables");
+	}
+	table_entry.GetStorage().SetBlocksMemoryPinned(pinned);
+}
+
+static void PragmaPinTableBlocks(ClientContext &context, const FunctionParameters &parameters) {
+	PragmaSetTableBlocksPinned(context, parameters, true);
+}
+
+static void PragmaUnpinTableBlocks(ClientContext &context, const FunctionParameters &parameters) {
+	PragmaSetTableBlocksPinned(context, parameters, false);
+}
+
 void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 	RegisterEnableProfiling(set);
 
@@ -154,6 +185,11 @@ void PragmaFunctions::RegisterFunction(BuiltinFunctions &set) {
 
 	set.AddFunction(PragmaFunction::PragmaStatement("force_checkpoint", PragmaForceCheckpoint));
 
+	set.AddFunction(PragmaFunction::PragmaStatement("calibrate_cost_model", PragmaCalibrateCostModel));
+
+	set.AddFunction(PragmaFunction::PragmaCall("pin_table_blocks", PragmaPinTableBlocks, {LogicalType::VARCHAR}));
+	set.AddFunction(PragmaFunction::PragmaCall("unpin_table_blocks", PragmaUnpinTableBlocks, {LogicalType::VARCHAR}));
+
 	set.AddFunction(PragmaFunction::PragmaStatement("enable_progress_bar", PragmaEnableProgressBar));
 	set.AddFunction(PragmaFunction::PragmaStatement("disable_progress_bar", PragmaDisableProgressBar));
 
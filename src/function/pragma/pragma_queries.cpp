@@ -5,8 +5,11 @@
 #include "duckdb/function/pragma/pragma_functions.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/extension_helper.hpp"
+#include "duckdb/main/materialized_view_registry.hpp"
+#include "duckdb/parser/expression/function_expression.hpp"
 #include "duckdb/parser/parser.hpp"
 #include "duckdb/parser/qualified_name.hpp"
 #include "duckdb/parser/statement/copy_statement.hpp"
@@ -212,6 +215,110 @@ static string PragmaUserAgent(ClientContext &context, const FunctionParameters &
 	return "SELECT * FROM pragma_user_agent()";
 }
 
+static string PragmaMemoryProfile(ClientContext &context, const FunctionParameters &parameters) {
+	// live bytes by data structure - per-operator attribution comes from the profiler
+	// (operator_allocated_memory / operator_peak_live_memory in custom_profiling_settings)
+	return "SELECT * FROM duckdb_memory() ORDER BY memory_usage_bytes DESC;";
+}
+
+//===--------------------------------------------------------------------===//
+// Materialized Views
+//===--------------------------------------------------------------------===//
+static string MaterializedViewMergeFunction(const string &function_name) {
+	// partial counts and sums are merged by summing them; min and max are their own merge function.
+	// other aggregates (e.g. avg) cannot be merged from their result alone
+	if (function_name == "count" || function_name == "count_star" || function_name == "sum") {
+		return "sum";
+	}
+	if (function_name == "min" || function_name == "max") {
+		return function_name;
+	}
+	throw InvalidInputException("Aggregate \"%s\" cannot be maintained incrementally - only count, sum, min and max "
+	                            "are supported in a materialized view",
+	                            function_name);
+}
+
+static string PragmaCreateMaterializedView(ClientContext &context, const FunctionParameters &parameters) {
+	auto name = parameters.values[0].ToString();
+	auto base_table = parameters.values[1].ToString();
+	auto group_columns = parameters.values[2].ToString();
+	auto aggregates = parameters.values[3].ToString();
+
+	// validate the aggregate list and derive the select list that merges the stored state with a delta
+	vector<string> merge_list;
+	for (auto &expr : Parser::ParseExpressionList(aggregates, context.GetParserOptions())) {
+		if (expr->GetExpressionClass() != ExpressionClass::FUNCTION) {
+			throw InvalidInputException("Materialized view entry \"%s\" is not an aggregate function call",
+			                            expr->ToString());
+		}
+		if (expr->GetAlias().empty()) {
+			throw InvalidInputException("Materialized view aggregate \"%s\" requires an alias (e.g. \"count(*) AS n\")",
+			                            expr->ToString());
+		}
+		auto &function = expr->Cast<FunctionExpression>();
+		auto merge_function = MaterializedViewMergeFunction(StringUtil::Lower(function.function_name));
+		auto quoted_alias = KeywordHelper::WriteOptionallyQuoted(expr->GetAlias());
+		merge_list.push_back(StringUtil::Format("%s(%s) AS %s", merge_function, quoted_alias, quoted_alias));
+	}
+	if (merge_list.empty()) {
+		throw InvalidInputException("Materialized view \"%s\" requires at least one aggregate", name);
+	}
+	// the group columns must be plain column references - the refresh query groups the stored state by them
+	if (!group_columns.empty()) {
+		for (auto &expr : Parser::ParseExpressionList(group_columns, context.GetParserOptions())) {
+			if (expr->GetExpressionClass() != ExpressionClass::COLUMN_REF) {
+				throw InvalidInputException("Materialized view group entry \"%s\" is not a column of the base table",
+				                            expr->ToString());
+			}
+		}
+	}
+
+	MaterializedViewDefinition definition;
+	definition.base_table = base_table;
+	definition.group_columns = group_columns;
+	definition.aggregates = aggregates;
+	definition.merge_aggregates = StringUtil::Join(merge_list, ", ");
+	DatabaseInstance::GetDatabase(context).GetMaterializedViewRegistry().CreateView(name, std::move(definition));
+
+	string group_prefix = group_columns.empty() ? "" : group_columns + ", ";
+	string group_by = group_columns.empty() ? "" : " GROUP BY " + group_columns;
+	// the backing table stores the aggregate state plus the highest row id it reflects
+	return StringUtil::Format("CREATE TABLE %s AS SELECT %s%s, max(rowid) AS __row_watermark FROM %s%s;",
+	                          KeywordHelper::WriteOptionallyQuoted(name), group_prefix, aggregates,
+	                          KeywordHelper::WriteOptionallyQuoted(base_table), group_by);
+}
+
+static string PragmaRefreshMaterializedView(ClientContext &context, const FunctionParameters &parameters) {
+	auto name = parameters.values[0].ToString();
+	auto view = DatabaseInstance::GetDatabase(context).GetMaterializedViewRegistry().GetView(name);
+	auto quoted_name = KeywordHelper::WriteOptionallyQuoted(name);
+	auto quoted_base = KeywordHelper::WriteOptionallyQuoted(view.base_table);
+
+	string group_prefix = view.group_columns.empty() ? "" : view.group_columns + ", ";
+	string group_by = view.group_columns.empty() ? "" : " GROUP BY " + view.group_columns;
+	// aggregate only the rows appended past the stored watermark and merge them into the stored state -
+	// the refresh reads the delta and the (small) aggregate state, never the full base table
+	string final_query = StringUtil::Format(
+	    "CREATE OR REPLACE TEMPORARY TABLE __materialized_view_refresh AS "
+	    "SELECT %s%s, max(__row_watermark) AS __row_watermark FROM ("
+	    "SELECT * FROM %s "
+	    "UNION ALL "
+	    "SELECT %s%s, max(rowid) AS __row_watermark FROM %s "
+	    "WHERE rowid > (SELECT coalesce(max(__row_watermark), -1) FROM %s)%s)%s;\n",
+	    group_prefix, view.merge_aggregates, quoted_name, group_prefix, view.aggregates, quoted_base, quoted_name,
+	    group_by, group_by);
+	final_query += StringUtil::Format("DELETE FROM %s;\n", quoted_name);
+	final_query += StringUtil::Format("INSERT INTO %s SELECT * FROM __materialized_view_refresh;\n", quoted_name);
+	final_query += "DROP TABLE __materialized_view_refresh;";
+	return final_query;
+}
+
+static string PragmaDropMaterializedView(ClientContext &context, const FunctionParameters &parameters) {
+	auto name = parameters.values[0].ToString();
+	DatabaseInstance::GetDatabase(context).GetMaterializedViewRegistry().DropView(name);
+	return StringUtil::Format("DROP TABLE IF EXISTS %s;", KeywordHelper::WriteOptionallyQuoted(name));
+}
+
 void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	set.AddFunction(PragmaFunction::PragmaCall("table_info", PragmaTableInfo, {LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaCall("storage_info", PragmaStorageInfo, {LogicalType::VARCHAR}));
@@ -232,6 +339,14 @@ void PragmaQueries::RegisterFunction(BuiltinFunctions &set) {
 	    PragmaFunction::PragmaCall("copy_database", PragmaCopyDatabase, {LogicalType::VARCHAR, LogicalType::VARCHAR}));
 	set.AddFunction(PragmaFunction::PragmaStatement("all_profiling_output", PragmaAllProfiling));
 	set.AddFunction(PragmaFunction::PragmaStatement("user_agent", PragmaUserAgent));
+	set.AddFunction(PragmaFunction::PragmaStatement("memory_profile", PragmaMemoryProfile));
+	set.AddFunction(PragmaFunction::PragmaCall(
+	    "create_materialized_view", PragmaCreateMaterializedView,
+	    {LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR, LogicalType::VARCHAR}));
+	set.AddFunction(
+	    PragmaFunction::PragmaCall("refresh_materialized_view", PragmaRefreshMaterializedView, {LogicalType::VARCHAR}));
+	set.AddFunction(
+	    PragmaFunction::PragmaCall("drop_materialized_view", PragmaDropMaterializedView, {LogicalType::VARCHAR}));
 }
 
 } // namespace duckdb
@@ -223,9 +223,39 @@ struct LikeSegment {
 };
 
 struct LikeMatcher : public FunctionData {
-	LikeMatcher(string like_pattern_p, vector<LikeSegment> segments, bool has_start_percentage, bool has_end_percentage)
+	LikeMatcher(string like_pattern_p, vector<LikeSegment> segments, bool has_start_percentage, bool has_end_percentage,
+	            bool exact_match = true, idx_t min_length = 0)
 	    : like_pattern(std::move(like_pattern_p)), segments(std::move(segments)),
-	      has_start_percentage(has_start_percentage), has_end_percentage(has_end_percentage) {
+	      has_start_percentage(has_start_percentage), has_end_percentage(has_end_percentage), exact_match(exact_match),
+	      min_length(min_length) {
+	}
+
+	//! Whether Match fully decides the pattern - if false, the segments are only required substrings and matching
+	//! candidates still need to run the generic matcher
+	bool IsExactMatch() const {
+		return exact_match;
+	}
+
+	//! Cheap rejection test for patterns that could not be fully compiled: any matching string must contain all
+	//! literal segments in order, and must be at least min_length bytes long
+	bool MatchPrefilter(string_t &str) {
+		auto str_data = const_uchar_ptr_cast(str.GetData());
+		auto str_len = str.GetSize();
+		if (str_len < min_length) {
+			return false;
+		}
+		for (auto &segment : segments) {
+			idx_t next_offset =
+			    FindStrInStr(str_data, str_len, const_uchar_ptr_cast(segment.pattern.c_str()), segment.pattern.size());
+			if (next_offset == DConstants::INVALID_INDEX) {
+				// could not find this literal in the string: the pattern cannot match
+				return false;
+			}
+			idx_t offset = next_offset + segment.pattern.size();
+			str_data += offset;
+			str_len -= offset;
+		}
+		return true;
 	}
 
 	bool Match(string_t &str) {
@@ -301,9 +331,9 @@ struct LikeMatcher : public FunctionData {
 				}
 				last_non_pattern = i + 1;
 				if (ch == escape || ch == '_') {
-					// escape or underscore: could not create efficient like matcher
-					// FIXME: we could handle escaped percentages here
-					return nullptr;
+					// escape or underscore: could not create an exact like matcher,
+					// but the literal segments can still be used to prefilter rows
+					return CreateLikePrefilter(like_pattern, escape);
 				} else {
 					// sample_size
 					if (i == 0) {
@@ -325,8 +355,52 @@ struct LikeMatcher : public FunctionData {
 		                              has_end_percentage);
 	}
 
+	static unique_ptr<LikeMatcher> CreateLikePrefilter(const string &like_pattern, char escape) {
+		// the pattern contains underscores or escapes, so the segments alone cannot decide a match
+		// instead extract the literal segments that any matching string must contain in order,
+		// so that rows missing one of them can be rejected without running the generic matcher
+		vector<LikeSegment> segments;
+		string current_segment;
+		idx_t min_length = 0;
+		for (idx_t i = 0; i < like_pattern.size(); i++) {
+			auto ch = like_pattern[i];
+			if (ch == escape) {
+				// escape character: the next character is matched literally
+				i++;
+				if (i == like_pattern.size()) {
+					// pattern ends in an escape: leave the error to the actual matcher
+					return nullptr;
+				}
+				current_segment += like_pattern[i];
+				min_length++;
+			} else if (ch == '%' || ch == '_') {
+				// wildcard: finish the current literal segment
+				if (!current_segment.empty()) {
+					segments.emplace_back(std::move(current_segment));
+					current_segment = string();
+				}
+				if (ch == '_') {
+					// underscore matches exactly one character (of at least one byte)
+					min_length++;
+				}
+			} else {
+				current_segment += ch;
+				min_length++;
+			}
+		}
+		if (!current_segment.empty()) {
+			segments.emplace_back(std::move(current_segment));
+		}
+		if (segments.empty()) {
+			// no required literals: nothing to prefilter on
+			return nullptr;
+		}
+		return make_uniq<LikeMatcher>(like_pattern, std::move(segments), true, true, false, min_length);
+	}
+
 	unique_ptr<FunctionData> Copy() const override {
-		return make_uniq<LikeMatcher>(like_pattern, segments, has_start_percentage, has_end_percentage);
+		return make_uniq<LikeMatcher>(like_pattern, segments, has_start_percentage, has_end_percentage, exact_match,
+		                              min_length);
 	}
 
 	bool Equals(const FunctionData &other_p) const override {
@@ -339,6 +413,8 @@ private:
 	vector<LikeSegment> segments;
 	bool has_start_percentage;
 	bool has_end_percentage;
+	bool exact_match;
+	idx_t min_length;
 };
 
 unique_ptr<FunctionData> LikeBindFunction(ClientContext &context, ScalarFunction &bound_function,
@@ -508,10 +584,23 @@ void RegularLikeFunction(DataChunk &input, ExpressionState &state, Vector &resul
 	auto &func_expr = state.expr.Cast<BoundFunctionExpression>();
 	if (func_expr.bind_info) {
 		auto &matcher = func_expr.bind_info->Cast<LikeMatcher>();
-		// use fast like matcher
-		UnaryExecutor::Execute<string_t, bool>(input.data[0], result, input.size(), [&](string_t input) {
-			return INVERT ? !matcher.Match(input) : matcher.Match(input);
-		});
+		if (matcher.IsExactMatch()) {
+			// use fast like matcher
+			UnaryExecutor::Execute<string_t, bool>(input.data[0], result, input.size(), [&](string_t input) {
+				return INVERT ? !matcher.Match(input) : matcher.Match(input);
+			});
+		} else {
+			// the pattern could not be fully compiled (e.g. it contains underscores):
+			// prefilter on the required literals and only run the generic matcher on candidate rows
+			BinaryExecutor::Execute<string_t, string_t, bool>(
+			    input.data[0], input.data[1], result, input.size(), [&](string_t str, string_t pattern) {
+				    if (!matcher.MatchPrefilter(str)) {
+					    // a required literal is missing: the pattern cannot match
+					    return INVERT;
+				    }
+				    return OP::template Operation<string_t, string_t, bool>(str, pattern);
+			    });
+		}
 	} else {
 		// use generic like matcher
 		BinaryExecutor::ExecuteStandard<string_t, string_t, bool, OP>(input.data[0], input.data[1], result,
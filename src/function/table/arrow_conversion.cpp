@@ -498,6 +498,30 @@ static idx_t FindRunIndex(const RUN_END_TYPE *run_ends, idx_t count, idx_t offse
 	return begin;
 }
 
+template <class RUN_END_TYPE>
+static bool TryReferenceSingleRun(Vector &result, ArrowRunEndEncodingState &run_end_encoding, idx_t compressed_size,
+                                  idx_t scan_offset, idx_t count) {
+	auto &runs = *run_end_encoding.run_ends;
+	auto &values = *run_end_encoding.values;
+
+	UnifiedVectorFormat run_end_format;
+	runs.ToUnifiedFormat(compressed_size, run_end_format);
+	auto run_ends_data = run_end_format.GetData<RUN_END_TYPE>(run_end_format);
+	auto run = FindRunIndex(run_ends_data, compressed_size, scan_offset);
+	if (run >= compressed_size) {
+		return false;
+	}
+	auto run_end_index = run_end_format.sel->get_index(run);
+	auto run_end = static_cast<idx_t>(run_ends_data[run_end_index]);
+	if (scan_offset + count > run_end) {
+		// the scanned range spans multiple runs
+		return false;
+	}
+	// the entire scanned range lies within a single run - reference the value instead of flattening it
+	ConstantVector::Reference(result, values, run, compressed_size);
+	return true;
+}
+
 template <class RUN_END_TYPE, class VALUE_TYPE>
 static void FlattenRunEnds(Vector &result, ArrowRunEndEncodingState &run_end_encoding, idx_t compressed_size,
                            idx_t scan_offset, idx_t count) {
@@ -679,13 +703,22 @@ void ArrowToDuckDBConversion::ColumnArrowToDuckDBRunEndEncoded(Vector &vector, c
 	auto physical_type = run_ends_type.GetDuckType().InternalType();
 	switch (physical_type) {
 	case PhysicalType::INT16:
+		if (TryReferenceSingleRun<int16_t>(vector, run_end_encoding, compressed_size, scan_offset, size)) {
+			return;
+		}
 		FlattenRunEndsSwitch<int16_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
 		break;
 	case PhysicalType::INT32:
+		if (TryReferenceSingleRun<int32_t>(vector, run_end_encoding, compressed_size, scan_offset, size)) {
+			return;
+		}
 		FlattenRunEndsSwitch<int32_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
 		break;
 	case PhysicalType::INT64:
-		FlattenRunEndsSwitch<int32_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
+		if (TryReferenceSingleRun<int64_t>(vector, run_end_encoding, compressed_size, scan_offset, size)) {
+			return;
+		}
+		FlattenRunEndsSwitch<int64_t>(vector, run_end_encoding, compressed_size, scan_offset, size);
 		break;
 	default:
 		throw NotImplementedException("Type '%s' not implemented for RunEndEncoding", TypeIdToString(physical_type));
@@ -0,0 +1,58 @@
+#include "duckdb/common/allocator.hpp"
+#include "duckdb/function/table/system_functions.hpp"
+
+namespace duckdb {
+
+struct DuckDBMemoryStatsData : public GlobalTableFunctionState {
+	DuckDBMemoryStatsData() : offset(0) {
+	}
+
+	vector<AllocatorStatsEntry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBMemoryStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                      vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("value");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBMemoryStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBMemoryStatsData>();
+	result->entries = Allocator::GetAllocatorStats();
+	return std::move(result);
+}
+
+void DuckDBMemoryStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBMemoryStatsData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		// return values:
+		idx_t col = 0;
+		// name, VARCHAR
+		output.SetValue(col++, count, Value(entry.name));
+		// value, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(entry.value));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBMemoryStatsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_memory_stats", {}, DuckDBMemoryStatsFunction, DuckDBMemoryStatsBind, DuckDBMemoryStatsInit));
+}
+
+} // namespace duckdb
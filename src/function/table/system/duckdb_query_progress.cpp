@@ -0,0 +1,109 @@
+#include "duckdb/function/table/system_functions.hpp"
+
+#include "duckdb/common/progress_bar/progress_bar.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/connection_manager.hpp"
+
+namespace duckdb {
+
+struct QueryProgressEntry {
+	connection_t connection_id;
+	QueryProgress progress;
+};
+
+struct DuckDBQueryProgressData : public GlobalTableFunctionState {
+	DuckDBQueryProgressData() : offset(0) {
+	}
+
+	//! Snapshot of the progress of every active connection
+	vector<QueryProgressEntry> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBQueryProgressBind(ClientContext &context, TableFunctionBindInput &input,
+                                                        vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("connection_id");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("percentage");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("rows_processed");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("total_rows_to_process");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("estimated_rows_remaining");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("completed_pipelines");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("total_pipelines");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBQueryProgressInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBQueryProgressData>();
+
+	auto &conn_manager = context.db->GetConnectionManager();
+	for (auto &conn : conn_manager.GetConnectionList()) {
+		QueryProgressEntry entry;
+		entry.connection_id = conn->GetConnectionId();
+		// GetQueryProgress returns a copy of the atomic snapshot maintained by the progress bar,
+		// so reading it from another connection is safe
+		entry.progress = conn->GetQueryProgress();
+		result->entries.push_back(std::move(entry));
+	}
+	return std::move(result);
+}
+
+void DuckDBQueryProgressFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBQueryProgressData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		auto percentage = entry.progress.GetPercentage();
+		auto rows_processed = entry.progress.GetRowsProcesseed();
+		auto total_rows = entry.progress.GetTotalRowsToProcess();
+		// return values:
+		idx_t col = 0;
+		// connection_id, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(entry.connection_id));
+		// percentage, DOUBLE (NULL when no progress information is available)
+		if (percentage < 0) {
+			output.SetValue(col++, count, Value(LogicalType::DOUBLE));
+		} else {
+			output.SetValue(col++, count, Value::DOUBLE(percentage));
+		}
+		// rows_processed, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(rows_processed));
+		// total_rows_to_process, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(total_rows));
+		// estimated_rows_remaining, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(total_rows > rows_processed ? total_rows - rows_processed : 0));
+		// completed_pipelines, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(entry.progress.GetCompletedPipelines()));
+		// total_pipelines, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(entry.progress.GetTotalPipelines()));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBQueryProgressFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_query_progress", {}, DuckDBQueryProgressFunction, DuckDBQueryProgressBind,
+	                              DuckDBQueryProgressInit));
+}
+
+} // namespace duckdb
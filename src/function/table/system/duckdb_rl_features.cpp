@@ -0,0 +1,103 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/rl_feature_recorder.hpp"
+
+namespace duckdb {
+
+struct DuckDBRLFeaturesData : public GlobalTableFunctionState {
+	DuckDBRLFeaturesData() : offset(0) {
+	}
+
+	vector<RLFeatureRow> entries;
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBRLFeaturesBind(ClientContext &context, TableFunctionBindInput &input,
+                                                     vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("timestamp_ms");
+	return_types.emplace_back(LogicalType::UBIGINT);
+
+	names.emplace_back("source");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("table_name");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("comparison_type");
+	return_types.emplace_back(LogicalType::VARCHAR);
+
+	names.emplace_back("base_cardinality");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("final_cardinality");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("num_filters");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("selectivity");
+	return_types.emplace_back(LogicalType::DOUBLE);
+
+	names.emplace_back("used_default_selectivity");
+	return_types.emplace_back(LogicalType::BOOLEAN);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBRLFeaturesInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBRLFeaturesData>();
+	result->entries = RLFeatureRecorder::Get().GetRows();
+	return std::move(result);
+}
+
+static const char *RLFeatureSourceToString(RLFeatureSource source) {
+	switch (source) {
+	case RLFeatureSource::TABLE_SCAN:
+		return "TABLE_SCAN";
+	case RLFeatureSource::FILTER_STATISTICS:
+		return "FILTER_STATISTICS";
+	default:
+		return "UNKNOWN";
+	}
+}
+
+void DuckDBRLFeaturesFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBRLFeaturesData>();
+	if (data.offset >= data.entries.size()) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining rows
+	idx_t count = 0;
+	while (data.offset < data.entries.size() && count < STANDARD_VECTOR_SIZE) {
+		auto &entry = data.entries[data.offset++];
+		idx_t col = 0;
+		// timestamp_ms, UBIGINT
+		output.SetValue(col++, count, Value::UBIGINT(entry.timestamp_ms));
+		// source, VARCHAR
+		output.SetValue(col++, count, Value(RLFeatureSourceToString(entry.source)));
+		// table_name, VARCHAR
+		output.SetValue(col++, count, entry.table_name.empty() ? Value() : Value(entry.table_name));
+		// comparison_type, VARCHAR
+		output.SetValue(col++, count, entry.comparison_type.empty() ? Value() : Value(entry.comparison_type));
+		// base_cardinality, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.base_cardinality)));
+		// final_cardinality, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.final_cardinality)));
+		// num_filters, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(entry.num_filters)));
+		// selectivity, DOUBLE
+		output.SetValue(col++, count, Value::DOUBLE(entry.selectivity));
+		// used_default_selectivity, BOOLEAN
+		output.SetValue(col++, count, Value::BOOLEAN(entry.used_default_selectivity));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBRLFeaturesFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(
+	    TableFunction("duckdb_rl_features", {}, DuckDBRLFeaturesFunction, DuckDBRLFeaturesBind, DuckDBRLFeaturesInit));
+}
+
+} // namespace duckdb
@@ -0,0 +1,80 @@
+#include "duckdb/function/table/system_functions.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+namespace duckdb {
+
+struct DuckDBSchedulerStatsData : public GlobalTableFunctionState {
+	DuckDBSchedulerStatsData() : offset(0) {
+	}
+
+	//! Snapshot of the scheduler histograms
+	idx_t queue_wait_count[SchedulerTaskTiming::BUCKET_COUNT];
+	idx_t run_time_count[SchedulerTaskTiming::BUCKET_COUNT];
+	idx_t offset;
+};
+
+static unique_ptr<FunctionData> DuckDBSchedulerStatsBind(ClientContext &context, TableFunctionBindInput &input,
+                                                         vector<LogicalType> &return_types, vector<string> &names) {
+	names.emplace_back("bucket");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("upper_bound_us");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("queue_wait_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	names.emplace_back("run_time_count");
+	return_types.emplace_back(LogicalType::BIGINT);
+
+	return nullptr;
+}
+
+unique_ptr<GlobalTableFunctionState> DuckDBSchedulerStatsInit(ClientContext &context, TableFunctionInitInput &input) {
+	auto result = make_uniq<DuckDBSchedulerStatsData>();
+
+	auto &timing = TaskScheduler::GetScheduler(context).GetTaskTiming();
+	for (idx_t i = 0; i < SchedulerTaskTiming::BUCKET_COUNT; i++) {
+		result->queue_wait_count[i] = timing.queue_wait_count[i];
+		result->run_time_count[i] = timing.run_time_count[i];
+	}
+	return std::move(result);
+}
+
+void DuckDBSchedulerStatsFunction(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
+	auto &data = data_p.global_state->Cast<DuckDBSchedulerStatsData>();
+	if (data.offset >= SchedulerTaskTiming::BUCKET_COUNT) {
+		// finished returning values
+		return;
+	}
+	// start returning values
+	// either fill up the chunk or return all the remaining columns
+	idx_t count = 0;
+	while (data.offset < SchedulerTaskTiming::BUCKET_COUNT && count < STANDARD_VECTOR_SIZE) {
+		auto bucket = data.offset++;
+		// return values:
+		idx_t col = 0;
+		// bucket, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(bucket)));
+		// upper_bound_us, BIGINT (NULL for the catch-all bucket)
+		if (bucket + 1 < SchedulerTaskTiming::BUCKET_COUNT) {
+			output.SetValue(col++, count, Value::BIGINT(int64_t(1) << bucket));
+		} else {
+			output.SetValue(col++, count, Value(LogicalType::BIGINT));
+		}
+		// queue_wait_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(data.queue_wait_count[bucket])));
+		// run_time_count, BIGINT
+		output.SetValue(col++, count, Value::BIGINT(NumericCast<int64_t>(data.run_time_count[bucket])));
+		count++;
+	}
+	output.SetCardinality(count);
+}
+
+void DuckDBSchedulerStatsFun::RegisterFunction(BuiltinFunctions &set) {
+	set.AddFunction(TableFunction("duckdb_scheduler_stats", {}, DuckDBSchedulerStatsFunction, DuckDBSchedulerStatsBind,
+	                              DuckDBSchedulerStatsInit));
+}
+
+} // namespace duckdb
@@ -52,10 +52,10 @@ static unique_ptr<FunctionData> DuckDBSettingsBind(ClientContext &context, Table
 unique_ptr<GlobalTableFunctionState> DuckDBSettingsInit(ClientContext &context, TableFunctionInitInput &input) {
 	auto result = make_uniq<DuckDBSettingsData>();
 
-	unordered_map<idx_t, vector<Value>> aliases;
+	unordered_map<string, vector<Value>> aliases;
 	for (idx_t i = 0; i < DBConfig::GetAliasCount(); i++) {
 		auto alias = DBConfig::GetAliasByIndex(i);
-		aliases[alias->option_index].emplace_back(alias->alias);
+		aliases[alias->target].emplace_back(alias->alias);
 	}
 
 	auto &config = DBConfig::GetConfig(context);
@@ -79,7 +79,7 @@ unique_ptr<GlobalTableFunctionState> DuckDBSettingsInit(ClientContext &context,
 		value.description = option->description;
 		value.input_type = option->parameter_type;
 		value.scope = EnumUtil::ToString(scope);
-		auto entry = aliases.find(i);
+		auto entry = aliases.find(value.name);
 		if (entry != aliases.end()) {
 			value.aliases = std::move(entry->second);
 		}
@@ -33,8 +33,12 @@ void BuiltinFunctions::RegisterSQLiteFunctions() {
 	DuckDBDependenciesFun::RegisterFunction(*this);
 	DuckDBExtensionsFun::RegisterFunction(*this);
 	DuckDBMemoryFun::RegisterFunction(*this);
+	DuckDBMemoryStatsFun::RegisterFunction(*this);
 	DuckDBExternalFileCacheFun::RegisterFunction(*this);
 	DuckDBOptimizersFun::RegisterFunction(*this);
+	DuckDBRLFeaturesFun::RegisterFunction(*this);
+	DuckDBQueryProgressFun::RegisterFunction(*this);
+	DuckDBSchedulerStatsFun::RegisterFunction(*this);
 	DuckDBSecretsFun::RegisterFunction(*this);
 	DuckDBWhichSecretFun::RegisterFunction(*this);
 	DuckDBSecretTypesFun::RegisterFunction(*this);
@@ -268,6 +268,11 @@ public:
 			if (context.interrupted) {
 				throw InterruptException();
 			}
+			if (!state.HasRowBudgetRemaining()) {
+				// a LIMIT pushed into this scan has been fully produced by the parallel scan tasks -
+				// terminate this task without scanning the remainder of its assigned row groups
+				return;
+			}
 			if (bind_data.is_create_index) {
 				storage.CreateIndexScan(l_state.scan_state, output,
 				                        TableScanType::TABLE_SCAN_COMMITTED_ROWS_OMIT_PERMANENTLY_DELETED);
@@ -279,6 +284,7 @@ public:
 				storage.Scan(tx, output, l_state.scan_state);
 			}
 			if (output.size() > 0) {
+				state.ConsumeRowBudget(output.size());
 				return;
 			}
 
@@ -330,6 +336,9 @@ unique_ptr<GlobalTableFunctionState> DuckTableScanInitGlobal(ClientContext &cont
                                                              DataTable &storage, const TableScanBindData &bind_data) {
 	auto g_state = make_uniq<DuckTableScanState>(context, input.bind_data.get());
 	storage.InitializeParallelScan(context, g_state->state);
+	if (bind_data.limit_rows != DConstants::INVALID_INDEX) {
+		g_state->state.row_budget = bind_data.limit_rows;
+	}
 	if (!input.CanRemoveFilterColumns()) {
 		return std::move(g_state);
 	}
@@ -642,6 +651,19 @@ static unique_ptr<BaseStatistics> TableScanStatistics(ClientContext &context, co
 	return duck_table.GetStatistics(context, column_id);
 }
 
+static bool TableScanStatisticsAreExact(ClientContext &context, const FunctionData *bind_data_p) {
+	auto &bind_data = bind_data_p->Cast<TableScanBindData>();
+	auto &duck_table = bind_data.table.Cast<DuckTableEntry>();
+	auto &local_storage = LocalStorage::Get(context, duck_table.catalog);
+
+	// Statistics are not exact for tables with outstanding transaction-local data.
+	if (local_storage.Find(duck_table.GetStorage())) {
+		return false;
+	}
+	// The min/max bounds in the statistics are exact if no row group has outstanding updates or deletes.
+	return !duck_table.GetStorage().HasChanges();
+}
+
 static void TableScanFunc(ClientContext &context, TableFunctionInput &data_p, DataChunk &output) {
 	auto &g_state = data_p.global_state->Cast<TableScanGlobalState>();
 	g_state.TableScanFunc(context, data_p, output);
@@ -745,6 +767,7 @@ TableFunction TableScanFunction::GetFunction() {
 	scan_function.init_local = TableScanInitLocal;
 	scan_function.init_global = TableScanInitGlobal;
 	scan_function.statistics = TableScanStatistics;
+	scan_function.statistics_exact = TableScanStatisticsAreExact;
 	scan_function.dependency = TableScanDependency;
 	scan_function.cardinality = TableScanCardinality;
 	scan_function.pushdown_complex_filter = nullptr;
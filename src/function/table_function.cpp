@@ -19,7 +19,8 @@ TableFunction::TableFunction(string name, vector<LogicalType> arguments, table_f
                              table_function_init_local_t init_local)
     : SimpleNamedParameterFunction(std::move(name), std::move(arguments)), bind(bind), bind_replace(nullptr),
       bind_operator(nullptr), init_global(init_global), init_local(init_local), function(function),
-      in_out_function(nullptr), in_out_function_final(nullptr), statistics(nullptr), dependency(nullptr),
+      in_out_function(nullptr), in_out_function_final(nullptr), statistics(nullptr), statistics_exact(nullptr),
+      dependency(nullptr),
       cardinality(nullptr), pushdown_complex_filter(nullptr), pushdown_expression(nullptr), to_string(nullptr),
       dynamic_to_string(nullptr), table_scan_progress(nullptr), get_partition_data(nullptr), get_bind_info(nullptr),
       type_pushdown(nullptr), get_multi_file_reader(nullptr), supports_pushdown_type(nullptr),
@@ -566,22 +566,30 @@ void WindowBoundariesState::PartitionBegin(DataChunk &bounds, idx_t row_idx, con
 		return;
 	}
 
-	for (idx_t chunk_idx = 0; chunk_idx < count; ++chunk_idx, ++row_idx) {
-		// determine partition and peer group boundaries to ultimately figure out window size
-		const auto is_same_partition = !partition_mask.RowIsValidUnsafe(row_idx);
+	//	A set partition mask bit marks the first row of a partition, so instead of testing every row we fill
+	//	entire runs of rows that share a partition with the same value. With many tiny partitions this avoids
+	//	the per-row branching; with large partitions it degenerates into a simple fill.
+	const auto begin = row_idx;
+	const auto end = begin + count;
+	if (is_jump) {
+		idx_t n = 1;
+		partition_start = FindPrevStart(partition_mask, 0, row_idx + 1, n);
+	} else if (partition_mask.RowIsValidUnsafe(row_idx)) {
+		partition_start = row_idx;
+	}
 
-		// when the partition changes, recompute the boundaries
-		if (!is_same_partition || is_jump) {
-			if (is_jump) {
-				idx_t n = 1;
-				partition_start = FindPrevStart(partition_mask, 0, row_idx + 1, n);
-				is_jump = false;
-			} else {
-				partition_start = row_idx;
-			}
+	while (row_idx < end) {
+		//	find the next partition break after this row
+		idx_t n = 1;
+		const auto run_end = FindNextStart(partition_mask, row_idx + 1, end, n);
+		for (auto chunk_idx = row_idx - begin; chunk_idx < run_end - begin; ++chunk_idx) {
+			partition_begin_data[chunk_idx] = partition_start;
 		}
-
-		partition_begin_data[chunk_idx] = partition_start;
+		if (run_end < end) {
+			//	a new partition starts at the break
+			partition_start = run_end;
+		}
+		row_idx = run_end;
 	}
 }
 
@@ -597,24 +605,36 @@ void WindowBoundariesState::PartitionEnd(DataChunk &bounds, idx_t row_idx, const
 		return;
 	}
 
+	//	Fill entire runs of rows that share a partition with the same value (see PartitionBegin)
 	auto partition_begin_data = FlatVector::GetData<const idx_t>(bounds.data[PARTITION_BEGIN]);
-	for (idx_t chunk_idx = 0; chunk_idx < count; ++chunk_idx, ++row_idx) {
-		// determine partition and peer group boundaries to ultimately figure out window size
-		const auto is_same_partition = !partition_mask.RowIsValidUnsafe(row_idx);
+	const auto begin = row_idx;
+	const auto end = begin + count;
+	if (is_jump || partition_mask.RowIsValidUnsafe(row_idx)) {
+		// find end of partition
+		partition_end = input_size;
+		if (partition_count) {
+			const auto partition_begin = partition_begin_data[0];
+			idx_t n = 1;
+			partition_end = FindNextStart(partition_mask, partition_begin + 1, input_size, n);
+		}
+	}
 
-		// when the partition changes, recompute the boundaries
-		if (!is_same_partition || is_jump) {
-			// find end of partition
+	while (row_idx < end) {
+		//	find the next partition break after this row
+		idx_t n = 1;
+		const auto run_end = FindNextStart(partition_mask, row_idx + 1, end, n);
+		for (auto chunk_idx = row_idx - begin; chunk_idx < run_end - begin; ++chunk_idx) {
+			partition_end_data[chunk_idx] = partition_end;
+		}
+		if (run_end < end) {
+			// find end of the partition starting at the break
 			partition_end = input_size;
 			if (partition_count) {
-				const auto partition_begin = partition_begin_data[chunk_idx];
-				idx_t n = 1;
-				partition_end = FindNextStart(partition_mask, partition_begin + 1, input_size, n);
+				idx_t next = 1;
+				partition_end = FindNextStart(partition_mask, run_end + 1, input_size, next);
 			}
-			is_jump = false;
 		}
-
-		partition_end_data[chunk_idx] = partition_end;
+		row_idx = run_end;
 	}
 }
 
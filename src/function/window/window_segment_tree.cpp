@@ -40,6 +40,8 @@ public:
 
 	//! The owning aggregator
 	const WindowSegmentTree &tree;
+	//! Whether the tree is built at all (invertible aggregates slide a state along the frames instead)
+	const bool build_tree;
 	//! The actual window segment tree: an array of aggregate states that represent all the intermediate nodes
 	WindowAggregateStates levels_flat_native;
 	//! For each level, the starting location in the levels_flat_native array
@@ -86,6 +88,13 @@ public:
 	void Evaluate(const WindowSegmentTreeGlobalState &tree, const idx_t *begins, const idx_t *ends, const idx_t *bounds,
 	              Vector &result, idx_t count, idx_t row_idx, FramePart frame_part);
 
+	//! Whether we can slide a single state along the frames instead of querying the tree
+	bool CanEvaluateIncrementally() const {
+		return aggr.function.CanInvert() && !aggr.function.destructor && cursor->chunk.ColumnCount() > 0;
+	}
+	//! Evaluate invertible aggregates by removing/adding the rows that left/entered each frame
+	void EvaluateIncrementally(const idx_t *begins, const idx_t *ends, idx_t count, idx_t row_idx);
+
 protected:
 	//! Initialises the accumulation state vector (statef)
 	void Initialize(idx_t count);
@@ -94,6 +103,8 @@ protected:
 	                         const idx_t *bounds, idx_t count, idx_t row_idx, FramePart frame_part);
 	void EvaluateLeaves(const WindowSegmentTreeGlobalState &tree, const idx_t *begins, const idx_t *ends,
 	                    const idx_t *bounds, idx_t count, idx_t row_idx, FramePart frame_part, FramePart leaf_part);
+	//! Add or remove a range of input rows to the incremental state, returning the number of non-NULL rows
+	idx_t AccumulateRows(WindowCursor &cur, idx_t begin, idx_t end, bool add);
 
 	static inline const idx_t *FrameBegins(const idx_t *begins, const idx_t *ends, const idx_t *bounds,
 	                                       FramePart frame_part) {
@@ -133,6 +144,17 @@ public:
 	idx_t flush_count;
 	//! Cache of right side tree ranges for ordered aggregates
 	vector<RightEntry> right_stack;
+	//! Single aggregate state slid along the frames of invertible aggregates
+	vector<data_t> incremental_state;
+	//! The frame currently accumulated into the incremental state
+	idx_t incremental_begin = 0;
+	idx_t incremental_end = 0;
+	//! The number of unfiltered, non-NULL rows in the incremental state
+	idx_t incremental_rows = 0;
+	//! The next row the incremental state can be continued from
+	idx_t incremental_row = DConstants::INVALID_INDEX;
+	//! Separate cursor for the rows sliding out of the frame, so add and remove don't fight over pins
+	unique_ptr<WindowCursor> remove_cursor;
 };
 
 class WindowSegmentTreeLocalState : public WindowAggregatorLocalState {
@@ -297,7 +319,10 @@ void WindowSegmentTreePart::Finalize(Vector &result, idx_t count) {
 
 WindowSegmentTreeGlobalState::WindowSegmentTreeGlobalState(ClientContext &context, const WindowSegmentTree &aggregator,
                                                            idx_t group_count)
-    : WindowAggregatorGlobalState(context, aggregator, group_count), tree(aggregator), levels_flat_native(aggr) {
+    : WindowAggregatorGlobalState(context, aggregator, group_count), tree(aggregator),
+      build_tree(!aggr.function.CanInvert() || aggr.function.destructor ||
+                 aggregator.exclude_mode != WindowExcludeMode::NO_OTHER),
+      levels_flat_native(aggr) {
 
 	D_ASSERT(!aggregator.wexpr.children.empty());
 
@@ -305,18 +330,20 @@ WindowSegmentTreeGlobalState::WindowSegmentTreeGlobalState(ClientContext &contex
 	levels_flat_start.push_back(0);
 
 	idx_t levels_flat_offset = 0;
-	idx_t level_current = 0;
-	// level 0 is data itself
-	idx_t level_size;
-	// iterate over the levels of the segment tree
-	while ((level_size =
-	            (level_current == 0 ? group_count : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
-		for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
-			levels_flat_offset++;
-		}
+	if (build_tree) {
+		idx_t level_current = 0;
+		// level 0 is data itself
+		idx_t level_size;
+		// iterate over the levels of the segment tree
+		while ((level_size = (level_current == 0 ? group_count
+		                                         : levels_flat_offset - levels_flat_start[level_current - 1])) > 1) {
+			for (idx_t pos = 0; pos < level_size; pos += TREE_FANOUT) {
+				levels_flat_offset++;
+			}
 
-		levels_flat_start.push_back(levels_flat_offset);
-		level_current++;
+			levels_flat_start.push_back(levels_flat_offset);
+			level_current++;
+		}
 	}
 
 	// Corner case: single element in the window
@@ -346,6 +373,10 @@ void WindowSegmentTreeLocalState::Finalize(ExecutionContext &context, WindowAggr
 
 	//	Single part for constructing the tree
 	auto &gstate = gastate.Cast<WindowSegmentTreeGlobalState>();
+	if (!gstate.build_tree) {
+		//	Invertible aggregates never query the tree, so don't build it
+		return;
+	}
 	auto cursor = make_uniq<WindowCursor>(*collection, gastate.aggregator.child_idx);
 	const auto leaf_count = collection->size();
 	auto &filter_mask = gstate.filter_mask;
@@ -434,6 +465,9 @@ void WindowSegmentTreeLocalState::Evaluate(ExecutionContext &context, const Wind
 
 		// 4. combine the buffer state into the Segment Tree State
 		part->Combine(*right_part, count);
+	} else if (part->CanEvaluateIncrementally()) {
+		//	Invertible aggregate: slide a single state along the (monotone) frame bounds
+		part->EvaluateIncrementally(window_begin, window_end, count, row_idx);
 	} else {
 		part->Evaluate(gtstate, window_begin, window_end, nullptr, result, count, row_idx, WindowSegmentTreePart::FULL);
 	}
@@ -460,6 +494,98 @@ void WindowSegmentTreePart::Evaluate(const WindowSegmentTreeGlobalState &tree, c
 	}
 }
 
+void WindowSegmentTreePart::EvaluateIncrementally(const idx_t *begins, const idx_t *ends, idx_t count, idx_t row_idx) {
+	Initialize(count);
+
+	if (incremental_state.empty()) {
+		incremental_state.resize(state_size);
+	}
+	if (!remove_cursor) {
+		remove_cursor = cursor->Copy();
+	}
+
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	const auto state_ptr = incremental_state.data();
+	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
+	auto ldata = FlatVector::GetData<data_ptr_t>(statel);
+	auto pdata = FlatVector::GetData<data_ptr_t>(statep);
+
+	//	If this is not the row right after the previous task, we cannot continue from the old state
+	bool valid = (incremental_row == row_idx);
+	for (idx_t rid = 0, cur_row = row_idx; rid < count; ++rid, ++cur_row) {
+		const auto begin = begins[rid];
+		const auto end = ends[rid];
+		//	Frame bounds are monotone within a partition, so anything else is a jump and we start over.
+		//	A frame completely right of the previous one is also cheaper to recompute than to slide.
+		if (!valid || begin < incremental_begin || end < incremental_end || begin > incremental_end) {
+			aggr.function.initialize(aggr.function, state_ptr);
+			incremental_begin = begin;
+			incremental_end = begin;
+			incremental_rows = 0;
+			valid = true;
+		}
+		//	Remove the rows that dropped out of the frame and add the rows that entered it
+		incremental_rows -= AccumulateRows(*remove_cursor, incremental_begin, begin, false);
+		incremental_rows += AccumulateRows(*cursor, MaxValue(incremental_end, begin), end, true);
+		incremental_begin = begin;
+		incremental_end = end;
+
+		//	Empty frames keep their freshly initialised result state so they finalise correctly
+		if (incremental_rows) {
+			ldata[0] = state_ptr;
+			pdata[0] = fdata[rid];
+			aggr.function.combine(statel, statep, aggr_input_data, 1);
+		}
+	}
+	incremental_row = row_idx + count;
+}
+
+idx_t WindowSegmentTreePart::AccumulateRows(WindowCursor &cur, idx_t begin, idx_t end, bool add) {
+	idx_t result = 0;
+	AggregateInputData aggr_input_data(aggr.GetFunctionData(), allocator);
+	const auto state_ptr = incremental_state.data();
+	while (begin < end) {
+		if (!cur.RowIsVisible(begin)) {
+			cur.Seek(begin);
+		}
+		const auto next = MinValue(end, cur.state.next_row_index);
+		//	Select the rows that pass the filter (see ExtractFrame)
+		idx_t n = 0;
+		if (filter_mask.AllValid()) {
+			const auto offset = cur.RowOffset(begin);
+			for (idx_t i = 0; i < next - begin; ++i) {
+				filter_sel.set_index(n++, offset + i);
+			}
+		} else {
+			for (idx_t i = begin; i < next; ++i) {
+				if (filter_mask.RowIsValid(i)) {
+					filter_sel.set_index(n++, cur.RowOffset(i));
+				}
+			}
+		}
+		if (n) {
+			leaves.Slice(cur.chunk, filter_sel, n);
+			//	Track the non-NULL rows so we know when the frame is really empty
+			UnifiedVectorFormat vdata;
+			leaves.data[0].ToUnifiedFormat(n, vdata);
+			if (vdata.validity.AllValid()) {
+				result += n;
+			} else {
+				for (idx_t i = 0; i < n; ++i) {
+					result += vdata.validity.RowIsValid(vdata.sel->get_index(i));
+				}
+			}
+			if (add) {
+				aggr.function.simple_update(&leaves.data[0], aggr_input_data, leaves.ColumnCount(), state_ptr, n);
+			} else {
+				aggr.function.simple_remove(&leaves.data[0], aggr_input_data, leaves.ColumnCount(), state_ptr, n);
+			}
+		}
+		begin = next;
+	}
+	return result;
+}
+
 void WindowSegmentTreePart::Initialize(idx_t count) {
 	auto fdata = FlatVector::GetData<data_ptr_t>(statef);
 	for (idx_t rid = 0; rid < count; ++rid) {
@@ -5085,6 +5085,35 @@ It is not known beforehand how many chunks will be returned by this result.
 */
 DUCKDB_C_API duckdb_data_chunk duckdb_fetch_chunk(duckdb_result result);
 
+/*!
+Fetches up to `max_rows` rows from a duckdb_result into caller-provided contiguous column buffers in a single call,
+reading across chunk boundaries as needed. This amortizes an expensive FFI boundary over many rows instead of paying
+for it per chunk or per cell.
+
+Only results in which every column has a fixed-width physical representation (booleans, integral and floating point
+types, dates, times, timestamps, intervals, decimals, enums and UUIDs) can be fetched this way. If any column has a
+variable-size type (such as VARCHAR, BLOB or a nested type) the function returns 0 without consuming any rows - such
+results should be read with `duckdb_fetch_chunk` instead.
+
+`column_buffers` must hold one non-NULL pointer per result column. Values are written starting at row 0 of each
+buffer, with the same layout and width as the data returned by `duckdb_vector_get_data`, so each buffer must have
+space for at least `max_rows` values of the column's physical width.
+
+`validity_masks` may be NULL if validity is not needed. Otherwise it must hold one pointer per result column; for
+each non-NULL entry the validity of every fetched row is written to the bit at the row's index, in the same format
+as `duckdb_vector_get_validity`, so each mask must have space for at least (`max_rows` + 63) / 64 entries.
+
+This function cannot be mixed with the deprecated result functions.
+
+* @param result The result object to fetch rows from.
+* @param column_buffers The caller-provided buffers to write column data to, one per result column.
+* @param validity_masks The caller-provided validity masks to write to, one per result column, or NULL.
+* @param max_rows The maximum number of rows to fetch.
+* @return The number of rows written to the buffers. Returns 0 if the result is exhausted or an error occurred.
+*/
+DUCKDB_C_API idx_t duckdb_fetch_columns(duckdb_result result, void **column_buffers, uint64_t **validity_masks,
+                                        idx_t max_rows);
+
 //===--------------------------------------------------------------------===//
 // Cast Functions
 //===--------------------------------------------------------------------===//
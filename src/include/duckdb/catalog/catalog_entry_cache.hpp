@@ -0,0 +1,62 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/catalog/catalog_entry_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/optional_ptr.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class Catalog;
+class CatalogEntry;
+class ClientContext;
+class EntryLookupInfo;
+class SchemaCatalogEntry;
+
+//! The CatalogEntryCache is a per-connection cache of successful catalog entry lookups.
+//! Cached entries are keyed by the version of the catalog they were resolved under:
+//! once a DDL statement bumps the catalog version, the entries cached for that catalog are discarded.
+//! Catalogs that do not expose a version (Catalog::GetCatalogVersion) are never cached.
+class CatalogEntryCache {
+public:
+	//! A successfully resolved entry, together with the schema it was found in
+	struct CachedEntry {
+		optional_ptr<SchemaCatalogEntry> schema;
+		optional_ptr<CatalogEntry> entry;
+	};
+
+	//! Maximum number of entries cached per catalog
+	static constexpr idx_t MAXIMUM_ENTRIES = 1ULL << 12ULL;
+
+public:
+	//! Try to find a previously resolved entry, discarding stale entries if the catalog version has changed
+	bool TryGetEntry(Catalog &catalog, ClientContext &context, const string &schema,
+	                 const EntryLookupInfo &lookup_info, CachedEntry &result);
+	//! Cache a successfully resolved entry under the current catalog version
+	void InsertEntry(Catalog &catalog, ClientContext &context, const string &schema,
+	                 const EntryLookupInfo &lookup_info, SchemaCatalogEntry &schema_entry, CatalogEntry &entry);
+
+private:
+	//! The entries cached for a single catalog
+	struct CatalogCache {
+		//! The catalog version under which the entries were resolved
+		idx_t catalog_version = 0;
+		//! The resolved entries (keyed by schema/type/name)
+		unordered_map<string, CachedEntry> entries;
+	};
+
+private:
+	static string EntryKey(const string &schema, const EntryLookupInfo &lookup_info);
+
+private:
+	//! The cached lookups (keyed by catalog oid)
+	unordered_map<idx_t, CatalogCache> catalogs;
+};
+
+} // namespace duckdb
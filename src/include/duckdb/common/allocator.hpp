@@ -13,6 +13,8 @@
 #include "duckdb/common/optional_ptr.hpp"
 #include "duckdb/common/shared_ptr.hpp"
 #include "duckdb/common/optional_idx.hpp"
+#include "duckdb/common/string.hpp"
+#include "duckdb/common/vector.hpp"
 
 namespace duckdb {
 class Allocator;
@@ -45,6 +47,31 @@ struct PrivateAllocatorData {
 	}
 };
 
+//! Per-thread allocation counters, installed by the profiler at operator boundaries.
+//! While installed, every allocation and free issued by the owning thread through an
+//! Allocator is accounted against these counters.
+struct ThreadAllocationCounters {
+	//! Total bytes allocated while the counters were installed
+	uint64_t allocated_bytes = 0;
+	//! Net live bytes (allocated minus freed); can go negative when a thread frees
+	//! memory that was allocated before the counters were installed
+	int64_t live_bytes = 0;
+	//! The maximum value live_bytes reached while the counters were installed
+	int64_t peak_live_bytes = 0;
+
+	void Reset() {
+		allocated_bytes = 0;
+		live_bytes = 0;
+		peak_live_bytes = 0;
+	}
+};
+
+//! A single named statistic reported by the underlying allocator
+struct AllocatorStatsEntry {
+	string name;
+	idx_t value;
+};
+
 typedef data_ptr_t (*allocate_function_ptr_t)(PrivateAllocatorData *private_data, idx_t size);
 typedef void (*free_function_ptr_t)(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t size);
 typedef data_ptr_t (*reallocate_function_ptr_t)(PrivateAllocatorData *private_data, data_ptr_t pointer, idx_t old_size,
@@ -122,12 +149,23 @@ public:
 	DUCKDB_API static Allocator &DefaultAllocator();
 	DUCKDB_API static shared_ptr<Allocator> &DefaultAllocatorReference();
 
+	//! Install (or, when passing nullptr, remove) allocation counters for the calling thread
+	DUCKDB_API static void SetThreadAllocationCounters(ThreadAllocationCounters *counters);
+
 	static bool SupportsFlush();
+	//! The number of bytes the default allocator currently has mapped with a huge page advice
+	//! (always 0 on platforms without huge-page-backed allocations)
+	static idx_t HugePageBytes();
 	static optional_idx DecayDelay();
 	static void ThreadFlush(bool allocator_background_threads, idx_t threshold, idx_t thread_count);
 	static void ThreadIdle();
 	static void FlushAll();
 	static void SetBackgroundThreads(bool enable);
+	//! Sets the decay delay (in milliseconds) after which unused dirty/muzzy pages are returned to the OS.
+	//! A negative value restores the allocator's build default. No-op without jemalloc.
+	static void SetDecay(int64_t dirty_decay_ms, int64_t muzzy_decay_ms);
+	//! Returns named statistics of the underlying allocator for monitoring (empty when unsupported)
+	static vector<AllocatorStatsEntry> GetAllocatorStats();
 
 private:
 	allocate_function_ptr_t allocate_function;
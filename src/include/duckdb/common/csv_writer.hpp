@@ -32,8 +32,8 @@ struct CSVWriterOptions {
 	string newline = "\n";
 	//! The size of the CSV file (in bytes) that we buffer before we flush it to disk
 	idx_t flush_size = 4096ULL * 8ULL;
-	//! For each byte whether the CSV file requires quotes when containing the byte
-	vector<bool> requires_quotes;
+	//! The distinct bytes that require a value to be quoted when it contains them
+	string quote_characters;
 	//! How to write newlines
 	CSVNewLineMode newline_writing_mode = CSVNewLineMode::WRITE_BEFORE;
 };
@@ -136,9 +136,9 @@ protected:
 
 	static void WriteQuoteOrEscape(WriteStream &writer, char quote_or_escape);
 	static string AddEscapes(char to_be_escaped, char escape, const string &val);
-	static bool RequiresQuotes(const char *str, idx_t len, const string &null_str, const vector<bool> &requires_quotes);
+	static bool RequiresQuotes(const char *str, idx_t len, const string &null_str, const string &quote_characters);
 	static void WriteQuotedString(WriteStream &writer, const char *str, idx_t len, bool force_quote,
-	                              const string &null_str, const vector<bool> &requires_quotes, char quote, char escape);
+	                              const string &null_str, const string &quote_characters, char quote, char escape);
 	static void WriteQuotedString(WriteStream &writer, const char *str, idx_t len, idx_t col_idx,
 	                              CSVReaderOptions &options, CSVWriterOptions &writer_options);
 
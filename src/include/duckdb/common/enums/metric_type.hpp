@@ -29,11 +29,17 @@ enum class MetricsType : uint8_t {
     CUMULATIVE_ROWS_SCANNED,
     EXTRA_INFO,
     LATENCY,
+    OPERATOR_ALLOCATED_MEMORY,
+    OPERATOR_BRANCH_MISSES,
     OPERATOR_CARDINALITY,
+    OPERATOR_CYCLES,
+    OPERATOR_LLC_MISSES,
     OPERATOR_NAME,
+    OPERATOR_PEAK_LIVE_MEMORY,
     OPERATOR_ROWS_SCANNED,
     OPERATOR_TIMING,
     OPERATOR_TYPE,
+    OPERATOR_WAIT_TIME,
     QUERY_NAME,
     RESULT_SET_SIZE,
     ROWS_RETURNED,
@@ -41,6 +47,7 @@ enum class MetricsType : uint8_t {
     SYSTEM_PEAK_TEMP_DIR_SIZE,
     TOTAL_BYTES_READ,
     TOTAL_BYTES_WRITTEN,
+    TOTAL_SPILLED_BYTES,
     WAITING_TO_ATTACH_LATENCY,
     ALL_OPTIMIZERS,
     CUMULATIVE_OPTIMIZER_TIMING,
@@ -80,6 +87,7 @@ enum class MetricsType : uint8_t {
     OPTIMIZER_LATE_MATERIALIZATION,
     OPTIMIZER_CTE_INLINING,
     OPTIMIZER_COMMON_SUBPLAN,
+    OPTIMIZER_JOIN_PRE_AGGREGATION,
 };
 
 struct MetricsTypeHashFunction {
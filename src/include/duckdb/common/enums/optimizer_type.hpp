@@ -45,6 +45,7 @@ enum class OptimizerType : uint32_t {
 	LATE_MATERIALIZATION,
 	CTE_INLINING,
 	COMMON_SUBPLAN,
+	JOIN_PRE_AGGREGATION,
 };
 
 string OptimizerTypeToString(OptimizerType type);
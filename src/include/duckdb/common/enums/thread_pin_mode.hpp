@@ -12,6 +12,8 @@
 
 namespace duckdb {
 
-enum class ThreadPinMode : uint8_t { OFF = 0, ON = 1, AUTO = 2 };
+// NUMA spreads pinned worker threads round-robin across NUMA nodes (each worker is bound
+// to all CPUs of one node) so buffer memory is first-touched on the node that scans it
+enum class ThreadPinMode : uint8_t { OFF = 0, ON = 1, AUTO = 2, NUMA = 3 };
 
 } // namespace duckdb
@@ -1,8 +1,9 @@
 #pragma once
 
 #include "duckdb/common/extra_type_info.hpp"
+#include "duckdb/common/operator/comparison_operators.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
-#include "duckdb/common/string_map_set.hpp"
+#include "duckdb/common/types/hash.hpp"
 
 namespace duckdb {
 
@@ -15,17 +16,24 @@ struct EnumTypeInfoTemplated : public EnumTypeInfo {
 		UnifiedVectorFormat vdata;
 		values_insert_order.ToUnifiedFormat(size_p, vdata);
 
+		// build a flat open-addressed index over the dictionary, sized to a power of two
+		// that keeps the table at most half full, so lookups take a handful of probes at worst
+		idx_t capacity = 2;
+		while (capacity < size_p * 2) {
+			capacity *= 2;
+		}
+		index.resize(capacity);
+
 		auto data = UnifiedVectorFormat::GetData<string_t>(vdata);
 		for (idx_t i = 0; i < size_p; i++) {
 			auto idx = vdata.sel->get_index(i);
 			if (!vdata.validity.RowIsValid(idx)) {
 				throw InternalException("Attempted to create ENUM type with NULL value");
 			}
-			if (values.count(data[idx]) > 0) {
+			if (!TryInsert(data[idx], UnsafeNumericCast<T>(i))) {
 				throw InvalidInputException("Attempted to create ENUM type with duplicate value %s",
 				                            data[idx].GetString());
 			}
-			values[data[idx]] = UnsafeNumericCast<T>(i);
 		}
 	}
 
@@ -39,15 +47,51 @@ struct EnumTypeInfoTemplated : public EnumTypeInfo {
 		return make_shared_ptr<EnumTypeInfoTemplated>(values_insert_order, size);
 	}
 
-	const string_map_t<T> &GetValues() const {
-		return values;
+	//! Returns the position of the key in the dictionary, or -1 if the key is not part of the enum
+	int64_t GetPos(const string_t &key) const {
+		const auto mask = index.size() - 1;
+		auto slot = Hash(key) & mask;
+		while (true) {
+			auto &entry = index[slot];
+			if (!entry.pos_plus_one) {
+				return -1;
+			}
+			if (Equals::Operation(entry.value, key)) {
+				return UnsafeNumericCast<int64_t>(entry.pos_plus_one) - 1;
+			}
+			slot = (slot + 1) & mask;
+		}
 	}
 
 	EnumTypeInfoTemplated(const EnumTypeInfoTemplated &) = delete;
 	EnumTypeInfoTemplated &operator=(const EnumTypeInfoTemplated &) = delete;
 
 private:
-	string_map_t<T> values;
+	struct EnumIndexEntry {
+		//! The dictionary string (references the data owned by values_insert_order)
+		string_t value;
+		//! Position in the dictionary plus one - zero marks an empty slot
+		uint32_t pos_plus_one = 0;
+	};
+
+	bool TryInsert(const string_t &value, T pos) {
+		const auto mask = index.size() - 1;
+		auto slot = Hash(value) & mask;
+		while (index[slot].pos_plus_one) {
+			if (Equals::Operation(index[slot].value, value)) {
+				// duplicate value
+				return false;
+			}
+			slot = (slot + 1) & mask;
+		}
+		index[slot].value = value;
+		index[slot].pos_plus_one = UnsafeNumericCast<uint32_t>(pos) + 1;
+		return true;
+	}
+
+private:
+	//! Open-addressed hash index over the dictionary, built once at type creation
+	vector<EnumIndexEntry> index;
 };
 
 } // namespace duckdb
@@ -86,11 +86,15 @@ protected:
 	//! The type of the buffer.
 	FileBufferType type;
 	//! The pointer to the internal buffer that will be read from or written to.
-	//! This includes the buffer header.
+	//! This includes the buffer header. Sector-aligned, which is necessary to support DIRECT_IO.
 	data_ptr_t internal_buffer;
 	//! The aligned size as passed to the constructor.
 	//! This is the size that is read from or written to disk.
 	uint64_t internal_size;
+	//! The start of the allocation backing internal_buffer (internal_buffer is aligned within it)
+	data_ptr_t malloc_ptr;
+	//! The size of the allocation backing internal_buffer
+	uint64_t malloc_size;
 
 	void ReallocBuffer(idx_t new_size);
 	void Init();
@@ -13,8 +13,10 @@
 namespace duckdb {
 
 class GZipFileSystem : public CompressedFileSystem {
-	// 32 KB
-	static constexpr const idx_t BUFFER_SIZE = 1u << 15;
+	// 128 KB of compressed input per child read
+	static constexpr const idx_t IN_BUFFER_SIZE = 1u << 17;
+	// 512 KB of decompressed output per inflate pass
+	static constexpr const idx_t OUT_BUFFER_SIZE = 1u << 19;
 
 public:
 	unique_ptr<FileHandle> OpenCompressedFile(QueryContext context, unique_ptr<FileHandle> handle, bool write) override;
@@ -46,7 +48,7 @@ static constexpr const uint8_t GZIP_FLAG_COMMENT = 0x10;
 static constexpr const uint8_t GZIP_FLAG_ENCRYPT = 0x20;
 
 static constexpr const uint8_t GZIP_HEADER_MINSIZE = 10;
-// MAXSIZE should be the same as input buffer size
+// MAXSIZE should not exceed the input buffer size
 static constexpr const idx_t GZIP_HEADER_MAXSIZE = 1u << 15;
 static constexpr const uint8_t GZIP_FOOTER_SIZE = 8;
 
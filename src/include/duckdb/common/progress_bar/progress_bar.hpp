@@ -29,6 +29,8 @@ public:
 	double GetPercentage();
 	uint64_t GetRowsProcesseed();
 	uint64_t GetTotalRowsToProcess();
+	uint64_t GetCompletedPipelines();
+	uint64_t GetTotalPipelines();
 	QueryProgress &operator=(const QueryProgress &other);
 	QueryProgress(const QueryProgress &other);
 
@@ -36,6 +38,8 @@ private:
 	atomic<double> percentage;
 	atomic<uint64_t> rows_processed;
 	atomic<uint64_t> total_rows_to_process;
+	atomic<uint64_t> completed_pipelines;
+	atomic<uint64_t> total_pipelines;
 };
 
 class ProgressBar {
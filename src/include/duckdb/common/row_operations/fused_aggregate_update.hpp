@@ -0,0 +1,53 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/common/row_operations/fused_aggregate_update.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/types/vector.hpp"
+
+namespace duckdb {
+
+class DataChunk;
+class TupleDataLayout;
+
+//! FusedAggregateUpdater updates all aggregate states of a row in a single pass over the payload,
+//! without going through the per-aggregate function pointers.
+//! It only supports layouts that consist of simple, unfiltered aggregates whose state layout is known here.
+class FusedAggregateUpdater {
+public:
+	//! The maximum number of aggregates we fuse - beyond this the per-row inner loop stops paying off
+	static constexpr idx_t MAXIMUM_FUSED_AGGREGATES = 4;
+
+public:
+	//! Try to create a fused updater for the aggregates in the layout - returns nullptr if not supported
+	static unique_ptr<FusedAggregateUpdater> TryCreate(const TupleDataLayout &layout);
+
+	//! Update all aggregate states in a single pass
+	//! The addresses must be flat and point to the aggregate data of each row (past the group columns)
+	void Update(DataChunk &payload, Vector &addresses, idx_t count);
+
+private:
+	enum class FusedAggregateType : uint8_t { COUNT_STAR, COUNT, MIN_INT64, MIN_DOUBLE, MAX_INT64, MAX_DOUBLE };
+
+	struct FusedAggregate {
+		//! Which specialized update to perform
+		FusedAggregateType type;
+		//! Offset of the aggregate state within the aggregate data of a row
+		idx_t state_offset;
+		//! Index of the (first) argument in the payload chunk
+		idx_t payload_idx;
+	};
+
+private:
+	//! The fused aggregates, in layout order
+	vector<FusedAggregate> aggregates;
+	//! Scratch space for the unified argument vectors (indexed by fused aggregate)
+	vector<UnifiedVectorFormat> formats;
+};
+
+} // namespace duckdb
@@ -75,6 +75,12 @@ public:
 	//! Whether this is an (approximate) index sort
 	const bool is_index_sort;
 
+	//! Whether the keys have arrived in sorted order so far (tracked during Sink) -
+	//! if they still are when we finalize, the sort can be skipped entirely
+	bool keys_sorted;
+	//! The most recently appended key (only tracked while keys_sorted is true)
+	data_ptr_t last_key;
+
 	//! Whether this run has been finalized
 	bool finalized;
 };
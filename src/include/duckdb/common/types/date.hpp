@@ -135,6 +135,9 @@ public:
 	//! If the date was a "special" value, the special flag will be set.
 	DUCKDB_API static DateCastResult TryConvertDate(const char *buf, idx_t len, idx_t &pos, date_t &result,
 	                                                bool &special, bool strict = false);
+	//! Branch-minimal parser for the fixed "YYYY-MM-DD" layout, used to parse vectors of uniformly
+	//! formatted dates; returns false if the string does not match the layout exactly
+	DUCKDB_API static bool TryParseISODate(const char *buf, idx_t len, date_t &result);
 
 	//! Create a string "YYYY-MM-DD" from a specified (year, month, day)
 	//! combination
@@ -77,6 +77,10 @@ public:
 	//! Algorithm 6
 	static int64_t EstimateCardinality(uint32_t *c);
 
+private:
+	//! Insert a contiguous batch of hashes (hot loop of Update)
+	void InsertElements(const hash_t *hashes, idx_t count);
+
 private:
 	uint8_t k[M];
 };
@@ -38,6 +38,11 @@ public:
 	//! Allocates space for an empty string of size "len" on the heap
 	DUCKDB_API string_t EmptyString(idx_t len);
 
+	//! Enables deduplication: repeated strings added to this heap share a single heap entry.
+	//! Uses a small open-addressing intern table; when the table fills up, additions degrade
+	//! gracefully to regular (non-deduplicated) copies.
+	DUCKDB_API void EnableDeduplication();
+
 	//! Size of strings
 	DUCKDB_API idx_t SizeInBytes() const;
 	//! Total allocation size (cached)
@@ -48,7 +53,23 @@ public:
 	}
 
 private:
+	//! Look up a string in the intern table, adding it to the heap (and table) if it is new
+	string_t AddBlobDeduplicated(const char *data, idx_t len);
+	//! Double the intern table and rehash the existing entries
+	void GrowInternTable();
+
+private:
+	static constexpr idx_t INTERN_TABLE_INITIAL_CAPACITY = 1024;
+	static constexpr idx_t INTERN_TABLE_MAXIMUM_CAPACITY = 1ULL << 16ULL;
+
 	ArenaAllocator allocator;
+	//! Whether repeated strings should share a single heap entry
+	bool deduplicate = false;
+	//! Open-addressing intern table over the heap entries (only used when deduplicating);
+	//! empty slots have size 0, which heap strings never have (they are longer than the inline limit)
+	vector<string_t> intern_table;
+	//! The number of occupied slots in the intern table
+	idx_t intern_count = 0;
 };
 
 } // namespace duckdb
@@ -154,6 +154,10 @@ public:
 	                                                          optional_ptr<int32_t> nanos = nullptr,
 	                                                          bool strict = false);
 	DUCKDB_API static TimestampCastResult TryConvertTimestamp(const char *str, idx_t len, timestamp_ns_t &result);
+	//! Branch-minimal parser for the fixed "YYYY-MM-DD HH:MM:SS[.ffffff]" layout (a 'T' date/time separator is
+	//! also accepted), used to parse vectors of uniformly formatted timestamps; returns false if the string does
+	//! not match the layout exactly
+	DUCKDB_API static bool TryParseISOTimestamp(const char *str, idx_t len, timestamp_t &result);
 	DUCKDB_API static timestamp_t FromCString(const char *str, idx_t len, bool use_offset = false,
 	                                          optional_ptr<int32_t> nanos = nullptr);
 	//! Convert a date object to a string in the format "YYYY-MM-DD hh:mm:ss"
@@ -14,6 +14,7 @@
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/selection_vector.hpp"
 #include "duckdb/common/types/validity_mask.hpp"
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/types/value.hpp"
 #include "duckdb/common/types/vector_buffer.hpp"
 #include "duckdb/common/vector_size.hpp"
@@ -328,6 +329,8 @@ public:
 	//! For caching the hashes of a child buffer
 	mutex cached_hashes_lock;
 	Vector cached_hashes;
+	//! Whether cached_hashes has been filled (checked without the lock on the hot path)
+	atomic<bool> cached_hashes_valid {false};
 };
 
 struct ConstantVector {
@@ -31,6 +31,10 @@ public:
 public:
 	void ResetFromCache(Vector &result) const;
 	const LogicalType &GetType() const;
+
+	//! Free any pooled cache buffers that were allocated with the given allocator.
+	//! Called when an allocator is torn down, so pooled buffers cannot outlive it.
+	DUCKDB_API static void PurgePool(Allocator &allocator);
 };
 
 } // namespace duckdb
@@ -19,6 +19,7 @@
 namespace duckdb {
 
 class BlockHandle;
+class FusedAggregateUpdater;
 
 struct FlushMoveState;
 
@@ -125,11 +126,19 @@ public:
 	//! Executes the filter(if any) and update the aggregates
 	void Combine(GroupedAggregateHashTable &other);
 	void Combine(TupleDataCollection &other_data, optional_ptr<atomic<double>> progress = nullptr);
+	//! Re-groups data that was aggregated at a finer group granularity and combines its aggregate states into
+	//! this HT, leaving the finer data intact. "group_map" maps every group column of this HT to the finer
+	//! layout column holding the same group; when this HT has no real group columns the caller passes the
+	//! constant group vector to use instead
+	void CombineFromFinerGrouping(TupleDataCollection &finer_data, const vector<idx_t> &group_map,
+	                              optional_ptr<Vector> constant_group);
 
 private:
 	ClientContext &context;
 	//! Efficiently matches groups
 	RowMatcher row_matcher;
+	//! Updates all aggregate states of a row in a single pass (if the layout supports it)
+	unique_ptr<FusedAggregateUpdater> fused_update;
 
 	struct AggregateDictionaryState {
 		AggregateDictionaryState();
@@ -168,6 +177,22 @@ private:
 	//! Bitmask for getting relevant bits from the hashes to determine the position
 	hash_t bitmask;
 
+	//! The number of old pointer table entries migrated per chunk during an incremental resize.
+	//! Must be large enough to drain the old table before the next resize triggers: a chunk adds at
+	//! most STANDARD_VECTOR_SIZE groups and the count has to grow by capacity / (2 * LOAD_FACTOR)
+	//! before the next doubling, so anything above STANDARD_VECTOR_SIZE * LOAD_FACTOR suffices
+	static constexpr idx_t MIGRATION_STEP = 4096;
+	//! The previous pointer table while an incremental resize is in progress (nullptr otherwise).
+	//! Entries are migrated into the new pointer table on demand (when a chunk probes their chain)
+	//! and by a bounded per-chunk cursor sweep, so a resize never rehashes everything at once
+	AllocatedData old_hash_map;
+	ht_entry_t *old_entries = nullptr;
+	//! Capacity of and bitmask into the old pointer table
+	idx_t old_capacity = 0;
+	hash_t old_bitmask = 0;
+	//! Sweep progress into the old pointer table
+	idx_t migration_cursor = 0;
+
 	//! How many tuples went into this HT (before de-duplication)
 	idx_t sink_count;
 	//! If true, we just append, skipping HT lookups
@@ -217,6 +242,16 @@ private:
 	//! Reinserts tuples (triggered by Resize)
 	void ReinsertTuples(PartitionedTupleData &data);
 
+	//! Inserts an entry of the old pointer table into the new one (no-op if already migrated)
+	void InsertMigratedEntry(const ht_entry_t &old_entry);
+	//! Migrates the old-table probe chains of the given hashes, so that every group of the
+	//! chunk that still lives in the old pointer table is present in the new one
+	void MigrateChunkGroups(const hash_t *hashes, idx_t chunk_size);
+	//! Migrates up to MIGRATION_STEP entries of the old pointer table
+	void IncrementalResizeStep();
+	//! Migrates all remaining entries of the old pointer table and drops it
+	void FinishIncrementalResize();
+
 	void UpdateAggregates(DataChunk &payload, const unsafe_vector<idx_t> &filter);
 
 	//! Does the actual group matching / creation
@@ -17,6 +17,7 @@
 
 namespace duckdb {
 class Allocator;
+class ArenaAllocator;
 class ExecutionContext;
 
 //! ExpressionExecutor is responsible for executing a set of expressions and storing the result in a data chunk
@@ -29,6 +30,7 @@ public:
 	DUCKDB_API ExpressionExecutor(ClientContext &context, const Expression &expression);
 	DUCKDB_API ExpressionExecutor(ClientContext &context, const vector<unique_ptr<Expression>> &expressions);
 	ExpressionExecutor(ExpressionExecutor &&) = delete;
+	DUCKDB_API ~ExpressionExecutor();
 
 	//! The expressions of the executor
 	vector<const Expression *> expressions;
@@ -40,6 +42,8 @@ public:
 	bool HasContext();
 	ClientContext &GetContext();
 	Allocator &GetAllocator();
+	//! Allocator for the expression states themselves (arena-backed, freed wholesale with the executor)
+	Allocator &GetStateAllocator();
 
 	//! Add an expression to the set of to-be-executed expressions of the executor
 	DUCKDB_API void AddExpression(const Expression &expr);
@@ -160,6 +164,10 @@ protected:
 private:
 	//! Client context
 	optional_ptr<ClientContext> context;
+	//! Arena for the intermediate chunks of the expression states: these are allocated once per expression,
+	//! so we batch them into a handful of arena blocks instead of hitting the heap for every expression.
+	//! Declared before "states" so the chunks are destroyed before the arena.
+	unique_ptr<ArenaAllocator> state_arena;
 	//! The states of the expression executor; this holds any intermediates and temporary states of expressions
 	vector<unique_ptr<ExpressionExecutorState>> states;
 	//! The vector verification (debug setting)
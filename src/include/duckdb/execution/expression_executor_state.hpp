@@ -19,6 +19,7 @@ class BoundFunctionExpression;
 class ExpressionExecutor;
 struct ExpressionExecutorState;
 struct FunctionLocalState;
+struct FusedFunctionInfo;
 
 struct ExpressionState {
 	ExpressionState(const Expression &expr, ExpressionExecutorState &root);
@@ -69,6 +70,8 @@ public:
 
 public:
 	unique_ptr<FunctionLocalState> local_state;
+	//! Fused single-pass evaluation of a nested arithmetic expression pair (if eligible)
+	unique_ptr<FusedFunctionInfo> fused;
 
 private:
 	//! The column index of the "unary" input column that may be a dictionary vector
@@ -97,7 +97,8 @@ public:
 
 	//! Merge another ART into this ART. Both must be locked.
 	//! FIXME: Return ARTConflictType instead of a boolean.
-	bool MergeIndexes(IndexLock &state, BoundIndex &other_index) override;
+	bool MergeIndexes(IndexLock &state, BoundIndex &other_index,
+	                  optional_ptr<atomic<bool>> interrupted = nullptr) override;
 
 	//! Vacuums the ART storage.
 	void Vacuum(IndexLock &state) override;
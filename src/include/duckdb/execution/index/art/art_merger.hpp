@@ -19,15 +19,21 @@ namespace duckdb {
 //! Must be initialized via its Init function before calling Merge,
 //! otherwise, the stack is empty and there is nothing to do.
 class ARTMerger {
+public:
+	//! The number of processed node entries between two polls of the interrupt flag.
+	static constexpr idx_t INTERRUPT_CHECK_INTERVAL = 2048;
+
 public:
 	ARTMerger() = delete;
-	ARTMerger(ArenaAllocator &arena, ART &art) : arena(arena), art(art) {
+	ARTMerger(ArenaAllocator &arena, ART &art, optional_ptr<atomic<bool>> interrupted = nullptr)
+	    : arena(arena), art(art), interrupted(interrupted) {
 	}
 
 public:
 	//! Init the merge by setting the initial nodes.
 	void Init(Node &left, Node &right);
-	//! Merge until (1) triggering constraint violation or (2) all nodes have been processed.
+	//! Merge until (1) triggering constraint violation, (2) all nodes have been processed,
+	//! or (3) the interrupt flag (if any) has been set, which throws an InterruptException.
 	ARTConflictType Merge();
 
 private:
@@ -50,6 +56,8 @@ private:
 	ArenaAllocator &arena;
 	//! The ART holding the node memory.
 	ART &art;
+	//! The interrupt flag of the active query, if any.
+	optional_ptr<atomic<bool>> interrupted;
 	//! The stack. While merging, NodeEntry elements are pushed onto of the stack.
 	stack<NodeEntry> s;
 
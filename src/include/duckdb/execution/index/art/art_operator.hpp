@@ -19,6 +19,20 @@ namespace duckdb {
 //! ARTOperator provides functionality for different ART operations.
 class ARTOperator {
 public:
+	//! Prefetch the memory of a node, if its segment is already loaded.
+	//! This overlaps the cache miss on the next node with the remaining work on the current one.
+	static inline void PrefetchNode(ART &art, const Node &node) {
+		const auto type = node.GetType();
+		if (type == NType::LEAF_INLINED) {
+			// Inlined leaves live in the pointer itself.
+			return;
+		}
+		auto ptr = Node::GetAllocator(art, type).GetIfLoaded(node);
+		if (ptr) {
+			__builtin_prefetch(ptr, 0, 3);
+		}
+	}
+
 	//! Lookup returns a pointer to the leaf matching the key,
 	//! or nullptr, if no such leaf exists.
 	static unsafe_optional_ptr<const Node> Lookup(ART &art, const Node &node, const ARTKey &key, idx_t depth) {
@@ -33,6 +47,8 @@ public:
 			// Traverse the prefix.
 			if (ref.get().GetType() == NType::PREFIX) {
 				Prefix prefix(art, ref.get());
+				// Fetch the node below the prefix while we compare the prefix bytes.
+				PrefetchNode(art, *prefix.ptr);
 				for (idx_t i = 0; i < prefix.data[Prefix::Count(art)]; i++) {
 					if (prefix.data[i] != key[depth]) {
 						// The key and the prefix don't match.
@@ -53,6 +69,9 @@ public:
 				return nullptr;
 			}
 
+			// Fetch the child's memory before descending into it.
+			PrefetchNode(art, *child);
+
 			// Continue in the child.
 			ref = *child;
 			D_ASSERT(ref.get().HasMetadata());
@@ -62,6 +81,112 @@ public:
 		return nullptr;
 	}
 
+	//! Looks up all keys of a chunk and writes a pointer to each matching leaf (or nullptr) into leaves.
+	//! The keys are probed in sorted order, and each descent resumes below the deepest node shared
+	//! with the previously probed key, amortizing node visits across shared prefixes.
+	static void LookupBatch(ART &art, const Node &node, const unsafe_vector<ARTKey> &keys, const idx_t count,
+	                        unsafe_vector<unsafe_optional_ptr<const Node>> &leaves) {
+		D_ASSERT(leaves.size() >= count);
+
+		// Sort the key indexes, so that identical keys and keys with shared prefixes are adjacent.
+		vector<idx_t> sorted_idx;
+		sorted_idx.reserve(count);
+		for (idx_t i = 0; i < count; i++) {
+			leaves[i] = nullptr;
+			if (!keys[i].Empty()) {
+				sorted_idx.push_back(i);
+			}
+		}
+		std::sort(sorted_idx.begin(), sorted_idx.end(),
+		          [&keys](const idx_t lhs, const idx_t rhs) { return keys[rhs] > keys[lhs]; });
+
+		// The inner nodes along the previous key's path, with the key depth at which we arrived at them.
+		struct LookupPathEntry {
+			idx_t depth;
+			const Node *node;
+		};
+		vector<LookupPathEntry> path;
+		optional_ptr<const ARTKey> prev_key;
+		unsafe_optional_ptr<const Node> prev_leaf = nullptr;
+
+		for (const auto idx : sorted_idx) {
+			auto &key = keys[idx];
+			if (prev_key && key == *prev_key) {
+				// Duplicate key (IN-lists, repeated probe values): reuse the previous result.
+				leaves[idx] = prev_leaf;
+				continue;
+			}
+
+			// Pop any path entries below the longest common prefix with the previous key.
+			idx_t lcp = 0;
+			if (prev_key) {
+				auto max_lcp = MinValue<idx_t>(key.len, prev_key->len);
+				while (lcp < max_lcp && key.data[lcp] == prev_key->data[lcp]) {
+					lcp++;
+				}
+			}
+			while (!path.empty() && path.back().depth > lcp) {
+				path.pop_back();
+			}
+
+			// Resume the descent at the deepest shared node (or the root).
+			reference<const Node> ref(path.empty() ? node : *path.back().node);
+			idx_t depth = path.empty() ? 0 : path.back().depth;
+			// The resume node is already on the path: only push nodes below it.
+			bool push_node = path.empty();
+
+			unsafe_optional_ptr<const Node> leaf = nullptr;
+			while (ref.get().HasMetadata()) {
+				// Return the leaf.
+				if (ref.get().IsAnyLeaf() || ref.get().GetGateStatus() == GateStatus::GATE_SET) {
+					leaf = unsafe_optional_ptr<const Node>(ref.get());
+					break;
+				}
+				if (push_node) {
+					path.push_back({depth, &ref.get()});
+				}
+				push_node = true;
+
+				// Traverse the prefix.
+				if (ref.get().GetType() == NType::PREFIX) {
+					Prefix prefix(art, ref.get());
+					bool mismatch = false;
+					for (idx_t i = 0; i < prefix.data[Prefix::Count(art)]; i++) {
+						if (prefix.data[i] != key[depth]) {
+							// The key and the prefix don't match.
+							mismatch = true;
+							break;
+						}
+						depth++;
+					}
+					if (mismatch) {
+						break;
+					}
+					ref = *prefix.ptr;
+					continue;
+				}
+
+				// Get the child node.
+				D_ASSERT(depth < key.len);
+				auto child = ref.get().GetChild(art, key[depth]);
+
+				// No child at the key byte.
+				if (!child) {
+					break;
+				}
+
+				// Continue in the child.
+				ref = *child;
+				D_ASSERT(ref.get().HasMetadata());
+				depth++;
+			}
+
+			leaves[idx] = leaf;
+			prev_key = &key;
+			prev_leaf = leaf;
+		}
+	}
+
 	//! Insert a key and its row ID into the node.
 	//! Starts at depth (in the key).
 	//! status indicates if the insert happens inside a gate or not.
@@ -8,10 +8,17 @@
 
 #pragma once
 
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/execution/index/fixed_size_allocator.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node.hpp"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
 template <uint8_t CAPACITY, NType TYPE>
@@ -152,10 +159,85 @@ public:
 	//! Delete the child at byte.
 	static void DeleteChild(ART &art, Node &node, const uint8_t byte);
 
+	//! Get the child at byte, comparing all sixteen key bytes at once where SIMD is available.
+	static unsafe_optional_ptr<Node> GetChild(Node16 &n, const uint8_t byte, const bool unsafe = false);
+	//! Get the first child greater than or equal to the byte.
+	static unsafe_optional_ptr<Node> GetNextChild(Node16 &n, uint8_t &byte);
+
 private:
 	static void GrowNode4(ART &art, Node &node16, Node &node4);
 	//! We shrink at < Node48::SHRINK_THRESHOLD.
 	static void ShrinkNode48(ART &art, Node &node16, Node &node48);
 };
 
+//===--------------------------------------------------------------------===//
+// SIMD within-node search
+//===--------------------------------------------------------------------===//
+
+inline unsafe_optional_ptr<Node> Node16::GetChild(Node16 &n, const uint8_t byte, const bool unsafe) {
+#if defined(__SSE2__)
+	auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n.key));
+	auto matches = _mm_cmpeq_epi8(keys, _mm_set1_epi8(static_cast<char>(byte)));
+	auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches)) & ((1U << n.count) - 1);
+	if (!mask) {
+		return nullptr;
+	}
+	auto i = CountZeros<uint32_t>::Trailing(mask);
+	if (!unsafe && !n.children[i].HasMetadata()) {
+		throw InternalException("empty child i = %d for byte %d in Node16::GetChild", i, byte);
+	}
+	return &n.children[i];
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	auto matches = vceqq_u8(vld1q_u8(n.key), vdupq_n_u8(byte));
+	// narrow the 16 lane results to a nibble mask (4 bits per lane)
+	auto narrowed = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+	auto mask = vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+	if (n.count != CAPACITY) {
+		mask &= (1ULL << (n.count * 4)) - 1;
+	}
+	if (!mask) {
+		return nullptr;
+	}
+	auto i = CountZeros<uint64_t>::Trailing(mask) / 4;
+	if (!unsafe && !n.children[i].HasMetadata()) {
+		throw InternalException("empty child i = %d for byte %d in Node16::GetChild", i, byte);
+	}
+	return &n.children[i];
+#else
+	return BaseNode<CAPACITY, NODE_16>::GetChild(n, byte, unsafe);
+#endif
+}
+
+inline unsafe_optional_ptr<Node> Node16::GetNextChild(Node16 &n, uint8_t &byte) {
+#if defined(__SSE2__)
+	auto keys = _mm_loadu_si128(reinterpret_cast<const __m128i *>(n.key));
+	auto byte_vec = _mm_set1_epi8(static_cast<char>(byte));
+	// key[i] >= byte <=> max(key[i], byte) == key[i] (SSE2 has no unsigned byte comparison)
+	auto matches = _mm_cmpeq_epi8(_mm_max_epu8(keys, byte_vec), keys);
+	auto mask = static_cast<uint32_t>(_mm_movemask_epi8(matches)) & ((1U << n.count) - 1);
+	if (!mask) {
+		return nullptr;
+	}
+	// the keys are sorted, so the lowest matching index holds the smallest key >= byte
+	auto i = CountZeros<uint32_t>::Trailing(mask);
+	byte = n.key[i];
+	return &n.children[i];
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	auto matches = vcgeq_u8(vld1q_u8(n.key), vdupq_n_u8(byte));
+	auto narrowed = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+	auto mask = vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+	if (n.count != CAPACITY) {
+		mask &= (1ULL << (n.count * 4)) - 1;
+	}
+	if (!mask) {
+		return nullptr;
+	}
+	auto i = CountZeros<uint64_t>::Trailing(mask) / 4;
+	byte = n.key[i];
+	return &n.children[i];
+#else
+	return BaseNode<CAPACITY, NODE_16>::GetNextChild(n, byte);
+#endif
+}
+
 } // namespace duckdb
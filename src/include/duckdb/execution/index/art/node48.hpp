@@ -8,11 +8,18 @@
 
 #pragma once
 
+#include "duckdb/common/bit_utils.hpp"
 #include "duckdb/execution/index/art/art.hpp"
 #include "duckdb/execution/index/art/node.hpp"
 #include "duckdb/execution/index/art/node256.hpp"
 #include "duckdb/execution/index/fixed_size_allocator.hpp"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
 //! Node48 holds up to 48 children. The child_index array is indexed by the key byte.
@@ -97,7 +104,33 @@ public:
 
 	template <class NODE>
 	static unsafe_optional_ptr<Node> GetNextChild(NODE &n, uint8_t &byte) {
-		for (idx_t i = byte; i < Node256::CAPACITY; i++) {
+		idx_t i = byte;
+#if defined(__SSE2__)
+		// scan the child index sixteen slots at a time for the first occupied entry
+		auto empty = _mm_set1_epi8(static_cast<char>(EMPTY_MARKER));
+		for (; i + 16 <= Node256::CAPACITY; i += 16) {
+			auto indexes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&n.child_index[i]));
+			auto occupied = ~static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(indexes, empty))) & 0xFFFFU;
+			if (occupied) {
+				i += CountZeros<uint32_t>::Trailing(occupied);
+				byte = UnsafeNumericCast<uint8_t>(i);
+				return &n.children[n.child_index[i]];
+			}
+		}
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+		auto empty = vdupq_n_u8(EMPTY_MARKER);
+		for (; i + 16 <= Node256::CAPACITY; i += 16) {
+			auto matches = vceqq_u8(vld1q_u8(&n.child_index[i]), empty);
+			auto narrowed = vshrn_n_u16(vreinterpretq_u16_u8(matches), 4);
+			auto occupied = ~vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+			if (occupied) {
+				i += CountZeros<uint64_t>::Trailing(occupied) / 4;
+				byte = UnsafeNumericCast<uint8_t>(i);
+				return &n.children[n.child_index[i]];
+			}
+		}
+#endif
+		for (; i < Node256::CAPACITY; i++) {
 			if (n.child_index[i] != EMPTY_MARKER) {
 				byte = UnsafeNumericCast<uint8_t>(i);
 				return &n.children[n.child_index[i]];
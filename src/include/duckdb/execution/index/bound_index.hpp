@@ -108,10 +108,12 @@ public:
 	virtual ErrorData Insert(IndexLock &l, DataChunk &chunk, Vector &row_ids, IndexAppendInfo &info);
 
 	//! Merge another index into this index. The lock obtained from InitializeLock must be held, and the other
-	//! index must also be locked during the merge
-	virtual bool MergeIndexes(IndexLock &state, BoundIndex &other_index) = 0;
+	//! index must also be locked during the merge. If an interrupt flag is provided, the merge polls it at
+	//! bounded intervals and throws an InterruptException when it is set.
+	virtual bool MergeIndexes(IndexLock &state, BoundIndex &other_index,
+	                          optional_ptr<atomic<bool>> interrupted = nullptr) = 0;
 	//! Obtains a lock and calls MergeIndexes while holding that lock
-	bool MergeIndexes(BoundIndex &other_index);
+	bool MergeIndexes(BoundIndex &other_index, optional_ptr<atomic<bool>> interrupted = nullptr);
 
 	//! Performs a full traversal of the ART while vacuuming the qualifying nodes.
 	//! The lock obtained from InitializeLock must be held.
@@ -179,6 +179,9 @@ private:
 	//! Unordered sets make no guarantee that begin() returns the same element.
 	//! By caching one of the buffers with free space, we get more consistency when filling buffers.
 	optional_idx buffer_with_free_space;
+	//! Caches a pointer to the buffer with free space, so that the allocation
+	//! path does not perform a hash lookup per segment.
+	optional_ptr<FixedSizeBuffer> free_space_buffer;
 
 	//! Buffers qualifying for a vacuum (helper field to allow for fast NeedsVacuum checks)
 	unordered_set<idx_t> vacuum_buffers;
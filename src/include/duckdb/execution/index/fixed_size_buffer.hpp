@@ -96,6 +96,8 @@ private:
 	idx_t segment_count;
 	//! The size of allocated memory in this buffer (necessary for copying while pinning)
 	idx_t allocation_size;
+	//! First bitmask entry that can contain a free bit (cursor into the buffer-local free list)
+	idx_t first_free_entry;
 
 	//! True: the in-memory buffer is no longer consistent with its optional copy on disk.
 	bool dirty;
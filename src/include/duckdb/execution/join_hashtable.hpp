@@ -341,6 +341,8 @@ public:
 	// External Join
 	//===--------------------------------------------------------------------===//
 	static constexpr const idx_t INITIAL_RADIX_BITS = 4;
+	//! The number of buckets in the histogram over the low hash bits, used to estimate key skew
+	static constexpr const idx_t HASH_HISTOGRAM_SIZE = 256;
 
 	struct ProbeSpillLocalAppendState {
 		ProbeSpillLocalAppendState() {
@@ -354,7 +356,8 @@ public:
 	//! dealt with in just 1 more round of probing, otherwise it is radix partitioned in the same way as the HashTable
 	struct ProbeSpill {
 	public:
-		ProbeSpill(JoinHashTable &ht, ClientContext &context, const vector<LogicalType> &probe_types);
+		ProbeSpill(JoinHashTable &ht, ClientContext &context, const vector<LogicalType> &probe_types,
+		           vector<column_t> spill_column_ids);
 
 	public:
 		//! Create a state for a new thread
@@ -370,6 +373,10 @@ public:
 		//! Scans and consumes the ColumnDataCollection
 		unique_ptr<ColumnDataConsumer> consumer;
 
+		//! The probe input columns that are spilled (only the join key inputs and the join output columns,
+		//! so columns that are not needed for the next probe round do not go through the temporary file manager)
+		const vector<column_t> spill_column_ids;
+
 	private:
 		JoinHashTable &ht;
 		mutex lock;
@@ -419,9 +426,13 @@ public:
 	                   idx_t &max_partition_size, idx_t &max_partition_count) const;
 	//! Get the remaining size of the unbuilt partitions
 	idx_t GetRemainingSize() const;
+	//! Estimate the number of rows of the most common build key from the hash histograms of this HT
+	//! and the (not yet merged) local HTs. All duplicates of a key share a histogram bucket, so the
+	//! largest bucket minus the expected share of the remaining keys approximates the heaviest hitter.
+	idx_t GetLargestKeyCountEstimate(const vector<unique_ptr<JoinHashTable>> &local_hts) const;
 	//! Sets number of radix bits according to the max ht size
 	void SetRepartitionRadixBits(const idx_t max_ht_size, const idx_t max_partition_size,
-	                             const idx_t max_partition_count);
+	                             const idx_t max_partition_count, const idx_t largest_key_count);
 	//! Initialized "current_partitions" and "completed_partitions"
 	void InitializePartitionMasks();
 	//! How many partitions are currently active
@@ -443,6 +454,9 @@ public:
 private:
 	//! The current number of radix bits used to partition
 	idx_t radix_bits;
+	//! Histogram over the low bits of the build hashes (disjoint from the radix partitioning bits),
+	//! used to estimate the size of the most common key under skew
+	unsafe_vector<idx_t> hash_histogram;
 
 	//! Bits set to 1 for currently active partitions
 	ValidityMask current_partitions;
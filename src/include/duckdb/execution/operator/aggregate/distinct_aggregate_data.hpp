@@ -28,6 +28,10 @@ public:
 	vector<idx_t> table_indices;
 	//! This indirection is used to allow two aggregates to share the same input data
 	unordered_map<idx_t, idx_t> table_map;
+	//! Maps each child of a distinct aggregate to the column of its (shared) table that holds
+	//! the child's data - only differs from the identity when aggregates share a table with
+	//! the same inputs in a different order
+	unordered_map<idx_t, vector<idx_t>> column_maps;
 	const vector<unique_ptr<Expression>> &aggregates;
 	// Total amount of children of the distinct aggregates
 	idx_t total_child_count;
@@ -80,6 +80,9 @@ public:
 	vector<GroupingSet> grouping_sets;
 	//! The radix partitioned hash tables (one per grouping set)
 	vector<HashAggregateGroupingData> groupings;
+	//! If set, the grouping set at this index is a superset of all other grouping sets: the input is then only
+	//! sunk into this grouping, and the coarser groupings are filled from it at Finalize by combining states
+	optional_idx finest_grouping_idx;
 	unique_ptr<DistinctAggregateCollectionInfo> distinct_collection_info;
 	//! A recreation of the input chunk, with nulls for everything that isnt a group
 	vector<LogicalType> input_group_types;
@@ -13,12 +13,13 @@
 
 namespace duckdb {
 
-//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause)
+//! PhysicalStreamingWindow implements streaming window functions (i.e. with an empty OVER clause,
+//! or with an OVER (ORDER BY ...) clause that the input is already provably sorted on)
 class PhysicalStreamingWindow : public PhysicalOperator {
 public:
 	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::STREAMING_WINDOW;
 
-	static bool IsStreamingFunction(ClientContext &context, unique_ptr<Expression> &expr);
+	static bool IsStreamingFunction(ClientContext &context, PhysicalOperator &child, unique_ptr<Expression> &expr);
 
 public:
 	PhysicalStreamingWindow(PhysicalPlan &physical_plan, vector<LogicalType> types,
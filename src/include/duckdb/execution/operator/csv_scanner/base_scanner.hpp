@@ -180,6 +180,11 @@ public:
 		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
 	}
 
+	//! Returns a mask with the high bit set for every zero byte in the word
+	inline static uint64_t ZeroByteMask(uint64_t v) {
+		return (v - UINT64_C(0x0101010101010101)) & ~(v)&UINT64_C(0x8080808080808080);
+	}
+
 protected:
 	//! Boundaries of this scanner
 	CSVIterator iterator;
@@ -306,6 +311,21 @@ protected:
 				ever_quoted = true;
 				T::SetQuoted(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
+				// fast path: classify 64 bytes per iteration - the fixed eight-word loop auto-vectorizes,
+				// and we only drop to the word/byte loops once a block contains a quote or escape
+				while (iterator.pos.buffer_pos + 64 < to_pos) {
+					uint64_t special = 0;
+					for (idx_t word = 0; word < 8; word++) {
+						const uint64_t value = Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(
+						    &buffer_handle_ptr[iterator.pos.buffer_pos + word * 8]));
+						special |= ZeroByteMask((value ^ state_machine->transition_array.quote) &
+						                        (value ^ state_machine->transition_array.escape));
+					}
+					if (special) {
+						break;
+					}
+					iterator.pos.buffer_pos += 64;
+				}
 				while (iterator.pos.buffer_pos + 8 < to_pos) {
 					const uint64_t value =
 					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
@@ -339,6 +359,23 @@ protected:
 				break;
 			case CSVState::STANDARD: {
 				iterator.pos.buffer_pos++;
+				// fast path: classify 64 bytes per iteration (see the QUOTED state)
+				while (iterator.pos.buffer_pos + 64 < to_pos) {
+					uint64_t special = 0;
+					for (idx_t word = 0; word < 8; word++) {
+						const uint64_t value = Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(
+						    &buffer_handle_ptr[iterator.pos.buffer_pos + word * 8]));
+						special |= ZeroByteMask((value ^ state_machine->transition_array.delimiter) &
+						                        (value ^ state_machine->transition_array.new_line) &
+						                        (value ^ state_machine->transition_array.carriage_return) &
+						                        (value ^ state_machine->transition_array.escape) &
+						                        (value ^ state_machine->transition_array.comment));
+					}
+					if (special) {
+						break;
+					}
+					iterator.pos.buffer_pos += 64;
+				}
 				while (iterator.pos.buffer_pos + 8 < to_pos) {
 					uint64_t value =
 					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
@@ -365,6 +402,20 @@ protected:
 			case CSVState::COMMENT: {
 				T::SetComment(result, iterator.pos.buffer_pos);
 				iterator.pos.buffer_pos++;
+				// fast path: classify 64 bytes per iteration (see the QUOTED state)
+				while (iterator.pos.buffer_pos + 64 < to_pos) {
+					uint64_t special = 0;
+					for (idx_t word = 0; word < 8; word++) {
+						const uint64_t value = Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(
+						    &buffer_handle_ptr[iterator.pos.buffer_pos + word * 8]));
+						special |= ZeroByteMask((value ^ state_machine->transition_array.new_line) &
+						                        (value ^ state_machine->transition_array.carriage_return));
+					}
+					if (special) {
+						break;
+					}
+					iterator.pos.buffer_pos += 64;
+				}
 				while (iterator.pos.buffer_pos + 8 < to_pos) {
 					const uint64_t value =
 					    Load<uint64_t>(reinterpret_cast<const_data_ptr_t>(&buffer_handle_ptr[iterator.pos.buffer_pos]));
@@ -151,6 +151,10 @@ private:
 
 	//! Checks if candidate still produces good values for the next chunk
 	bool RefineCandidateNextChunk(ColumnCountScanner &candidate) const;
+	//! Runs a candidate over the whole sample, returns whether it parsed the sample successfully
+	//! Candidates are refined concurrently, hence this must not touch any mutable sniffer state
+	bool RefineCandidateFully(ColumnCountScanner &candidate, idx_t &sniffed_lines) const;
+	friend class CSVRefineCandidateTask;
 
 	//! ------------------------------------------------------//
 	//! ------------------- Type Detection ------------------ //
@@ -23,6 +23,7 @@ public:
 public:
 	// Sink interface
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkNextBatchType NextBatch(ExecutionContext &context, OperatorSinkNextBatchInput &input) const override;
 	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 	SinkFinalizeType Finalize(Pipeline &pipeline, Event &event, ClientContext &context,
 	                          OperatorSinkFinalizeInput &input) const override;
@@ -44,12 +45,48 @@ public:
 //===--------------------------------------------------------------------===//
 class BatchCollectorGlobalState : public GlobalSinkState {
 public:
+	//! The number of partitions completed batches are distributed over while sinking
+	static constexpr idx_t MERGE_PARTITIONS = 8;
+
 	BatchCollectorGlobalState(ClientContext &context, const PhysicalBatchCollector &op) : data(context, op.types) {
+		for (idx_t i = 0; i < MERGE_PARTITIONS; i++) {
+			partitions.push_back(make_uniq<MergePartition>(context, op.types));
+		}
+	}
+
+	//! Hand a set of completed local batches to its batch-index-affine merge partition
+	//! Merging happens while other threads are still producing batches instead of at combine/finalize time
+	void MergeBatches(BatchedDataCollection &local_data) {
+		if (local_data.BatchCount() == 0) {
+			return;
+		}
+		auto &partition = *partitions[local_data.IndexToBatchIndex(0) % MERGE_PARTITIONS];
+		lock_guard<mutex> l(partition.lock);
+		partition.data.Merge(local_data);
+	}
+
+	//! Gather all merge partitions into the final (batch-index ordered) collection
+	void GatherPartitions() {
+		for (auto &partition : partitions) {
+			lock_guard<mutex> l(partition->lock);
+			data.Merge(partition->data);
+		}
 	}
 
-	mutex glock;
 	BatchedDataCollection data;
 	unique_ptr<QueryResult> result;
+
+private:
+	struct MergePartition {
+		MergePartition(ClientContext &context, vector<LogicalType> types) : data(context, std::move(types)) {
+		}
+
+		mutex lock;
+		BatchedDataCollection data;
+	};
+
+	//! The merge partitions - batches are routed here by batch index so producers rarely contend on the same lock
+	vector<unique_ptr<MergePartition>> partitions;
 };
 
 class BatchCollectorLocalState : public LocalSinkState {
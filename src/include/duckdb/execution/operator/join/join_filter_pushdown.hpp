@@ -64,6 +64,9 @@ struct JoinFilterPushdownInfo {
 	//! Min/Max aggregates
 	vector<unique_ptr<Expression>> min_max_aggregates;
 
+	//! Maximum build-side count for which we generate a bloom filter over the build key hashes
+	static constexpr idx_t BLOOM_FILTER_MAX_BUILD_COUNT = idx_t(1) << 21;
+
 public:
 	unique_ptr<JoinFilterGlobalState> GetGlobalState(ClientContext &context, const PhysicalOperator &op) const;
 	unique_ptr<JoinFilterLocalState> GetLocalState(JoinFilterGlobalState &gstate) const;
@@ -76,6 +79,8 @@ public:
 private:
 	void PushInFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht, const PhysicalOperator &op,
 	                  idx_t filter_idx, idx_t filter_col_idx) const;
+	void PushBloomFilter(const JoinFilterPushdownFilter &info, JoinHashTable &ht, const PhysicalOperator &op,
+	                     idx_t filter_idx, idx_t filter_col_idx) const;
 };
 
 } // namespace duckdb
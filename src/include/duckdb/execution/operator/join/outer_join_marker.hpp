@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/atomic.hpp"
 #include "duckdb/common/mutex.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/operator/join/physical_comparison_join.hpp"
@@ -60,15 +61,26 @@ public:
 	//! Perform the scan
 	void Scan(OuterJoinGlobalScanState &gstate, OuterJoinLocalScanState &lstate, DataChunk &result);
 
-	//! Read-only matches vector
-	const bool *GetMatches() const {
-		return found_match.get();
+	//! Returns whether the row at the given position has found a match
+	inline bool IsMatched(idx_t position) const {
+		D_ASSERT(position < count);
+		const auto word = match_bitmap[position / BITS_PER_WORD].load(std::memory_order_relaxed);
+		return (word & (uint64_t(1) << (position % BITS_PER_WORD))) != 0;
 	}
 
+	//! Appends the positions in [base, base + scan_count) that have not found a match to the selection vector
+	//! (as indices relative to base), returning the number of unmatched positions
+	idx_t FindUnmatched(idx_t base, idx_t scan_count, SelectionVector &sel) const;
+
+private:
+	static constexpr idx_t BITS_PER_WORD = 64;
+
 private:
 	bool enabled;
-	unsafe_unique_array<bool> found_match;
+	//! Bitmap of matched rows (one bit per row, atomically OR-ed into under parallel probes)
+	unsafe_unique_array<atomic<uint64_t>> match_bitmap;
 	idx_t count;
+	idx_t word_count;
 };
 
 } // namespace duckdb
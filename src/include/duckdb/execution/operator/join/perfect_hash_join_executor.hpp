@@ -24,6 +24,8 @@ struct PerfectHashJoinStats {
 	Value build_max;
 	bool is_build_small = false;
 	bool is_build_dense = false;
+	//! Whether the build keys are remapped to their rank (for small builds with a sparse key range)
+	bool is_remapped = false;
 	idx_t build_range = 0;
 };
 
@@ -48,12 +50,18 @@ private:
 	template <typename T>
 	void TemplatedFillSelectionVectorProbe(Vector &source, SelectionVector &build_sel_vec,
 	                                       SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
+	template <typename T>
+	void TemplatedFillSelectionVectorProbeRemap(Vector &source, SelectionVector &build_sel_vec,
+	                                            SelectionVector &probe_sel_vec, idx_t count, idx_t &prob_sel_count);
 
 	bool FillSelectionVectorSwitchBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
 	                                    idx_t count);
 	template <typename T>
 	bool TemplatedFillSelectionVectorBuild(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
 	                                       idx_t count);
+	template <typename T>
+	bool TemplatedFillSelectionVectorBuildRemap(Vector &source, SelectionVector &sel_vec, SelectionVector &seq_sel_vec,
+	                                            idx_t count);
 	bool FullScanHashTable(LogicalType &key_type);
 
 private:
@@ -67,6 +75,8 @@ private:
 	ValidityMask bitmap_build_idx;
 	//! Stores the number of unique keys in the build side
 	idx_t unique_keys = 0;
+	//! The sorted build keys (only used when the build keys are remapped to their rank)
+	unique_ptr<Vector> remap_keys;
 };
 
 } // namespace duckdb
@@ -0,0 +1,64 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/execution/operator/projection/physical_parallel_unnest.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/planner/expression.hpp"
+
+namespace duckdb {
+
+//! PhysicalParallelUnnest implements UNNEST as a materializing operator: the input is collected into a
+//! ColumnDataCollection and the list entries are split into independent ranges that multiple threads
+//! unnest concurrently. Large lists are split mid-list, so a single row with a huge list no longer
+//! serializes on one thread. It is only used when the plan does not require the input order.
+class PhysicalParallelUnnest : public PhysicalOperator {
+public:
+	static constexpr const PhysicalOperatorType TYPE = PhysicalOperatorType::UNNEST;
+	//! The number of output rows that are handed out to a thread at a time
+	static constexpr const idx_t MORSEL_SIZE = 32 * STANDARD_VECTOR_SIZE;
+
+public:
+	PhysicalParallelUnnest(PhysicalPlan &physical_plan, vector<LogicalType> types,
+	                       vector<unique_ptr<Expression>> select_list, idx_t estimated_cardinality);
+
+	//! The projection list of the UNNEST (same layout as PhysicalUnnest)
+	vector<unique_ptr<Expression>> select_list;
+
+public:
+	// Source interface
+	unique_ptr<GlobalSourceState> GetGlobalSourceState(ClientContext &context) const override;
+	unique_ptr<LocalSourceState> GetLocalSourceState(ExecutionContext &context,
+	                                                 GlobalSourceState &gstate) const override;
+	SourceResultType GetData(ExecutionContext &context, DataChunk &chunk, OperatorSourceInput &input) const override;
+
+	bool IsSource() const override {
+		return true;
+	}
+
+	bool ParallelSource() const override {
+		return true;
+	}
+
+public:
+	// Sink interface
+	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
+	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+
+	bool IsSink() const override {
+		return true;
+	}
+
+	bool ParallelSink() const override {
+		return true;
+	}
+};
+
+} // namespace duckdb
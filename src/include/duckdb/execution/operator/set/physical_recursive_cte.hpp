@@ -57,8 +57,10 @@ public:
 public:
 	// Sink interface
 	SinkResultType Sink(ExecutionContext &context, DataChunk &chunk, OperatorSinkInput &input) const override;
+	SinkCombineResultType Combine(ExecutionContext &context, OperatorSinkCombineInput &input) const override;
 
 	unique_ptr<GlobalSinkState> GetGlobalSinkState(ClientContext &context) const override;
+	unique_ptr<LocalSinkState> GetLocalSinkState(ExecutionContext &context) const override;
 
 	bool IsSink() const override {
 		return true;
@@ -76,9 +78,6 @@ public:
 	vector<const_reference<PhysicalOperator>> GetSources() const override;
 
 private:
-	//! Probe Hash Table and eliminate duplicate rows
-	idx_t ProbeHT(DataChunk &chunk, RecursiveCTEState &state) const;
-
 	void ExecuteRecursivePipelines(ExecutionContext &context) const;
 };
 
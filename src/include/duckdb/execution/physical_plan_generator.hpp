@@ -161,6 +161,8 @@ private:
 private:
 	PhysicalOperator &ResolveAndPlan(unique_ptr<LogicalOperator> logical);
 	unique_ptr<PhysicalPlan> PlanInternal(LogicalOperator &logical);
+	//! Materialize structurally identical hash join build sides once and share them across the consuming joins
+	PhysicalOperator &ShareDuplicateJoinBuilds(PhysicalOperator &plan);
 	bool PreserveInsertionOrder(PhysicalOperator &plan);
 	bool UseBatchIndex(PhysicalOperator &plan);
 	optional_ptr<PhysicalOperator> PlanAsOfLoopJoin(LogicalComparisonJoin &op, PhysicalOperator &probe,
@@ -45,6 +45,11 @@ public:
 	          const unsafe_vector<idx_t> &filter) const;
 	void Combine(ExecutionContext &context, GlobalSinkState &gstate, LocalSinkState &lstate) const;
 	void Finalize(ClientContext &context, GlobalSinkState &gstate) const;
+	//! Fills this table by re-grouping the (combined but unscanned) data of a table that groups on a superset of
+	//! this table's grouping set, so that coarser grouping sets do not have to re-read the input.
+	//! Must be called before Finalize of either table
+	void CombineFromFinerTable(ClientContext &context, GlobalSinkState &gstate, const RadixPartitionedHashTable &finer,
+	                           GlobalSinkState &finer_gstate) const;
 
 public:
 	//! Source interface
@@ -21,6 +21,9 @@ struct RLOperatorState {
 	//! The feature vector used for prediction
 	vector<double> feature_vector;
 
+	//! Structural fingerprint of the operator's features (key into the cardinality feedback store)
+	uint64_t feature_fingerprint = 0;
+
 	//! The RL model's prediction
 	idx_t rl_predicted_cardinality = 0;
 
@@ -33,16 +36,20 @@ struct RLOperatorState {
 	//! Actual cardinality collected during execution (atomic for thread-safe updates)
 	std::atomic<idx_t> actual_cardinality;
 
+	//! The cardinality most recently published to the feedback store while the query is still
+	//! running (0 if no runtime misestimate has been detected yet)
+	std::atomic<idx_t> published_cardinality;
+
 	//! Whether actual cardinality has been collected
 	bool has_actual_cardinality = false;
 
-	RLOperatorState() : actual_cardinality(0) {
+	RLOperatorState() : actual_cardinality(0), published_cardinality(0) {
 	}
 
 	RLOperatorState(vector<double> features, idx_t rl_pred, idx_t duckdb_est)
 	    : feature_vector(std::move(features)), rl_predicted_cardinality(rl_pred),
 	      duckdb_estimated_cardinality(duckdb_est), has_rl_prediction(true),
-	      actual_cardinality(0), has_actual_cardinality(false) {
+	      actual_cardinality(0), published_cardinality(0), has_actual_cardinality(false) {
 	}
 
 	//! Add rows to the actual cardinality count (thread-safe)
@@ -196,6 +196,9 @@ public:
 	aggregate_finalize_t finalize;
 	//! The simple aggregate update function (may be null)
 	aggregate_simple_update_t simple_update;
+	//! The inverse of simple_update: takes previously added rows back out of a state (may be null).
+	//! Only set for aggregates where removal is exact, so sliding window frames can be updated incrementally.
+	aggregate_simple_update_t simple_remove = nullptr;
 	//! The windowed aggregate custom function (may be null)
 	aggregate_window_t window;
 	//! The windowed aggregate custom initialization function (may be null)
@@ -232,6 +235,10 @@ public:
 	bool CanWindow() const {
 		return window;
 	}
+	//! True if rows can be removed from a state again, so sliding frames can be evaluated incrementally
+	bool CanInvert() const {
+		return simple_update && simple_remove;
+	}
 
 public:
 	template <class STATE, class RESULT_TYPE, class OP>
@@ -63,6 +63,14 @@ struct DuckDBConstraintsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBQueryProgressFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
+struct DuckDBSchedulerStatsFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBSecretsFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -111,6 +119,10 @@ struct DuckDBMemoryFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBMemoryStatsFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBExternalFileCacheFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
@@ -135,6 +147,10 @@ struct DuckDBTablesFun {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
 
+struct DuckDBRLFeaturesFun {
+	static void RegisterFunction(BuiltinFunctions &set);
+};
+
 struct DuckDBTableSample {
 	static void RegisterFunction(BuiltinFunctions &set);
 };
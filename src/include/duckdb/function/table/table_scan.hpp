@@ -28,6 +28,10 @@ struct TableScanBindData : public TableFunctionData {
 	bool is_index_scan;
 	//! Whether or not the table scan is for index creation.
 	bool is_create_index;
+	//! The maximum number of rows this scan has to produce when a constant LIMIT sits directly on top of it,
+	//! or DConstants::INVALID_INDEX if the scan is unbounded. Installed during physical planning and used as a
+	//! shared row budget so that parallel scan tasks terminate early once the limit has been produced.
+	idx_t limit_rows = DConstants::INVALID_INDEX;
 
 public:
 	bool Equals(const FunctionData &other_p) const override {
@@ -38,6 +42,7 @@ public:
 		auto bind_data = make_uniq<TableScanBindData>(table);
 		bind_data->is_index_scan = is_index_scan;
 		bind_data->is_create_index = is_create_index;
+		bind_data->limit_rows = limit_rows;
 		bind_data->column_ids = column_ids;
 		return std::move(bind_data);
 	}
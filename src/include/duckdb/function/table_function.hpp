@@ -279,6 +279,7 @@ typedef unique_ptr<LocalTableFunctionState> (*table_function_init_local_t)(Execu
                                                                            GlobalTableFunctionState *global_state);
 typedef unique_ptr<BaseStatistics> (*table_statistics_t)(ClientContext &context, const FunctionData *bind_data,
                                                          column_t column_index);
+typedef bool (*table_statistics_exact_t)(ClientContext &context, const FunctionData *bind_data);
 typedef void (*table_function_t)(ClientContext &context, TableFunctionInput &data, DataChunk &output);
 typedef OperatorResultType (*table_in_out_function_t)(ExecutionContext &context, TableFunctionInput &data,
                                                       DataChunk &input, DataChunk &output);
@@ -369,6 +370,9 @@ public:
 	//! (Optional) statistics function
 	//! Returns the statistics of a specified column
 	table_statistics_t statistics;
+	//! (Optional) returns whether the min/max bounds in the column statistics are exact,
+	//! i.e. values that are currently present in the table (no outstanding updates or deletes)
+	table_statistics_exact_t statistics_exact;
 	//! (Optional) dependency function
 	//! Sets up which catalog entries this table function depend on
 	table_function_dependency_t dependency;
@@ -15,6 +15,7 @@
 
 namespace duckdb {
 class LogType;
+struct AsyncLogState;
 
 // Holds global logging state
 // - Handles configuration changes
@@ -52,6 +53,12 @@ public:
 
 	DUCKDB_API void SetConfig(DatabaseInstance &db, const LogConfig &config);
 	DUCKDB_API void SetEnableLogging(bool enable);
+	//! Enable/disable asynchronous logging: entries are queued by the logging thread and written to the
+	//! log storage by a background flusher thread. Entries are dropped when the queue is full.
+	DUCKDB_API void SetEnableAsyncLogging(bool enable);
+	DUCKDB_API bool AsyncLoggingEnabled() const;
+	//! The number of log entries dropped because the async queue was full
+	DUCKDB_API idx_t GetDroppedLogEntryCount() const;
 	DUCKDB_API void SetLogMode(LogMode mode);
 	DUCKDB_API void SetLogLevel(LogLevel level);
 	DUCKDB_API void SetEnabledLogTypes(optional_ptr<unordered_set<string>> enabled_log_types);
@@ -85,9 +92,23 @@ protected:
 
 	void SetConfigInternal(LogConfig config);
 
+	//! Main loop of the background flusher thread
+	void AsyncFlusherLoop();
+	//! Writes all queued entries to the log storage, returns whether any entries were written
+	bool DrainAsyncQueue();
+	//! Stops and joins the flusher thread. Must be called without holding the lock.
+	void StopAsyncFlusher();
+
 	mutex lock;
 	LogConfig config;
 
+	//! State of the async logging mode (queue, flusher thread, overflow accounting)
+	unique_ptr<AsyncLogState> async_state;
+	//! Whether log writes are currently deferred to the flusher thread
+	atomic<bool> async_enabled {false};
+	//! Number of entries dropped because the async queue was full
+	atomic<idx_t> dropped_log_entries {0};
+
 	shared_ptr<Logger> global_logger;
 
 	shared_ptr<LogStorage> log_storage;
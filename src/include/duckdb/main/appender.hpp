@@ -25,6 +25,24 @@ enum class AppenderType : uint8_t {
 	PHYSICAL // Cast input -> PhysicalType
 };
 
+//! A typed column of a row-batch append: references a caller-owned array of values laid out in
+//! the physical type of the column (e.g. int32_t for INTEGER, string_t for VARCHAR)
+struct AppendBatchColumn {
+	explicit AppendBatchColumn(data_ptr_t data, const bool *nulls = nullptr) : data(data), nulls(nulls) {
+	}
+
+	//! Wrap a typed caller-owned array
+	template <class T>
+	static AppendBatchColumn Typed(T *data_p, const bool *nulls_p = nullptr) {
+		return AppendBatchColumn(data_ptr_cast(data_p), nulls_p);
+	}
+
+	//! Pointer to the column values
+	data_ptr_t data;
+	//! Optional per-row null flags (nullptr if all rows are valid)
+	const bool *nulls;
+};
+
 //! The Appender class can be used to append elements to a table.
 class BaseAppender {
 public:
@@ -89,6 +107,11 @@ public:
 		return column;
 	}
 	DUCKDB_API void AppendDataChunk(DataChunk &value);
+	//! Append a batch of rows from caller-owned typed column arrays, bypassing per-value Value
+	//! construction: the arrays are referenced directly and copied into the buffered collection
+	//! once per vector-sized slice. They must match the physical types of the active columns and
+	//! stay alive for the duration of the call. Only flat (non-nested) types are supported.
+	DUCKDB_API void AppendRowBatch(const vector<AppendBatchColumn> &columns, idx_t count);
 
 	virtual void AppendDefault();
 	virtual void AppendDefault(DataChunk &chunk, idx_t col, idx_t row);
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/allocator.hpp"
 #include "duckdb/main/buffered_data/buffered_data.hpp"
 #include "duckdb/parallel/interrupt.hpp"
 #include "duckdb/common/queue.hpp"
@@ -22,6 +23,10 @@ class ClientContextLock;
 class SimpleBufferedData : public BufferedData {
 public:
 	static constexpr const BufferedData::Type TYPE = BufferedData::Type::SIMPLE;
+	//! Grow the buffer target after this many consecutive scans that drained the buffer completely
+	static constexpr const idx_t BUFFER_GROW_THRESHOLD = 2;
+	//! Shrink the buffer target after this many consecutive scans that left a significant backlog
+	static constexpr const idx_t BUFFER_SHRINK_THRESHOLD = 16;
 
 public:
 	explicit SimpleBufferedData(ClientContext &context);
@@ -38,15 +43,37 @@ public:
 		return buffer_size;
 	}
 
+private:
+	//! A parked chunk: either the chunk itself, or (in compressed buffering mode) its compressed serialization
+	struct BufferedChunk {
+		unique_ptr<DataChunk> chunk;
+		AllocatedData compressed_data;
+		idx_t uncompressed_size = 0;
+	};
+
+private:
+	BufferedChunk CompressChunk(const DataChunk &to_append);
+	unique_ptr<DataChunk> DecompressChunk(const BufferedChunk &buffered);
+	//! Adapt the buffer target to the observed production/consumption balance (requires glock)
+	void AdjustBufferSize(bool buffer_drained);
+
 private:
 	//! Our handles to reschedule the blocked sink tasks
 	queue<InterruptState> blocked_sinks;
 	//! The queue of chunks
-	queue<unique_ptr<DataChunk>> buffered_chunks;
-	//! The current capacity of the buffer (tuples)
+	queue<BufferedChunk> buffered_chunks;
+	//! Whether buffered chunks are compressed until they are fetched
+	bool compress_buffer;
+	//! The current size of the buffer (bytes)
 	atomic<idx_t> buffered_count;
-	//! The amount of tuples we should buffer
-	idx_t buffer_size;
+	//! The amount of bytes we aim to keep buffered - adapted between min_buffer_size and max_buffer_size
+	atomic<idx_t> buffer_size;
+	//! The bounds between which the buffer target can adapt
+	idx_t min_buffer_size;
+	idx_t max_buffer_size;
+	//! Consecutive scans that drained the buffer / found a backlog, used for hysteresis (protected by glock)
+	idx_t drained_scans = 0;
+	idx_t backlogged_scans = 0;
 };
 
 } // namespace duckdb
@@ -101,6 +101,9 @@ struct DuckDBResultData {
 	// Results can only use either the new API or the old API, not a mix of the two
 	// They start off as "none" and switch to one or the other when an API method is used
 	CAPIResultSetType result_set_type;
+	//! Chunk partially consumed by duckdb_fetch_columns, and the number of rows of it already consumed
+	unique_ptr<DataChunk> partial_chunk;
+	idx_t partial_offset = 0;
 };
 
 duckdb_type LogicalTypeIdToC(const LogicalTypeId type);
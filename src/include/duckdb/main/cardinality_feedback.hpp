@@ -0,0 +1,47 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/cardinality_feedback.hpp
+//
+// Feedback store mapping plan-node fingerprints to observed cardinalities
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+
+struct OperatorFeatures;
+
+//! Database-wide store of per-operator cardinalities observed during execution.
+//! After a query finishes, the actual cardinality of each instrumented operator is recorded
+//! under a fingerprint of the operator's structural features (operator type, table, predicates,
+//! join shape - everything EXCEPT the cardinality estimates themselves, so the fingerprint is
+//! stable across runs even when the estimates change). On the next planning of the same
+//! statement, the optimizer consults the store and uses the observed cardinality instead of
+//! the estimate, so chronically mis-estimated operators get corrected plans by the second run.
+class CardinalityFeedbackStore {
+public:
+	//! Compute the structural fingerprint of an operator's features
+	static uint64_t Fingerprint(const OperatorFeatures &features);
+
+	//! Record the cardinality observed for the given fingerprint during execution
+	void RecordObservation(uint64_t fingerprint, idx_t actual_cardinality);
+	//! Look up the most recently observed cardinality for the given fingerprint.
+	//! Returns false if this plan node has not been executed before.
+	bool TryGetObservation(uint64_t fingerprint, idx_t &actual_cardinality) const;
+
+private:
+	//! Maximum number of fingerprints we remember; new observations are dropped beyond this
+	static constexpr idx_t MAXIMUM_ENTRIES = 1ULL << 16ULL;
+
+private:
+	mutable mutex lock;
+	//! Fingerprint -> most recently observed cardinality
+	unordered_map<uint64_t, idx_t> observations;
+};
+
+} // namespace duckdb
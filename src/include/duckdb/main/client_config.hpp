@@ -82,6 +82,8 @@ struct ClientConfig {
 
 	//! The maximum amount of memory to keep buffered in a streaming query result. Default: 1mb.
 	idx_t streaming_buffer_size = 1000000;
+	//! Whether chunks buffered in a streaming query result are compressed until they are fetched. Default: false.
+	bool compress_streaming_buffer = false;
 
 	//! Callback to create a progress bar display
 	progress_bar_display_create_func_t display_create_func = nullptr;
@@ -121,6 +123,11 @@ public:
 
 	bool AnyVerification() const;
 
+	//! Returns a string that fingerprints every session-local setting and user variable that can change
+	//! how a statement text parses or binds - two sessions with the same fingerprint (and the same
+	//! default database and search path) bind the same text identically
+	string SessionSettingsFingerprint() const;
+
 	void SetUserVariable(const String &name, Value value);
 	bool GetUserVariable(const string &name, Value &result);
 	void ResetUserVariable(const String &name);
@@ -15,6 +15,7 @@ namespace duckdb {
 
 class AttachedDatabase;
 class BufferedFileWriter;
+class CatalogEntryCache;
 class ClientContext;
 class CatalogSearchPath;
 class FileOpener;
@@ -47,6 +48,8 @@ public:
 
 	//! The catalog search path.
 	unique_ptr<CatalogSearchPath> catalog_search_path;
+	//! The cache of resolved catalog entries (invalidated when the catalog version is bumped).
+	unique_ptr<CatalogEntryCache> catalog_entry_cache;
 	//! The file search path.
 	string file_search_path;
 
@@ -94,6 +94,10 @@ struct DBConfigOptions {
 	AccessMode access_mode = AccessMode::AUTOMATIC;
 	//! Checkpoint when WAL reaches this size (default: 16MB)
 	idx_t checkpoint_wal_size = 1 << 24;
+	//! Whether automatic checkpoints run on a background task instead of the committing thread
+	bool background_checkpoint = false;
+	//! Whether version cleanup runs on a background task instead of the committing thread
+	bool background_cleanup = false;
 	//! Whether or not to use Direct IO, bypassing operating system buffers
 	bool use_direct_io = false;
 	//! Whether extensions should be loaded on start-up
@@ -191,6 +195,12 @@ struct DBConfigOptions {
 	idx_t allocator_bulk_deallocation_flush_threshold = 536870912ULL;
 	//! Whether the allocator background thread is enabled
 	bool allocator_background_threads = false;
+	//! Decay delay (in ms) before the allocator returns unused dirty pages to the OS (-1 = allocator build default)
+	int64_t allocator_dirty_decay_ms = -1;
+	//! Decay delay (in ms) before the allocator returns unused muzzy pages to the OS (-1 = allocator build default)
+	int64_t allocator_muzzy_decay_ms = -1;
+	//! The active allocator memory profile (default, latency or footprint)
+	string allocator_memory_profile = "default";
 	//! DuckDB API surface
 	string duckdb_api;
 	//! Metadata from DuckDB callers
@@ -211,6 +221,8 @@ struct DBConfigOptions {
 	LogConfig log_config = LogConfig();
 	//! Whether to enable external file caching using CachingFileSystem
 	bool enable_external_file_cache = true;
+	//! Whether to cache materialized results of read-only queries and reuse them while the database is unchanged
+	bool enable_result_cache = false;
 	//! Partially process tasks before rescheduling - allows for more scheduler fairness between separate queries
 #ifdef DUCKDB_ALTERNATIVE_VERIFY
 	bool scheduler_process_partial = true;
@@ -0,0 +1,57 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/cost_calibration.hpp
+//
+// Machine-specific cost constants measured by calibration microbenchmarks
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+class FileSystem;
+
+//! Per-tuple costs (in nanoseconds) of the basic operations the planner reasons about.
+//! The defaults keep planning behavior unchanged; measured values only take effect once
+//! a calibration has run on this machine (calibrated = true).
+struct CostConstants {
+	//! Sequentially reading a tuple
+	double scan_ns_per_tuple = 1.0;
+	//! Inserting a tuple into a hash table
+	double hash_build_ns_per_tuple = 2.0;
+	//! Probing a hash table with a tuple
+	double hash_probe_ns_per_tuple = 1.0;
+	//! Copying a tuple into a materialized buffer
+	double materialization_ns_per_tuple = 1.0;
+	//! Whether these constants were measured on this machine (as opposed to the defaults)
+	bool calibrated = false;
+};
+
+//! Measures per-tuple scan, hash build, hash probe and materialization costs on the
+//! actual machine and persists the result in the user's .duckdb directory, where the
+//! join-order cost model and the temporary memory manager pick it up. Calibration is
+//! meant to run once per machine (e.g. at install time) via PRAGMA calibrate_cost_model;
+//! every later process loads the persisted constants on first use.
+class CostCalibration {
+public:
+	//! The constants for this machine: loaded from disk on first use, defaults when
+	//! no calibration has been persisted
+	DUCKDB_API static CostConstants Get(FileSystem &fs);
+	//! Run the calibration microbenchmarks, persist the result and return it
+	DUCKDB_API static CostConstants Calibrate(FileSystem &fs);
+	//! Path of the persisted calibration file (~/.duckdb/cost_calibration)
+	DUCKDB_API static string CalibrationFilePath(FileSystem &fs);
+
+private:
+	//! Load the persisted constants, or the defaults if the file is absent or malformed
+	static CostConstants Load(FileSystem &fs);
+	//! Persist the constants to the calibration file
+	static void Store(FileSystem &fs, const CostConstants &constants);
+	//! Run the microbenchmarks and return the measured constants
+	static CostConstants Measure();
+};
+
+} // namespace duckdb
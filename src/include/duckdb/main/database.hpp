@@ -29,12 +29,18 @@ class ExtensionManager;
 class FileSystem;
 class TaskScheduler;
 class ObjectCache;
+class QueryResultCache;
+class PreparedStatementCache;
+class MaterializedViewRegistry;
+class CardinalityFeedbackStore;
+class JoinOrderMemo;
 struct AttachInfo;
 struct AttachOptions;
 class DatabaseFileSystem;
 struct DatabaseCacheEntry;
 class LogManager;
 class ExternalFileCache;
+class RLCardinalityModel;
 
 class DatabaseInstance : public enable_shared_from_this<DatabaseInstance> {
 	friend class DuckDB;
@@ -55,6 +61,11 @@ public:
 	DUCKDB_API ExternalFileCache &GetExternalFileCache();
 	DUCKDB_API TaskScheduler &GetScheduler();
 	DUCKDB_API ObjectCache &GetObjectCache();
+	DUCKDB_API QueryResultCache &GetQueryResultCache();
+	DUCKDB_API PreparedStatementCache &GetPreparedStatementCache();
+	DUCKDB_API MaterializedViewRegistry &GetMaterializedViewRegistry();
+	DUCKDB_API CardinalityFeedbackStore &GetCardinalityFeedbackStore();
+	DUCKDB_API JoinOrderMemo &GetJoinOrderMemo();
 	DUCKDB_API ConnectionManager &GetConnectionManager();
 	DUCKDB_API ExtensionManager &GetExtensionManager();
 	DUCKDB_API ValidChecker &GetValidChecker();
@@ -80,6 +91,15 @@ public:
 	DUCKDB_API RLTrainingBuffer &GetRLTrainingBuffer();
 	//! Get RL training thread (for monitoring/control)
 	DUCKDB_API RLTrainingThread &GetRLTrainingThread();
+	//! Get this database's cardinality model for inference (may be the shared base model)
+	DUCKDB_API RLCardinalityModel &GetRLCardinalityModel();
+	//! Get this database's cardinality model for a training update. Detaches from the shared
+	//! base model on first call (copy-on-write) so tenants train independently.
+	DUCKDB_API RLCardinalityModel &GetRLCardinalityModelForUpdate();
+
+	//! Warm up the instance before it takes traffic: preload table metadata, pin the given hot tables
+	//! into the buffer pool, and refresh the cardinality model from its snapshot
+	DUCKDB_API void Warmup(const vector<string> &hot_tables = vector<string>());
 
 private:
 	void Initialize(const char *path, DBConfig *config);
@@ -93,6 +113,11 @@ private:
 	unique_ptr<DatabaseManager> db_manager;
 	unique_ptr<TaskScheduler> scheduler;
 	unique_ptr<ObjectCache> object_cache;
+	unique_ptr<QueryResultCache> query_result_cache;
+	unique_ptr<PreparedStatementCache> prepared_statement_cache;
+	unique_ptr<MaterializedViewRegistry> materialized_view_registry;
+	unique_ptr<CardinalityFeedbackStore> cardinality_feedback_store;
+	unique_ptr<JoinOrderMemo> join_order_memo;
 	unique_ptr<ConnectionManager> connection_manager;
 	unique_ptr<ExtensionManager> extension_manager;
 	ValidChecker db_validity;
@@ -103,6 +128,10 @@ private:
 	// RL training infrastructure
 	unique_ptr<RLTrainingBuffer> rl_training_buffer;
 	unique_ptr<RLTrainingThread> rl_training_thread;
+	//! Per-database cardinality model; initially shares the process base model and is
+	//! cloned lazily on the first training update (copy-on-write)
+	shared_ptr<RLCardinalityModel> rl_cardinality_model;
+	mutex rl_cardinality_model_lock;
 
 	duckdb_ext_api_v1 (*create_api_v1)();
 };
@@ -156,6 +185,8 @@ public:
 	DUCKDB_API static idx_t StandardVectorSize();
 	DUCKDB_API static string Platform();
 	DUCKDB_API bool ExtensionIsLoaded(const string &name);
+	//! Warm up the underlying database instance, see DatabaseInstance::Warmup
+	DUCKDB_API void Warmup(const vector<string> &hot_tables = vector<string>());
 };
 
 } // namespace duckdb
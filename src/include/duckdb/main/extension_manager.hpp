@@ -13,6 +13,7 @@
 
 namespace duckdb {
 class ErrorData;
+struct ProducerToken;
 
 class ExtensionInfo {
 public:
@@ -50,10 +51,27 @@ public:
 	DUCKDB_API static ExtensionManager &Get(DatabaseInstance &db);
 	DUCKDB_API static ExtensionManager &Get(ClientContext &context);
 
+	//! Record that an extension was loaded for this database - the usage history is persisted alongside the
+	//! database file and drives the speculative autoload on the next startup
+	void RecordExtensionUsage(const string &extension_name);
+	//! Asynchronously load the extensions in the usage history of this database, so that the first query
+	//! touching them does not block on extension loading
+	void StartSpeculativeAutoload();
+	//! Read the persisted extension usage history of this database
+	vector<string> ReadUsageHistory();
+
+private:
+	//! The path the extension usage history is persisted at (empty for in-memory databases)
+	string UsageHistoryPath() const;
+
 private:
 	DatabaseInstance &db;
 	mutex lock;
 	unordered_map<string, unique_ptr<ExtensionInfo>> loaded_extensions_info;
+	//! Lock protecting writes to the usage history file
+	mutex usage_history_lock;
+	//! Token for scheduling the speculative autoload task
+	unique_ptr<ProducerToken> autoload_producer;
 };
 
 } // namespace duckdb
@@ -0,0 +1,56 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/hardware_counters.hpp
+//
+// Per-thread hardware performance counter sampling for the profiler
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+
+namespace duckdb {
+
+//! A single sample (or delta) of the hardware counters we track per operator
+struct HardwareCounterSample {
+	uint64_t cycles = 0;
+	uint64_t llc_misses = 0;
+	uint64_t branch_misses = 0;
+};
+
+//! Samples CPU cycles, last-level cache misses and branch misses for the calling thread.
+//! On Linux this is backed by perf_event_open; on other platforms (or when the kernel
+//! denies access, e.g. restrictive perf_event_paranoid) Available() returns false and
+//! Start/Stop are no-ops, so the corresponding metrics simply stay at zero.
+//! One sampler exists per OperatorProfiler, i.e. per execution thread - the counters
+//! only measure the thread they were opened on.
+class HardwareCounterSampler {
+public:
+	HardwareCounterSampler();
+	~HardwareCounterSampler();
+
+	//! Whether hardware counters could be opened for this thread
+	bool Available() const {
+		return available;
+	}
+	//! Snapshot the counters at the start of an operator
+	void Start();
+	//! Return the counter deltas since the last Start
+	HardwareCounterSample Stop();
+
+private:
+	//! Read the current counter values (group read)
+	bool ReadCounters(HardwareCounterSample &sample);
+
+private:
+	bool available = false;
+	//! File descriptors of the perf events (cycles is the group leader); -1 when unopened
+	int cycles_fd = -1;
+	int llc_misses_fd = -1;
+	int branch_misses_fd = -1;
+	//! The counter values captured by the last Start
+	HardwareCounterSample start_sample;
+};
+
+} // namespace duckdb
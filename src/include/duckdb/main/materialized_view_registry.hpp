@@ -0,0 +1,51 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/materialized_view_registry.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/case_insensitive_map.hpp"
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+
+namespace duckdb {
+
+//! The definition of an incrementally maintained materialized view
+struct MaterializedViewDefinition {
+	//! The base table the view aggregates over
+	string base_table;
+	//! The GROUP BY columns, as written by the user (empty for a global aggregation)
+	string group_columns;
+	//! The aggregate select list, as written by the user
+	string aggregates;
+	//! The select list that merges the stored aggregate state with a freshly aggregated delta
+	string merge_aggregates;
+};
+
+//! The MaterializedViewRegistry tracks the materialized views created through
+//! PRAGMA create_materialized_view. A materialized view is backed by a regular table holding the
+//! aggregate state plus a row-id watermark; refreshing re-aggregates only the base table rows past
+//! the watermark and merges them into the stored state, so refresh cost is proportional to the
+//! number of appended rows rather than the size of the base table.
+//! The definitions live in memory only - after a restart the backing table still exists, but the
+//! view must be re-created before it can be refreshed again.
+class MaterializedViewRegistry {
+public:
+	//! Register a view definition - throws if a view with this name already exists
+	void CreateView(const string &name, MaterializedViewDefinition definition);
+	//! Get a view definition - throws if no view with this name exists
+	MaterializedViewDefinition GetView(const string &name);
+	//! Unregister a view definition - throws if no view with this name exists
+	void DropView(const string &name);
+
+private:
+	mutex lock;
+	//! The registered view definitions by view name
+	case_insensitive_map_t<MaterializedViewDefinition> views;
+};
+
+} // namespace duckdb
@@ -0,0 +1,55 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/prepared_statement_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+namespace duckdb {
+class ClientContext;
+class PreparedStatementData;
+
+//! PreparedStatementCache recycles prepared statement plans across connections, so preparing a
+//! statement that another connection already planned skips binding and optimization entirely.
+//! Plans are handed out exclusively: a plan cannot be executed by two connections at once because
+//! the operator states live inside the physical operators. A plan is returned to the cache when
+//! the prepared statement that borrowed it is destroyed. The same statement text binds differently
+//! under a different search path, default database or session settings (e.g. integer_division), so
+//! plans are keyed on the session binding state in addition to the text - see CreateCacheKey.
+//! Stale plans are not a correctness concern -
+//! the catalog version checks in PreparedStatementData::RequireRebind trigger a rebind at
+//! execution time, exactly as they do for long-lived prepared statements.
+class PreparedStatementCache {
+public:
+	//! The maximum total number of cached plans
+	static constexpr idx_t MAXIMUM_CACHED_PLANS = 256;
+	//! The maximum number of cached plans per statement text
+	static constexpr idx_t MAXIMUM_PLANS_PER_STATEMENT = 8;
+
+public:
+	//! Build the cache key for a statement text: the default database, the search path, a fingerprint
+	//! of the session settings and user variables that influence parsing and binding, and the
+	//! effective parser options, combined with the text itself
+	static string CreateCacheKey(ClientContext &context, const string &query);
+	//! Check out an idle plan for this cache key - returns nullptr on a miss
+	shared_ptr<PreparedStatementData> Checkout(const string &cache_key);
+	//! Return a plan so other connections can reuse it; plans that cannot safely be shared are dropped.
+	//! The plan is stored under the cache key it was bound under (PreparedStatementData::cache_key).
+	void Return(shared_ptr<PreparedStatementData> data);
+
+private:
+	mutex lock;
+	//! The idle plans per cache key
+	unordered_map<string, vector<shared_ptr<PreparedStatementData>>> cache;
+	//! The total number of cached plans
+	idx_t total_plans = 0;
+};
+
+} // namespace duckdb
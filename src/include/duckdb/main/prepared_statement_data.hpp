@@ -46,6 +46,11 @@ public:
 	bound_parameter_map_t value_map;
 	//! Whether we are creating a streaming result or not
 	bool is_streaming = false;
+	//! The key under which this plan can be stored in the shared PreparedStatementCache - this is the
+	//! statement text combined with the session binding state (default database and search path) it was
+	//! bound under, so sessions with different binding state never exchange plans. Empty if the plan was
+	//! not created through ClientContext::Prepare and is not eligible for sharing.
+	string cache_key;
 
 public:
 	void CheckParameterCount(idx_t parameter_count);
@@ -8,6 +8,7 @@
 
 #pragma once
 
+#include "duckdb/common/allocator.hpp"
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/deque.hpp"
 #include "duckdb/common/enums/profiler_format.hpp"
@@ -21,6 +22,7 @@
 #include "duckdb/common/winapi.hpp"
 #include "duckdb/execution/expression_executor_state.hpp"
 #include "duckdb/execution/physical_operator.hpp"
+#include "duckdb/main/hardware_counters.hpp"
 #include "duckdb/main/profiling_info.hpp"
 #include "duckdb/main/profiling_node.hpp"
 
@@ -48,6 +50,17 @@ struct OperatorInformation {
 	idx_t system_peak_buffer_manager_memory = 0;
 	idx_t system_peak_temp_directory_size = 0;
 	idx_t estimated_cardinality = 0;
+	//! Accumulated hardware counter deltas (zero if counters are unavailable)
+	HardwareCounterSample hardware_counters;
+	//! Total bytes allocated while the operator was active on this thread
+	uint64_t allocated_memory = 0;
+	//! The highest number of live bytes the operator held at any point on this thread.
+	//! Peaks are per active window, i.e. memory the operator keeps live across
+	//! GetChunk calls (e.g. a hash table) counts towards the window that built it.
+	uint64_t peak_live_memory = 0;
+	//! Time this thread spent suspended while the operator was blocked (waiting on I/O,
+	//! buffer eviction, or another async callback), as opposed to the compute time above
+	double wait_time = 0;
 
 	InsertionOrderPreservingMap<string> extra_info;
 
@@ -59,6 +72,19 @@ struct OperatorInformation {
 		elements_returned += n_elements;
 	}
 
+	void AddHardwareCounters(const HardwareCounterSample &sample) {
+		hardware_counters.cycles += sample.cycles;
+		hardware_counters.llc_misses += sample.llc_misses;
+		hardware_counters.branch_misses += sample.branch_misses;
+	}
+
+	void AddAllocationCounters(const ThreadAllocationCounters &counters) {
+		allocated_memory += counters.allocated_bytes;
+		if (counters.peak_live_bytes > 0 && static_cast<uint64_t>(counters.peak_live_bytes) > peak_live_memory) {
+			peak_live_memory = static_cast<uint64_t>(counters.peak_live_bytes);
+		}
+	}
+
 	void AddResultSetSize(idx_t n_result_set_size) {
 		result_set_size += n_result_set_size;
 	}
@@ -84,12 +110,18 @@ class OperatorProfiler {
 public:
 	DUCKDB_API explicit OperatorProfiler(ClientContext &context);
 	~OperatorProfiler() {
+		if (memory_profiling_enabled) {
+			// make sure the thread-local counter pointer does not outlive this profiler
+			Allocator::SetThreadAllocationCounters(nullptr);
+		}
 	}
 
 public:
 	DUCKDB_API void StartOperator(optional_ptr<const PhysicalOperator> phys_op);
 	DUCKDB_API void EndOperator(optional_ptr<DataChunk> chunk);
 	DUCKDB_API void FinishSource(GlobalSourceState &gstate, LocalSourceState &lstate);
+	//! Attributes time this thread spent suspended to the operator that blocked the pipeline
+	DUCKDB_API void AddWaitTime(const PhysicalOperator &phys_op, double wait_time);
 
 	//! Adds the timings in the OperatorProfiler (tree) to the QueryProfiler (tree).
 	DUCKDB_API void Flush(const PhysicalOperator &phys_op);
@@ -107,6 +139,14 @@ private:
 
 	//! The timer used to time the execution time of the individual Physical Operators
 	Profiler op;
+	//! Samples hardware counters at operator boundaries for this thread
+	HardwareCounterSampler hardware_counters;
+	//! Whether any hardware counter metric is enabled AND the counters could be opened
+	bool hardware_counters_enabled = false;
+	//! The allocation counters installed for this thread while an operator is active
+	ThreadAllocationCounters allocation_counters;
+	//! Whether any of the operator memory metrics is enabled
+	bool memory_profiling_enabled = false;
 	//! The stack of Physical Operators that are currently active
 	optional_ptr<const PhysicalOperator> active_operator;
 	//! A mapping of physical operators to profiled operator information.
@@ -115,7 +155,7 @@ private:
 
 //! Top level query metrics.
 struct QueryMetrics {
-	QueryMetrics() : total_bytes_read(0), total_bytes_written(0) {};
+	QueryMetrics() : total_bytes_read(0), total_bytes_written(0), spilled_bytes_baseline(0) {};
 
 	//! Reset the query metrics.
 	void Reset() {
@@ -127,6 +167,7 @@ struct QueryMetrics {
 		checkpoint_latency.Reset();
 		total_bytes_read = 0;
 		total_bytes_written = 0;
+		spilled_bytes_baseline = 0;
 	}
 
 	ProfilingInfo query_global_info;
@@ -147,6 +188,8 @@ struct QueryMetrics {
 	atomic<idx_t> total_bytes_read;
 	//! The total bytes written by the file system.
 	atomic<idx_t> total_bytes_written;
+	//! The cumulative spilled bytes of the buffer manager when the query started.
+	idx_t spilled_bytes_baseline;
 };
 
 //! QueryProfiler collects the profiling metrics of a query.
@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/query_result_cache.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/pair.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+
+namespace duckdb {
+class ClientContext;
+class LogicalOperator;
+
+//! The QueryResultCache caches materialized results of read-only queries so that repeated identical queries
+//! (e.g. dashboards polling the same statement) can be answered without re-execution.
+//! Cached entries are validated by comparing the last commit timestamp of every attached database - any commit
+//! to any database invalidates the affected entries on the next lookup.
+class QueryResultCache {
+public:
+	//! Returns whether the result of the given optimized plan may be cached - the plan must be free of
+	//! non-consistent functions (random(), now(), ...) and may only scan non-temporary base tables
+	static bool IsResultCacheable(LogicalOperator &plan);
+
+	//! Collects the last commit timestamp of every attached database, sorted by database name.
+	//! Returns false if any database does not support change detection.
+	static bool GetDatabaseVersions(ClientContext &context, vector<pair<string, transaction_t>> &versions);
+
+	//! Looks up a cached result for the given query under the given commit-version snapshot,
+	//! returning nullptr if there is no valid entry
+	unique_ptr<MaterializedQueryResult> GetResult(ClientContext &context, const string &query,
+	                                              const vector<pair<string, transaction_t>> &versions);
+	//! Caches the result of the given query, if it is eligible. The versions must be the commit-version
+	//! snapshot taken before the query executed - if a commit happened while the query ran, the result
+	//! could be stamped with a version it does not reflect, so it is not cached at all.
+	void CacheResult(ClientContext &context, const string &query, MaterializedQueryResult &result,
+	                 const vector<pair<string, transaction_t>> &versions);
+	//! Removes all cached results
+	void Clear();
+
+private:
+	struct CachedResult {
+		StatementType statement_type;
+		StatementProperties properties;
+		vector<string> names;
+		unique_ptr<ColumnDataCollection> collection;
+		//! The last commit timestamp of every attached database at the time the result was cached
+		vector<pair<string, transaction_t>> database_versions;
+	};
+
+	//! Builds the cache key for the given query - delegates to PreparedStatementCache::CreateCacheKey so
+	//! both caches key on the same session binding state (default database, search path, session settings)
+	static string GetCacheKey(ClientContext &context, const string &query);
+	static unique_ptr<ColumnDataCollection> CopyCollection(const ColumnDataCollection &collection);
+
+private:
+	//! The maximum number of cached results
+	static constexpr idx_t MAXIMUM_CACHED_RESULTS = 64;
+	//! The maximum size (in bytes) of a single cached result
+	static constexpr idx_t MAXIMUM_RESULT_SIZE = 1ULL << 24;
+
+	mutex lock;
+	unordered_map<string, CachedResult> cache;
+};
+
+} // namespace duckdb
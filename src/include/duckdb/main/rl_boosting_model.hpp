@@ -11,10 +11,12 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/shared_ptr.hpp"
 #include "duckdb/main/rl_training_buffer.hpp"
 #include <atomic>
 
 namespace duckdb {
+class RLQuantizedEnsemble;
 
 typedef void *DMatrixHandle;
 typedef void *BoosterHandle;
@@ -44,6 +46,18 @@ public:
 	double Predict(const vector<double> &features);
 	void PredictBatch(const vector<vector<double>> &feature_matrix, vector<double> &output);
 
+	//! Fast inference on the int8-quantized ensemble snapshot (no XGBoost call, no predict lock)
+	//! Falls back to Predict if no snapshot has been built yet
+	//! Used for latency-sensitive predictions where planning budget matters more than precision
+	double PredictQuantized(const vector<double> &features);
+
+	//! Get the current quantized snapshot (may be nullptr before the first booster swap)
+	shared_ptr<const RLQuantizedEnsemble> GetQuantizedEnsemble() const;
+
+	//! Get the ensemble-disagreement spread of a prediction (log-cardinality units)
+	//! Returns false when no quantized snapshot is available to measure it on
+	bool GetPredictionSpread(const vector<double> &features, double &log_spread);
+
 	//! Train incrementally: adds trees based on recent samples from sliding window
 	//! Uses synchronous training after each query
 	//! Thread-safe with exclusive write lock
@@ -70,6 +84,8 @@ public:
 
 private:
 	void InitializeBooster();
+	//! Rebuild the quantized snapshot from a booster; the caller must hold predict_lock
+	void RebuildQuantizedEnsemble(BoosterHandle booster);
 	BoosterHandle CloneBooster(BoosterHandle source);
 	void EnsureTrainingBooster();
 	DMatrixHandle CreateDMatrix(const vector<RLTrainingSample> &samples);
@@ -80,6 +96,10 @@ private:
 	mutable mutex predict_lock;
 	//! Serialize training updates (but do NOT block prediction)
 	mutable mutex train_lock;
+	//! Protects the quantized snapshot pointer (readers copy the shared_ptr and release immediately)
+	mutable mutex quantized_lock;
+	//! Immutable int8-quantized snapshot of the active booster, rebuilt on every booster swap
+	shared_ptr<const RLQuantizedEnsemble> quantized_ensemble;
 
 	// XGBoost handles
 	std::atomic<BoosterHandle> active_booster;
@@ -102,7 +122,7 @@ public:
 	static constexpr float DEFAULT_SUBSAMPLE = 0.8f;
 	static constexpr float DEFAULT_COLSAMPLE_BYTREE = 0.8f;
 	static constexpr int DEFAULT_MIN_CHILD_WEIGHT = 3;
-	static constexpr int FEATURE_VECTOR_SIZE = 80;     // Must match RLModelInterface
+	static constexpr int FEATURE_VECTOR_SIZE = 96;     // Must match RLModelInterface
 	static constexpr idx_t DEFAULT_MAX_TOTAL_TREES = 2000;
 
 private:
@@ -11,26 +11,31 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/shared_ptr.hpp"
 
 namespace duckdb {
 
 //! Multi-layer Perceptron for online reinforcement learning cardinality estimation
 //! Learns from query execution feedback (Q-error) to improve estimates over time
-//! Singleton pattern - one model instance shared across all queries
+//! A process-wide base model is shared between databases; each DatabaseInstance detaches
+//! its own copy on first training update (copy-on-write), so tenants train independently
 class RLCardinalityModel {
 public:
-	//! Get the singleton instance
+	RLCardinalityModel();
+	~RLCardinalityModel();
+
+	//! Get the process-wide base model (shared read-only between databases until they detach)
 	static RLCardinalityModel &Get();
+	//! Get the process-wide base model as a shared_ptr (for copy-on-write sharing)
+	static shared_ptr<RLCardinalityModel> GetBaseShared();
 
 	// Delete copy constructor and assignment operator
 	RLCardinalityModel(const RLCardinalityModel &) = delete;
 	RLCardinalityModel &operator=(const RLCardinalityModel &) = delete;
 
-private:
-	RLCardinalityModel();
-	~RLCardinalityModel();
+	//! Deep-copy this model's weights into a fresh instance
+	shared_ptr<RLCardinalityModel> Clone() const;
 
-public:
 
 	//! Perform inference: takes feature vector and returns estimated cardinality
 	//! Input: 64-dimensional feature vector
@@ -41,10 +46,27 @@ public:
 	//! Uses gradient descent to minimize Q-error
 	void Update(const vector<double> &features, idx_t actual_cardinality, idx_t predicted_cardinality);
 
-	//! Save/load model weights (optional, for checkpointing)
+	//! Save/load model weights as a versioned binary snapshot
 	void SaveWeights(const string &model_path);
 	void LoadWeights(const string &model_path);
 
+	//! Remember where this model should be persisted (set when a database is opened)
+	void SetSnapshotPath(const string &path) {
+		lock_guard<mutex> lock(model_lock);
+		snapshot_path = path;
+	}
+	//! Persist the model to the configured snapshot path (no-op if none is set)
+	void SaveSnapshot() {
+		string path;
+		{
+			lock_guard<mutex> lock(model_lock);
+			path = snapshot_path;
+		}
+		if (!path.empty()) {
+			SaveWeights(path);
+		}
+	}
+
 	//! Check if model is ready for inference
 	bool IsReady() const {
 		return initialized;
@@ -70,7 +92,11 @@ private:
 	// Learning rate for gradient descent
 	double learning_rate;
 
+	// Where to persist the model on shutdown (empty: no persistence)
+	string snapshot_path;
+
 	// Weight matrices and biases (protected by model_lock)
+	// Double precision is kept as the master copy used by training updates
 	vector<vector<double>> weights_input_hidden1;   // 64 x 128
 	vector<double> bias_hidden1;                     // 128
 	vector<vector<double>> weights_hidden1_hidden2;  // 128 x 128
@@ -80,6 +106,18 @@ private:
 	vector<vector<double>> weights_hidden3_output;   // 64 x 1
 	vector<double> bias_output;                      // 1
 
+	// Flat, row-major float32 copies of the weights used by the inference fast path
+	// (protected by model_lock, regenerated lazily after a training update)
+	vector<float> inference_weights1; // HIDDEN1_SIZE x INPUT_SIZE
+	vector<float> inference_bias1;    // HIDDEN1_SIZE
+	vector<float> inference_weights2; // HIDDEN2_SIZE x HIDDEN1_SIZE
+	vector<float> inference_bias2;    // HIDDEN2_SIZE
+	vector<float> inference_weights3; // HIDDEN3_SIZE x HIDDEN2_SIZE
+	vector<float> inference_bias3;    // HIDDEN3_SIZE
+	vector<float> inference_weights4; // OUTPUT_SIZE x HIDDEN3_SIZE
+	vector<float> inference_bias4;    // OUTPUT_SIZE
+	bool inference_weights_valid = false;
+
 	// Helper functions
 	void InitializeWeights();
 	double ReLU(double x) const;
@@ -88,6 +126,10 @@ private:
 	void AddBias(vector<double> &vec, const vector<double> &bias) const;
 	void ApplyReLU(vector<double> &vec) const;
 
+	// Inference fast path (caller must hold model_lock)
+	void SyncInferenceWeightsUnlocked();
+	float InferenceForwardPassUnlocked(const float *features) const;
+
 	// Forward and backward pass (caller must hold model_lock)
 	double ForwardPassUnlocked(const vector<double> &features,
 	                            vector<double> &hidden1_out,
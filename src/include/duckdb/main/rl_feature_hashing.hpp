@@ -0,0 +1,75 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/rl_feature_hashing.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_set.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+
+//! Hashed encoding of (table, column, comparison) predicate identity for the RL feature vector
+//! A fixed-width feature vector cannot give every column of a wide schema its own slot, so
+//! predicate tuples are hashed into a small bucket block instead; the distinct tuples per bucket
+//! are tracked so collisions are measurable and surfaced to the model as a feature.
+//! In addition, a count-min sketch keyed by the same tuple hash accumulates the selectivities
+//! observed for each predicate, giving the model a per-column selectivity summary that works
+//! for any schema without retraining.
+//! Singleton - predicate history is shared across all queries, like the model itself.
+class RLFeatureHashing {
+public:
+	//! Number of hash buckets in the feature vector's predicate identity block
+	static constexpr idx_t HASH_BUCKET_COUNT = 12;
+	//! Count-min sketch dimensions
+	static constexpr idx_t SKETCH_DEPTH = 4;
+	static constexpr idx_t SKETCH_WIDTH = 1024;
+	//! Cap on distinct tuples remembered per bucket for collision tracking
+	static constexpr idx_t MAX_TRACKED_TUPLES_PER_BUCKET = 64;
+
+	//! Get the singleton instance
+	static RLFeatureHashing &Get();
+
+	RLFeatureHashing(const RLFeatureHashing &) = delete;
+	RLFeatureHashing &operator=(const RLFeatureHashing &) = delete;
+
+	//! Hash a (table, column, comparison) predicate tuple
+	static uint64_t HashPredicate(const string &table_name, idx_t column_id, const string &comparison_type);
+	//! Bucket of a predicate tuple in the feature vector's hash block
+	static idx_t Bucket(uint64_t tuple_hash) {
+		return tuple_hash % HASH_BUCKET_COUNT;
+	}
+
+	//! Record a predicate occurrence and its (estimated) selectivity into the sketches
+	void RecordPredicate(uint64_t tuple_hash, double selectivity);
+
+	//! Estimate the mean selectivity observed for a predicate tuple
+	//! Returns false if the sketch has not seen the tuple yet
+	bool EstimateSelectivity(uint64_t tuple_hash, double &result) const;
+
+	//! Number of distinct predicate tuples that have hashed into a bucket (saturates at the cap)
+	idx_t GetBucketTupleCount(idx_t bucket) const;
+
+private:
+	RLFeatureHashing();
+
+	//! Row/cell of the sketch for a tuple hash at a given depth
+	static idx_t SketchCell(uint64_t tuple_hash, idx_t depth);
+
+private:
+	//! Protects the sketches and the collision registry
+	mutable mutex lock;
+	//! Count-min sketch: occurrence counts and summed selectivities per cell
+	vector<idx_t> sketch_counts;
+	vector<double> sketch_selectivity_sums;
+	//! Distinct tuple hashes seen per bucket (capped), for collision tracking
+	unordered_set<uint64_t> bucket_tuples[HASH_BUCKET_COUNT];
+};
+
+} // namespace duckdb
@@ -0,0 +1,70 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/rl_feature_recorder.hpp
+//
+// Structured in-memory capture of optimizer feature events for RL training
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/common/mutex.hpp"
+#include <deque>
+
+namespace duckdb {
+
+//! Where a feature row was captured
+enum class RLFeatureSource : uint8_t { TABLE_SCAN = 0, FILTER_STATISTICS = 1 };
+
+//! One fixed-width feature row. Numeric fields carry the payload; the small string
+//! fields identify the object the row refers to (no formatted text is built here).
+struct RLFeatureRow {
+	uint64_t timestamp_ms = 0;
+	RLFeatureSource source = RLFeatureSource::TABLE_SCAN;
+	string table_name;
+	string comparison_type;
+	idx_t base_cardinality = 0;
+	idx_t final_cardinality = 0;
+	idx_t num_filters = 0;
+	double selectivity = 1.0;
+	bool used_default_selectivity = false;
+};
+
+//! Bounded in-memory recorder for optimizer feature events.
+//! Replaces the old [RL FEATURE] Printer::Print logging: rows are appended as plain
+//! structs on the optimizer path (no string formatting) and exported through the
+//! duckdb_rl_features() table function instead of being parsed out of logs.
+class RLFeatureRecorder {
+public:
+	//! Get the singleton instance
+	static RLFeatureRecorder &Get();
+
+	RLFeatureRecorder(const RLFeatureRecorder &) = delete;
+	RLFeatureRecorder &operator=(const RLFeatureRecorder &) = delete;
+
+	//! Record a table-scan statistics event (called from relation statistics extraction)
+	void RecordTableScan(const string &table_name, idx_t base_cardinality, idx_t final_cardinality, idx_t num_filters,
+	                     bool used_default_selectivity);
+	//! Record a filter statistics-update event (called from statistics propagation)
+	void RecordFilterStatistics(const string &comparison_type);
+
+	//! Snapshot all recorded rows (for the duckdb_rl_features() table function)
+	vector<RLFeatureRow> GetRows() const;
+	//! Drop all recorded rows
+	void Clear();
+
+private:
+	RLFeatureRecorder() = default;
+
+	void Append(RLFeatureRow row);
+
+	//! Retain at most this many rows; older rows are evicted first
+	static constexpr idx_t MAX_ROWS = 1 << 16;
+
+	mutable mutex rows_lock;
+	std::deque<RLFeatureRow> rows;
+};
+
+} // namespace duckdb
@@ -81,6 +81,16 @@ struct OperatorFeatures {
 	string ToString() const;
 };
 
+//! Aggregated Q-error statistics of the RL model vs DuckDB's native estimator,
+//! accumulated over all operators observed since the last reset
+struct RLQErrorStats {
+	idx_t operator_count = 0;
+	double rl_q_error_sum = 0.0;
+	double rl_q_error_max = 0.0;
+	double duckdb_q_error_sum = 0.0;
+	double duckdb_q_error_max = 0.0;
+};
+
 //! Interface for RL model cardinality estimation
 class RLModelInterface {
 public:
@@ -98,6 +108,11 @@ public:
 	//! Returns 0 if a prediction is not available.
 	idx_t PredictPlanningCardinality(const OperatorFeatures &features);
 
+	//! Batched variant of PredictPlanningCardinality: evaluates a whole frontier of candidates
+	//! in a single model call, amortizing per-prediction overhead during plan enumeration.
+	//! Returns one prediction per input (0 where a prediction is not available).
+	vector<idx_t> PredictPlanningCardinalityBatch(const vector<OperatorFeatures> &features);
+
 	//! Reset per-thread prediction caches for the current connection.
 	//! Call this at query boundaries to avoid cache growth across long sessions.
 	static void ResetPredictionCachesForThread();
@@ -123,6 +138,15 @@ public:
 	void CollectActualCardinalities(PhysicalOperator &root_operator, class QueryProfiler &profiler,
 	                                 RLTrainingBuffer &buffer);
 
+	//! Globally enable/disable model predictions at runtime (all call sites fall back to
+	//! DuckDB's native estimates while disabled). Used by the offline evaluation harness
+	//! to compare plans with the model on and off; initial value comes from RL_DISABLE_MODEL.
+	DUCKDB_API static void SetModelEnabled(bool enabled);
+	DUCKDB_API static bool ModelEnabled();
+
+	//! Snapshot the accumulated Q-error statistics, optionally resetting the accumulator
+	DUCKDB_API static RLQErrorStats SnapshotQErrorStats(bool reset);
+
 private:
 	ClientContext &context;
 	bool enabled;
@@ -138,8 +162,9 @@ private:
 	// - Aggregate features (4)
 	// - Filter features (2)
 	// - Context+extra features (13)
-	// Total: 80
-	static constexpr idx_t FEATURE_VECTOR_SIZE = 80;
+	// - Hashed predicate identity block (12 buckets + 3 sketch/collision features)
+	// Total: 91 (padded to 96)
+	static constexpr idx_t FEATURE_VECTOR_SIZE = 96;
 };
 
 } // namespace duckdb
@@ -0,0 +1,72 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/rl_quantized_ensemble.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/main/rl_boosting_model.hpp"
+
+namespace duckdb {
+
+//! Int8-quantized snapshot of the boosting ensemble for planning-budget inference
+//! Split thresholds are quantized per feature to int8 and all trees share a flat
+//! structure-of-arrays node pool, so a prediction is a handful of small sequential
+//! arrays walked without any XGBoost calls (and without taking the predict lock).
+//! Snapshots are immutable after Build - concurrent readers need no synchronization.
+class RLQuantizedEnsemble {
+public:
+	//! Feature count must match the full model
+	static constexpr idx_t FEATURE_COUNT = RLBoostingModel::FEATURE_VECTOR_SIZE;
+	//! Feature index marking a leaf node
+	static constexpr uint8_t LEAF_MARKER = 0xFF;
+
+	//! Build a quantized snapshot from the per-tree JSON dumps of an XGBoost booster
+	//! (XGBoosterDumpModelEx with format "json") and the booster config JSON
+	//! (XGBoosterSaveConfig, used to recover the base score).
+	//! Returns nullptr if the dump cannot be parsed.
+	static unique_ptr<RLQuantizedEnsemble> Build(const char **tree_dumps, idx_t tree_count, const char *config_json);
+
+	//! Evaluate the ensemble on a feature vector
+	//! Output: predicted cardinality, post-processed the same way as RLBoostingModel::Predict
+	double Predict(const vector<double> &features) const;
+
+	//! Evaluate the ensemble and also report the dispersion of the per-tree contributions
+	//! to the log prediction (stddev of the leaf values scaled by sqrt(tree count)).
+	//! A large spread means the trees disagree - a cheap confidence proxy.
+	double PredictWithSpread(const vector<double> &features, double &log_spread) const;
+
+	//! Number of trees in the snapshot
+	idx_t GetTreeCount() const {
+		return tree_roots.size();
+	}
+
+private:
+	RLQuantizedEnsemble() : base_score(0.0) {
+	}
+
+	//! Quantize a raw feature value with the per-feature affine mapping
+	inline int8_t QuantizeFeature(idx_t feature, double value) const;
+
+private:
+	//! SoA node pool shared by all trees; leaves have feature_index == LEAF_MARKER
+	vector<uint8_t> node_feature;
+	vector<int8_t> node_threshold;
+	vector<uint32_t> node_left;
+	vector<uint32_t> node_right;
+	vector<float> node_leaf_value;
+	//! Root node of each tree in the pool
+	vector<uint32_t> tree_roots;
+	//! Per-feature affine quantization: q = round((value - offset) * scale)
+	double feature_offset[FEATURE_COUNT];
+	double feature_scale[FEATURE_COUNT];
+	//! Global bias of the booster (added to the summed leaf values)
+	double base_score;
+};
+
+} // namespace duckdb
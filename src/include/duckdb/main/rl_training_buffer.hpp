@@ -11,6 +11,8 @@
 #include "duckdb/common/common.hpp"
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/mutex.hpp"
+#include "duckdb/common/atomic.hpp"
+#include "duckdb/common/unique_ptr.hpp"
 #include <deque>
 
 namespace duckdb {
@@ -20,12 +22,14 @@ struct RLTrainingSample {
 	vector<double> features;           // Feature vector (must match RLBoostingModel input size)
 	idx_t actual_cardinality;          // Ground truth from execution
 	idx_t predicted_cardinality;       // Model's prediction
+	idx_t duckdb_estimated_cardinality; // The native estimator's prediction (0 if unknown),
+	                                    // kept so training can learn from disagreements
 	double q_error;                    // Quality metric
 	uint64_t timestamp_ms;             // For prioritization/aging
 
-	RLTrainingSample(vector<double> feat, idx_t actual, idx_t predicted)
+	RLTrainingSample(vector<double> feat, idx_t actual, idx_t predicted, idx_t duckdb_estimate = 0)
 	    : features(std::move(feat)), actual_cardinality(actual),
-	      predicted_cardinality(predicted), timestamp_ms(0) {
+	      predicted_cardinality(predicted), duckdb_estimated_cardinality(duckdb_estimate), timestamp_ms(0) {
 		// Compute Q-error
 		q_error = std::max(
 			static_cast<double>(actual) / std::max(static_cast<double>(predicted), 1.0),
@@ -34,14 +38,19 @@ struct RLTrainingSample {
 	}
 };
 
-//! Thread-safe circular buffer for experience replay
+//! Circular buffer for experience replay.
+//! Producers (query threads) enqueue samples through a bounded lock-free ring so that
+//! recording feedback never blocks query completion; when the background trainer falls
+//! behind and the ring fills up, new samples are dropped instead of waiting.
+//! The trainer drains the ring into the replay window (a deque) on its own thread.
 class RLTrainingBuffer {
 public:
 	RLTrainingBuffer(idx_t max_size = 10000);
 	~RLTrainingBuffer();
 
-	//! Add a training sample (called from query execution thread)
-	void AddSample(const vector<double> &features, idx_t actual_cardinality, idx_t predicted_cardinality);
+	//! Add a training sample (called from query execution thread; wait-free, may drop)
+	void AddSample(const vector<double> &features, idx_t actual_cardinality, idx_t predicted_cardinality,
+	               idx_t duckdb_estimated_cardinality = 0);
 
 	//! Get a batch of samples for training (called from background thread)
 	//! Returns empty vector if buffer is empty
@@ -56,13 +65,38 @@ public:
 	idx_t Capacity() const;
 	bool IsEmpty() const;
 	double AverageQError() const;
+	//! Number of samples dropped because the ingest ring was full
+	idx_t DroppedSamples() const;
 
 private:
+	//! Bounded MPMC ring slot (Vyukov-style): the sequence number encodes whether the
+	//! slot is free for the producer (seq == pos) or holds data for the consumer (seq == pos + 1)
+	struct RingSlot {
+		atomic<idx_t> sequence;
+		RLTrainingSample *sample;
+	};
+
+	//! Ingest ring capacity (must be a power of two)
+	static constexpr idx_t RING_CAPACITY = 1024;
+
+	//! Try to enqueue a sample into the ingest ring; returns false when the ring is full
+	bool TryEnqueue(RLTrainingSample *sample);
+	//! Try to dequeue a sample from the ingest ring; returns nullptr when the ring is empty
+	RLTrainingSample *TryDequeue();
+	//! Drain all pending ring samples into the replay window (caller must hold buffer_lock)
+	void DrainRingUnlocked();
+
 	mutable mutex buffer_lock;
 	std::deque<RLTrainingSample> buffer;
 	idx_t max_size;
 
-	// Statistics
+	// Lock-free ingest ring (query threads -> trainer)
+	unique_ptr<RingSlot[]> ring;
+	atomic<idx_t> enqueue_pos;
+	atomic<idx_t> dequeue_pos;
+	atomic<idx_t> dropped_samples;
+
+	// Statistics (protected by buffer_lock)
 	double running_q_error_sum;
 	idx_t sample_count;
 };
@@ -0,0 +1,60 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/rl_training_task.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/vector.hpp"
+#include "duckdb/main/rl_training_buffer.hpp"
+#include "duckdb/parallel/task.hpp"
+
+namespace duckdb {
+class DatabaseInstance;
+
+//! Background training of the boosting cardinality model, scheduled through the TaskScheduler
+//! instead of running inline on a query thread. The task trains in mini-batches and checks the
+//! scheduler's pending task count before each one: while query tasks are waiting for workers,
+//! training defers itself back to the queue so it only consumes cycles the workers have spare.
+class RLTrainingTask : public Task {
+public:
+	RLTrainingTask(DatabaseInstance &db, vector<RLTrainingSample> samples_p);
+
+	//! Schedule a training task over the given sample window
+	//! Returns false (dropping the window - the samples remain in the training buffer)
+	//! if a training task is already queued or running
+	static bool Schedule(DatabaseInstance &db, vector<RLTrainingSample> samples);
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override;
+
+	string TaskType() const override {
+		return "RLTrainingTask";
+	}
+
+private:
+	//! Whether query tasks are currently waiting for a worker
+	bool SchedulerBusy() const;
+	//! Put this task back at the end of the scheduler queue
+	void Defer();
+
+private:
+	DatabaseInstance &db;
+	//! The sample window to train on
+	vector<RLTrainingSample> samples;
+	//! Start of the next mini-batch within the window
+	idx_t batch_offset = 0;
+	//! How often this task has deferred itself so far (bounded to guarantee progress)
+	idx_t deferral_count = 0;
+	//! Mini-batch size (0 trains the whole window in one batch)
+	idx_t mini_batch_size;
+	//! Defer while at least this many tasks are pending in the scheduler queue
+	idx_t queue_threshold;
+	//! Maximum number of deferrals before training proceeds regardless of load
+	idx_t max_deferrals;
+};
+
+} // namespace duckdb
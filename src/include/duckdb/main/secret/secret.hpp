@@ -321,8 +321,8 @@ protected:
 
 	//! Fetching the secret
 	optional_ptr<const KeyValueSecret> secret;
-	//! Optionally an owning pointer to the secret entry
-	shared_ptr<SecretEntry> secret_entry;
+	//! Optionally an owning pointer to the (immutable, possibly cached) secret entry
+	shared_ptr<const SecretEntry> secret_entry;
 
 	//! Secrets/settings will be fetched either through a context (local + global settings) or a databaseinstance
 	//! (global only)
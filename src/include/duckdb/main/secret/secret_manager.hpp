@@ -9,7 +9,9 @@
 #pragma once
 
 #include "duckdb/catalog/default/default_generator.hpp"
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/common.hpp"
+#include "duckdb/common/unordered_map.hpp"
 #include "duckdb/main/secret/secret.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/main/secret/secret_storage.hpp"
@@ -70,6 +72,28 @@ public:
 	int64_t score;
 };
 
+//! An immutable, shared snapshot of a secret lookup
+//! Hot paths (e.g. per-request credential resolution in remote file systems) read these instead of re-resolving
+//! the secret through the secret storages and cloning it on every request
+struct CachedSecretMatch {
+public:
+	//! Get the secret - only valid if HasMatch
+	const BaseSecret &GetSecret() const {
+		return *secret_entry->secret;
+	}
+
+	bool HasMatch() const {
+		return secret_entry != nullptr;
+	}
+
+	//! The matched secret entry (null if the lookup found no match)
+	shared_ptr<const SecretEntry> secret_entry;
+	//! The score of the match
+	int64_t score = NumericLimits<int64_t>::Minimum();
+	//! When the lookup was resolved - lookups are re-resolved after the cache TTL expires
+	time_point<steady_clock> resolved_at;
+};
+
 struct SecretManagerConfig {
 	static constexpr const bool DEFAULT_ALLOW_PERSISTENT_SECRETS = true;
 	//! The default persistence type for secrets
@@ -124,6 +148,11 @@ public:
 	DUCKDB_API BoundStatement BindCreateSecret(CatalogTransaction transaction, CreateSecretInput &info);
 	//! Lookup the best matching secret by matching the secret scopes to the path
 	DUCKDB_API SecretMatch LookupSecret(CatalogTransaction transaction, const string &path, const string &type);
+	//! Lookup the best matching secret through the lookup cache, returning an immutable shared snapshot
+	//! The cache avoids scanning the secret storages and cloning the secret on every request; entries are
+	//! re-resolved after a TTL and the cache is invalidated whenever a secret is created or dropped
+	DUCKDB_API CachedSecretMatch LookupSecretCached(CatalogTransaction transaction, const string &path,
+	                                                const string &type);
 	//! Get a secret by name, optionally from a specific storage
 	DUCKDB_API unique_ptr<SecretEntry> GetSecretByName(CatalogTransaction transaction, const string &name,
 	                                                   const string &storage = "");
@@ -192,6 +221,16 @@ private:
 	//! Throw an exception if the secret manager is initialized
 	void ThrowOnSettingChangeIfInitialized();
 
+	//! Drop all cached secret lookups - called whenever a secret is created or dropped
+	void InvalidateSecretLookupCache();
+
+	//! TTL after which cached secret lookups are re-resolved - persistent storages can change behind our back
+	static constexpr uint64_t SECRET_LOOKUP_CACHE_TTL_SECONDS = 60;
+
+	//! Lock for the secret lookup cache
+	mutex lookup_cache_lock;
+	//! Cache of resolved secret lookups by type/path
+	unordered_map<string, CachedSecretMatch> lookup_cache;
 	//! Lock for types, functions, settings and storages
 	mutex manager_lock;
 	//! Secret functions;
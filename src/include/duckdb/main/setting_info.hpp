@@ -86,7 +86,9 @@ struct ConfigurationOption {
 
 struct ConfigurationAlias {
 	const char *alias;
-	idx_t option_index;
+	//! The name of the setting this alias targets - resolved by name so that inserting new settings
+	//! into the option list cannot silently retarget an alias
+	const char *target;
 };
 
 typedef void (*set_option_callback_t)(ClientContext &context, SetScope scope, Value &parameter);
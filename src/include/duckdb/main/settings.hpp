@@ -63,6 +63,17 @@ struct AllocatorBulkDeallocationFlushThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct AllocatorDirtyDecayMsSetting {
+	using RETURN_TYPE = int64_t;
+	static constexpr const char *Name = "allocator_dirty_decay_ms";
+	static constexpr const char *Description =
+	    "Decay delay (in ms) before the allocator returns unused dirty pages to the OS (-1 = allocator default).";
+	static constexpr const char *InputType = "BIGINT";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct AllocatorFlushThresholdSetting {
 	using RETURN_TYPE = string;
 	static constexpr const char *Name = "allocator_flush_threshold";
@@ -74,6 +85,28 @@ struct AllocatorFlushThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct AllocatorMemoryProfileSetting {
+	using RETURN_TYPE = string;
+	static constexpr const char *Name = "allocator_memory_profile";
+	static constexpr const char *Description =
+	    "Workload profile for the allocator (DEFAULT, LATENCY or FOOTPRINT), trading page reuse against RSS.";
+	static constexpr const char *InputType = "VARCHAR";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct AllocatorMuzzyDecayMsSetting {
+	using RETURN_TYPE = int64_t;
+	static constexpr const char *Name = "allocator_muzzy_decay_ms";
+	static constexpr const char *Description =
+	    "Decay delay (in ms) before the allocator returns unused muzzy pages to the OS (-1 = allocator default).";
+	static constexpr const char *InputType = "BIGINT";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct AllowCommunityExtensionsSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "allow_community_extensions";
@@ -206,6 +239,16 @@ struct ArrowOutputVersionSetting {
 	static void OnSet(SettingCallbackInfo &info, Value &input);
 };
 
+struct ArrowZeroCopyExportSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "arrow_zero_copy_export";
+	static constexpr const char *Description =
+	    "Whether export to Arrow format may hand vector buffers to the ArrowArray directly instead of copying them";
+	static constexpr const char *InputType = "BOOLEAN";
+	static constexpr const char *DefaultValue = "false";
+	static constexpr SetScope DefaultScope = SetScope::GLOBAL;
+};
+
 struct AsofLoopJoinThresholdSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "asof_loop_join_threshold";
@@ -249,6 +292,39 @@ struct AutoloadKnownExtensionsSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct BackgroundCheckpointSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "background_checkpoint";
+	static constexpr const char *Description =
+	    "Whether automatic checkpoints run on a background task instead of the committing thread";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct BackgroundCleanupSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "background_cleanup";
+	static constexpr const char *Description =
+	    "Whether version cleanup of committed transactions runs on a background task instead of the committing thread";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct BatchInsertDirectFlushSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "batch_insert_direct_flush";
+	static constexpr const char *Description =
+	    "Batch inserts write each batch's row groups to disk directly from the inserting thread instead of merging "
+	    "neighboring batches into full row groups first; scales better with threads but can produce smaller row groups";
+	static constexpr const char *InputType = "BOOLEAN";
+	static constexpr const char *DefaultValue = "false";
+	static constexpr SetScope DefaultScope = SetScope::GLOBAL;
+};
+
 struct CatalogErrorMaxSchemasSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "catalog_error_max_schemas";
@@ -270,6 +346,29 @@ struct CheckpointThresholdSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct CompressStreamingBufferSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "compress_streaming_buffer";
+	static constexpr const char *Description =
+	    "Whether chunks buffered in a streaming query result are compressed until they are fetched";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetLocal(ClientContext &context, const Value &parameter);
+	static void ResetLocal(ClientContext &context);
+	static Value GetSetting(const ClientContext &context);
+};
+
+struct CompressionScanBiasSetting {
+	using RETURN_TYPE = double;
+	static constexpr const char *Name = "compression_scan_bias";
+	static constexpr const char *Description =
+	    "Weight within [0, 1] that biases checkpoint compression selection towards decode speed over compressed size "
+	    "(0 picks the smallest encoding, 1 fully weighs the relative decode cost of each method)";
+	static constexpr const char *InputType = "DOUBLE";
+	static constexpr const char *DefaultValue = "0";
+	static constexpr SetScope DefaultScope = SetScope::GLOBAL;
+	static void OnSet(SettingCallbackInfo &info, Value &input);
+};
+
 struct CustomExtensionRepositorySetting {
 	using RETURN_TYPE = string;
 	static constexpr const char *Name = "custom_extension_repository";
@@ -421,6 +520,20 @@ struct DefaultSecretStorageSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct DirectIOSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "direct_io";
+	static constexpr const char *Description =
+	    "Use direct I/O (bypassing the operating system page cache) for database and temporary files, making the "
+	    "buffer pool the only cache. Must be set before the database is started.";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static bool OnGlobalSet(DatabaseInstance *db, DBConfig &config, const Value &input);
+	static bool OnGlobalReset(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct DisableDatabaseInvalidationSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "disable_database_invalidation";
@@ -568,6 +681,17 @@ struct EnableLogging {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableLoggingAsync {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "enable_logging_async";
+	static constexpr const char *Description =
+	    "Queues log entries and writes them to the log storage on a background thread";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableMacroDependenciesSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "enable_macro_dependencies";
@@ -622,6 +746,17 @@ struct EnableProgressBarPrintSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct EnableResultCacheSetting {
+	using RETURN_TYPE = bool;
+	static constexpr const char *Name = "enable_result_cache";
+	static constexpr const char *Description =
+	    "Cache materialized results of read-only queries and reuse them when the database has not changed";
+	static constexpr const char *InputType = "BOOLEAN";
+	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
+	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
+	static Value GetSetting(const ClientContext &context);
+};
+
 struct EnableViewDependenciesSetting {
 	using RETURN_TYPE = bool;
 	static constexpr const char *Name = "enable_view_dependencies";
@@ -1033,7 +1168,7 @@ struct PinThreadsSetting {
 	using RETURN_TYPE = ThreadPinMode;
 	static constexpr const char *Name = "pin_threads";
 	static constexpr const char *Description =
-	    "Whether to pin threads to cores (Linux only, default AUTO: on when there are more than 64 cores)";
+	    "Whether to pin threads to cores (Linux only, default AUTO: on when there are more than 64 cores); NUMA binds workers round-robin to NUMA nodes";
 	static constexpr const char *InputType = "VARCHAR";
 	static void SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &parameter);
 	static void ResetGlobal(DatabaseInstance *db, DBConfig &config);
@@ -1265,6 +1400,16 @@ struct UsernameSetting {
 	static Value GetSetting(const ClientContext &context);
 };
 
+struct WALGroupCommitWaitSetting {
+	using RETURN_TYPE = idx_t;
+	static constexpr const char *Name = "wal_group_commit_wait_us";
+	static constexpr const char *Description =
+	    "Microseconds a committing transaction waits for other commits to join its WAL fsync (0 disables group commit)";
+	static constexpr const char *InputType = "UBIGINT";
+	static constexpr const char *DefaultValue = "0";
+	static constexpr SetScope DefaultScope = SetScope::GLOBAL;
+};
+
 struct WriteBufferRowGroupCountSetting {
 	using RETURN_TYPE = idx_t;
 	static constexpr const char *Name = "write_buffer_row_group_count";
@@ -34,6 +34,9 @@ private:
 
 	//! Main method to extract common subexpressions
 	void ExtractCommonSubExpresions(LogicalOperator &op);
+	//! Extract subexpressions that a projection shares with the filter directly below it, pushing a projection that
+	//! computes them once under the filter
+	void ExtractCrossOperatorCSEs(LogicalOperator &op, LogicalOperator &filter);
 
 private:
 	Binder &binder;
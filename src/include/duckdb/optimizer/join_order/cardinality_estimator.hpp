@@ -17,6 +17,7 @@ namespace duckdb {
 
 class FilterInfo;
 class ClientContext;
+struct OperatorFeatures;
 
 struct DenomInfo {
 	DenomInfo(JoinRelationSet &numerator_relations, double filter_strength, double denominator)
@@ -116,6 +117,11 @@ public:
 	template <class T>
 	T EstimateCardinalityWithSet(JoinRelationSet &new_set);
 
+	//! Batch-estimate cardinalities for a frontier of candidate join sets, priming the per-set
+	//! cache so subsequent EstimateCardinalityWithSet calls hit. Evaluates the RL model once for
+	//! the whole batch instead of once per candidate pair.
+	void PrimeCardinalityEstimates(const vector<reference<JoinRelationSet>> &sets);
+
 	//! used for debugging.
 	void AddRelationNamesToTdoms(vector<RelationStats> &stats);
 	void PrintRelationToTdomInfo();
@@ -123,6 +129,8 @@ public:
 private:
 	double GetNumerator(JoinRelationSet &set);
 	DenomInfo GetDenominator(JoinRelationSet &set);
+	//! Build the model feature vector describing a candidate join set
+	OperatorFeatures BuildJoinSetFeatures(JoinRelationSet &new_set, double numerator, double denominator);
 
 	bool SingleColumnFilter(FilterInfo &filter_info);
 	vector<idx_t> DetermineMatchingEquivalentSets(optional_ptr<FilterInfo> filter_info);
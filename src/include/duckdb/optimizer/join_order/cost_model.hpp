@@ -9,6 +9,7 @@
 
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/common/enums/join_type.hpp"
+#include "duckdb/main/cost_calibration.hpp"
 #include "duckdb/optimizer/join_order/cardinality_estimator.hpp"
 
 namespace duckdb {
@@ -33,6 +34,8 @@ public:
 	CardinalityEstimator cardinality_estimator;
 
 private:
+	//! Per-tuple cost constants calibrated for this machine (defaults when uncalibrated)
+	CostConstants cost_constants;
 };
 
 } // namespace duckdb
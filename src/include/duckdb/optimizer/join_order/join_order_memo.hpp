@@ -0,0 +1,54 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_order/join_order_memo.hpp
+//
+// Memo mapping query-structure fingerprints to enumerated join orders
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/common/common.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+#include "duckdb/common/vector.hpp"
+
+namespace duckdb {
+
+//! One merge step of a memoized join order: the relation indexes on either side of the join
+struct JoinOrderMemoMerge {
+	vector<idx_t> left;
+	vector<idx_t> right;
+};
+
+//! A memoized join order: the sequence of merges that produced the final plan, in bottom-up order
+struct JoinOrderMemoEntry {
+	vector<JoinOrderMemoMerge> merges;
+};
+
+//! Database-wide memo of join orders found by the plan enumerator. Templated workloads issue
+//! thousands of structurally identical queries that differ only in their literals; the join order
+//! the enumerator finds for one of them is almost always the right one for the rest. The memo is
+//! keyed on a fingerprint of the query graph's structure (relations, join edges and predicate
+//! shapes - everything EXCEPT the literal values), so a structurally identical query replays the
+//! memoized merge sequence and only re-costs it against its own statistics, instead of
+//! re-enumerating the search space from scratch.
+class JoinOrderMemo {
+public:
+	//! Record the join order found for the given fingerprint
+	void Record(uint64_t fingerprint, JoinOrderMemoEntry entry);
+	//! Look up the memoized join order for the given fingerprint.
+	//! Returns false if no structurally identical query has been optimized before.
+	bool TryGet(uint64_t fingerprint, JoinOrderMemoEntry &entry) const;
+
+private:
+	//! Maximum number of fingerprints we remember; new entries are dropped beyond this
+	static constexpr idx_t MAXIMUM_ENTRIES = 1ULL << 12ULL;
+
+private:
+	mutable mutex lock;
+	//! Fingerprint -> memoized join order
+	unordered_map<uint64_t, JoinOrderMemoEntry> entries;
+};
+
+} // namespace duckdb
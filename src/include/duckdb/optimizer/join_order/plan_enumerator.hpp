@@ -14,6 +14,7 @@
 #include "duckdb/optimizer/join_order/cardinality_estimator.hpp"
 #include "duckdb/optimizer/join_order/query_graph.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
+#include "duckdb/optimizer/join_order/join_order_memo.hpp"
 #include "duckdb/optimizer/join_order/cost_model.hpp"
 #include "duckdb/parser/expression_map.hpp"
 #include "duckdb/common/reference_map.hpp"
@@ -34,11 +35,24 @@ public:
 	}
 
 	static constexpr idx_t THRESHOLD_TO_SWAP_TO_APPROXIMATE = 12;
+	//! The budget of join pairs the dynamic programming phase is allowed to emit before we fall back to the
+	//! greedy algorithm
+	static constexpr idx_t DP_PAIR_BUDGET = 10000;
+	//! How many of the cheapest candidate merges the greedy algorithm evaluates with one-merge lookahead
+	static constexpr idx_t APPROXIMATE_BEAM_WIDTH = 4;
 
 	//! Perform the join order solving
 	void SolveJoinOrder();
 	void InitLeafPlans();
 
+	//! Replay a memoized merge sequence, re-costing every merge against the current statistics.
+	//! Returns false if the sequence does not produce a full plan for this query graph, in which case
+	//! the caller should fall back to regular enumeration.
+	bool ReplayJoinOrder(const JoinOrderMemoEntry &memo);
+	//! Extract the merge sequence of the final plan so it can be memoized.
+	//! Returns false if no full plan has been found.
+	bool ExtractJoinOrder(JoinOrderMemoEntry &memo) const;
+
 	const reference_map_t<JoinRelationSet, unique_ptr<DPJoinNode>> &GetPlans() const;
 
 private:
@@ -79,6 +93,9 @@ private:
 	bool SolveJoinOrderExactly();
 	//! Solve the join order approximately using a greedy algorithm
 	void SolveJoinOrderApproximately();
+	//! Spend the DP budget on optimal plans for the small connected subgraphs, which the greedy algorithm
+	//! then reuses as building blocks
+	void SeedSmallSubgraphPlans();
 };
 
 } // namespace duckdb
@@ -94,6 +94,11 @@ public:
 	//! products to create edges.
 	void CreateQueryGraphCrossProduct(JoinRelationSet &left, JoinRelationSet &right);
 
+	//! Compute a fingerprint of the query graph's structure: the relations, join edges and predicate shapes,
+	//! deliberately excluding literal values. Structurally identical queries that differ only in their
+	//! literals produce the same fingerprint, which keys the join order memo.
+	uint64_t ComputeStructuralFingerprint();
+
 	//! A map to store the optimal join plan found for a specific JoinRelationSet*
 	optional_ptr<const reference_map_t<JoinRelationSet, unique_ptr<DPJoinNode>>> plans;
 
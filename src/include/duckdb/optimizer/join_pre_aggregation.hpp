@@ -0,0 +1,52 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/optimizer/join_pre_aggregation.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/column_binding_map.hpp"
+#include "duckdb/planner/logical_operator.hpp"
+
+namespace duckdb {
+
+class LogicalAggregate;
+class LogicalComparisonJoin;
+class Optimizer;
+
+//! The JoinPreAggregation optimizer pushes a duplicate-collapsing pre-aggregation below a join whose output feeds
+//! directly into an aggregate. For fact-dimension queries the probe side often carries many rows per distinct
+//! (join key, aggregate input) combination - collapsing them before the join shrinks the probe volume by the
+//! key-duplication factor. This is only valid if the aggregate above the join cannot observe row multiplicities,
+//! i.e., all of its aggregates are either DISTINCT or MIN/MAX.
+class JoinPreAggregation {
+public:
+	explicit JoinPreAggregation(Optimizer &optimizer);
+
+	//! Optimize the plan by inserting pre-aggregations below eligible aggregate-over-join patterns
+	unique_ptr<LogicalOperator> Optimize(unique_ptr<LogicalOperator> op);
+
+private:
+	//! Whether the aggregate is insensitive to duplicate input rows (only DISTINCT or MIN/MAX aggregates)
+	bool CanPreAggregate(const LogicalAggregate &aggr) const;
+	//! Try to insert a pre-aggregation on top of the given join child
+	void TryInsertPreAggregation(LogicalAggregate &aggr, LogicalComparisonJoin &join, idx_t child_idx);
+	//! Collect all column references into the given child (deduplicated, in order of first occurrence)
+	void CollectChildReferences(Expression &expr, const column_binding_set_t &child_bindings,
+	                            column_binding_set_t &seen, vector<ColumnBinding> &references,
+	                            vector<LogicalType> &types) const;
+
+private:
+	//! Skip inputs below this estimated cardinality - the pre-aggregation would not pay for itself
+	static constexpr idx_t MINIMUM_INPUT_CARDINALITY = 4096;
+	//! Maximum width of the pre-aggregation key - wide keys rarely have enough duplication to be worthwhile
+	static constexpr idx_t MAXIMUM_KEY_COLUMNS = 4;
+
+private:
+	Optimizer &optimizer;
+};
+
+} // namespace duckdb
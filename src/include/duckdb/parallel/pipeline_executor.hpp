@@ -126,6 +126,11 @@ private:
 	//! source_chunk should be sent through the pipeline
 	bool next_batch_blocked = false;
 
+	//! The operator that caused the pipeline to be interrupted (for wait-time attribution)
+	optional_ptr<const PhysicalOperator> blocked_operator;
+	//! Times how long the pipeline task was suspended after blocking
+	Profiler wait_timer;
+
 	//! Current operator being flushed
 	idx_t flushing_idx;
 	//! Whether the current flushing_idx should be flushed: this needs to be stored to make flushing code re-entrant
@@ -134,6 +139,13 @@ private:
 private:
 	void StartOperator(PhysicalOperator &op);
 	void EndOperator(PhysicalOperator &op, optional_ptr<DataChunk> chunk);
+	//! Publishes the observed cardinality to the feedback store mid-execution when it
+	//! grossly exceeds the prediction, so concurrent planning no longer trusts the estimate
+	void PublishRuntimeMisestimate(PhysicalOperator &op);
+	//! Marks the operator the pipeline is about to block on and starts the wait timer
+	void MarkBlocked(const PhysicalOperator &op);
+	//! Attributes the time spent suspended (if any) to the operator that blocked the pipeline
+	void FinishBlocked();
 
 	//! Reset the operator index to the first operator
 	void GoToSource(idx_t &current_idx, idx_t initial_idx);
@@ -58,6 +58,8 @@ public:
 
 public:
 	optional_ptr<ProducerToken> token;
+	//! The time at which the task was (last) queued, in microseconds (0 if the task was never queued)
+	int64_t scheduled_time_us = 0;
 };
 
 } // namespace duckdb
@@ -18,6 +18,7 @@ namespace duckdb {
 
 struct ConcurrentQueue;
 struct QueueProducerToken;
+struct WorkerLocalQueue;
 class ClientContext;
 class DatabaseInstance;
 class TaskScheduler;
@@ -33,6 +34,25 @@ struct ProducerToken {
 	mutex producer_lock;
 };
 
+//! Lock-free telemetry of task queue wait and run durations
+//! Bucket i counts durations of up to 2^i microseconds; the last bucket catches everything above that
+struct SchedulerTaskTiming {
+	static constexpr idx_t BUCKET_COUNT = 24;
+
+	SchedulerTaskTiming();
+
+	//! Record how long a task was queued before a thread picked it up
+	void RecordQueueWait(int64_t micros);
+	//! Record how long a single Task::Execute call took
+	void RecordRunTime(int64_t micros);
+
+	atomic<idx_t> queue_wait_count[BUCKET_COUNT];
+	atomic<idx_t> run_time_count[BUCKET_COUNT];
+
+private:
+	static idx_t BucketIndex(int64_t micros);
+};
+
 //! The TaskScheduler is responsible for managing tasks and threads
 class TaskScheduler {
 	// timeout for semaphore wait, default 5ms
@@ -84,6 +104,9 @@ public:
 	//! Sets the allocator background thread
 	void SetAllocatorBackgroundThreads(bool enable);
 
+	//! Get the queue wait/run duration telemetry of this scheduler
+	DUCKDB_API const SchedulerTaskTiming &GetTaskTiming() const;
+
 	//! Get the number of the CPU on which the calling thread is currently executing.
 	//! Fallback to calling thread id if CPU number is not available.
 	//! Result do not need to be exact 'return 0' is a valid fallback strategy
@@ -91,17 +114,34 @@ public:
 
 private:
 	void RelaunchThreadsInternal(int32_t n);
+	//! Park the calling worker: it stops waiting on the task semaphore and sleeps until woken.
+	//! Workers park after sitting idle through the allocator decay delay, so surplus capacity
+	//! is released when the node is quiet instead of every worker waking for each task signal.
+	void ParkWorker();
+	//! Wake just enough parked workers to cover the current queue backlog (called on enqueue)
+	void WakeParkedWorkers();
+	//! Register/deregister the calling worker's local task queue (for work stealing)
+	void RegisterWorkerQueue(WorkerLocalQueue &local_queue);
+	void DeregisterWorkerQueue(WorkerLocalQueue &local_queue);
+	//! Try to steal a task from another worker's local queue
+	bool TryStealTask(const WorkerLocalQueue &thief, shared_ptr<Task> &task);
 
 private:
 	DatabaseInstance &db;
 	//! The task queue
 	unique_ptr<ConcurrentQueue> queue;
+	//! Registry of per-worker local queues; workers pop their own queue LIFO and steal
+	//! from other workers FIFO when both their queue and the shared queue are empty
+	mutex worker_queue_lock;
+	vector<reference<WorkerLocalQueue>> worker_queues;
 	//! Lock for modifying the thread count
 	mutex thread_lock;
 	//! The active background threads of the task scheduler
 	vector<unique_ptr<SchedulerThread>> threads;
 	//! Markers used by the various threads, if the markers are set to "false" the thread execution is stopped
 	vector<unique_ptr<atomic<bool>>> markers;
+	//! Telemetry of task queue wait and run durations
+	SchedulerTaskTiming task_timing;
 	//! The threshold after which to flush the allocator after completing a task
 	atomic<idx_t> allocator_flush_threshold;
 	//! Whether allocator background threads are enabled
@@ -110,6 +150,8 @@ private:
 	atomic<int32_t> requested_thread_count;
 	//! The amount of threads currently running
 	atomic<int32_t> current_thread_count;
+	//! The amount of workers currently parked (deep-idle, not contending for tasks)
+	atomic<int32_t> parked_workers;
 };
 
 } // namespace duckdb
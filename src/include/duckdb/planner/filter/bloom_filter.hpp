@@ -0,0 +1,78 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/planner/filter/bloom_filter.hpp
+//
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include "duckdb/planner/table_filter.hpp"
+#include "duckdb/common/types/hash.hpp"
+
+namespace duckdb {
+class Vector;
+
+//! Shared, blocked bloom filter over hashes of the build side of a join.
+//! Built single-threaded during hash join finalization, then probed concurrently by scans.
+struct BloomFilterData {
+	explicit BloomFilterData(idx_t expected_count);
+
+	//! Insert hashes into the filter (NOT thread-safe, only called while building the filter)
+	void Insert(Vector &hashes, idx_t count);
+	//! Whether the hash may be in the set (false positives are possible, false negatives are not)
+	bool Contains(hash_t hash) const {
+		const auto mask = BlockMask(hash);
+		return (blocks[BlockIndex(hash)] & mask) == mask;
+	}
+
+private:
+	//! Mask with BITS_PER_KEY bits set within a 64-bit block, derived from the low hash bits
+	static uint64_t BlockMask(hash_t hash) {
+		return (1ULL << (hash & 63)) | (1ULL << ((hash >> 6) & 63)) | (1ULL << ((hash >> 12) & 63)) |
+		       (1ULL << ((hash >> 18) & 63));
+	}
+	//! Block selected by the hash bits above the ones consumed by BlockMask
+	idx_t BlockIndex(hash_t hash) const {
+		return (hash >> BLOCK_INDEX_SHIFT) & (block_count - 1);
+	}
+
+private:
+	//! Bits of each key within its block (four 6-bit positions, see BlockMask)
+	static constexpr idx_t BITS_PER_KEY = 4;
+	//! Hash bits consumed by BlockMask before the block index bits start
+	static constexpr idx_t BLOCK_INDEX_SHIFT = 24;
+	//! Aim for this many keys per 64-bit block, i.e., around 16 bits per key
+	static constexpr idx_t KEYS_PER_BLOCK = 4;
+	//! Lower bound on the block count so tiny filters stay well below capacity
+	static constexpr idx_t MINIMUM_BLOCK_COUNT = 64;
+
+	//! Number of 64-bit blocks (always a power of two)
+	idx_t block_count;
+	//! The blocks
+	unsafe_unique_array<uint64_t> blocks;
+};
+
+class BloomFilter : public TableFilter {
+public:
+	static constexpr const TableFilterType TYPE = TableFilterType::BLOOM_FILTER;
+
+public:
+	BloomFilter();
+	explicit BloomFilter(shared_ptr<BloomFilterData> filter_data);
+
+	//! The shared filter data (null if deserialized - the filter then accepts everything)
+	shared_ptr<BloomFilterData> filter_data;
+
+public:
+	FilterPropagateResult CheckStatistics(BaseStatistics &stats) const override;
+	string ToString(const string &column_name) const override;
+	bool Equals(const TableFilter &other) const override;
+	unique_ptr<TableFilter> Copy() const override;
+	unique_ptr<Expression> ToExpression(const Expression &column) const override;
+	void Serialize(Serializer &serializer) const override;
+	static unique_ptr<TableFilter> Deserialize(Deserializer &deserializer);
+};
+
+} // namespace duckdb
@@ -33,7 +33,8 @@ enum class TableFilterType : uint8_t {
 	OPTIONAL_FILTER = 6,     // executing filter is not required for query correctness
 	IN_FILTER = 7,           // col IN (C1, C2, C3, ...)
 	DYNAMIC_FILTER = 8,      // dynamic filters can be updated at run-time
-	EXPRESSION_FILTER = 9    // an arbitrary expression
+	EXPRESSION_FILTER = 9,   // an arbitrary expression
+	BLOOM_FILTER = 10        // bloom filter over the hashes of a join build side
 };
 
 //! TableFilter represents a filter pushed down into the table scan.
@@ -51,6 +52,8 @@ public:
 	virtual FilterPropagateResult CheckStatistics(BaseStatistics &stats) const = 0;
 	virtual string ToString(const string &column_name) const = 0;
 	string DebugToString() const;
+	//! Whether this filter contains a dynamic filter (possibly wrapped), i.e. it can tighten while a scan runs
+	bool HasDynamicFilters() const;
 	virtual unique_ptr<TableFilter> Copy() const = 0;
 	virtual bool Equals(const TableFilter &other) const {
 		return filter_type == other.filter_type;
@@ -138,6 +138,34 @@ public:
 		return state;
 	}
 
+	//! Heat the block up by one step (called when pinning an already-loaded block)
+	inline void BumpEvictionTemperature() {
+		auto current = eviction_temperature.load(std::memory_order_relaxed);
+		if (current < MAXIMUM_EVICTION_TEMPERATURE) {
+			eviction_temperature.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	//! Cool the block down by one step. Returns true if the block still had any temperature left, in which case it
+	//! deserves a second chance in the eviction queue instead of being unloaded
+	inline bool CoolDown() {
+		auto current = eviction_temperature.load(std::memory_order_relaxed);
+		while (current > 0) {
+			if (eviction_temperature.compare_exchange_weak(current, current - 1, std::memory_order_relaxed)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	inline void SetMemoryPinned(bool pinned) {
+		memory_pinned = pinned;
+	}
+
+	inline bool IsMemoryPinned() const {
+		return memory_pinned;
+	}
+
 	int64_t GetLRUTimestamp() const {
 		return lru_timestamp_msec;
 	}
@@ -210,6 +238,15 @@ private:
 	const char *unswizzled;
 	//! Index for eviction queue (FileBufferType::MANAGED_BUFFER only, for now)
 	atomic<idx_t> eviction_queue_idx;
+	//! How often the block was re-pinned while loaded, capped at MAXIMUM_EVICTION_TEMPERATURE.
+	//! Used for scan-resistant eviction: warm blocks survive a single bulk scan pushing them to the queue head.
+	atomic<idx_t> eviction_temperature;
+	//! Whether the block was explicitly pinned in memory (PRAGMA pin_table_blocks)
+	atomic<bool> memory_pinned;
+
+private:
+	//! The maximum eviction temperature, i.e., the maximum number of second chances a block can accumulate
+	static constexpr idx_t MAXIMUM_EVICTION_TEMPERATURE = 4;
 };
 
 } // namespace duckdb
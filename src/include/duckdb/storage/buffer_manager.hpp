@@ -71,6 +71,8 @@ public:
 	virtual idx_t GetMaxMemory() const = 0;
 	//! Returns the currently used swap space.
 	virtual idx_t GetUsedSwap() const = 0;
+	//! Returns the cumulative amount of buffer data spilled to the temporary directory
+	virtual idx_t GetTotalSpilledBytes() const;
 	//! Returns the maximum swap space that can be used.
 	virtual optional_idx GetMaxSwap() const = 0;
 	//! Returns the block allocation size for buffer-managed blocks.
@@ -45,6 +45,11 @@ public:
 	DUCKDB_API BufferHandle Read(data_ptr_t &buffer, idx_t nr_bytes, idx_t location);
 	//! Read (non-seeking) nr bytes from the file (or cache), same as above, also sets nr_bytes to actually read bytes
 	DUCKDB_API BufferHandle Read(data_ptr_t &buffer, idx_t &nr_bytes);
+	//! Register a byte range that an upcoming scan will read (to be coalesced and read by Prefetch)
+	DUCKDB_API void RegisterPrefetch(idx_t nr_bytes, idx_t location);
+	//! Coalesce the registered ranges within a gap threshold and read them into the external file cache,
+	//! so that the upcoming actual reads are served from the cache with fewer (larger) file system reads
+	DUCKDB_API void Prefetch();
 	//! Get some properties of the file
 	DUCKDB_API string GetPath() const;
 	DUCKDB_API idx_t GetFileSize();
@@ -99,6 +104,8 @@ private:
 
 	//! Current position (if non-seeking reads)
 	idx_t position;
+	//! Byte ranges registered for prefetching (location/nr_bytes pairs, cleared by Prefetch)
+	vector<pair<idx_t, idx_t>> prefetch_ranges;
 };
 
 //! CachingFileSystem is a read-only file system that closely resembles the FileSystem API.
@@ -11,6 +11,7 @@
 #include "duckdb/storage/partial_block_manager.hpp"
 #include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
 
 namespace duckdb {
 class DatabaseInstance;
@@ -20,6 +21,7 @@ class MetadataReader;
 class SchemaCatalogEntry;
 class SequenceCatalogEntry;
 class TableCatalogEntry;
+class TaskExecutor;
 class ViewCatalogEntry;
 class TypeCatalogEntry;
 
@@ -50,6 +52,12 @@ protected:
 	virtual void WriteType(TypeCatalogEntry &type, Serializer &serializer);
 };
 
+//! Index entry read from the checkpoint - created only after the table it is attached to has been created
+struct DeferredIndexInfo {
+	unique_ptr<CreateInfo> create_info;
+	BlockPointer root_block_pointer;
+};
+
 class CheckpointReader {
 public:
 	explicit CheckpointReader(Catalog &catalog) : catalog(catalog) {
@@ -59,6 +67,12 @@ public:
 
 protected:
 	Catalog &catalog;
+	//! Executor that loads table metadata in the background while the remaining catalog entries are being read
+	optional_ptr<TaskExecutor> load_executor;
+	//! Tables read from the checkpoint - created in the catalog (in checkpoint order) after their metadata has loaded
+	vector<unique_ptr<BoundCreateTableInfo>> deferred_tables;
+	//! Index entries read from the checkpoint - created after the deferred tables
+	vector<DeferredIndexInfo> deferred_indexes;
 
 protected:
 	virtual void LoadCheckpoint(CatalogTransaction transaction, MetadataReader &reader);
@@ -72,6 +86,10 @@ protected:
 	virtual void ReadIndex(CatalogTransaction transaction, Deserializer &deserializer);
 	virtual void ReadType(CatalogTransaction transaction, Deserializer &deserializer);
 
+	//! Creates the deferred tables and indexes in the catalog, in checkpoint order
+	virtual void CreateDeferredEntries(CatalogTransaction transaction);
+	virtual void CreateIndex(CatalogTransaction transaction, DeferredIndexInfo &deferred);
+
 	virtual void ReadTableData(CatalogTransaction transaction, Deserializer &deserializer,
 	                           BoundCreateTableInfo &bound_info);
 };
@@ -134,6 +134,31 @@ public:
 		total_value_count += vector_size;
 	}
 
+	//! How many bytes of the next vector's compressed payload to prefetch
+	static constexpr idx_t PREFETCH_WINDOW = 512;
+
+	static inline void PrefetchRange(data_ptr_t ptr, idx_t size) {
+#if defined(__GNUC__) || defined(__clang__)
+		const auto end = ptr + size;
+		for (auto current = ptr; current < end; current += 64) {
+			__builtin_prefetch(current, 0, 3);
+		}
+#endif
+	}
+
+	//! Prefetch the start of the next vector's compressed payload before the current vector is decompressed,
+	//! so the decode of the next vector does not stall on cold segment memory
+	void PrefetchNextVector(idx_t vector_size) {
+		if (total_value_count + vector_size >= count) {
+			// This is the last vector of the segment
+			return;
+		}
+		// The metadata pointer has already been decremented past the current vector's entry
+		auto next_data_byte_offset = Load<uint32_t>(metadata_ptr - AlpRDConstants::METADATA_POINTER_SIZE);
+		D_ASSERT(next_data_byte_offset < segment.GetBlockManager().GetBlockSize());
+		PrefetchRange(segment_data + next_data_byte_offset, PREFETCH_WINDOW);
+	}
+
 	// Using the metadata, we can avoid loading any of the data if we don't care about the vector at all
 	void SkipVector() {
 		// Skip the offset indicating where the data starts
@@ -177,6 +202,9 @@ public:
 			       AlpRDConstants::EXCEPTION_POSITION_SIZE * vector_state.exceptions_count);
 		}
 
+		// Warm up the next vector's compressed payload while we decompress the current one
+		PrefetchNextVector(vector_size);
+
 		// Decode all the vector values to the specified 'value_buffer'
 		vector_state.template LoadValues<SKIP>(value_buffer, vector_size);
 	}
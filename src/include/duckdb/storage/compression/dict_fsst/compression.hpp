@@ -76,6 +76,8 @@ public:
 
 	//! string -> dictionary_index (for lookups)
 	string_map_t<uint32_t> current_string_map;
+	//! Memoized dictionary index per entry of a dictionary input vector (see Compress)
+	vector<idx_t> input_lookup_cache;
 	//! strings added to the dictionary waiting to be encoded
 	vector<string_t> dictionary_encoding_buffer;
 	idx_t to_encode_string_sum = 0;
@@ -95,6 +97,11 @@ public:
 
 private:
 	void *encoder = nullptr;
+	//! Encoder retained from a previous segment of this column - segments of the same column tend to have
+	//  near-identical symbol tables, so reusing the encoder skips training (TryEncode retrains on drift)
+	void *retained_encoder = nullptr;
+	//! The dictionary compression ratio measured when the retained encoder was trained
+	double trained_compression_ratio = 0.0;
 	unsafe_unique_array<unsigned char> fsst_serialized_symbol_table;
 	DictionaryAppendState append_state = DictionaryAppendState::REGULAR;
 };
@@ -129,6 +129,18 @@ public:
 		D_ASSERT(IsArray());
 		return count;
 	}
+	//! Whether the container encodes no nulls at all - a validity summary that lets scans
+	//! skip the container data entirely and leave the result mask in its all-valid representation
+	bool IsAllValid() const {
+		if (IsRun()) {
+			return NumberOfRuns() == 0;
+		}
+		if (IsArray()) {
+			return IsInverted() && Cardinality() == 0;
+		}
+		// bitset containers always hold a mix of nulls and non-nulls
+		return false;
+	}
 
 public:
 	ContainerType container_type;
@@ -596,6 +608,7 @@ public:
 	idx_t SkipVector(const ContainerMetadata &metadata);
 	bool UseContainerStateCache(idx_t container_index, idx_t internal_offset);
 	ContainerMetadata GetContainerMetadata(idx_t container_index);
+	idx_t GetContainerSize(idx_t container_index);
 	data_ptr_t GetStartOfContainerData(idx_t container_index);
 	ContainerScanState &LoadContainer(idx_t container_index, idx_t internal_offset);
 	void ScanInternal(ContainerScanState &scan_state, idx_t to_scan, Vector &result, idx_t offset);
@@ -221,6 +221,8 @@ public:
 	unique_ptr<BlockingSample> GetSample();
 	//! Sets statistics of a physical column within the table
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	//! Replaces the min/max statistics of a physical column within the table (used by ANALYZE)
+	void SetStatistics(column_t column_id, const BaseStatistics &new_stats);
 
 	//! Obtains a shared lock to prevent checkpointing while operations are running
 	unique_ptr<StorageLockKey> GetSharedCheckpointLock();
@@ -235,6 +237,9 @@ public:
 	idx_t GetTotalRows() const;
 
 	vector<ColumnSegmentInfo> GetColumnSegmentInfo(const QueryContext &context);
+	//! Pin (or unpin) the blocks of all column segments of this table in the buffer pool,
+	//! protecting them from being evicted by bulk scans over other tables
+	void SetBlocksMemoryPinned(bool pinned);
 
 	//! Scans the next chunk for the CREATE INDEX operator
 	bool CreateIndexScan(TableScanState &state, DataChunk &result, TableScanType type);
@@ -280,6 +285,9 @@ public:
 
 	//! Returns a list of the partition stats
 	vector<PartitionStatistics> GetPartitionStats(ClientContext &context);
+	//! Whether any row group has outstanding changes (updates or deletes),
+	//! in which case the min/max bounds in the column statistics may not be exact
+	bool HasChanges() const;
 
 private:
 	//! Verify the new added constraints against current persistent&local data
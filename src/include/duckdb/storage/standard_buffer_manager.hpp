@@ -33,6 +33,7 @@ class StandardBufferManager : public BufferManager {
 	friend class BufferHandle;
 	friend class BlockHandle;
 	friend class BlockManager;
+	friend class PrefetchBatchTask;
 
 public:
 	StandardBufferManager(DatabaseInstance &db, string temp_directory);
@@ -51,6 +52,7 @@ public:
 	idx_t GetUsedMemory() const final;
 	idx_t GetMaxMemory() const final;
 	idx_t GetUsedSwap() const final;
+	idx_t GetTotalSpilledBytes() const final;
 	optional_idx GetMaxSwap() const final;
 	//! Returns the block allocation size for buffer-managed blocks.
 	idx_t GetBlockAllocSize() const final;
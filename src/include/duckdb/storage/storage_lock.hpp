@@ -20,7 +20,7 @@ enum class StorageLockType { SHARED = 0, EXCLUSIVE = 1 };
 
 class StorageLockKey {
 public:
-	StorageLockKey(shared_ptr<StorageLockInternals> internals, StorageLockType type);
+	StorageLockKey(shared_ptr<StorageLockInternals> internals, StorageLockType type, idx_t shard_index = 0);
 	~StorageLockKey();
 
 	StorageLockType GetType() const {
@@ -30,6 +30,8 @@ public:
 private:
 	shared_ptr<StorageLockInternals> internals;
 	StorageLockType type;
+	//! For shared locks: the reader shard our count lives on, so release decrements the same shard
+	idx_t shard_index;
 };
 
 class StorageLock {
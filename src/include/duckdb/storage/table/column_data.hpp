@@ -114,6 +114,8 @@ public:
 
 	//! Initialize prefetch state with required I/O data for the next N rows
 	virtual void InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows);
+	//! Initialize prefetch state with the I/O required to fetch the row with the given row id
+	virtual void InitializeFetchPrefetch(PrefetchState &prefetch_state, row_t row_id);
 	//! Initialize a scan of the column
 	virtual void InitializeScan(ColumnScanState &state);
 	//! Initialize a scan starting at the specified offset
@@ -147,6 +149,9 @@ public:
 	//! Append a vector of type [type] to the end of the column
 	void Append(ColumnAppendState &state, Vector &vector, idx_t count);
 	virtual void AppendData(BaseStatistics &stats, ColumnAppendState &state, UnifiedVectorFormat &vdata, idx_t count);
+	//! Append "count" copies of a constant value as a zero-storage constant segment that synthesizes the value at
+	//! scan time, instead of materializing the value for every row
+	virtual void AppendConstantSegment(const Value &value, idx_t count);
 	//! Revert a set of appends to the ColumnData
 	virtual void RevertAppend(row_t start_row);
 
@@ -182,6 +187,8 @@ public:
 
 	virtual void GetColumnSegmentInfo(const QueryContext &context, idx_t row_group_index, vector<idx_t> col_path,
 	                                  vector<ColumnSegmentInfo> &result);
+	//! Pin (or unpin) the blocks of all segments of this column in the buffer pool
+	virtual void SetBlocksMemoryPinned(bool pinned);
 	virtual void Verify(RowGroup &parent);
 
 	FilterPropagateResult CheckZonemap(TableFilter &filter);
@@ -45,6 +45,7 @@ class CollectionScanState;
 class TableFilter;
 class TableFilterSet;
 struct ColumnFetchState;
+struct PrefetchState;
 struct RowGroupAppendState;
 class MetadataManager;
 class RowVersionManager;
@@ -115,7 +116,8 @@ public:
 	                               ExpressionExecutor &executor, CollectionScanState &scan_state,
 	                               DataChunk &scan_chunk);
 	unique_ptr<RowGroup> AddColumn(RowGroupCollection &collection, ColumnDefinition &new_column,
-	                               ExpressionExecutor &executor, Vector &intermediate);
+	                               ExpressionExecutor &executor, Vector &intermediate,
+	                               optional_ptr<const Value> constant_default = nullptr);
 	unique_ptr<RowGroup> RemoveColumn(RowGroupCollection &collection, idx_t removed_column);
 
 	void CommitDrop();
@@ -130,6 +132,9 @@ public:
 	//! Checks the given set of table filters against the row-group statistics. Returns false if the entire row group
 	//! can be skipped.
 	bool CheckZonemap(ScanFilterInfo &filters);
+	//! For a two-stage system sample, probabilistically decides whether this row group is part of the sample.
+	//! Returns false if the entire row group can be skipped.
+	bool CheckRowGroupSample(CollectionScanState &state);
 	//! Checks the given set of table filters against the per-segment statistics. Returns false if any segments were
 	//! skipped.
 	bool CheckZonemapSegments(CollectionScanState &state);
@@ -142,6 +147,8 @@ public:
 
 	//! For a specific row, returns true if it should be used for the transaction and false otherwise.
 	bool Fetch(TransactionData transaction, idx_t row);
+	//! Initialize prefetch state with the I/O required to fetch a specific row for the given columns
+	void InitializeFetchPrefetch(PrefetchState &prefetch_state, const vector<StorageIndex> &column_ids, row_t row_id);
 	//! Fetch a specific row from the row_group and insert it into the result at the specified index
 	void FetchRow(TransactionData transaction, ColumnFetchState &state, const vector<StorageIndex> &column_ids,
 	              row_t row_id, DataChunk &result, idx_t result_idx);
@@ -184,6 +191,8 @@ public:
 	unique_ptr<BaseStatistics> GetStatistics(idx_t column_idx);
 
 	void GetColumnSegmentInfo(const QueryContext &context, idx_t row_group_index, vector<ColumnSegmentInfo> &result);
+	//! Pin (or unpin) the blocks of all column segments of this row group in the buffer pool
+	void SetBlocksMemoryPinned(bool pinned);
 	PartitionStatistics GetPartitionStats() const;
 
 	idx_t GetAllocationSize() const {
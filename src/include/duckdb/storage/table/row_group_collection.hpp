@@ -20,6 +20,7 @@ struct ParallelTableScanState;
 struct ParallelCollectionScanState;
 class CreateIndexScanState;
 class CollectionScanState;
+class ScanFilterInfo;
 class PersistentTableData;
 class TableDataWriter;
 class TableIndexList;
@@ -64,13 +65,16 @@ public:
 
 	void InitializeScan(const QueryContext &context, CollectionScanState &state, const vector<StorageIndex> &column_ids,
 	                    optional_ptr<TableFilterSet> table_filters);
+	//! Checks the pushed-down filters against the table-wide statistics
+	//! Returns false if no row in the collection can possibly match, allowing the scan to skip it wholesale
+	bool CheckZonemap(ScanFilterInfo &filters);
 	void InitializeCreateIndexScan(CreateIndexScanState &state);
 	void InitializeScanWithOffset(const QueryContext &context, CollectionScanState &state,
 	                              const vector<StorageIndex> &column_ids, idx_t start_row, idx_t end_row);
 	static bool InitializeScanInRowGroup(const QueryContext &context, CollectionScanState &state,
 	                                     RowGroupCollection &collection, RowGroup &row_group, idx_t vector_index,
 	                                     idx_t max_row);
-	void InitializeParallelScan(ParallelCollectionScanState &state);
+	void InitializeParallelScan(ParallelCollectionScanState &state, bool attach_to_shared_scan = false);
 	bool NextParallelScan(ClientContext &context, ParallelCollectionScanState &state, CollectionScanState &scan_state);
 
 	bool Scan(DuckTransaction &transaction, const vector<StorageIndex> &column_ids,
@@ -119,7 +123,11 @@ public:
 	void CommitDropTable();
 
 	vector<PartitionStatistics> GetPartitionStats() const;
+	//! Whether any row group has outstanding changes (updates or deletes)
+	bool HasChanges() const;
 	vector<ColumnSegmentInfo> GetColumnSegmentInfo(const QueryContext &context);
+	//! Pin (or unpin) the blocks of all column segments of this collection in the buffer pool
+	void SetBlocksMemoryPinned(bool pinned);
 	const vector<LogicalType> &GetTypes() const;
 
 	shared_ptr<RowGroupCollection> AddColumn(ClientContext &context, ColumnDefinition &new_column,
@@ -133,6 +141,7 @@ public:
 	unique_ptr<BaseStatistics> CopyStats(column_t column_id);
 	unique_ptr<BlockingSample> GetSample();
 	void SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> distinct_stats);
+	void SetStatistics(column_t column_id, const BaseStatistics &new_stats);
 
 	AttachedDatabase &GetAttached();
 	BlockManager &GetBlockManager() {
@@ -175,6 +184,8 @@ private:
 	TableStatistics stats;
 	//! Allocation size, only tracked for appends
 	atomic<idx_t> allocation_size;
+	//! The row at which the most recent parallel scan handed out work (used to attach shared scans)
+	atomic<idx_t> shared_scan_cursor;
 	//! Root metadata pointer, if the collection is loaded from disk
 	MetaBlockPointer metadata_pointer;
 	//! Whether or not we need to append a new row group prior to appending
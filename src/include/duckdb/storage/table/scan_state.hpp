@@ -134,6 +134,9 @@ struct ScanFilter {
 	idx_t table_column_index;
 	TableFilter &filter;
 	bool always_true;
+	//! Whether the filter contains a dynamic filter - dynamic filters can tighten while the scan runs,
+	//! so their zone maps keep being checked even after the filter is labeled as always true
+	bool has_dynamic_filter;
 	unique_ptr<TableFilterState> filter_state;
 
 	bool IsAlwaysTrue() const {
@@ -202,6 +205,8 @@ public:
 	idx_t batch_index;
 	//! The valid selection
 	SelectionVector valid_sel;
+	//! When this thread was handed its current unit of work (used to adapt the morsel size)
+	int64_t last_morsel_start_ns = 0;
 
 	RandomEngine random;
 
@@ -224,6 +229,11 @@ struct ScanSamplingInfo {
 	bool do_system_sample = false;
 	//! The sampling rate to use
 	double sample_rate;
+	//! The rate at which whole row groups are admitted into the sample
+	double row_group_rate = 1.0;
+	//! The rate at which vectors within an admitted row group are sampled
+	//! (row_group_rate * vector_rate == sample_rate)
+	double vector_rate = 1.0;
 };
 
 struct TableScanOptions {
@@ -283,6 +293,14 @@ struct ParallelCollectionScanState {
 	idx_t vector_index;
 	idx_t max_row;
 	idx_t batch_index;
+	//! The number of row groups handed out per unit of work (adapted while the scan runs)
+	idx_t morsel_row_groups;
+	//! The row group this scan attached to when sharing an in-flight pass (null when scanning from the start)
+	RowGroup *start_row_group;
+	//! Whether an attached scan has wrapped around to the beginning of the collection
+	bool wrapped;
+	//! Whether the filters were checked against the table-wide statistics (done once per scan)
+	bool checked_zonemap;
 	atomic<idx_t> processed_rows;
 	mutex lock;
 };
@@ -294,6 +312,15 @@ struct ParallelTableScanState {
 	ParallelCollectionScanState local_state;
 	//! Shared lock over the checkpoint to prevent checkpoints while reading
 	shared_ptr<CheckpointLock> checkpoint_lock;
+	//! The shared remaining row budget when a LIMIT has been pushed into the scan, or DConstants::INVALID_INDEX
+	//! if the scan is unbounded
+	atomic<idx_t> row_budget = {DConstants::INVALID_INDEX};
+
+	//! Whether any of the shared row budget remains - checked per vector by parallel scan tasks so that sibling
+	//! tasks terminate cooperatively once the pushed-down limit has been produced
+	bool HasRowBudgetRemaining() const;
+	//! Consume "count" rows of the shared row budget
+	void ConsumeRowBudget(idx_t count);
 };
 
 struct PrefetchState {
@@ -29,6 +29,7 @@ public:
 	idx_t GetMaxEntry() override;
 
 	void InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows) override;
+	void InitializeFetchPrefetch(PrefetchState &prefetch_state, row_t row_id) override;
 	void InitializeScan(ColumnScanState &state) override;
 	void InitializeScanWithOffset(ColumnScanState &state, idx_t row_idx) override;
 
@@ -65,6 +66,7 @@ public:
 
 	void GetColumnSegmentInfo(const QueryContext &context, duckdb::idx_t row_group_index,
 	                          vector<duckdb::idx_t> col_path, vector<duckdb::ColumnSegmentInfo> &result) override;
+	void SetBlocksMemoryPinned(bool pinned) override;
 
 	void Verify(RowGroup &parent) override;
 };
@@ -96,10 +96,16 @@ private:
 	get_effective_updates_t get_effective_updates;
 
 private:
+	//! Chain length at which an update triggers consolidation of the version chain
+	static constexpr idx_t CHAIN_CONSOLIDATION_THRESHOLD = 8;
+
 	UndoBufferPointer GetUpdateNode(StorageLockKey &lock, idx_t vector_idx) const;
 	void InitializeUpdateInfo(idx_t vector_idx);
 	void InitializeUpdateInfo(UpdateInfo &info, row_t *ids, const SelectionVector &sel, idx_t count, idx_t vector_index,
 	                          idx_t vector_offset);
+	//! Unlink committed entries from a vector's update chain that no active or future transaction can still see
+	//! Triggered from Update once the chain exceeds CHAIN_CONSOLIDATION_THRESHOLD
+	void ConsolidateUpdateChain(const StorageLockKey &lock, DataTable &data_table, UpdateInfo &base_info);
 };
 
 struct UpdateNode {
@@ -132,6 +132,9 @@ private:
 	idx_t num_connections = DConstants::INVALID_INDEX;
 	//! Max memory per query
 	idx_t query_max_memory = DConstants::INVALID_INDEX;
+	//! Weight of the materialization penalties in the reservation cost function, derived
+	//! from the calibrated ratio of materialization cost to scan cost (1.0 if uncalibrated)
+	double materialization_cost_multiplier = 1.0;
 
 	//! Currently active states
 	reference_set_t<TemporaryMemoryState> active_states;
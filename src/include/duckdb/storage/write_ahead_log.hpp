@@ -117,6 +117,21 @@ public:
 	//! Delete the WAL file on disk. The WAL should not be used after this point.
 	void Delete();
 	void Flush();
+	//! Write a WAL_FLUSH marker without syncing the file, returning the generation of the marker.
+	//! Used by group commit, where the fsync covering the marker is batched across concurrently
+	//! committing transactions. The caller must hold the WAL write lock of the transaction manager.
+	idx_t WriteFlushMarker();
+	//! Sync all WAL entries written so far to disk, returning the flush generation covered by the
+	//! sync. The caller must hold the WAL write lock of the transaction manager.
+	idx_t SyncFlush();
+	//! The generation of the last written flush marker
+	idx_t GetFlushGeneration() const {
+		return flush_generation;
+	}
+	//! The flush generation covered by the last sync
+	idx_t GetSyncedFlushGeneration() const {
+		return synced_flush_generation;
+	}
 
 	void WriteCheckpoint(MetaBlockPointer meta_block);
 
@@ -130,6 +145,10 @@ protected:
 	string wal_path;
 	atomic<idx_t> wal_size;
 	atomic<WALInitState> init_state;
+	//! The generation of the last written flush marker (see group commit)
+	atomic<idx_t> flush_generation = {0};
+	//! The flush generation covered by the last sync
+	atomic<idx_t> synced_flush_generation = {0};
 };
 
 } // namespace duckdb
@@ -13,8 +13,12 @@
 #include "duckdb/common/enums/checkpoint_type.hpp"
 #include "duckdb/common/queue.hpp"
 
+#include <condition_variable>
+
 namespace duckdb {
 class DuckTransaction;
+class WriteAheadLog;
+struct ProducerToken;
 struct UndoBufferProperties;
 
 //! CleanupInfo collects transactions awaiting cleanup.
@@ -72,6 +76,9 @@ public:
 	                      idx_t extra_data_size = 0);
 	void PushAttach(Transaction &transaction_p, AttachedDatabase &db);
 
+	//! Fully drains the cleanup queue; called from the background cleanup task
+	void RunBackgroundCleanup();
+
 protected:
 	struct CheckpointDecision {
 		explicit CheckpointDecision(string reason_p);
@@ -94,6 +101,15 @@ private:
 	//! Whether or not we can checkpoint
 	CheckpointDecision CanCheckpoint(DuckTransaction &transaction, unique_ptr<StorageLockKey> &checkpoint_lock,
 	                                 const UndoBufferProperties &properties);
+	//! Schedule an automatic checkpoint on a background task, so the committing thread does not have to wait for it
+	void ScheduleBackgroundCheckpoint();
+	//! Pop pending cleanup info from the queue and clean it up - in-order, one at a time (or all, if drain_all is set)
+	void CleanupPendingTransactions(bool drain_all);
+	//! Ensure the WAL is synced up to the given flush generation, batching the fsync with other
+	//! concurrently committing transactions (group commit)
+	void GroupWALSync(WriteAheadLog &wal, idx_t target_generation);
+	//! Schedule version cleanup on a background task, so the committing thread does not have to wait for it
+	void ScheduleBackgroundCleanup();
 
 private:
 	//! The current start timestamp used by transactions
@@ -118,6 +134,12 @@ private:
 	mutex start_transaction_lock;
 	//! Mutex used to control writes to the WAL - separate from the transaction lock
 	mutex wal_lock;
+	//! Lock coordinating group-commit WAL syncs
+	mutex wal_sync_lock;
+	//! Signalled whenever a group-commit sync completes
+	std::condition_variable wal_sync_cv;
+	//! Whether a committer is currently acting as the group-commit sync leader
+	bool wal_sync_in_progress = false;
 
 	atomic<idx_t> last_uncommitted_catalog_version = {TRANSACTION_ID_START};
 	idx_t last_committed_version = 0;
@@ -131,6 +153,18 @@ private:
 	//! inverting the cleanup order can result in catalog errors.
 	queue<unique_ptr<DuckCleanupInfo>> cleanup_queue;
 
+	//! Lock protecting the background checkpoint producer
+	mutex background_checkpoint_lock;
+	//! Producer token for scheduling background checkpoint tasks (lazily created)
+	unique_ptr<ProducerToken> background_checkpoint_producer;
+
+	//! Lock protecting the background cleanup producer
+	mutex background_cleanup_lock;
+	//! Producer token for scheduling background cleanup tasks (lazily created)
+	unique_ptr<ProducerToken> background_cleanup_producer;
+	//! Whether a background cleanup task is scheduled but has not started draining yet
+	atomic<bool> background_cleanup_pending = {false};
+
 protected:
 	virtual void OnCommitCheckpointDecision(const CheckpointDecision &decision, DuckTransaction &transaction) {
 	}
@@ -7,8 +7,50 @@
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/common/local_file_system.hpp"
 
+#ifndef DUCKDB_NO_THREADS
+#include "concurrentqueue.h"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/thread.hpp"
+#endif
+
 namespace duckdb {
 
+#ifndef DUCKDB_NO_THREADS
+
+//! A log entry that has been queued by a logging thread but not yet written to the log storage
+struct AsyncLogEntry {
+	timestamp_t timestamp;
+	LogLevel level;
+	string log_type;
+	string log_message;
+	RegisteredLoggingContext context;
+};
+
+//! State of the async logging mode. The queue keeps a sub-queue per producing thread, so
+//! logging threads enqueue without contending with each other (same structure as the task
+//! scheduler queue). The flusher thread periodically drains all sub-queues into the storage.
+struct AsyncLogState {
+	//! Maximum number of queued entries before we start dropping
+	static constexpr idx_t QUEUE_CAPACITY = 1 << 16;
+	//! How long the flusher sleeps when the queue is empty
+	static constexpr idx_t FLUSH_INTERVAL_MS = 100;
+
+	//! The queued log entries
+	duckdb_moodycamel::ConcurrentQueue<AsyncLogEntry> queue;
+	//! Approximate number of queued entries (for overflow accounting)
+	atomic<idx_t> queued_count {0};
+	//! Set to false to stop the flusher thread
+	atomic<bool> flusher_running {true};
+	//! The background flusher thread
+	unique_ptr<thread> flusher_thread;
+};
+
+#else
+
+struct AsyncLogState {};
+
+#endif
+
 unique_ptr<Logger> LogManager::CreateLogger(LoggingContext context, bool thread_safe, bool mutable_settings) {
 	unique_lock<mutex> lck(lock);
 
@@ -49,6 +91,12 @@ shared_ptr<Logger> LogManager::GlobalLoggerReference() {
 }
 
 void LogManager::Flush() {
+#ifndef DUCKDB_NO_THREADS
+	if (async_enabled) {
+		// Write out the queued entries, so that Flush remains a synchronization barrier.
+		DrainAsyncQueue();
+	}
+#endif
 	unique_lock<mutex> lck(lock);
 	log_storage->FlushAll();
 }
@@ -68,6 +116,7 @@ LogManager::LogManager(DatabaseInstance &db, LogConfig config_p) : config(std::m
 }
 
 LogManager::~LogManager() {
+	StopAsyncFlusher();
 }
 
 void LogManager::Initialize() {
@@ -95,6 +144,20 @@ RegisteredLoggingContext LogManager::RegisterLoggingContextInternal(LoggingConte
 
 void LogManager::WriteLogEntry(timestamp_t timestamp, const char *log_type, LogLevel log_level, const char *log_message,
                                const RegisteredLoggingContext &context) {
+#ifndef DUCKDB_NO_THREADS
+	if (async_enabled) {
+		// Defer the write: the flusher thread moves queued entries into the log storage.
+		auto &state = *async_state;
+		if (state.queued_count.load(std::memory_order_relaxed) >= AsyncLogState::QUEUE_CAPACITY) {
+			// The flusher cannot keep up: drop the entry instead of stalling the logging thread.
+			dropped_log_entries.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+		state.queue.enqueue(AsyncLogEntry {timestamp, log_level, log_type, log_message, context});
+		state.queued_count.fetch_add(1, std::memory_order_relaxed);
+		return;
+	}
+#endif
 	unique_lock<mutex> lck(lock);
 	log_storage->WriteLogEntry(timestamp, log_level, log_type, log_message, context);
 }
@@ -118,6 +181,88 @@ void LogManager::SetEnableLogging(bool enable) {
 	global_logger->UpdateConfig(config);
 }
 
+void LogManager::SetEnableAsyncLogging(bool enable) {
+#ifndef DUCKDB_NO_THREADS
+	{
+		unique_lock<mutex> lck(lock);
+		if (enable == async_enabled) {
+			return;
+		}
+		if (enable) {
+			if (!async_state) {
+				async_state = make_uniq<AsyncLogState>();
+			}
+			async_state->flusher_running = true;
+			async_state->flusher_thread = make_uniq<thread>([this]() { AsyncFlusherLoop(); });
+			async_enabled = true;
+			return;
+		}
+		async_enabled = false;
+	}
+	// Join outside of the lock: the flusher takes the lock to write out the remaining entries.
+	StopAsyncFlusher();
+#else
+	if (enable) {
+		throw NotImplementedException("Asynchronous logging requires thread support");
+	}
+#endif
+}
+
+bool LogManager::AsyncLoggingEnabled() const {
+	return async_enabled;
+}
+
+idx_t LogManager::GetDroppedLogEntryCount() const {
+	return dropped_log_entries;
+}
+
+void LogManager::AsyncFlusherLoop() {
+#ifndef DUCKDB_NO_THREADS
+	while (async_state->flusher_running) {
+		if (!DrainAsyncQueue()) {
+			std::this_thread::sleep_for(std::chrono::milliseconds(AsyncLogState::FLUSH_INTERVAL_MS));
+		}
+	}
+	// Write out any entries that were queued while shutting down.
+	DrainAsyncQueue();
+#endif
+}
+
+bool LogManager::DrainAsyncQueue() {
+#ifndef DUCKDB_NO_THREADS
+	auto &state = *async_state;
+	idx_t drained = 0;
+
+	// Take the lock once per batch instead of once per entry.
+	unique_lock<mutex> lck(lock);
+	AsyncLogEntry entry {timestamp_t(), LogLevel::LOG_TRACE, string(), string(),
+	                     RegisteredLoggingContext {0, LoggingContext(LogContextScope::DATABASE)}};
+	while (state.queue.try_dequeue(entry)) {
+		log_storage->WriteLogEntry(entry.timestamp, entry.level, entry.log_type, entry.log_message, entry.context);
+		drained++;
+	}
+	lck.unlock();
+
+	if (drained != 0) {
+		state.queued_count.fetch_sub(drained, std::memory_order_relaxed);
+	}
+	return drained != 0;
+#else
+	return false;
+#endif
+}
+
+void LogManager::StopAsyncFlusher() {
+#ifndef DUCKDB_NO_THREADS
+	if (!async_state || !async_state->flusher_thread) {
+		return;
+	}
+	async_state->flusher_running = false;
+	async_state->flusher_thread->join();
+	async_state->flusher_thread.reset();
+#endif
+}
+
 void LogManager::SetLogMode(LogMode mode) {
 	unique_lock<mutex> lck(lock);
 	config.mode = mode;
@@ -376,6 +376,50 @@ void BaseAppender::AppendDataChunk(DataChunk &chunk_p) {
 	}
 }
 
+void BaseAppender::AppendRowBatch(const vector<AppendBatchColumn> &columns, idx_t count) {
+	if (column != 0) {
+		throw InvalidInputException("Failed to append row batch: incomplete append to row!");
+	}
+	auto &append_types = GetActiveTypes();
+	if (columns.size() != append_types.size()) {
+		throw InvalidInputException("incorrect column count in AppendRowBatch, expected %d, got %d",
+		                            append_types.size(), columns.size());
+	}
+	for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+		auto physical_type = append_types[col_idx].InternalType();
+		if (!TypeIsConstantSize(physical_type) && physical_type != PhysicalType::VARCHAR) {
+			throw NotImplementedException("AppendRowBatch does not support nested types - use AppendDataChunk instead");
+		}
+	}
+	// append any pending row-based data first, so that row order is preserved
+	FlushChunk();
+
+	for (idx_t offset = 0; offset < count; offset += STANDARD_VECTOR_SIZE) {
+		auto batch_count = MinValue<idx_t>(STANDARD_VECTOR_SIZE, count - offset);
+		DataChunk batch;
+		for (idx_t col_idx = 0; col_idx < columns.size(); col_idx++) {
+			auto &input = columns[col_idx];
+			auto type_size = GetTypeIdSize(append_types[col_idx].InternalType());
+			// wrap the caller-owned array directly - no per-value boxing, and no copy until the
+			// slice lands in the buffered collection
+			batch.data.emplace_back(append_types[col_idx], input.data + offset * type_size);
+			if (input.nulls) {
+				auto &validity = FlatVector::Validity(batch.data.back());
+				for (idx_t i = 0; i < batch_count; i++) {
+					if (input.nulls[offset + i]) {
+						validity.SetInvalid(i);
+					}
+				}
+			}
+		}
+		batch.SetCardinality(batch_count);
+		collection->Append(batch);
+	}
+	if (collection->Count() >= flush_count) {
+		Flush();
+	}
+}
+
 void BaseAppender::FlushChunk() {
 	if (chunk.size() == 0) {
 		return;
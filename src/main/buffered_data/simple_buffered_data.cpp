@@ -1,14 +1,22 @@
 #include "duckdb/main/buffered_data/simple_buffered_data.hpp"
 #include "duckdb/common/printer.hpp"
+#include "duckdb/common/serializer/binary_deserializer.hpp"
+#include "duckdb/common/serializer/binary_serializer.hpp"
+#include "duckdb/common/serializer/memory_stream.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/stream_query_result.hpp"
 #include "duckdb/common/helper.hpp"
+#include "miniz_wrapper.hpp"
 
 namespace duckdb {
 
 SimpleBufferedData::SimpleBufferedData(ClientContext &context) : BufferedData(BufferedData::Type::SIMPLE, context) {
 	buffered_count = 0;
-	buffer_size = total_buffer_size;
+	// The configured size is the hard upper bound - start at a quarter of it and adapt from there
+	max_buffer_size = total_buffer_size;
+	min_buffer_size = MaxValue<idx_t>(total_buffer_size / 16, 1);
+	buffer_size = MaxValue(max_buffer_size / 4, min_buffer_size);
+	compress_buffer = ClientConfig::GetConfig(context).compress_streaming_buffer;
 }
 
 SimpleBufferedData::~SimpleBufferedData() {
@@ -23,6 +31,30 @@ bool SimpleBufferedData::BufferIsFull() {
 	return buffered_count >= BufferSize();
 }
 
+void SimpleBufferedData::AdjustBufferSize(bool buffer_drained) {
+	if (buffer_drained) {
+		// The consumer caught up with the producer - after a few of these in a row, give the pipelines more room to
+		// run ahead so the consumer doesn't have to wait for execution on every fetch
+		backlogged_scans = 0;
+		if (++drained_scans >= BUFFER_GROW_THRESHOLD) {
+			buffer_size = MinValue<idx_t>(buffer_size * 2, max_buffer_size);
+			drained_scans = 0;
+		}
+	} else if (buffered_count >= buffer_size / 2) {
+		// The consumer is lagging behind - if this persists, shrink the in-flight buffer so the producer stops
+		// bursting ahead and parking memory the consumer won't touch for a while
+		drained_scans = 0;
+		if (++backlogged_scans >= BUFFER_SHRINK_THRESHOLD) {
+			buffer_size = MaxValue<idx_t>(buffer_size / 2, min_buffer_size);
+			backlogged_scans = 0;
+		}
+	} else {
+		// Production and consumption are balanced - keep the current target
+		drained_scans = 0;
+		backlogged_scans = 0;
+	}
+}
+
 void SimpleBufferedData::UnblockSinks() {
 	auto cc = context.lock();
 	if (!cc) {
@@ -91,30 +123,91 @@ unique_ptr<DataChunk> SimpleBufferedData::Scan() {
 		return nullptr;
 	}
 
-	lock_guard<mutex> lock(glock);
-	if (buffered_chunks.empty()) {
-		Close();
+	BufferedChunk buffered;
+	{
+		lock_guard<mutex> lock(glock);
+		if (buffered_chunks.empty()) {
+			Close();
+			return nullptr;
+		}
+		buffered = std::move(buffered_chunks.front());
+		buffered_chunks.pop();
+
+		if (buffered.chunk) {
+			buffered_count -= buffered.chunk->GetAllocationSize();
+		} else if (buffered.compressed_data.IsSet()) {
+			buffered_count -= buffered.compressed_data.GetSize();
+		}
+		AdjustBufferSize(buffered_chunks.empty());
+	}
+	if (buffered.chunk) {
+		return std::move(buffered.chunk);
+	}
+	if (!buffered.compressed_data.IsSet()) {
 		return nullptr;
 	}
-	auto chunk = std::move(buffered_chunks.front());
-	buffered_chunks.pop();
+	// Decompress outside of the lock
+	return DecompressChunk(buffered);
+}
 
-	if (chunk) {
-		auto allocation_size = chunk->GetAllocationSize();
-		buffered_count -= allocation_size;
-	}
+SimpleBufferedData::BufferedChunk SimpleBufferedData::CompressChunk(const DataChunk &to_append) {
+	auto &allocator = Allocator::DefaultAllocator();
+
+	// Serialize the chunk, then run it through lightweight (gzip) compression before parking it
+	MemoryStream stream(allocator);
+	BinarySerializer serializer(stream);
+	serializer.Begin();
+	to_append.Serialize(serializer);
+	serializer.End();
+
+	const auto uncompressed_size = NumericCast<size_t>(stream.GetPosition());
+	auto compression_buffer = allocator.Allocate(MiniZStream::MaxCompressedLength(uncompressed_size));
+	size_t compressed_size = compression_buffer.GetSize();
+	MiniZStream mz_stream;
+	mz_stream.Compress(const_char_ptr_cast(stream.GetData()), uncompressed_size,
+	                   char_ptr_cast(compression_buffer.get()), &compressed_size);
+
+	// Only hold on to the actual compressed bytes - the whole point is bounding the parked memory
+	BufferedChunk result;
+	result.compressed_data = allocator.Allocate(compressed_size);
+	memcpy(result.compressed_data.get(), compression_buffer.get(), compressed_size);
+	result.uncompressed_size = uncompressed_size;
+	return result;
+}
+
+unique_ptr<DataChunk> SimpleBufferedData::DecompressChunk(const BufferedChunk &buffered) {
+	auto &allocator = Allocator::DefaultAllocator();
+
+	auto uncompressed = allocator.Allocate(buffered.uncompressed_size);
+	MiniZStream mz_stream;
+	mz_stream.Decompress(const_char_ptr_cast(buffered.compressed_data.get()), buffered.compressed_data.GetSize(),
+	                     char_ptr_cast(uncompressed.get()), buffered.uncompressed_size);
+
+	MemoryStream stream(uncompressed.get(), buffered.uncompressed_size);
+	BinaryDeserializer deserializer(stream);
+	auto chunk = make_uniq<DataChunk>();
+	deserializer.Begin();
+	chunk->Deserialize(deserializer);
+	deserializer.End();
 	return chunk;
 }
 
 void SimpleBufferedData::Append(const DataChunk &to_append) {
-	auto chunk = make_uniq<DataChunk>();
-	chunk->Initialize(Allocator::DefaultAllocator(), to_append.GetTypes());
-	to_append.Copy(*chunk, 0);
-	auto allocation_size = chunk->GetAllocationSize();
+	BufferedChunk buffered;
+	idx_t allocation_size;
+	if (compress_buffer) {
+		buffered = CompressChunk(to_append);
+		allocation_size = buffered.compressed_data.GetSize();
+	} else {
+		buffered.chunk = make_uniq<DataChunk>();
+		buffered.chunk->Initialize(Allocator::DefaultAllocator(), to_append.GetTypes());
+		to_append.Copy(*buffered.chunk, 0);
+		allocation_size = buffered.chunk->GetAllocationSize();
+	}
 
 	unique_lock<mutex> lock(glock);
 	buffered_count += allocation_size;
-	buffered_chunks.push(std::move(chunk));
+	buffered_chunks.push(std::move(buffered));
 }
 
 } // namespace duckdb
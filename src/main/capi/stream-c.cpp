@@ -32,3 +32,85 @@ duckdb_data_chunk duckdb_fetch_chunk(duckdb_result result) {
 		return nullptr;
 	}
 }
+
+static void FetchColumnData(duckdb::Vector &vector, idx_t chunk_offset, idx_t copy_count, idx_t row_offset,
+                            void *column_buffer, uint64_t *validity_mask) {
+	auto width = duckdb::GetTypeIdSize(vector.GetType().InternalType());
+	memcpy(reinterpret_cast<duckdb::data_ptr_t>(column_buffer) + row_offset * width,
+	       vector.GetData() + chunk_offset * width, copy_count * width);
+	if (!validity_mask) {
+		return;
+	}
+	auto &validity = duckdb::FlatVector::Validity(vector);
+	for (idx_t i = 0; i < copy_count; i++) {
+		auto row = row_offset + i;
+		auto mask_entry = uint64_t(1) << (row % 64);
+		if (validity.RowIsValid(chunk_offset + i)) {
+			validity_mask[row / 64] |= mask_entry;
+		} else {
+			validity_mask[row / 64] &= ~mask_entry;
+		}
+	}
+}
+
+idx_t duckdb_fetch_columns(duckdb_result result, void **column_buffers, uint64_t **validity_masks, idx_t max_rows) {
+	if (!result.internal_data || !column_buffers || max_rows == 0) {
+		return 0;
+	}
+	auto &result_data = *(reinterpret_cast<duckdb::DuckDBResultData *>(result.internal_data));
+	if (result_data.result_set_type == duckdb::CAPIResultSetType::CAPI_RESULT_TYPE_DEPRECATED) {
+		return 0;
+	}
+	result_data.result_set_type = duckdb::CAPIResultSetType::CAPI_RESULT_TYPE_STREAMING;
+	auto &result_instance = *result_data.result;
+	for (auto &type : result_instance.types) {
+		if (!duckdb::TypeIsConstantSize(type.InternalType())) {
+			// variable-size columns cannot be written into contiguous caller-provided buffers
+			return 0;
+		}
+	}
+
+	idx_t row_offset = 0;
+	try {
+		while (row_offset < max_rows) {
+			// continue with the partially consumed chunk of a previous call, or fetch a new one
+			duckdb::unique_ptr<duckdb::DataChunk> fetched;
+			duckdb::optional_ptr<duckdb::DataChunk> chunk;
+			idx_t chunk_offset = 0;
+			if (result_data.partial_chunk) {
+				chunk = result_data.partial_chunk.get();
+				chunk_offset = result_data.partial_offset;
+			} else {
+				fetched = result_instance.Fetch();
+				if (!fetched || fetched->size() == 0) {
+					break;
+				}
+				fetched->Flatten();
+				chunk = fetched.get();
+			}
+
+			auto available = chunk->size() - chunk_offset;
+			auto copy_count = duckdb::MinValue<idx_t>(available, max_rows - row_offset);
+			for (idx_t col_idx = 0; col_idx < chunk->ColumnCount(); col_idx++) {
+				auto validity_mask = validity_masks ? validity_masks[col_idx] : nullptr;
+				FetchColumnData(chunk->data[col_idx], chunk_offset, copy_count, row_offset, column_buffers[col_idx],
+				                validity_mask);
+			}
+			row_offset += copy_count;
+
+			if (copy_count < available) {
+				// the chunk did not fit in the remaining buffer space - keep the rest for the next call
+				if (fetched) {
+					result_data.partial_chunk = std::move(fetched);
+				}
+				result_data.partial_offset = chunk_offset + copy_count;
+			} else if (result_data.partial_chunk) {
+				result_data.partial_chunk.reset();
+				result_data.partial_offset = 0;
+			}
+		}
+	} catch (std::exception &e) {
+		return 0;
+	}
+	return row_offset;
+}
@@ -0,0 +1,80 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/cardinality_feedback.cpp
+//
+//===----------------------------------------------------------------------===//
+
+#include "duckdb/main/cardinality_feedback.hpp"
+
+#include "duckdb/common/types/hash.hpp"
+#include "duckdb/main/rl_model_interface.hpp"
+
+namespace duckdb {
+
+static inline void HashString(uint64_t &fingerprint, const string &value) {
+	fingerprint = CombineHash(fingerprint, Hash(value.c_str(), value.size()));
+}
+
+static inline void HashValue(uint64_t &fingerprint, uint64_t value) {
+	fingerprint = CombineHash(fingerprint, Hash(value));
+}
+
+uint64_t CardinalityFeedbackStore::Fingerprint(const OperatorFeatures &features) {
+	// Hash only the structural features: cardinality estimates are deliberately excluded,
+	// because they change from run to run once feedback (or the RL model) kicks in
+	uint64_t fingerprint = 0;
+	HashString(fingerprint, features.operator_type);
+	HashString(fingerprint, features.table_name);
+	HashValue(fingerprint, features.num_table_filters);
+	for (auto &filter_type : features.filter_types) {
+		HashString(fingerprint, filter_type);
+	}
+	for (auto &comparison_type : features.comparison_types) {
+		HashString(fingerprint, comparison_type);
+	}
+	for (auto &column_id : features.filter_column_ids) {
+		HashValue(fingerprint, column_id);
+	}
+	HashValue(fingerprint, features.filter_constant_count);
+	fingerprint = CombineHash(fingerprint, Hash(features.filter_constant_numeric_log_mean));
+	fingerprint = CombineHash(fingerprint, Hash(features.filter_constant_string_log_mean));
+	HashString(fingerprint, features.join_type);
+	HashString(fingerprint, features.comparison_type_join);
+	HashString(fingerprint, features.join_relation_set);
+	HashValue(fingerprint, features.join_condition_count);
+	HashValue(fingerprint, features.join_equality_condition_count);
+	fingerprint = CombineHash(fingerprint, Hash(features.join_key_signature_hash));
+	HashValue(fingerprint, features.num_relations);
+	HashValue(fingerprint, features.num_group_by_columns);
+	HashValue(fingerprint, features.num_aggregate_functions);
+	HashValue(fingerprint, features.num_grouping_sets);
+	return fingerprint;
+}
+
+void CardinalityFeedbackStore::RecordObservation(uint64_t fingerprint, idx_t actual_cardinality) {
+	lock_guard<mutex> guard(lock);
+	auto entry = observations.find(fingerprint);
+	if (entry != observations.end()) {
+		// the most recent execution wins - parameters may have shifted since the first run
+		entry->second = actual_cardinality;
+		return;
+	}
+	if (observations.size() >= MAXIMUM_ENTRIES) {
+		// full - drop the observation rather than growing without bound
+		return;
+	}
+	observations.emplace(fingerprint, actual_cardinality);
+}
+
+bool CardinalityFeedbackStore::TryGetObservation(uint64_t fingerprint, idx_t &actual_cardinality) const {
+	lock_guard<mutex> guard(lock);
+	auto entry = observations.find(fingerprint);
+	if (entry == observations.end()) {
+		return false;
+	}
+	actual_cardinality = entry->second;
+	return true;
+}
+
+} // namespace duckdb
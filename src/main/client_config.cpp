@@ -1,6 +1,9 @@
 #include "duckdb/main/client_config.hpp"
 
 #include "duckdb/common/file_system.hpp"
+#include "duckdb/common/string_util.hpp"
+
+#include <algorithm>
 
 namespace duckdb {
 
@@ -8,6 +11,25 @@ bool ClientConfig::AnyVerification() const {
 	return query_verification_enabled || verify_external || verify_serializer || verify_fetch_row;
 }
 
+string ClientConfig::SessionSettingsFingerprint() const {
+	vector<string> entries;
+	// session-local settings (e.g. integer_division) change how a statement parses or binds
+	for (auto &entry : set_variables) {
+		entries.push_back(StringUtil::Lower(entry.first) + "=" + entry.second.ToString());
+	}
+	// user variables are folded into the plan as constants when the statement binds
+	for (auto &entry : user_variables) {
+		entries.push_back("$" + StringUtil::Lower(entry.first) + "=" + entry.second.ToString());
+	}
+	// the maps are unordered - sort for a stable fingerprint
+	std::sort(entries.begin(), entries.end());
+	auto result = StringUtil::Join(entries, ";");
+	// session state that lives outside the generic settings map but affects parsing/binding
+	result += "|" + to_string(max_expression_depth);
+	result += "|" + to_string(static_cast<uint8_t>(lambda_syntax));
+	return result;
+}
+
 void ClientConfig::SetUserVariable(const String &name, Value value) {
 	user_variables[name.ToStdString()] = std::move(value);
 }
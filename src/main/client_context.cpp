@@ -7,6 +7,7 @@
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/progress_bar/progress_bar.hpp"
 #include "duckdb/common/serializer/buffered_file_writer.hpp"
+#include "duckdb/common/thread.hpp"
 #include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/execution/column_binding_resolver.hpp"
 #include "duckdb/execution/operator/helper/physical_result_collector.hpp"
@@ -17,11 +18,13 @@
 #include "duckdb/main/client_context_state.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_cache.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/error_manager.hpp"
 #include "duckdb/main/materialized_query_result.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/query_result.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/relation.hpp"
 #include "duckdb/main/stream_query_result.hpp"
 #include "duckdb/optimizer/optimizer.hpp"
@@ -432,6 +435,11 @@ ClientContext::CreatePreparedStatementInternal(ClientContextLock &lock, const st
 #endif
 	}
 
+	if (DBConfig::GetConfig(*this).options.enable_result_cache) {
+		// determine whether the result of this statement may be stored in the query result cache
+		result->properties.result_cacheable = QueryResultCache::IsResultCacheable(*logical_plan);
+	}
+
 	// Convert the logical query plan into a physical query plan.
 	profiler.StartPhase(MetricsType::PHYSICAL_PLANNER);
 	PhysicalPlanGenerator physical_planner(*this);
@@ -733,11 +741,21 @@ unique_ptr<PreparedStatement> ClientContext::PrepareInternal(ClientContextLock &
                                                              unique_ptr<SQLStatement> statement) {
 	auto named_param_map = statement->named_param_map;
 	auto statement_query = statement->query;
+	// check whether another connection has returned a plan for this statement text bound under the
+	// same default database, search path and session settings - stale plans are caught by the
+	// catalog version checks in RequireRebind when executing
+	auto cache_key = PreparedStatementCache::CreateCacheKey(*this, statement_query);
+	auto cached_data = DatabaseInstance::GetDatabase(*this).GetPreparedStatementCache().Checkout(cache_key);
+	if (cached_data) {
+		return make_uniq<PreparedStatement>(shared_from_this(), std::move(cached_data), std::move(statement_query),
+		                                    std::move(named_param_map));
+	}
 	shared_ptr<PreparedStatementData> prepared_data;
 	auto unbound_statement = statement->Copy();
 	RunFunctionInTransactionInternal(
 	    lock, [&]() { prepared_data = CreatePreparedStatement(lock, statement_query, std::move(statement)); }, false);
 	prepared_data->unbound_statement = std::move(unbound_statement);
+	prepared_data->cache_key = std::move(cache_key);
 	return make_uniq<PreparedStatement>(shared_from_this(), std::move(prepared_data), std::move(statement_query),
 	                                    std::move(named_param_map));
 }
@@ -995,6 +1013,22 @@ unique_ptr<QueryResult> ClientContext::Query(unique_ptr<SQLStatement> statement,
 	return pending_query->Execute();
 }
 
+//! Whether a statement can take part in pipelined batch execution. The current statement must not be able
+//! to change state the next statement's binding depends on, and the next statement must be one whose plan
+//! can be prepared ahead of time - plain reads and data modifications qualify, DDL and
+//! transaction/setting-related statements do not.
+static bool IsPipelineSafeStatement(StatementType type) {
+	switch (type) {
+	case StatementType::SELECT_STATEMENT:
+	case StatementType::INSERT_STATEMENT:
+	case StatementType::UPDATE_STATEMENT:
+	case StatementType::DELETE_STATEMENT:
+		return true;
+	default:
+		return false;
+	}
+}
+
 unique_ptr<QueryResult> ClientContext::Query(const string &query, bool allow_stream_result) {
 	auto lock = LockContext();
 
@@ -1013,21 +1047,108 @@ unique_ptr<QueryResult> ClientContext::Query(const string &query, bool allow_str
 		                                          std::move(collection), GetClientProperties());
 	}
 
+	// check the query result cache - repeated read-only queries can be answered without re-execution
+	optional_ptr<QueryResultCache> result_cache;
+	vector<pair<string, transaction_t>> result_cache_versions;
+	if (DBConfig::GetConfig(*this).options.enable_result_cache && statements.size() == 1 &&
+	    statements[0]->type == StatementType::SELECT_STATEMENT && transaction.IsAutoCommit()) {
+		// the commit-version snapshot is taken before executing - CacheResult refuses to store the result
+		// if a commit lands while the query runs, since the result might not reflect that commit
+		if (QueryResultCache::GetDatabaseVersions(*this, result_cache_versions)) {
+			result_cache = db->GetQueryResultCache();
+			auto cached_result = result_cache->GetResult(*this, query, result_cache_versions);
+			if (cached_result) {
+				return std::move(cached_result);
+			}
+		}
+	}
+
 	unique_ptr<QueryResult> result;
 	optional_ptr<QueryResult> last_result;
 	bool last_had_result = false;
+	// pipelined execution over the batch: while statement N executes, a helper context binds and plans
+	// statement N+1 on a background thread, so small statements don't pay a planning gap between each other.
+	// A pre-bound plan is validated by the catalog version checks in RequireRebind before it runs, exactly
+	// like a plan recycled through the prepared statement cache, so a statement that does change the catalog
+	// only costs us the speculative bind - never correctness.
+	shared_ptr<ClientContext> speculative_context;
+	std::thread speculative_thread;
+	shared_ptr<PreparedStatementData> speculative_prepared;
+	idx_t speculative_index = DConstants::INVALID_INDEX;
 	for (idx_t i = 0; i < statements.size(); i++) {
 		auto &statement = statements[i];
 		bool is_last_statement = i + 1 == statements.size();
 		PendingQueryParameters parameters;
 		parameters.allow_stream_result = allow_stream_result && is_last_statement;
-		auto pending_query = PendingQueryInternal(*lock, std::move(statement), parameters);
+		const auto current_statement_type = statement->type;
+		unique_ptr<PendingQueryResult> pending_query;
+		if (i == speculative_index && speculative_prepared) {
+			// the previous iteration pre-bound this statement in the background - execute the prepared plan
+			pending_query = PendingQueryPreparedInternal(*lock, statement->query, speculative_prepared, parameters);
+			speculative_prepared.reset();
+		} else {
+			speculative_prepared.reset();
+			pending_query = PendingQueryInternal(*lock, std::move(statement), parameters);
+		}
 		auto has_result = pending_query->properties.return_type == StatementReturnType::QUERY_RESULT;
+		if (i + 1 < statements.size() && !pending_query->HasError() && !config.query_verification_enabled &&
+		    !config.enable_profiler && IsPipelineSafeStatement(current_statement_type) &&
+		    IsPipelineSafeStatement(statements[i + 1]->type)) {
+			// bind the next statement in the background while this one executes
+			if (!speculative_context) {
+				speculative_context = make_shared_ptr<ClientContext>(db);
+				speculative_context->config = config;
+			}
+			auto &bind_context = *speculative_context;
+			// capture the session's explicitly set search path - the helper context must bind under the
+			// same binding state as this session, otherwise it can resolve a same-named table elsewhere
+			auto session_search_path = ClientData::Get(*this).catalog_search_path->GetSetPaths();
+			shared_ptr<SQLStatement> statement_copy(statements[i + 1]->Copy().release());
+			speculative_thread =
+			    std::thread([&bind_context, &speculative_prepared, statement_copy, session_search_path]() {
+				    try {
+					    auto bind_lock = bind_context.LockContext();
+					    bind_context.InitialCleanup(*bind_lock);
+					    auto unbound_statement = statement_copy->Copy();
+					    auto bound_statement = statement_copy->Copy();
+					    auto statement_query = statement_copy->query;
+					    shared_ptr<PreparedStatementData> data;
+					    bind_context.RunFunctionInTransactionInternal(
+					        *bind_lock,
+					        [&]() {
+						        ClientData::Get(bind_context)
+						            .catalog_search_path->Set(session_search_path, CatalogSetPathType::SET_SCHEMAS);
+						        data = bind_context.CreatePreparedStatement(*bind_lock, statement_query,
+						                                                    std::move(bound_statement));
+					        },
+					        false);
+					    if (data && data->properties.bound_all_parameters) {
+						    data->unbound_statement = std::move(unbound_statement);
+						    speculative_prepared = std::move(data);
+					    }
+				    } catch (...) {
+					    // speculation failed - the statement is bound again on the main path, which surfaces
+					    // any genuine error in order
+				    }
+			    });
+			speculative_index = i + 1;
+		}
 		unique_ptr<QueryResult> current_result;
-		if (pending_query->HasError()) {
-			current_result = ErrorResult<MaterializedQueryResult>(pending_query->GetErrorObject());
-		} else {
-			current_result = ExecutePendingQueryInternal(*lock, *pending_query);
+		try {
+			if (pending_query->HasError()) {
+				current_result = ErrorResult<MaterializedQueryResult>(pending_query->GetErrorObject());
+			} else {
+				current_result = ExecutePendingQueryInternal(*lock, *pending_query);
+			}
+		} catch (...) {
+			// the background bind references stack state - it must finish before we unwind
+			if (speculative_thread.joinable()) {
+				speculative_thread.join();
+			}
+			throw;
+		}
+		if (speculative_thread.joinable()) {
+			speculative_thread.join();
 		}
 		if (current_result->HasError()) {
 			// Reset the interrupted flag, this was set by the task that found the error
@@ -1052,6 +1173,9 @@ unique_ptr<QueryResult> ClientContext::Query(const string &query, bool allow_str
 		}
 		D_ASSERT(last_result);
 	}
+	if (result_cache && !result->HasError() && result->type == QueryResultType::MATERIALIZED_RESULT) {
+		result_cache->CacheResult(*this, query, result->Cast<MaterializedQueryResult>(), result_cache_versions);
+	}
 	return result;
 }
 
@@ -1491,12 +1615,14 @@ ClientProperties ClientContext::GetClientProperties() {
 	bool arrow_lossless_conversion = DBConfig::GetSetting<ArrowLosslessConversionSetting>(*this);
 	bool arrow_use_string_view = DBConfig::GetSetting<ProduceArrowStringViewSetting>(*this);
 	auto arrow_format_version = DBConfig::GetSetting<ArrowOutputVersionSetting>(*this);
+	bool arrow_zero_copy_export = DBConfig::GetSetting<ArrowZeroCopyExportSetting>(*this);
 	return {timezone,
 	        arrow_offset_size,
 	        arrow_use_list_view,
 	        arrow_use_string_view,
 	        arrow_lossless_conversion,
 	        arrow_format_version,
+	        arrow_zero_copy_export,
 	        this};
 }
 
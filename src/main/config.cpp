@@ -50,17 +50,20 @@ bool DBConfigOptions::debug_print_bindings = false;
 #define FINAL_SETTING                                                                                                  \
 	{ nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr, SetScope::AUTOMATIC, nullptr, nullptr }
 
-#define DUCKDB_SETTING_ALIAS(_ALIAS, _SETTING_INDEX)                                                                   \
-	{ _ALIAS, _SETTING_INDEX }
+#define DUCKDB_SETTING_ALIAS(_ALIAS, _TARGET)                                                                          \
+	{ _ALIAS, _TARGET::Name }
 #define FINAL_ALIAS                                                                                                    \
-	{ nullptr, 0 }
+	{ nullptr, nullptr }
 
 static const ConfigurationOption internal_options[] = {
 
     DUCKDB_GLOBAL(AccessModeSetting),
     DUCKDB_GLOBAL(AllocatorBackgroundThreadsSetting),
     DUCKDB_GLOBAL(AllocatorBulkDeallocationFlushThresholdSetting),
+    DUCKDB_GLOBAL(AllocatorDirtyDecayMsSetting),
     DUCKDB_GLOBAL(AllocatorFlushThresholdSetting),
+    DUCKDB_GLOBAL(AllocatorMemoryProfileSetting),
+    DUCKDB_GLOBAL(AllocatorMuzzyDecayMsSetting),
     DUCKDB_GLOBAL(AllowCommunityExtensionsSetting),
     DUCKDB_SETTING(AllowExtensionsMetadataMismatchSetting),
     DUCKDB_GLOBAL(AllowParserOverrideExtensionSetting),
@@ -73,12 +76,18 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_SETTING(ArrowLosslessConversionSetting),
     DUCKDB_SETTING(ArrowOutputListViewSetting),
     DUCKDB_SETTING_CALLBACK(ArrowOutputVersionSetting),
+    DUCKDB_SETTING(ArrowZeroCopyExportSetting),
     DUCKDB_SETTING(AsofLoopJoinThresholdSetting),
     DUCKDB_GLOBAL(AutoinstallExtensionRepositorySetting),
     DUCKDB_GLOBAL(AutoinstallKnownExtensionsSetting),
     DUCKDB_GLOBAL(AutoloadKnownExtensionsSetting),
+    DUCKDB_GLOBAL(BackgroundCheckpointSetting),
+    DUCKDB_GLOBAL(BackgroundCleanupSetting),
+    DUCKDB_SETTING(BatchInsertDirectFlushSetting),
     DUCKDB_SETTING(CatalogErrorMaxSchemasSetting),
     DUCKDB_GLOBAL(CheckpointThresholdSetting),
+    DUCKDB_LOCAL(CompressStreamingBufferSetting),
+    DUCKDB_SETTING_CALLBACK(CompressionScanBiasSetting),
     DUCKDB_GLOBAL(CustomExtensionRepositorySetting),
     DUCKDB_LOCAL(CustomProfilingSettingsSetting),
     DUCKDB_GLOBAL(CustomUserAgentSetting),
@@ -94,6 +103,7 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_SETTING_CALLBACK(DefaultNullOrderSetting),
     DUCKDB_SETTING_CALLBACK(DefaultOrderSetting),
     DUCKDB_GLOBAL(DefaultSecretStorageSetting),
+    DUCKDB_GLOBAL(DirectIOSetting),
     DUCKDB_GLOBAL(DisableDatabaseInvalidationSetting),
     DUCKDB_SETTING(DisableTimestamptzCastsSetting),
     DUCKDB_GLOBAL(DisabledCompressionMethodsSetting),
@@ -108,11 +118,13 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_LOCAL(EnableHTTPLoggingSetting),
     DUCKDB_GLOBAL(EnableHTTPMetadataCacheSetting),
     DUCKDB_GLOBAL(EnableLogging),
+    DUCKDB_GLOBAL(EnableLoggingAsync),
     DUCKDB_SETTING(EnableMacroDependenciesSetting),
     DUCKDB_SETTING(EnableObjectCacheSetting),
     DUCKDB_LOCAL(EnableProfilingSetting),
     DUCKDB_LOCAL(EnableProgressBarSetting),
     DUCKDB_LOCAL(EnableProgressBarPrintSetting),
+    DUCKDB_GLOBAL(EnableResultCacheSetting),
     DUCKDB_SETTING(EnableViewDependenciesSetting),
     DUCKDB_GLOBAL(EnabledLogTypes),
     DUCKDB_LOCAL(ErrorsAsJSONSetting),
@@ -176,16 +188,17 @@ static const ConfigurationOption internal_options[] = {
     DUCKDB_GLOBAL(TempFileEncryptionSetting),
     DUCKDB_GLOBAL(ThreadsSetting),
     DUCKDB_GLOBAL(UsernameSetting),
+    DUCKDB_SETTING(WALGroupCommitWaitSetting),
     DUCKDB_SETTING(WriteBufferRowGroupCountSetting),
     DUCKDB_GLOBAL(ZstdMinStringLengthSetting),
     FINAL_SETTING};
 
-static const ConfigurationAlias setting_aliases[] = {DUCKDB_SETTING_ALIAS("memory_limit", 84),
-                                                     DUCKDB_SETTING_ALIAS("null_order", 34),
-                                                     DUCKDB_SETTING_ALIAS("profiling_output", 103),
-                                                     DUCKDB_SETTING_ALIAS("user", 118),
-                                                     DUCKDB_SETTING_ALIAS("wal_autocheckpoint", 21),
-                                                     DUCKDB_SETTING_ALIAS("worker_threads", 117),
+static const ConfigurationAlias setting_aliases[] = {DUCKDB_SETTING_ALIAS("memory_limit", MaxMemorySetting),
+                                                     DUCKDB_SETTING_ALIAS("null_order", DefaultNullOrderSetting),
+                                                     DUCKDB_SETTING_ALIAS("profiling_output", ProfileOutputSetting),
+                                                     DUCKDB_SETTING_ALIAS("user", UsernameSetting),
+                                                     DUCKDB_SETTING_ALIAS("wal_autocheckpoint", CheckpointThresholdSetting),
+                                                     DUCKDB_SETTING_ALIAS("worker_threads", ThreadsSetting),
                                                      FINAL_ALIAS};
 
 vector<ConfigurationOption> DBConfig::GetOptions() {
@@ -254,9 +267,8 @@ optional_ptr<const ConfigurationOption> DBConfig::GetOptionByName(const String &
 		}
 	}
 	for (idx_t index = 0; setting_aliases[index].alias; index++) {
-		D_ASSERT(StringUtil::Lower(internal_options[index].name) == string(internal_options[index].name));
 		if (setting_aliases[index].alias == lname) {
-			return GetOptionByIndex(setting_aliases[index].option_index);
+			return GetOptionByName(string(setting_aliases[index].target));
 		}
 	}
 	return nullptr;
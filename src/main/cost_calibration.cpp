@@ -0,0 +1,178 @@
+#include "duckdb/main/cost_calibration.hpp"
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/fstream.hpp"
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/profiler.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/vector.hpp"
+
+#include <cmath>
+#include <unordered_map>
+
+namespace duckdb {
+
+//! Number of tuples each microbenchmark runs over: large enough to exceed the caches on
+//! typical machines, small enough that calibration finishes in well under a second
+static constexpr idx_t CALIBRATION_TUPLE_COUNT = 1ULL << 22;
+
+static mutex calibration_lock;
+static unique_ptr<CostConstants> cached_constants;
+
+string CostCalibration::CalibrationFilePath(FileSystem &fs) {
+	auto home_directory = fs.GetHomeDirectory();
+	auto duckdb_directory = fs.JoinPath(home_directory, ".duckdb");
+	return fs.JoinPath(duckdb_directory, "cost_calibration");
+}
+
+CostConstants CostCalibration::Load(FileSystem &fs) {
+	CostConstants result;
+	auto path = CalibrationFilePath(fs);
+	if (!fs.FileExists(path)) {
+		return result;
+	}
+	std::ifstream file(path);
+	if (!file.good()) {
+		return result;
+	}
+	idx_t parsed_entries = 0;
+	string line;
+	while (std::getline(file, line)) {
+		auto splits = StringUtil::Split(line, '=');
+		if (splits.size() != 2) {
+			continue;
+		}
+		double value;
+		try {
+			value = std::stod(splits[1]);
+		} catch (...) {
+			continue;
+		}
+		if (!std::isfinite(value) || value <= 0) {
+			continue;
+		}
+		if (splits[0] == "scan_ns_per_tuple") {
+			result.scan_ns_per_tuple = value;
+		} else if (splits[0] == "hash_build_ns_per_tuple") {
+			result.hash_build_ns_per_tuple = value;
+		} else if (splits[0] == "hash_probe_ns_per_tuple") {
+			result.hash_probe_ns_per_tuple = value;
+		} else if (splits[0] == "materialization_ns_per_tuple") {
+			result.materialization_ns_per_tuple = value;
+		} else {
+			continue;
+		}
+		parsed_entries++;
+	}
+	if (parsed_entries != 4) {
+		// incomplete or malformed file - fall back to the defaults
+		return CostConstants();
+	}
+	result.calibrated = true;
+	return result;
+}
+
+void CostCalibration::Store(FileSystem &fs, const CostConstants &constants) {
+	auto home_directory = fs.GetHomeDirectory();
+	if (!fs.DirectoryExists(home_directory)) {
+		throw IOException("Can't find the home directory at '%s' to persist the cost calibration\nSpecify a home "
+		                  "directory using the SET home_directory='/path/to/dir' option.",
+		                  home_directory);
+	}
+	auto duckdb_directory = fs.JoinPath(home_directory, ".duckdb");
+	if (!fs.DirectoryExists(duckdb_directory)) {
+		fs.CreateDirectory(duckdb_directory);
+	}
+	auto path = CalibrationFilePath(fs);
+	std::ofstream file(path);
+	if (!file.good()) {
+		throw IOException("Could not open cost calibration file '%s' for writing", path);
+	}
+	file << "scan_ns_per_tuple=" << constants.scan_ns_per_tuple << "\n";
+	file << "hash_build_ns_per_tuple=" << constants.hash_build_ns_per_tuple << "\n";
+	file << "hash_probe_ns_per_tuple=" << constants.hash_probe_ns_per_tuple << "\n";
+	file << "materialization_ns_per_tuple=" << constants.materialization_ns_per_tuple << "\n";
+}
+
+//! Cheap deterministic pseudo-random generator (splitmix64) to generate calibration keys
+static inline uint64_t CalibrationRandom(uint64_t &state) {
+	state += 0x9E3779B97F4A7C15ULL;
+	uint64_t z = state;
+	z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31);
+}
+
+CostConstants CostCalibration::Measure() {
+	CostConstants result;
+	const idx_t count = CALIBRATION_TUPLE_COUNT;
+	Profiler profiler;
+
+	vector<uint64_t> tuples(count);
+	uint64_t seed = 0;
+	for (idx_t i = 0; i < count; i++) {
+		tuples[i] = CalibrationRandom(seed);
+	}
+	// accumulate into a volatile sink so the compiler cannot elide the benchmark loops
+	volatile uint64_t sink = 0;
+
+	// per-tuple cost of a sequential scan
+	profiler.Start();
+	uint64_t sum = 0;
+	for (idx_t i = 0; i < count; i++) {
+		sum += tuples[i];
+	}
+	profiler.End();
+	sink = sink + sum;
+	result.scan_ns_per_tuple = profiler.Elapsed() * 1e9 / static_cast<double>(count);
+
+	// per-tuple cost of building a hash table
+	std::unordered_map<uint64_t, uint64_t> hash_table;
+	hash_table.reserve(count);
+	profiler.Start();
+	for (idx_t i = 0; i < count; i++) {
+		hash_table.emplace(tuples[i], i);
+	}
+	profiler.End();
+	result.hash_build_ns_per_tuple = profiler.Elapsed() * 1e9 / static_cast<double>(count);
+
+	// per-tuple cost of probing the hash table (all probes hit)
+	profiler.Start();
+	uint64_t hits = 0;
+	for (idx_t i = 0; i < count; i++) {
+		hits += hash_table.find(tuples[count - 1 - i]) != hash_table.end();
+	}
+	profiler.End();
+	sink = sink + hits;
+	result.hash_probe_ns_per_tuple = profiler.Elapsed() * 1e9 / static_cast<double>(count);
+
+	// per-tuple cost of materializing (copying) tuples into a fresh buffer
+	vector<uint64_t> materialized(count);
+	profiler.Start();
+	memcpy(materialized.data(), tuples.data(), count * sizeof(uint64_t));
+	profiler.End();
+	sink = sink + materialized[count / 2];
+	result.materialization_ns_per_tuple = profiler.Elapsed() * 1e9 / static_cast<double>(count);
+
+	(void)sink;
+	result.calibrated = true;
+	return result;
+}
+
+CostConstants CostCalibration::Get(FileSystem &fs) {
+	lock_guard<mutex> guard(calibration_lock);
+	if (!cached_constants) {
+		cached_constants = make_uniq<CostConstants>(Load(fs));
+	}
+	return *cached_constants;
+}
+
+CostConstants CostCalibration::Calibrate(FileSystem &fs) {
+	auto constants = Measure();
+	Store(fs, constants);
+	lock_guard<mutex> guard(calibration_lock);
+	cached_constants = make_uniq<CostConstants>(constants);
+	return constants;
+}
+
+} // namespace duckdb
@@ -1,8 +1,16 @@
 #include "duckdb/main/database.hpp"
 
 #include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/connection.hpp"
+#include "duckdb/parser/qualified_name.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
 #include "duckdb/common/virtual_file_system.hpp"
 #include "duckdb/main/rl_training_buffer.hpp"
+#include "duckdb/main/rl_cardinality_model.hpp"
 // Note: RLTrainingThread not used - we do synchronous training with XGBoost
 // #include "duckdb/main/rl_training_thread.hpp"
 #include "duckdb/execution/index/index_type_set.hpp"
@@ -17,12 +25,17 @@
 #include "duckdb/main/database_path_and_type.hpp"
 #include "duckdb/main/db_instance_cache.hpp"
 #include "duckdb/main/error_manager.hpp"
+#include "duckdb/optimizer/join_order/join_order_memo.hpp"
 #include "duckdb/main/extension_helper.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/attach_info.hpp"
 #include "duckdb/planner/collation_binding.hpp"
 #include "duckdb/planner/extension_callback.hpp"
+#include "duckdb/main/query_result_cache.hpp"
+#include "duckdb/main/prepared_statement_cache.hpp"
+#include "duckdb/main/materialized_view_registry.hpp"
+#include "duckdb/main/cardinality_feedback.hpp"
 #include "duckdb/storage/object_cache.hpp"
 #include "duckdb/storage/standard_buffer_manager.hpp"
 #include "duckdb/storage/storage_extension.hpp"
@@ -104,6 +117,11 @@ DatabaseInstance::~DatabaseInstance() {
 	}
 	// destroy child elements
 	connection_manager.reset();
+	query_result_cache.reset();
+	prepared_statement_cache.reset();
+	materialized_view_registry.reset();
+	cardinality_feedback_store.reset();
+	join_order_memo.reset();
 	object_cache.reset();
 	scheduler.reset();
 	db_manager.reset();
@@ -113,6 +131,11 @@ DatabaseInstance::~DatabaseInstance() {
 
 	external_file_cache.reset();
 
+	// Persist this database's trained cardinality model next to the database file (if any)
+	if (rl_cardinality_model) {
+		rl_cardinality_model->SaveSnapshot();
+	}
+
 	// Clean up RL training infrastructure
 	rl_training_thread.reset();
 	rl_training_buffer.reset();
@@ -319,6 +342,11 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 
 	scheduler = make_uniq<TaskScheduler>(*this);
 	object_cache = make_uniq<ObjectCache>();
+	query_result_cache = make_uniq<QueryResultCache>();
+	prepared_statement_cache = make_uniq<PreparedStatementCache>();
+	materialized_view_registry = make_uniq<MaterializedViewRegistry>();
+	cardinality_feedback_store = make_uniq<CardinalityFeedbackStore>();
+	join_order_memo = make_uniq<JoinOrderMemo>();
 	connection_manager = make_uniq<ConnectionManager>();
 	extension_manager = make_uniq<ExtensionManager>(*this);
 
@@ -329,6 +357,19 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	auto &fs = FileSystem::GetFileSystem(*this);
 	DBPathAndType::ResolveDatabaseType(fs, config.options.database_path, config.options.database_type);
 
+	// set up the per-database cardinality model: share the process base model until the first
+	// training update (copy-on-write), and load a persisted snapshot stored alongside the
+	// database file so a restart does not throw away online training
+	rl_cardinality_model = RLCardinalityModel::GetBaseShared();
+	if (!config.options.database_path.empty()) {
+		auto model_snapshot_path = config.options.database_path + ".rlmodel";
+		// loading a snapshot mutates weights, so detach from the base model first
+		lock_guard<mutex> model_guard(rl_cardinality_model_lock);
+		rl_cardinality_model = rl_cardinality_model->Clone();
+		rl_cardinality_model->LoadWeights(model_snapshot_path);
+		rl_cardinality_model->SetSnapshotPath(model_snapshot_path);
+	}
+
 	// initialize the system catalog
 	db_manager->InitializeSystemCatalog();
 
@@ -352,6 +393,70 @@ void DatabaseInstance::Initialize(const char *database_path, DBConfig *user_conf
 	// only increase thread count after storage init because we get races on catalog otherwise
 	scheduler->SetThreads(config.options.maximum_threads, config.options.external_threads);
 	scheduler->RelaunchThreads();
+
+	// speculatively load the extensions this database used before in the background,
+	// so the first query touching them does not block on extension loading
+	extension_manager->StartSpeculativeAutoload();
+}
+
+//===--------------------------------------------------------------------===//
+// Warmup
+//===--------------------------------------------------------------------===//
+static void WarmupTableMetadata(ClientContext &context) {
+	// force the lazily deserialized column metadata of every table into memory
+	for (auto &schema_ref : Catalog::GetAllSchemas(context)) {
+		schema_ref.get().Scan(context, CatalogType::TABLE_ENTRY, [&](CatalogEntry &entry) {
+			auto &table_entry = entry.Cast<TableCatalogEntry>();
+			if (!table_entry.IsDuckTable()) {
+				return;
+			}
+			table_entry.GetStorage().GetColumnSegmentInfo(QueryContext(context));
+		});
+	}
+}
+
+static void WarmupHotTable(ClientContext &context, const string &table_name) {
+	auto qname = QualifiedName::Parse(table_name);
+	Binder::BindSchemaOrCatalog(context, qname.catalog, qname.schema);
+	auto &table_entry = Catalog::GetEntry<TableCatalogEntry>(context, qname.catalog, qname.schema, qname.name);
+	if (!table_entry.IsDuckTable()) {
+		throw NotImplementedException("Warming up tables is only supported for DuckDB tables");
+	}
+	auto &storage = table_entry.GetStorage();
+	// pin first, so that the blocks the warmup scan pages in are protected from eviction
+	storage.SetBlocksMemoryPinned(true);
+	// scan the full table once to page its blocks into the buffer pool
+	auto &transaction = DuckTransaction::Get(context, table_entry.catalog);
+	auto total_rows = storage.GetTotalRows();
+	if (total_rows > 0) {
+		storage.ScanTableSegment(transaction, 0, total_rows, [](DataChunk &chunk) {});
+	}
+}
+
+void DatabaseInstance::Warmup(const vector<string> &hot_tables) {
+	// run within a connection so catalog lookups and scans have a transaction context
+	Connection con(*this);
+	con.BeginTransaction();
+	auto &context = *con.context;
+
+	WarmupTableMetadata(context);
+	for (auto &table_name : hot_tables) {
+		WarmupHotTable(context, table_name);
+	}
+	con.Rollback();
+
+	// refresh the per-database cardinality model from its snapshot, so that a warm standby picks up
+	// the online training its primary has persisted since this instance was started
+	if (!config.options.database_path.empty()) {
+		lock_guard<mutex> model_guard(rl_cardinality_model_lock);
+		if (rl_cardinality_model) {
+			rl_cardinality_model->LoadWeights(config.options.database_path + ".rlmodel");
+		}
+	}
+}
+
+void DuckDB::Warmup(const vector<string> &hot_tables) {
+	instance->Warmup(hot_tables);
 }
 
 DuckDB::DuckDB(const char *path, DBConfig *new_config) : instance(make_shared_ptr<DatabaseInstance>()) {
@@ -403,6 +508,26 @@ ObjectCache &DatabaseInstance::GetObjectCache() {
 	return *object_cache;
 }
 
+QueryResultCache &DatabaseInstance::GetQueryResultCache() {
+	return *query_result_cache;
+}
+
+PreparedStatementCache &DatabaseInstance::GetPreparedStatementCache() {
+	return *prepared_statement_cache;
+}
+
+MaterializedViewRegistry &DatabaseInstance::GetMaterializedViewRegistry() {
+	return *materialized_view_registry;
+}
+
+CardinalityFeedbackStore &DatabaseInstance::GetCardinalityFeedbackStore() {
+	return *cardinality_feedback_store;
+}
+
+JoinOrderMemo &DatabaseInstance::GetJoinOrderMemo() {
+	return *join_order_memo;
+}
+
 FileSystem &DatabaseInstance::GetFileSystem() {
 	return *db_file_system;
 }
@@ -564,6 +689,21 @@ RLTrainingBuffer &DatabaseInstance::GetRLTrainingBuffer() {
 	return *rl_training_buffer;
 }
 
+RLCardinalityModel &DatabaseInstance::GetRLCardinalityModel() {
+	lock_guard<mutex> guard(rl_cardinality_model_lock);
+	return *rl_cardinality_model;
+}
+
+RLCardinalityModel &DatabaseInstance::GetRLCardinalityModelForUpdate() {
+	lock_guard<mutex> guard(rl_cardinality_model_lock);
+	// copy-on-write: detach from the shared base model before the first weight update so
+	// this database trains independently of other tenants in the process
+	if (rl_cardinality_model == RLCardinalityModel::GetBaseShared()) {
+		rl_cardinality_model = rl_cardinality_model->Clone();
+	}
+	return *rl_cardinality_model;
+}
+
 RLTrainingThread &DatabaseInstance::GetRLTrainingThread() {
 	D_ASSERT(rl_training_thread);
 	return *rl_training_thread;
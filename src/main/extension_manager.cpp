@@ -1,5 +1,9 @@
 #include "duckdb/main/extension_manager.hpp"
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/planner/extension_callback.hpp"
 #include "duckdb/main/extension_helper.hpp"
 #include "duckdb/logging/log_manager.hpp"
@@ -22,6 +26,9 @@ void ExtensionActiveLoad::FinishLoad(ExtensionInstallInfo &install_info) {
 		callback->OnExtensionLoaded(db, extension_name);
 	}
 	DUCKDB_LOG_INFO(db, extension_name);
+
+	// remember this extension so the next startup of this database can load it speculatively
+	ExtensionManager::Get(db).RecordExtensionUsage(extension_name);
 }
 
 void ExtensionActiveLoad::LoadFail(const ErrorData &error) {
@@ -112,4 +119,132 @@ unique_ptr<ExtensionActiveLoad> ExtensionManager::BeginLoad(const string &name)
 	return result;
 }
 
+//===--------------------------------------------------------------------===//
+// Speculative Autoload
+//===--------------------------------------------------------------------===//
+//! Upper bound on the number of extensions kept in the usage history
+static constexpr idx_t MAX_EXTENSION_USAGE_ENTRIES = 16;
+
+class SpeculativeAutoloadTask : public Task {
+public:
+	explicit SpeculativeAutoloadTask(DatabaseInstance &db) : db_instance(db.shared_from_this()) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		auto &db = *db_instance;
+		auto extensions = ExtensionManager::Get(db).ReadUsageHistory();
+		for (auto &extension_name : extensions) {
+			if (!ExtensionHelper::CanAutoloadExtension(extension_name)) {
+				continue;
+			}
+			// the load is speculative - a failure here is not an error, the query path retries and reports
+			ExtensionHelper::TryAutoLoadExtension(db, extension_name);
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+	string TaskType() const override {
+		return "SpeculativeAutoloadTask";
+	}
+
+private:
+	//! Keep the database alive while the task is in flight
+	shared_ptr<DatabaseInstance> db_instance;
+};
+
+string ExtensionManager::UsageHistoryPath() const {
+	auto &database_path = DBConfig::GetConfig(db).options.database_path;
+	if (database_path.empty()) {
+		// in-memory database - there is no place to persist the history
+		return string();
+	}
+	return database_path + ".extensions";
+}
+
+vector<string> ExtensionManager::ReadUsageHistory() {
+	vector<string> result;
+	auto history_path = UsageHistoryPath();
+	if (history_path.empty()) {
+		return result;
+	}
+	auto &fs = FileSystem::GetFileSystem(db);
+	try {
+		if (!fs.FileExists(history_path)) {
+			return result;
+		}
+		auto handle = fs.OpenFile(history_path, FileFlags::FILE_FLAGS_READ);
+		auto file_size = handle->GetFileSize();
+		string content(file_size, '\0');
+		handle->Read((void *)content.data(), file_size, 0);
+		for (auto &line : StringUtil::Split(content, '\n')) {
+			StringUtil::Trim(line);
+			if (!line.empty()) {
+				result.push_back(StringUtil::Lower(line));
+			}
+		}
+	} catch (...) {
+		// the history is advisory - ignore unreadable files
+		result.clear();
+	}
+	return result;
+}
+
+void ExtensionManager::RecordExtensionUsage(const string &extension_name_p) {
+	auto extension_name = ExtensionHelper::GetExtensionName(extension_name_p);
+	if (!ExtensionHelper::CanAutoloadExtension(extension_name)) {
+		// only remember extensions that can be loaded again without user interaction
+		return;
+	}
+	auto history_path = UsageHistoryPath();
+	if (history_path.empty()) {
+		return;
+	}
+	lock_guard<mutex> guard(usage_history_lock);
+	auto history = ReadUsageHistory();
+	for (auto &entry : history) {
+		if (entry == extension_name) {
+			// already recorded
+			return;
+		}
+	}
+	history.push_back(extension_name);
+	if (history.size() > MAX_EXTENSION_USAGE_ENTRIES) {
+		history.erase(history.begin(), history.begin() + NumericCast<int64_t>(history.size() -
+		                                                                      MAX_EXTENSION_USAGE_ENTRIES));
+	}
+	string content;
+	for (auto &entry : history) {
+		content += entry;
+		content += "\n";
+	}
+	try {
+		auto &fs = FileSystem::GetFileSystem(db);
+		auto handle =
+		    fs.OpenFile(history_path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE_NEW);
+		handle->Write(QueryContext(), (void *)content.data(), content.size(), 0);
+	} catch (...) {
+		// persisting the history is best-effort
+	}
+}
+
+void ExtensionManager::StartSpeculativeAutoload() {
+	if (!DBConfig::GetConfig(db).options.autoload_known_extensions) {
+		return;
+	}
+	if (UsageHistoryPath().empty()) {
+		return;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db);
+	if (scheduler.NumberOfThreads() <= 1) {
+		// no background workers - loading up-front would just move the cost into startup
+		return;
+	}
+	lock_guard<mutex> guard(usage_history_lock);
+	if (!autoload_producer) {
+		autoload_producer = scheduler.CreateProducer();
+	}
+	shared_ptr<Task> task = make_shared_ptr<SpeculativeAutoloadTask>(db);
+	scheduler.ScheduleTask(*autoload_producer, task);
+}
+
 } // namespace duckdb
@@ -0,0 +1,133 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/hardware_counters.cpp
+//
+//===----------------------------------------------------------------------===//
+
+#include "duckdb/main/hardware_counters.hpp"
+
+#if defined(__linux__)
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace duckdb {
+
+#if defined(__linux__)
+
+static int OpenPerfEvent(uint32_t type, uint64_t config, int group_fd) {
+	perf_event_attr attr;
+	memset(&attr, 0, sizeof(attr));
+	attr.type = type;
+	attr.size = sizeof(attr);
+	attr.config = config;
+	attr.disabled = group_fd == -1 ? 1 : 0;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	attr.read_format = PERF_FORMAT_GROUP;
+	// measure the calling thread only, on any CPU it gets scheduled on
+	return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+
+HardwareCounterSampler::HardwareCounterSampler() {
+	cycles_fd = OpenPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+	if (cycles_fd == -1) {
+		// no permission (perf_event_paranoid) or no PMU (e.g. some VMs) - stay unavailable
+		return;
+	}
+	llc_misses_fd = OpenPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES, cycles_fd);
+	branch_misses_fd = OpenPerfEvent(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, cycles_fd);
+	if (llc_misses_fd == -1 || branch_misses_fd == -1) {
+		// partial groups would silently report zeroes for the missing events - all or nothing
+		if (llc_misses_fd != -1) {
+			close(llc_misses_fd);
+			llc_misses_fd = -1;
+		}
+		close(cycles_fd);
+		cycles_fd = -1;
+		return;
+	}
+	ioctl(cycles_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	available = true;
+}
+
+HardwareCounterSampler::~HardwareCounterSampler() {
+	if (branch_misses_fd != -1) {
+		close(branch_misses_fd);
+	}
+	if (llc_misses_fd != -1) {
+		close(llc_misses_fd);
+	}
+	if (cycles_fd != -1) {
+		close(cycles_fd);
+	}
+}
+
+bool HardwareCounterSampler::ReadCounters(HardwareCounterSample &sample) {
+	// PERF_FORMAT_GROUP layout: nr followed by one value per event, in creation order
+	struct {
+		uint64_t nr;
+		uint64_t values[3];
+	} data;
+	if (read(cycles_fd, &data, sizeof(data)) != sizeof(data) || data.nr != 3) {
+		return false;
+	}
+	sample.cycles = data.values[0];
+	sample.llc_misses = data.values[1];
+	sample.branch_misses = data.values[2];
+	return true;
+}
+
+void HardwareCounterSampler::Start() {
+	if (!available) {
+		return;
+	}
+	if (!ReadCounters(start_sample)) {
+		available = false;
+	}
+}
+
+HardwareCounterSample HardwareCounterSampler::Stop() {
+	HardwareCounterSample delta;
+	if (!available) {
+		return delta;
+	}
+	HardwareCounterSample end_sample;
+	if (!ReadCounters(end_sample)) {
+		available = false;
+		return delta;
+	}
+	delta.cycles = end_sample.cycles - start_sample.cycles;
+	delta.llc_misses = end_sample.llc_misses - start_sample.llc_misses;
+	delta.branch_misses = end_sample.branch_misses - start_sample.branch_misses;
+	return delta;
+}
+
+#else
+
+// Portable fallback: no hardware counters - the metrics remain zero
+
+HardwareCounterSampler::HardwareCounterSampler() {
+}
+
+HardwareCounterSampler::~HardwareCounterSampler() {
+}
+
+bool HardwareCounterSampler::ReadCounters(HardwareCounterSample &) {
+	return false;
+}
+
+void HardwareCounterSampler::Start() {
+}
+
+HardwareCounterSample HardwareCounterSampler::Stop() {
+	return HardwareCounterSample();
+}
+
+#endif
+
+} // namespace duckdb
@@ -0,0 +1,36 @@
+#include "duckdb/main/materialized_view_registry.hpp"
+
+#include "duckdb/common/exception.hpp"
+#include "duckdb/common/exception/catalog_exception.hpp"
+
+namespace duckdb {
+
+void MaterializedViewRegistry::CreateView(const string &name, MaterializedViewDefinition definition) {
+	lock_guard<mutex> guard(lock);
+	if (views.find(name) != views.end()) {
+		throw CatalogException("Materialized view \"%s\" already exists", name);
+	}
+	views[name] = std::move(definition);
+}
+
+MaterializedViewDefinition MaterializedViewRegistry::GetView(const string &name) {
+	lock_guard<mutex> guard(lock);
+	auto entry = views.find(name);
+	if (entry == views.end()) {
+		throw CatalogException("Materialized view \"%s\" does not exist - note that materialized view definitions "
+		                       "are not persistent and must be re-created after a restart",
+		                       name);
+	}
+	return entry->second;
+}
+
+void MaterializedViewRegistry::DropView(const string &name) {
+	lock_guard<mutex> guard(lock);
+	auto entry = views.find(name);
+	if (entry == views.end()) {
+		throw CatalogException("Materialized view \"%s\" does not exist", name);
+	}
+	views.erase(entry);
+}
+
+} // namespace duckdb
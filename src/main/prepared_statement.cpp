@@ -1,6 +1,8 @@
 #include "duckdb/main/prepared_statement.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database.hpp"
+#include "duckdb/main/prepared_statement_cache.hpp"
 #include "duckdb/main/prepared_statement_data.hpp"
 
 namespace duckdb {
@@ -16,6 +18,10 @@ PreparedStatement::PreparedStatement(ErrorData error) : context(nullptr), succes
 }
 
 PreparedStatement::~PreparedStatement() {
+	if (context && data) {
+		// hand the plan back to the shared cache so other connections can skip planning this statement
+		DatabaseInstance::GetDatabase(*context).GetPreparedStatementCache().Return(std::move(data));
+	}
 }
 
 const string &PreparedStatement::GetError() {
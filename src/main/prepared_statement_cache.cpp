@@ -0,0 +1,82 @@
+#include "duckdb/main/prepared_statement_cache.hpp"
+
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/main/client_config.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/client_data.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/parser_options.hpp"
+#include "duckdb/parser/sql_statement.hpp"
+
+namespace duckdb {
+
+string PreparedStatementCache::CreateCacheKey(ClientContext &context, const string &query) {
+	// the same text resolves to different catalog entries under a different default database or
+	// search path - include the session binding state in the key so such sessions never share a plan
+	string key = DatabaseManager::GetDefaultDatabase(context);
+	auto &search_path = *ClientData::Get(context).catalog_search_path;
+	for (auto &entry : search_path.Get()) {
+		key += "\n";
+		key += entry.ToString();
+	}
+	// session settings and user variables also change how the text parses and binds
+	// (e.g. SET integer_division makes "1/2" bind to a different division function)
+	key += "\n";
+	key += ClientConfig::GetConfig(context).SessionSettingsFingerprint();
+	// the parser flags can additionally be set globally, which the session fingerprint cannot see -
+	// fold in their effective values so a global change stops matching previously cached plans
+	auto parser_options = context.GetParserOptions();
+	key += StringUtil::Format("\n%d|%d|%s", parser_options.preserve_identifier_case ? 1 : 0,
+	                          parser_options.integer_division ? 1 : 0, parser_options.parser_override_setting);
+	key += "\n";
+	key += query;
+	return key;
+}
+
+shared_ptr<PreparedStatementData> PreparedStatementCache::Checkout(const string &cache_key) {
+	lock_guard<mutex> guard(lock);
+	auto entry = cache.find(cache_key);
+	if (entry == cache.end()) {
+		return nullptr;
+	}
+	auto result = std::move(entry->second.back());
+	entry->second.pop_back();
+	if (entry->second.empty()) {
+		cache.erase(entry);
+	}
+	total_plans--;
+	return result;
+}
+
+void PreparedStatementCache::Return(shared_ptr<PreparedStatementData> data) {
+	if (!data || data->cache_key.empty() || !data->physical_plan || !data->unbound_statement) {
+		return;
+	}
+	auto &properties = data->properties;
+	if (!properties.bound_all_parameters || properties.always_require_rebind) {
+		// plans that must be rebound per execution gain nothing from caching
+		return;
+	}
+	if (!properties.modified_databases.empty()) {
+		// only share read-only plans
+		return;
+	}
+	if (data.use_count() != 1) {
+		// something still references this plan (e.g. an open result) - it is not idle
+		return;
+	}
+	lock_guard<mutex> guard(lock);
+	if (total_plans >= MAXIMUM_CACHED_PLANS) {
+		return;
+	}
+	auto &entry = cache[data->cache_key];
+	if (entry.size() >= MAXIMUM_PLANS_PER_STATEMENT) {
+		return;
+	}
+	entry.push_back(std::move(data));
+	total_plans++;
+}
+
+} // namespace duckdb
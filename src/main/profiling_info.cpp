@@ -57,6 +57,7 @@ profiler_settings_t ProfilingInfo::DefaultSettings() {
 	        MetricsType::SYSTEM_PEAK_TEMP_DIR_SIZE,
 	        MetricsType::TOTAL_BYTES_READ,
 	        MetricsType::TOTAL_BYTES_WRITTEN,
+	        MetricsType::TOTAL_SPILLED_BYTES,
 	        MetricsType::WAITING_TO_ATTACH_LATENCY,
 	        MetricsType::QUERY_NAME};
 }
@@ -70,13 +71,17 @@ profiler_settings_t ProfilingInfo::RootScopeSettings() {
 	        MetricsType::ROWS_RETURNED,
 	        MetricsType::TOTAL_BYTES_READ,
 	        MetricsType::TOTAL_BYTES_WRITTEN,
+	        MetricsType::TOTAL_SPILLED_BYTES,
 	        MetricsType::WAITING_TO_ATTACH_LATENCY,
 	        MetricsType::QUERY_NAME};
 }
 
 profiler_settings_t ProfilingInfo::OperatorScopeSettings() {
-	return {MetricsType::OPERATOR_CARDINALITY, MetricsType::OPERATOR_ROWS_SCANNED, MetricsType::OPERATOR_TIMING,
-	        MetricsType::OPERATOR_NAME, MetricsType::OPERATOR_TYPE};
+	return {MetricsType::OPERATOR_CARDINALITY,   MetricsType::OPERATOR_ROWS_SCANNED, MetricsType::OPERATOR_TIMING,
+	        MetricsType::OPERATOR_NAME,          MetricsType::OPERATOR_TYPE,         MetricsType::OPERATOR_CYCLES,
+	        MetricsType::OPERATOR_LLC_MISSES,    MetricsType::OPERATOR_BRANCH_MISSES,
+	        MetricsType::OPERATOR_ALLOCATED_MEMORY, MetricsType::OPERATOR_PEAK_LIVE_MEMORY,
+	        MetricsType::OPERATOR_WAIT_TIME};
 }
 
 void ProfilingInfo::ResetMetrics() {
@@ -95,6 +100,7 @@ void ProfilingInfo::ResetMetrics() {
 		case MetricsType::BLOCKED_THREAD_TIME:
 		case MetricsType::CPU_TIME:
 		case MetricsType::OPERATOR_TIMING:
+		case MetricsType::OPERATOR_WAIT_TIME:
 		case MetricsType::WAITING_TO_ATTACH_LATENCY:
 		case MetricsType::ATTACH_LOAD_STORAGE_LATENCY:
 		case MetricsType::ATTACH_REPLAY_WAL_LATENCY:
@@ -117,6 +123,12 @@ void ProfilingInfo::ResetMetrics() {
 		case MetricsType::SYSTEM_PEAK_TEMP_DIR_SIZE:
 		case MetricsType::TOTAL_BYTES_READ:
 		case MetricsType::TOTAL_BYTES_WRITTEN:
+		case MetricsType::TOTAL_SPILLED_BYTES:
+		case MetricsType::OPERATOR_CYCLES:
+		case MetricsType::OPERATOR_LLC_MISSES:
+		case MetricsType::OPERATOR_BRANCH_MISSES:
+		case MetricsType::OPERATOR_ALLOCATED_MEMORY:
+		case MetricsType::OPERATOR_PEAK_LIVE_MEMORY:
 			metrics[metric] = Value::CreateValue<uint64_t>(0);
 			break;
 		case MetricsType::EXTRA_INFO:
@@ -226,6 +238,7 @@ void ProfilingInfo::WriteMetricsToJSON(yyjson_mut_doc *doc, yyjson_mut_val *dest
 		case MetricsType::BLOCKED_THREAD_TIME:
 		case MetricsType::CPU_TIME:
 		case MetricsType::OPERATOR_TIMING:
+		case MetricsType::OPERATOR_WAIT_TIME:
 		case MetricsType::WAITING_TO_ATTACH_LATENCY:
 		case MetricsType::ATTACH_LOAD_STORAGE_LATENCY:
 		case MetricsType::ATTACH_REPLAY_WAL_LATENCY:
@@ -246,7 +259,13 @@ void ProfilingInfo::WriteMetricsToJSON(yyjson_mut_doc *doc, yyjson_mut_val *dest
 		case MetricsType::SYSTEM_PEAK_BUFFER_MEMORY:
 		case MetricsType::SYSTEM_PEAK_TEMP_DIR_SIZE:
 		case MetricsType::TOTAL_BYTES_READ:
-		case MetricsType::TOTAL_BYTES_WRITTEN: {
+		case MetricsType::TOTAL_BYTES_WRITTEN:
+		case MetricsType::TOTAL_SPILLED_BYTES:
+		case MetricsType::OPERATOR_CYCLES:
+		case MetricsType::OPERATOR_LLC_MISSES:
+		case MetricsType::OPERATOR_BRANCH_MISSES:
+		case MetricsType::OPERATOR_ALLOCATED_MEMORY:
+		case MetricsType::OPERATOR_PEAK_LIVE_MEMORY: {
 			yyjson_mut_obj_add_uint(doc, dest, key_ptr, metrics[metric].GetValue<uint64_t>());
 			break;
 		}
@@ -95,6 +95,7 @@ void QueryProfiler::Start(const string &query) {
 	Reset();
 	running = true;
 	query_metrics.query = query;
+	query_metrics.spilled_bytes_baseline = BufferManager::GetBufferManager(context).GetTotalSpilledBytes();
 	query_metrics.latency.Start();
 }
 
@@ -306,6 +307,11 @@ void QueryProfiler::EndQuery() {
 			if (info.Enabled(settings, MetricsType::TOTAL_BYTES_WRITTEN)) {
 				info.metrics[MetricsType::TOTAL_BYTES_WRITTEN] = Value::UBIGINT(query_metrics.total_bytes_written);
 			}
+			if (info.Enabled(settings, MetricsType::TOTAL_SPILLED_BYTES)) {
+				const auto spilled_bytes = BufferManager::GetBufferManager(context).GetTotalSpilledBytes();
+				info.metrics[MetricsType::TOTAL_SPILLED_BYTES] =
+				    Value::UBIGINT(spilled_bytes - MinValue(spilled_bytes, query_metrics.spilled_bytes_baseline));
+			}
 			if (info.Enabled(settings, MetricsType::ROWS_RETURNED)) {
 				info.metrics[MetricsType::ROWS_RETURNED] = child_info.metrics[MetricsType::OPERATOR_CARDINALITY];
 			}
@@ -511,6 +517,14 @@ OperatorProfiler::OperatorProfiler(ClientContext &context) : context(context) {
 	for (const auto metric : root_metrics) {
 		settings.erase(metric);
 	}
+
+	hardware_counters_enabled = hardware_counters.Available() &&
+	                            (ProfilingInfo::Enabled(settings, MetricsType::OPERATOR_CYCLES) ||
+	                             ProfilingInfo::Enabled(settings, MetricsType::OPERATOR_LLC_MISSES) ||
+	                             ProfilingInfo::Enabled(settings, MetricsType::OPERATOR_BRANCH_MISSES));
+
+	memory_profiling_enabled = ProfilingInfo::Enabled(settings, MetricsType::OPERATOR_ALLOCATED_MEMORY) ||
+	                           ProfilingInfo::Enabled(settings, MetricsType::OPERATOR_PEAK_LIVE_MEMORY);
 }
 
 void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_op) {
@@ -544,6 +558,13 @@ void OperatorProfiler::StartOperator(optional_ptr<const PhysicalOperator> phys_o
 		if (ProfilingInfo::Enabled(settings, MetricsType::OPERATOR_TIMING)) {
 			op.Start();
 		}
+		if (hardware_counters_enabled) {
+			hardware_counters.Start();
+		}
+		if (memory_profiling_enabled) {
+			allocation_counters.Reset();
+			Allocator::SetThreadAllocationCounters(&allocation_counters);
+		}
 	}
 }
 
@@ -561,6 +582,13 @@ void OperatorProfiler::EndOperator(optional_ptr<DataChunk> chunk) {
 			op.End();
 			info.AddTime(op.Elapsed());
 		}
+		if (hardware_counters_enabled) {
+			info.AddHardwareCounters(hardware_counters.Stop());
+		}
+		if (memory_profiling_enabled) {
+			Allocator::SetThreadAllocationCounters(nullptr);
+			info.AddAllocationCounters(allocation_counters);
+		}
 		if (ProfilingInfo::Enabled(settings, MetricsType::OPERATOR_CARDINALITY) && chunk) {
 			info.AddReturnedElements(chunk->size());
 		}
@@ -606,6 +634,14 @@ void OperatorProfiler::FinishSource(GlobalSourceState &gstate, LocalSourceState
 	}
 }
 
+void OperatorProfiler::AddWaitTime(const PhysicalOperator &phys_op, const double wait_time) {
+	if (!enabled || !ProfilingInfo::Enabled(settings, MetricsType::OPERATOR_WAIT_TIME)) {
+		return;
+	}
+	auto &info = GetOperatorInfo(phys_op);
+	info.wait_time += wait_time;
+}
+
 bool OperatorProfiler::OperatorInfoIsInitialized(const PhysicalOperator &phys_op) {
 	auto entry = operator_infos.find(phys_op);
 	return entry != operator_infos.end();
@@ -655,6 +691,25 @@ void QueryProfiler::Flush(OperatorProfiler &profiler) {
 				operator_estimated_cardinalities[op] = node.second.estimated_cardinality;
 			}
 		}
+		if (ProfilingInfo::Enabled(profiler.settings, MetricsType::OPERATOR_CYCLES)) {
+			info.MetricSum<idx_t>(MetricsType::OPERATOR_CYCLES, node.second.hardware_counters.cycles);
+		}
+		if (ProfilingInfo::Enabled(profiler.settings, MetricsType::OPERATOR_LLC_MISSES)) {
+			info.MetricSum<idx_t>(MetricsType::OPERATOR_LLC_MISSES, node.second.hardware_counters.llc_misses);
+		}
+		if (ProfilingInfo::Enabled(profiler.settings, MetricsType::OPERATOR_BRANCH_MISSES)) {
+			info.MetricSum<idx_t>(MetricsType::OPERATOR_BRANCH_MISSES, node.second.hardware_counters.branch_misses);
+		}
+		if (ProfilingInfo::Enabled(profiler.settings, MetricsType::OPERATOR_WAIT_TIME)) {
+			info.MetricSum<double>(MetricsType::OPERATOR_WAIT_TIME, node.second.wait_time);
+		}
+		if (ProfilingInfo::Enabled(profiler.settings, MetricsType::OPERATOR_ALLOCATED_MEMORY)) {
+			info.MetricSum<idx_t>(MetricsType::OPERATOR_ALLOCATED_MEMORY, node.second.allocated_memory);
+		}
+		if (ProfilingInfo::Enabled(profiler.settings, MetricsType::OPERATOR_PEAK_LIVE_MEMORY)) {
+			// peaks on different threads can overlap in time, so summing them gives an upper bound
+			info.MetricSum<idx_t>(MetricsType::OPERATOR_PEAK_LIVE_MEMORY, node.second.peak_live_memory);
+		}
 		if (ProfilingInfo::Enabled(profiler.settings, MetricsType::OPERATOR_ROWS_SCANNED)) {
 			if (op.type == PhysicalOperatorType::TABLE_SCAN) {
 				auto &scan_op = op.Cast<PhysicalTableScan>();
@@ -0,0 +1,158 @@
+#include "duckdb/main/query_result_cache.hpp"
+
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/client_context.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/prepared_statement_cache.hpp"
+#include "duckdb/planner/logical_operator_visitor.hpp"
+#include "duckdb/planner/operator/logical_get.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
+
+#include <algorithm>
+
+namespace duckdb {
+
+//===--------------------------------------------------------------------===//
+// IsResultCacheable
+//===--------------------------------------------------------------------===//
+class ResultCacheableVisitor : public LogicalOperatorVisitor {
+public:
+	bool cacheable = true;
+
+public:
+	void VisitOperator(LogicalOperator &op) override {
+		if (!cacheable) {
+			return;
+		}
+		if (op.type == LogicalOperatorType::LOGICAL_GET) {
+			auto &get = op.Cast<LogicalGet>();
+			if (get.function.name != "seq_scan" && get.function.name != "index_scan") {
+				// table functions can return different results for identical database versions (e.g. file reads)
+				cacheable = false;
+				return;
+			}
+			auto table = get.GetTable();
+			if (!table || table->temporary) {
+				// temporary tables are session-local, while the cache is shared across sessions
+				cacheable = false;
+				return;
+			}
+		}
+		VisitOperatorChildren(op);
+		VisitOperatorExpressions(op);
+	}
+
+protected:
+	void VisitExpression(unique_ptr<Expression> *expression) override {
+		if (!(*expression)->IsConsistent()) {
+			// e.g. random() or now() - re-executing the query could produce a different result
+			cacheable = false;
+		}
+	}
+};
+
+bool QueryResultCache::IsResultCacheable(LogicalOperator &plan) {
+	ResultCacheableVisitor visitor;
+	visitor.VisitOperator(plan);
+	return visitor.cacheable;
+}
+
+//===--------------------------------------------------------------------===//
+// Cache Lookup / Insertion
+//===--------------------------------------------------------------------===//
+bool QueryResultCache::GetDatabaseVersions(ClientContext &context, vector<pair<string, transaction_t>> &versions) {
+	auto databases = DatabaseManager::Get(context).GetDatabases(context);
+	for (auto &database_ptr : databases) {
+		auto &database = *database_ptr;
+		if (database.IsSystem() || database.IsTemporary()) {
+			// the system and temporary databases are not tracked - plans touching temporary tables are never cached
+			continue;
+		}
+		auto &transaction_manager = database.GetTransactionManager();
+		if (!transaction_manager.IsDuckTransactionManager()) {
+			// we cannot cheaply detect changes made through this transaction manager
+			return false;
+		}
+		versions.emplace_back(database.GetName(), DuckTransactionManager::Get(database).GetLastCommit());
+	}
+	std::sort(versions.begin(), versions.end());
+	return true;
+}
+
+string QueryResultCache::GetCacheKey(ClientContext &context, const string &query) {
+	// the same text can bind to different objects - or to different plans entirely - depending on the
+	// default database, the search path and the session settings (e.g. integer_division); reuse the
+	// prepared statement cache key so both caches agree on what "the same query" means
+	return PreparedStatementCache::CreateCacheKey(context, query);
+}
+
+unique_ptr<ColumnDataCollection> QueryResultCache::CopyCollection(const ColumnDataCollection &collection) {
+	auto copy = make_uniq<ColumnDataCollection>(Allocator::DefaultAllocator(), collection.Types());
+	for (auto &chunk : collection.Chunks()) {
+		copy->Append(chunk);
+	}
+	return copy;
+}
+
+unique_ptr<MaterializedQueryResult> QueryResultCache::GetResult(ClientContext &context, const string &query,
+                                                                const vector<pair<string, transaction_t>> &versions) {
+	auto key = GetCacheKey(context, query);
+	lock_guard<mutex> guard(lock);
+	auto entry = cache.find(key);
+	if (entry == cache.end()) {
+		return nullptr;
+	}
+	auto &cached = entry->second;
+	if (cached.database_versions != versions) {
+		// a commit has happened since the result was cached - drop the stale entry
+		cache.erase(entry);
+		return nullptr;
+	}
+	return make_uniq<MaterializedQueryResult>(cached.statement_type, cached.properties, cached.names,
+	                                          CopyCollection(*cached.collection), context.GetClientProperties());
+}
+
+void QueryResultCache::CacheResult(ClientContext &context, const string &query, MaterializedQueryResult &result,
+                                   const vector<pair<string, transaction_t>> &versions) {
+	auto &properties = result.properties;
+	if (!properties.result_cacheable || !properties.IsReadOnly() ||
+	    properties.return_type != StatementReturnType::QUERY_RESULT) {
+		return;
+	}
+	auto &collection = result.Collection();
+	if (collection.SizeInBytes() > MAXIMUM_RESULT_SIZE) {
+		return;
+	}
+	vector<pair<string, transaction_t>> current_versions;
+	if (!GetDatabaseVersions(context, current_versions)) {
+		return;
+	}
+	if (current_versions != versions) {
+		// a write transaction committed while the query executed - the result may predate that commit,
+		// so stamping it with the current versions would serve a stale result as fresh
+		return;
+	}
+
+	CachedResult cached;
+	cached.statement_type = result.statement_type;
+	cached.properties = properties;
+	cached.names = result.names;
+	cached.collection = CopyCollection(collection);
+	cached.database_versions = versions;
+
+	auto key = GetCacheKey(context, query);
+	lock_guard<mutex> guard(lock);
+	if (cache.size() >= MAXIMUM_CACHED_RESULTS && cache.find(key) == cache.end()) {
+		// evict an arbitrary entry to bound the memory footprint of the cache
+		cache.erase(cache.begin());
+	}
+	cache[key] = std::move(cached);
+}
+
+void QueryResultCache::Clear() {
+	lock_guard<mutex> guard(lock);
+	cache.clear();
+}
+
+} // namespace duckdb
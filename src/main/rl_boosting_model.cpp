@@ -1,4 +1,5 @@
 #include "duckdb/main/rl_boosting_model.hpp"
+#include "duckdb/main/rl_quantized_ensemble.hpp"
 #include "xgboost/c_api.h"
 #include "duckdb/common/printer.hpp"
 #include <algorithm>
@@ -219,6 +220,65 @@ BoosterHandle RLBoostingModel::CloneBooster(BoosterHandle source) {
 	return cloned;
 }
 
+void RLBoostingModel::RebuildQuantizedEnsemble(BoosterHandle booster) {
+	if (!booster) {
+		return;
+	}
+	// Dump the ensemble as per-tree JSON and quantize it; the caller holds predict_lock,
+	// so the dump cannot race with a concurrent XGBoosterPredictFromDense on the same handle
+	bst_ulong dump_count = 0;
+	const char **tree_dumps = nullptr;
+	int ret = XGBoosterDumpModelEx(booster, "", 0, "json", &dump_count, &tree_dumps);
+	if (ret != 0 || !tree_dumps || dump_count == 0) {
+		return;
+	}
+	bst_ulong config_len = 0;
+	const char *config_json = nullptr;
+	if (XGBoosterSaveJsonConfig(booster, &config_len, &config_json) != 0) {
+		config_json = nullptr;
+	}
+	shared_ptr<const RLQuantizedEnsemble> snapshot =
+	    RLQuantizedEnsemble::Build(tree_dumps, dump_count, config_json);
+	if (!snapshot) {
+		// Keep the previous snapshot rather than dropping to the slow path
+		return;
+	}
+	lock_guard<mutex> quant_guard(quantized_lock);
+	quantized_ensemble = std::move(snapshot);
+}
+
+shared_ptr<const RLQuantizedEnsemble> RLBoostingModel::GetQuantizedEnsemble() const {
+	lock_guard<mutex> quant_guard(quantized_lock);
+	return quantized_ensemble;
+}
+
+bool RLBoostingModel::GetPredictionSpread(const vector<double> &features, double &log_spread) {
+	shared_ptr<const RLQuantizedEnsemble> snapshot;
+	{
+		lock_guard<mutex> quant_guard(quantized_lock);
+		snapshot = quantized_ensemble;
+	}
+	if (!snapshot) {
+		return false;
+	}
+	snapshot->PredictWithSpread(features, log_spread);
+	return true;
+}
+
+double RLBoostingModel::PredictQuantized(const vector<double> &features) {
+	shared_ptr<const RLQuantizedEnsemble> snapshot;
+	{
+		lock_guard<mutex> quant_guard(quantized_lock);
+		snapshot = quantized_ensemble;
+	}
+	if (!snapshot) {
+		// No snapshot yet (model not swapped since startup/reset) - use the full model
+		return Predict(features);
+	}
+	// The snapshot is immutable: evaluate without touching XGBoost or the predict lock
+	return snapshot->Predict(features);
+}
+
 void RLBoostingModel::EnsureTrainingBooster() {
 	if (training_booster) {
 		return;
@@ -498,6 +558,8 @@ void RLBoostingModel::UpdateIncremental(const vector<RLTrainingSample> &recent_s
 			active_booster.store(training_booster, std::memory_order_release);
 			num_trees.store(training_num_trees, std::memory_order_release);
 			total_updates.store(training_total_updates, std::memory_order_release);
+			// Refresh the int8-quantized snapshot from the newly active booster
+			RebuildQuantizedEnsemble(training_booster);
 			// Start a fresh training booster cloned from the new active model for the next segment
 			training_booster = nullptr;
 			if (old_active) {
@@ -547,6 +609,11 @@ void RLBoostingModel::ResetModel() {
 	training_total_updates = 0;
 	training_update_calls = 0;
 	initialized = false;
+	{
+		// Drop the quantized snapshot - it reflects the discarded ensemble
+		lock_guard<mutex> quant_guard(quantized_lock);
+		quantized_ensemble.reset();
+	}
 
 	// Printer::Print("[RL BOOSTING] Model reset\n");
 
@@ -1,20 +1,110 @@
 #include "duckdb/main/rl_cardinality_model.hpp"
 #include "duckdb/common/printer.hpp"
 #include <cmath>
+#include <cstring>
+#include <fstream>
 #include <random>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
 namespace duckdb {
 
+namespace {
+
+//! Single-precision dot product used by the inference fast path.
+//! Vectorized with AVX2 or NEON when the compiler targets them; the scalar
+//! fallback is written so auto-vectorization can still kick in elsewhere.
+inline float InferenceDotProduct(const float *weights, const float *input,
+                                 idx_t count) {
+	idx_t i = 0;
+	float result = 0.0f;
+#if defined(__AVX2__)
+	__m256 acc = _mm256_setzero_ps();
+	for (; i + 8 <= count; i += 8) {
+#if defined(__FMA__)
+		acc = _mm256_fmadd_ps(_mm256_loadu_ps(weights + i), _mm256_loadu_ps(input + i), acc);
+#else
+		acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(weights + i), _mm256_loadu_ps(input + i)));
+#endif
+	}
+	// horizontal sum of the 8 accumulator lanes
+	__m128 lo = _mm256_castps256_ps128(acc);
+	__m128 hi = _mm256_extractf128_ps(acc, 1);
+	__m128 sum = _mm_add_ps(lo, hi);
+	sum = _mm_hadd_ps(sum, sum);
+	sum = _mm_hadd_ps(sum, sum);
+	result = _mm_cvtss_f32(sum);
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+	float32x4_t acc = vdupq_n_f32(0.0f);
+	for (; i + 4 <= count; i += 4) {
+		acc = vmlaq_f32(acc, vld1q_f32(weights + i), vld1q_f32(input + i));
+	}
+	result = vgetq_lane_f32(acc, 0) + vgetq_lane_f32(acc, 1) + vgetq_lane_f32(acc, 2) + vgetq_lane_f32(acc, 3);
+#endif
+	for (; i < count; i++) {
+		result += weights[i] * input[i];
+	}
+	return result;
+}
+
+//! Dense layer: out[i] = dot(weights[i * in_count], input) + bias[i], optionally ReLU
+inline void InferenceDenseLayer(const float *weights, const float *bias,
+                                const float *input, float *output, idx_t out_count,
+                                idx_t in_count, bool relu) {
+	for (idx_t i = 0; i < out_count; i++) {
+		float value = InferenceDotProduct(weights + i * in_count, input, in_count) + bias[i];
+		output[i] = relu && value < 0.0f ? 0.0f : value;
+	}
+}
+
+void FlattenWeights(const vector<vector<double>> &matrix, const vector<double> &bias, vector<float> &flat_weights,
+                    vector<float> &flat_bias) {
+	const idx_t rows = matrix.size();
+	const idx_t cols = rows == 0 ? 0 : matrix[0].size();
+	flat_weights.resize(rows * cols);
+	flat_bias.resize(rows);
+	for (idx_t i = 0; i < rows; i++) {
+		for (idx_t j = 0; j < cols; j++) {
+			flat_weights[i * cols + j] = static_cast<float>(matrix[i][j]);
+		}
+		flat_bias[i] = static_cast<float>(bias[i]);
+	}
+}
+
+} // namespace
+
 RLCardinalityModel &RLCardinalityModel::Get() {
-	static RLCardinalityModel instance;
-	return instance;
+	return *GetBaseShared();
+}
+
+shared_ptr<RLCardinalityModel> RLCardinalityModel::GetBaseShared() {
+	static shared_ptr<RLCardinalityModel> base = make_shared_ptr<RLCardinalityModel>();
+	return base;
+}
+
+shared_ptr<RLCardinalityModel> RLCardinalityModel::Clone() const {
+	auto result = make_shared_ptr<RLCardinalityModel>();
+	lock_guard<mutex> lock(model_lock);
+	result->learning_rate = learning_rate;
+	result->weights_input_hidden1 = weights_input_hidden1;
+	result->bias_hidden1 = bias_hidden1;
+	result->weights_hidden1_hidden2 = weights_hidden1_hidden2;
+	result->bias_hidden2 = bias_hidden2;
+	result->weights_hidden2_hidden3 = weights_hidden2_hidden3;
+	result->bias_hidden3 = bias_hidden3;
+	result->weights_hidden3_output = weights_hidden3_output;
+	result->bias_output = bias_output;
+	result->inference_weights_valid = false;
+	return result;
 }
 
 RLCardinalityModel::RLCardinalityModel() : initialized(false), learning_rate(0.0003) {  // Higher LR for faster convergence with stable init
-	Printer::Print("[RL MODEL] Initializing singleton MLP for online RL...\n");
 	InitializeWeights();
 	initialized = true;
-	Printer::Print("[RL MODEL] MLP initialized with architecture: 64 -> 128 -> 128 -> 64 -> 1, LR=0.0003, InitBias=9.21\n");
 }
 
 RLCardinalityModel::~RLCardinalityModel() {
@@ -134,6 +224,31 @@ double RLCardinalityModel::ForwardPassUnlocked(const vector<double> &features,
 	return output[0];
 }
 
+void RLCardinalityModel::SyncInferenceWeightsUnlocked() {
+	FlattenWeights(weights_input_hidden1, bias_hidden1, inference_weights1, inference_bias1);
+	FlattenWeights(weights_hidden1_hidden2, bias_hidden2, inference_weights2, inference_bias2);
+	FlattenWeights(weights_hidden2_hidden3, bias_hidden3, inference_weights3, inference_bias3);
+	FlattenWeights(weights_hidden3_output, bias_output, inference_weights4, inference_bias4);
+	inference_weights_valid = true;
+}
+
+float RLCardinalityModel::InferenceForwardPassUnlocked(const float *features) const {
+	// Activations live on the stack: small, cache-resident and allocation-free
+	float hidden1[HIDDEN1_SIZE];
+	float hidden2[HIDDEN2_SIZE];
+	float hidden3[HIDDEN3_SIZE];
+	float output[OUTPUT_SIZE];
+	InferenceDenseLayer(inference_weights1.data(), inference_bias1.data(), features, hidden1, HIDDEN1_SIZE, INPUT_SIZE,
+	                    true);
+	InferenceDenseLayer(inference_weights2.data(), inference_bias2.data(), hidden1, hidden2, HIDDEN2_SIZE, HIDDEN1_SIZE,
+	                    true);
+	InferenceDenseLayer(inference_weights3.data(), inference_bias3.data(), hidden2, hidden3, HIDDEN3_SIZE, HIDDEN2_SIZE,
+	                    true);
+	InferenceDenseLayer(inference_weights4.data(), inference_bias4.data(), hidden3, output, OUTPUT_SIZE, HIDDEN3_SIZE,
+	                    false);
+	return output[0];
+}
+
 double RLCardinalityModel::Predict(const vector<double> &features) {
 	// Validate input size
 	if (features.size() != INPUT_SIZE) {
@@ -147,12 +262,20 @@ double RLCardinalityModel::Predict(const vector<double> &features) {
 		return 0.0;
 	}
 
+	// Convert the input to float32 once; the network itself runs entirely in single precision
+	float input[INPUT_SIZE];
+	for (idx_t i = 0; i < INPUT_SIZE; i++) {
+		input[i] = static_cast<float>(features[i]);
+	}
+
 	// Forward pass through the network (thread-safe)
 	double log_cardinality;
 	{
 		lock_guard<mutex> lock(model_lock);
-		vector<double> hidden1_temp, hidden2_temp, hidden3_temp;
-		log_cardinality = ForwardPassUnlocked(features, hidden1_temp, hidden2_temp, hidden3_temp);
+		if (!inference_weights_valid) {
+			SyncInferenceWeightsUnlocked();
+		}
+		log_cardinality = InferenceForwardPassUnlocked(input);
 	}
 
 	// Clamp log prediction to reasonable range BEFORE exp to prevent overflow
@@ -297,16 +420,123 @@ void RLCardinalityModel::Update(const vector<double> &features, idx_t actual_car
 
 	// Now do backprop with the activations
 	BackwardPassUnlocked(features, hidden1_temp, hidden2_temp, hidden3_temp, error);
+
+	// The float32 inference copy is now stale; regenerate it on the next Predict
+	inference_weights_valid = false;
 }
 
+//===--------------------------------------------------------------------===//
+// Snapshot persistence
+//===--------------------------------------------------------------------===//
+// Versioned binary snapshot layout (all fields little-endian, weights row-major):
+//   uint64 magic | uint32 version | uint32 dims[5] | double learning_rate |
+//   per layer: weights (rows x cols doubles), bias (rows doubles)
+static constexpr uint64_t RL_MODEL_SNAPSHOT_MAGIC = 0x314C444F4D4C52ULL; // "RLMODL1"
+static constexpr uint32_t RL_MODEL_SNAPSHOT_VERSION = 1;
+
+namespace {
+
+void WriteMatrix(std::ofstream &out, const vector<vector<double>> &matrix, const vector<double> &bias) {
+	for (auto &row : matrix) {
+		out.write(reinterpret_cast<const char *>(row.data()), static_cast<std::streamsize>(row.size() * sizeof(double)));
+	}
+	out.write(reinterpret_cast<const char *>(bias.data()), static_cast<std::streamsize>(bias.size() * sizeof(double)));
+}
+
+//! Copy a matrix + bias out of the flat snapshot buffer; returns the advanced read offset
+idx_t ReadMatrix(const char *data, idx_t offset, vector<vector<double>> &matrix, vector<double> &bias) {
+	for (auto &row : matrix) {
+		memcpy(row.data(), data + offset, row.size() * sizeof(double));
+		offset += row.size() * sizeof(double);
+	}
+	memcpy(bias.data(), data + offset, bias.size() * sizeof(double));
+	offset += bias.size() * sizeof(double);
+	return offset;
+}
+
+} // namespace
+
 void RLCardinalityModel::SaveWeights(const string &model_path) {
-	// TODO: Implement weight serialization to file
-	Printer::Print("[RL MODEL] SaveWeights not yet implemented for path: " + model_path + "\n");
+	lock_guard<mutex> lock(model_lock);
+	std::ofstream out(model_path, std::ios::binary | std::ios::trunc);
+	if (!out.is_open()) {
+		Printer::Print("[RL MODEL] Failed to open snapshot for writing: " + model_path + "\n");
+		return;
+	}
+	out.write(reinterpret_cast<const char *>(&RL_MODEL_SNAPSHOT_MAGIC), sizeof(RL_MODEL_SNAPSHOT_MAGIC));
+	out.write(reinterpret_cast<const char *>(&RL_MODEL_SNAPSHOT_VERSION), sizeof(RL_MODEL_SNAPSHOT_VERSION));
+	const uint32_t dims[5] = {INPUT_SIZE, HIDDEN1_SIZE, HIDDEN2_SIZE, HIDDEN3_SIZE, OUTPUT_SIZE};
+	out.write(reinterpret_cast<const char *>(dims), sizeof(dims));
+	out.write(reinterpret_cast<const char *>(&learning_rate), sizeof(learning_rate));
+	WriteMatrix(out, weights_input_hidden1, bias_hidden1);
+	WriteMatrix(out, weights_hidden1_hidden2, bias_hidden2);
+	WriteMatrix(out, weights_hidden2_hidden3, bias_hidden3);
+	WriteMatrix(out, weights_hidden3_output, bias_output);
+	if (!out.good()) {
+		Printer::Print("[RL MODEL] Failed to write snapshot: " + model_path + "\n");
+		return;
+	}
+	Printer::Print("[RL MODEL] Saved model snapshot to " + model_path + "\n");
 }
 
 void RLCardinalityModel::LoadWeights(const string &model_path) {
-	// TODO: Implement weight loading from file
-	Printer::Print("[RL MODEL] LoadWeights not yet implemented for path: " + model_path + "\n");
+	// Slurp the snapshot in a single read; at ~330KB this takes microseconds and avoids
+	// per-matrix I/O round trips
+	std::ifstream in(model_path, std::ios::binary | std::ios::ate);
+	if (!in.is_open()) {
+		// No snapshot yet: keep the randomly initialized weights
+		return;
+	}
+	auto file_size = static_cast<idx_t>(in.tellg());
+	in.seekg(0, std::ios::beg);
+	vector<char> data(file_size);
+	if (!in.read(data.data(), static_cast<std::streamsize>(file_size))) {
+		Printer::Print("[RL MODEL] Failed to read snapshot: " + model_path + "\n");
+		return;
+	}
+
+	// Validate header before touching any weights
+	const idx_t header_size = sizeof(uint64_t) + sizeof(uint32_t) + 5 * sizeof(uint32_t) + sizeof(double);
+	if (file_size < header_size) {
+		Printer::Print("[RL MODEL] Snapshot too small, ignoring: " + model_path + "\n");
+		return;
+	}
+	idx_t offset = 0;
+	uint64_t magic;
+	memcpy(&magic, data.data() + offset, sizeof(magic));
+	offset += sizeof(magic);
+	uint32_t version;
+	memcpy(&version, data.data() + offset, sizeof(version));
+	offset += sizeof(version);
+	if (magic != RL_MODEL_SNAPSHOT_MAGIC || version != RL_MODEL_SNAPSHOT_VERSION) {
+		Printer::Print("[RL MODEL] Snapshot has unknown magic/version, ignoring: " + model_path + "\n");
+		return;
+	}
+	uint32_t dims[5];
+	memcpy(dims, data.data() + offset, sizeof(dims));
+	offset += sizeof(dims);
+	if (dims[0] != INPUT_SIZE || dims[1] != HIDDEN1_SIZE || dims[2] != HIDDEN2_SIZE || dims[3] != HIDDEN3_SIZE ||
+	    dims[4] != OUTPUT_SIZE) {
+		Printer::Print("[RL MODEL] Snapshot architecture mismatch, ignoring: " + model_path + "\n");
+		return;
+	}
+	const idx_t weight_count = idx_t(INPUT_SIZE) * HIDDEN1_SIZE + HIDDEN1_SIZE * HIDDEN2_SIZE +
+	                           HIDDEN2_SIZE * HIDDEN3_SIZE + HIDDEN3_SIZE * OUTPUT_SIZE + HIDDEN1_SIZE + HIDDEN2_SIZE +
+	                           HIDDEN3_SIZE + OUTPUT_SIZE;
+	if (file_size < header_size + weight_count * sizeof(double)) {
+		Printer::Print("[RL MODEL] Snapshot truncated, ignoring: " + model_path + "\n");
+		return;
+	}
+
+	lock_guard<mutex> lock(model_lock);
+	memcpy(&learning_rate, data.data() + offset, sizeof(learning_rate));
+	offset += sizeof(learning_rate);
+	offset = ReadMatrix(data.data(), offset, weights_input_hidden1, bias_hidden1);
+	offset = ReadMatrix(data.data(), offset, weights_hidden1_hidden2, bias_hidden2);
+	offset = ReadMatrix(data.data(), offset, weights_hidden2_hidden3, bias_hidden3);
+	ReadMatrix(data.data(), offset, weights_hidden3_output, bias_output);
+	inference_weights_valid = false;
+	Printer::Print("[RL MODEL] Loaded model snapshot from " + model_path + "\n");
 }
 
 } // namespace duckdb
@@ -0,0 +1,69 @@
+#include "duckdb/main/rl_feature_hashing.hpp"
+
+#include <functional>
+
+namespace duckdb {
+
+RLFeatureHashing &RLFeatureHashing::Get() {
+	static RLFeatureHashing instance;
+	return instance;
+}
+
+RLFeatureHashing::RLFeatureHashing()
+    : sketch_counts(SKETCH_DEPTH * SKETCH_WIDTH, 0), sketch_selectivity_sums(SKETCH_DEPTH * SKETCH_WIDTH, 0.0) {
+}
+
+uint64_t RLFeatureHashing::HashPredicate(const string &table_name, idx_t column_id, const string &comparison_type) {
+	std::hash<std::string> string_hasher;
+	// Mix the three components with distinct multipliers so (t, c, op) permutations differ
+	uint64_t hash = string_hasher(table_name);
+	hash = hash * 0x9E3779B97F4A7C15ULL + column_id;
+	hash = hash * 0x9E3779B97F4A7C15ULL + string_hasher(comparison_type);
+	return hash;
+}
+
+idx_t RLFeatureHashing::SketchCell(uint64_t tuple_hash, idx_t depth) {
+	// Derive an independent row hash per depth by remixing with a depth-dependent odd constant
+	uint64_t row_hash = (tuple_hash ^ (depth * 0xC2B2AE3D27D4EB4FULL)) * 0x9E3779B97F4A7C15ULL;
+	return depth * SKETCH_WIDTH + (row_hash % SKETCH_WIDTH);
+}
+
+void RLFeatureHashing::RecordPredicate(uint64_t tuple_hash, double selectivity) {
+	lock_guard<mutex> guard(lock);
+	for (idx_t depth = 0; depth < SKETCH_DEPTH; depth++) {
+		auto cell = SketchCell(tuple_hash, depth);
+		sketch_counts[cell]++;
+		sketch_selectivity_sums[cell] += selectivity;
+	}
+	auto &tuples = bucket_tuples[Bucket(tuple_hash)];
+	if (tuples.size() < MAX_TRACKED_TUPLES_PER_BUCKET) {
+		tuples.insert(tuple_hash);
+	}
+}
+
+bool RLFeatureHashing::EstimateSelectivity(uint64_t tuple_hash, double &result) const {
+	lock_guard<mutex> guard(lock);
+	// Standard count-min estimate: the least-loaded cell has the least collision noise,
+	// so use its selectivity average
+	idx_t min_count = DConstants::INVALID_INDEX;
+	double min_sum = 0.0;
+	for (idx_t depth = 0; depth < SKETCH_DEPTH; depth++) {
+		auto cell = SketchCell(tuple_hash, depth);
+		if (sketch_counts[cell] < min_count) {
+			min_count = sketch_counts[cell];
+			min_sum = sketch_selectivity_sums[cell];
+		}
+	}
+	if (min_count == 0 || min_count == DConstants::INVALID_INDEX) {
+		return false;
+	}
+	result = min_sum / static_cast<double>(min_count);
+	return true;
+}
+
+idx_t RLFeatureHashing::GetBucketTupleCount(idx_t bucket) const {
+	lock_guard<mutex> guard(lock);
+	return bucket_tuples[bucket].size();
+}
+
+} // namespace duckdb
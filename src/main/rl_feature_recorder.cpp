@@ -0,0 +1,66 @@
+//===----------------------------------------------------------------------===//
+//                         DuckDB
+//
+// duckdb/main/rl_feature_recorder.cpp
+//
+//===----------------------------------------------------------------------===//
+
+#include "duckdb/main/rl_feature_recorder.hpp"
+
+#include <chrono>
+
+namespace duckdb {
+
+RLFeatureRecorder &RLFeatureRecorder::Get() {
+	static RLFeatureRecorder instance;
+	return instance;
+}
+
+static uint64_t CurrentTimestampMs() {
+	auto now = std::chrono::system_clock::now();
+	return static_cast<uint64_t>(
+	    std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count());
+}
+
+void RLFeatureRecorder::Append(RLFeatureRow row) {
+	row.timestamp_ms = CurrentTimestampMs();
+	lock_guard<mutex> lock(rows_lock);
+	if (rows.size() >= MAX_ROWS) {
+		rows.pop_front();
+	}
+	rows.push_back(std::move(row));
+}
+
+void RLFeatureRecorder::RecordTableScan(const string &table_name, idx_t base_cardinality, idx_t final_cardinality,
+                                        idx_t num_filters, bool used_default_selectivity) {
+	RLFeatureRow row;
+	row.source = RLFeatureSource::TABLE_SCAN;
+	row.table_name = table_name;
+	row.base_cardinality = base_cardinality;
+	row.final_cardinality = final_cardinality;
+	row.num_filters = num_filters;
+	row.selectivity = base_cardinality > 0
+	                      ? static_cast<double>(final_cardinality) / static_cast<double>(base_cardinality)
+	                      : 1.0;
+	row.used_default_selectivity = used_default_selectivity;
+	Append(std::move(row));
+}
+
+void RLFeatureRecorder::RecordFilterStatistics(const string &comparison_type) {
+	RLFeatureRow row;
+	row.source = RLFeatureSource::FILTER_STATISTICS;
+	row.comparison_type = comparison_type;
+	Append(std::move(row));
+}
+
+vector<RLFeatureRow> RLFeatureRecorder::GetRows() const {
+	lock_guard<mutex> lock(rows_lock);
+	return vector<RLFeatureRow>(rows.begin(), rows.end());
+}
+
+void RLFeatureRecorder::Clear() {
+	lock_guard<mutex> lock(rows_lock);
+	rows.clear();
+}
+
+} // namespace duckdb
@@ -19,6 +19,10 @@
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/main/query_profiler.hpp"
 #include "duckdb/main/rl_training_buffer.hpp"
+#include "duckdb/main/rl_training_task.hpp"
+#include "duckdb/main/rl_feature_hashing.hpp"
+#include "duckdb/main/cardinality_feedback.hpp"
+#include "duckdb/main/database.hpp"
 #include "duckdb/execution/physical_operator.hpp"
 #include "duckdb/main/profiling_node.hpp"
 #include "duckdb/common/enums/metric_type.hpp"
@@ -35,6 +39,12 @@ namespace duckdb {
 
 static constexpr bool RL_ENABLED = true;
 
+//! Runtime model switch (see SetModelEnabled); initialized lazily from RL_DISABLE_MODEL
+static std::atomic<int> rl_model_enabled {-1};
+//! Q-error accumulator for the offline evaluation harness
+static std::mutex rl_q_error_lock;
+static RLQErrorStats rl_q_error_stats;
+
 namespace {
 
 struct PredictionCacheState {
@@ -67,16 +77,8 @@ static void ResetIfNewQuery(PredictionCacheState &state, ClientContext &context)
 	}
 }
 
-static idx_t PredictWithState(ClientContext &context, const OperatorFeatures &features, PredictionCacheState &state,
-                             const idx_t max_predictions) {
-	ResetIfNewQuery(state, context);
-
-	if (state.prediction_count >= max_predictions) {
-		// Soft cap: return 0 and fall back to DuckDB estimate at call sites
-		return 0;
-	}
-
-	// Build operator-specific cache key (must be stable + cheap)
+// Build operator-specific cache key (must be stable + cheap)
+static std::string BuildPredictionCacheKey(const OperatorFeatures &features) {
 	std::string cache_key;
 	cache_key.reserve(128);
 	cache_key.append(features.operator_type);
@@ -123,6 +125,55 @@ static idx_t PredictWithState(ClientContext &context, const OperatorFeatures &fe
 		cache_key.push_back('|');
 		cache_key.append(std::to_string(features.num_grouping_sets));
 	}
+	return cache_key;
+}
+
+static int EnvInt(const char *name, int default_value);
+static double EnvDouble(const char *name, double default_value);
+
+//! Confidence gate for planning predictions: when the ensemble's trees disagree strongly,
+//! a single bad estimate can pick a catastrophic join order, so the planner falls back to
+//! the native CardinalityEstimator instead. The spread threshold (log-cardinality units)
+//! is tunable with RL_CONFIDENCE_MAX_SPREAD (0 disables the gate).
+static bool LowConfidencePrediction(const vector<double> &feature_vec) {
+	static const double max_log_spread = EnvDouble("RL_CONFIDENCE_MAX_SPREAD", 6.0);
+	if (max_log_spread <= 0.0) {
+		return false;
+	}
+	double log_spread;
+	if (!RLBoostingModel::Get().GetPredictionSpread(feature_vec, log_spread)) {
+		// No quantized snapshot yet to measure disagreement on - trust the prediction
+		return false;
+	}
+	return log_spread > max_log_spread;
+}
+
+//! Classify whether this prediction belongs to a low-latency query: for short OLTP-style queries
+//! over small inputs the planning budget matters more than estimate precision, so we route them
+//! to the int8-quantized ensemble snapshot instead of the full XGBoost evaluation.
+//! The input-size threshold can be tuned with RL_QUANTIZED_CARD_THRESHOLD (0 disables the fast path).
+static bool IsLowLatencyPrediction(const OperatorFeatures &features) {
+	static const idx_t low_latency_threshold = (idx_t)EnvInt("RL_QUANTIZED_CARD_THRESHOLD", 100000);
+	if (low_latency_threshold == 0) {
+		return false;
+	}
+	return features.estimated_cardinality <= low_latency_threshold;
+}
+
+static idx_t PredictWithState(ClientContext &context, const OperatorFeatures &features, PredictionCacheState &state,
+                             const idx_t max_predictions, const bool confidence_gated) {
+	if (!RLModelInterface::ModelEnabled()) {
+		// Model switched off: fall back to DuckDB estimates at all call sites
+		return 0;
+	}
+	ResetIfNewQuery(state, context);
+
+	if (state.prediction_count >= max_predictions) {
+		// Soft cap: return 0 and fall back to DuckDB estimate at call sites
+		return 0;
+	}
+
+	auto cache_key = BuildPredictionCacheKey(features);
 
 	auto cached = state.cache.find(cache_key);
 	if (cached != state.cache.end()) {
@@ -131,12 +182,19 @@ static idx_t PredictWithState(ClientContext &context, const OperatorFeatures &fe
 
 	// Convert features to vector and predict
 	auto feature_vec = RLModelInterface::FeaturesToVector(features);
-	double predicted_cardinality = RLBoostingModel::Get().Predict(feature_vec);
+	auto &model = RLBoostingModel::Get();
+	double predicted_cardinality =
+	    IsLowLatencyPrediction(features) ? model.PredictQuantized(feature_vec) : model.Predict(feature_vec);
 	if (predicted_cardinality <= 0.0) {
 		return 0;
 	}
 
 	idx_t result = static_cast<idx_t>(predicted_cardinality);
+	if (confidence_gated && LowConfidencePrediction(feature_vec)) {
+		// Low confidence: cache the fallback so this operator consistently uses the native
+		// estimate for the rest of the query
+		result = 0;
+	}
 	state.cache[cache_key] = result;
 	state.prediction_count++;
 	return result;
@@ -174,6 +232,28 @@ static int EnvInt(const char *name, int default_value) {
 
 } // namespace
 
+void RLModelInterface::SetModelEnabled(bool enabled) {
+	rl_model_enabled.store(enabled ? 1 : 0);
+}
+
+bool RLModelInterface::ModelEnabled() {
+	auto value = rl_model_enabled.load(std::memory_order_relaxed);
+	if (value < 0) {
+		value = EnvBool("RL_DISABLE_MODEL", false) ? 0 : 1;
+		rl_model_enabled.store(value);
+	}
+	return value == 1;
+}
+
+RLQErrorStats RLModelInterface::SnapshotQErrorStats(bool reset) {
+	std::lock_guard<std::mutex> guard(rl_q_error_lock);
+	auto result = rl_q_error_stats;
+	if (reset) {
+		rl_q_error_stats = RLQErrorStats();
+	}
+	return result;
+}
+
 RLModelInterface::RLModelInterface(ClientContext &context) : context(context), enabled(true) {
 	// Intentionally do NOT register a predictor callback for planning/optimization.
 	// We still collect features and generate predictions during physical plan creation
@@ -356,6 +436,17 @@ OperatorFeatures RLModelInterface::ExtractFeatures(LogicalOperator &op, ClientCo
 			features.filter_types = table_features->filter_types;
 			features.comparison_types = table_features->comparison_types;
 			features.filter_column_ids = table_features->filter_column_ids;
+
+			// Feed the predicate tuples into the hashed-feature sketches
+			// (the collector only has a scan-level selectivity, so all predicates of a scan share it)
+			auto &hashing = RLFeatureHashing::Get();
+			idx_t predicate_count =
+			    MinValue<idx_t>(features.filter_column_ids.size(), features.comparison_types.size());
+			for (idx_t i = 0; i < predicate_count; i++) {
+				auto tuple_hash = RLFeatureHashing::HashPredicate(features.table_name, features.filter_column_ids[i],
+				                                                  features.comparison_types[i]);
+				hashing.RecordPredicate(tuple_hash, features.filter_selectivity);
+			}
 		}
 		break;
 	}
@@ -697,6 +788,39 @@ vector<double> RLModelInterface::FeaturesToVector(const OperatorFeatures &featur
 	feature_vec[idx++] = features.filter_constant_numeric_log_mean;
 	feature_vec[idx++] = features.filter_constant_string_log_mean;
 
+	// 10. HASHED PREDICATE IDENTITY - 12 bucket counts + 3 sketch/collision features
+	// Hashing (table, column, op) tuples gives every column of a wide schema a stable signal
+	// without dedicating a feature slot per column (and without per-schema retraining)
+	{
+		auto &hashing = RLFeatureHashing::Get();
+		const idx_t bucket_base = idx;
+		idx += RLFeatureHashing::HASH_BUCKET_COUNT;
+		double selectivity_sum = 0.0;
+		idx_t selectivity_hits = 0;
+		double max_bucket_tuples = 0.0;
+		idx_t predicate_count = MinValue<idx_t>(features.filter_column_ids.size(), features.comparison_types.size());
+		for (idx_t i = 0; i < predicate_count; i++) {
+			auto tuple_hash =
+			    RLFeatureHashing::HashPredicate(features.table_name, features.filter_column_ids[i],
+			                                    features.comparison_types[i]);
+			auto bucket = RLFeatureHashing::Bucket(tuple_hash);
+			feature_vec[bucket_base + bucket] += 1.0;
+			double sketch_selectivity;
+			if (hashing.EstimateSelectivity(tuple_hash, sketch_selectivity)) {
+				selectivity_sum += sketch_selectivity;
+				selectivity_hits++;
+			}
+			max_bucket_tuples =
+			    std::max(max_bucket_tuples, static_cast<double>(hashing.GetBucketTupleCount(bucket)));
+		}
+		// Mean sketch selectivity over the predicates the sketch has seen before
+		feature_vec[idx++] = selectivity_hits > 0 ? selectivity_sum / selectivity_hits : 0.0;
+		// Fraction of this operator's predicates with sketch history
+		feature_vec[idx++] = predicate_count > 0 ? static_cast<double>(selectivity_hits) / predicate_count : 0.0;
+		// Collision pressure: how many distinct tuples share the busiest bucket we touched
+		feature_vec[idx++] = std::log1p(std::max(0.0, max_bucket_tuples - 1.0));
+	}
+
 	// Remaining features are padding (already initialized to 0.0) if any remain
 	D_ASSERT(idx <= FEATURE_VECTOR_SIZE);
 
@@ -708,8 +832,9 @@ idx_t RLModelInterface::PredictCardinality(const OperatorFeatures &features) {
 		return 0;
 	}
 	// Physical-plan prediction: bounded because it can be called for many physical operators
+	// Observe-only, so no confidence gate: training should see the model's raw prediction
 	static constexpr idx_t MAX_PHYSICAL_PREDICTIONS = 5000;
-	return PredictWithState(context, features, physical_state, MAX_PHYSICAL_PREDICTIONS);
+	return PredictWithState(context, features, physical_state, MAX_PHYSICAL_PREDICTIONS, false);
 }
 
 idx_t RLModelInterface::GetCardinalityEstimate(const OperatorFeatures &features) {
@@ -722,8 +847,59 @@ idx_t RLModelInterface::PredictPlanningCardinality(const OperatorFeatures &featu
 		return 0;
 	}
 	// Planning prediction: separate cap/cache from physical to avoid interference
+	// Confidence-gated: a low-confidence estimate must not steer the join order
+	static constexpr idx_t MAX_PLANNING_PREDICTIONS = 50000;
+	return PredictWithState(context, features, planning_state, MAX_PLANNING_PREDICTIONS, true);
+}
+
+vector<idx_t> RLModelInterface::PredictPlanningCardinalityBatch(const vector<OperatorFeatures> &features) {
+	vector<idx_t> results(features.size(), 0);
+	if (!enabled || !RL_ENABLED || features.empty() || !ModelEnabled()) {
+		return results;
+	}
 	static constexpr idx_t MAX_PLANNING_PREDICTIONS = 50000;
-	return PredictWithState(context, features, planning_state, MAX_PLANNING_PREDICTIONS);
+	auto &state = planning_state;
+	ResetIfNewQuery(state, context);
+
+	// Resolve cache hits first, then evaluate all misses in a single batched model call.
+	vector<idx_t> miss_indices;
+	vector<std::string> miss_keys;
+	vector<vector<double>> feature_matrix;
+	for (idx_t i = 0; i < features.size(); i++) {
+		auto cache_key = BuildPredictionCacheKey(features[i]);
+		auto cached = state.cache.find(cache_key);
+		if (cached != state.cache.end()) {
+			results[i] = cached->second;
+			continue;
+		}
+		if (state.prediction_count + miss_indices.size() >= MAX_PLANNING_PREDICTIONS) {
+			// Soft cap: leave 0 so call sites fall back to the DuckDB estimate
+			continue;
+		}
+		miss_indices.push_back(i);
+		miss_keys.push_back(std::move(cache_key));
+		feature_matrix.push_back(FeaturesToVector(features[i]));
+	}
+	if (miss_indices.empty()) {
+		return results;
+	}
+
+	vector<double> predictions;
+	RLBoostingModel::Get().PredictBatch(feature_matrix, predictions);
+	for (idx_t i = 0; i < miss_indices.size() && i < predictions.size(); i++) {
+		if (predictions[i] <= 0.0) {
+			continue;
+		}
+		auto result = static_cast<idx_t>(predictions[i]);
+		if (LowConfidencePrediction(feature_matrix[i])) {
+			// Planning prediction with low ensemble confidence: fall back to the native estimate
+			result = 0;
+		}
+		results[miss_indices[i]] = result;
+		state.cache[miss_keys[i]] = result;
+		state.prediction_count++;
+	}
+	return results;
 }
 
 void RLModelInterface::ResetPredictionCachesForThread() {
@@ -755,6 +931,9 @@ void RLModelInterface::AttachRLState(PhysicalOperator &physical_op, const Operat
 	const idx_t safe_rl_pred = std::max<idx_t>(rl_prediction, 1);
 	const idx_t safe_duck_pred = std::max<idx_t>(duckdb_estimate, 1);
 	physical_op.rl_state = make_uniq<RLOperatorState>(std::move(feature_vec), safe_rl_pred, safe_duck_pred);
+	// Remember the structural fingerprint so the observed cardinality can be fed back
+	// into the feedback store (and found again by the optimizer) after execution
+	physical_op.rl_state->feature_fingerprint = CardinalityFeedbackStore::Fingerprint(features);
 }
 
 void RLModelInterface::CollectActualCardinalities(PhysicalOperator &root_operator,
@@ -788,8 +967,15 @@ void RLModelInterface::CollectActualCardinalities(PhysicalOperator &root_operato
 		if (train_every_n != 0 && (q % train_every_n) == 0) {
 			auto recent_samples = buffer.GetRecentSamples(train_window);
 			if (recent_samples.size() >= 50) {
-				auto &model = RLBoostingModel::Get();
-				model.UpdateIncremental(recent_samples);
+				if (EnvBool("RL_SYNC_TRAINING", false)) {
+					// Train inline on the query thread (old behavior)
+					auto &model = RLBoostingModel::Get();
+					model.UpdateIncremental(recent_samples);
+				} else {
+					// Hand training to the task scheduler: it runs as a deferrable task that
+					// only consumes a worker when no query tasks are waiting for one
+					RLTrainingTask::Schedule(DatabaseInstance::GetDatabase(context), std::move(recent_samples));
+				}
 			}
 		}
 	}
@@ -810,10 +996,18 @@ void RLModelInterface::CollectActualCardinalitiesRecursive(PhysicalOperator &op,
 			// Mark as collected
 			op.rl_state->has_actual_cardinality = true;
 
-			// Add to buffer first
+			// Add to buffer first (both estimates, so training can learn from disagreements)
 			buffer.AddSample(op.rl_state->feature_vector,
 			                 actual_cardinality,
-			                 op.rl_state->rl_predicted_cardinality);
+			                 op.rl_state->rl_predicted_cardinality,
+			                 op.rl_state->duckdb_estimated_cardinality);
+
+			// Record the observation in the feedback store so the optimizer can use the
+			// true cardinality the next time this exact plan node is planned
+			if (op.rl_state->feature_fingerprint != 0) {
+				auto &feedback = DatabaseInstance::GetDatabase(context).GetCardinalityFeedbackStore();
+				feedback.RecordObservation(op.rl_state->feature_fingerprint, actual_cardinality);
+			}
 
 			// SYNCHRONOUS INCREMENTAL TRAINING: Train immediately using sliding window
 			// Get recent samples (sliding window: use more samples for better learning)
@@ -844,6 +1038,16 @@ void RLModelInterface::CollectActualCardinalitiesRecursive(PhysicalOperator &op,
 				op.rl_state->duckdb_estimated_cardinality / (double)std::max(actual_cardinality, (idx_t)1)
 			);
 
+			// Accumulate into the global Q-error statistics (read by the evaluation harness)
+			{
+				std::lock_guard<std::mutex> q_guard(rl_q_error_lock);
+				rl_q_error_stats.operator_count++;
+				rl_q_error_stats.rl_q_error_sum += rl_q_error;
+				rl_q_error_stats.rl_q_error_max = std::max(rl_q_error_stats.rl_q_error_max, rl_q_error);
+				rl_q_error_stats.duckdb_q_error_sum += duckdb_q_error;
+				rl_q_error_stats.duckdb_q_error_max = std::max(rl_q_error_stats.duckdb_q_error_max, duckdb_q_error);
+			}
+
 			// Logging with BOTH predictions for comparison (can be disabled for performance).
 			// NOTE: `run_tpcds_benchmark.py` parses this exact line format.
 			if (EnvBool("RL_PRINT_TRAINING", true)) {
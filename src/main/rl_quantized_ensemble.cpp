@@ -0,0 +1,267 @@
+#include "duckdb/main/rl_quantized_ensemble.hpp"
+
+#include "duckdb/common/numeric_utils.hpp"
+
+#include "yyjson.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+using namespace duckdb_yyjson; // NOLINT
+
+namespace duckdb {
+
+namespace {
+
+//! Full-precision node as parsed from the JSON dump, before quantization
+struct RawEnsembleNode {
+	//! Split feature, or -1 for a leaf
+	int feature = -1;
+	double threshold = 0.0;
+	uint32_t left = 0;
+	uint32_t right = 0;
+	double leaf_value = 0.0;
+};
+
+//! Recursively parse one node object of an XGBoost JSON tree dump into the raw node pool
+//! Returns false if the dump does not have the expected shape
+bool ParseDumpNode(yyjson_val *val, vector<RawEnsembleNode> &nodes, uint32_t &out_index) {
+	if (!yyjson_is_obj(val)) {
+		return false;
+	}
+	out_index = UnsafeNumericCast<uint32_t>(nodes.size());
+	nodes.emplace_back();
+
+	auto leaf = yyjson_obj_get(val, "leaf");
+	if (leaf) {
+		nodes[out_index].leaf_value = yyjson_get_num(leaf);
+		return true;
+	}
+
+	auto split = yyjson_obj_get(val, "split");
+	auto condition = yyjson_obj_get(val, "split_condition");
+	auto yes = yyjson_obj_get(val, "yes");
+	auto no = yyjson_obj_get(val, "no");
+	auto children = yyjson_obj_get(val, "children");
+	if (!split || !yyjson_is_str(split) || !condition || !yes || !no || !children || !yyjson_is_arr(children) ||
+	    yyjson_arr_size(children) != 2) {
+		return false;
+	}
+	// Split features are encoded as "f<index>"
+	auto split_str = yyjson_get_str(split);
+	if (!split_str || split_str[0] != 'f') {
+		return false;
+	}
+	auto feature = std::atoi(split_str + 1);
+	if (feature < 0 || idx_t(feature) >= RLQuantizedEnsemble::FEATURE_COUNT) {
+		return false;
+	}
+	nodes[out_index].feature = feature;
+	nodes[out_index].threshold = yyjson_get_num(condition);
+
+	// Recurse into both children and match them against the "yes"/"no" node ids
+	// Note: indexed writes only - the recursion can reallocate the node pool
+	auto yes_id = int64_t(yyjson_get_num(yes));
+	auto no_id = int64_t(yyjson_get_num(no));
+	for (idx_t child_idx = 0; child_idx < 2; child_idx++) {
+		auto child = yyjson_arr_get(children, child_idx);
+		auto child_id_val = yyjson_obj_get(child, "nodeid");
+		if (!child_id_val) {
+			return false;
+		}
+		auto child_id = int64_t(yyjson_get_num(child_id_val));
+		uint32_t child_index;
+		if (!ParseDumpNode(child, nodes, child_index)) {
+			return false;
+		}
+		if (child_id == yes_id) {
+			nodes[out_index].left = child_index;
+		} else if (child_id == no_id) {
+			nodes[out_index].right = child_index;
+		} else {
+			return false;
+		}
+	}
+	return true;
+}
+
+//! Recover the global bias from the booster config JSON ("learner.learner_model_param.base_score")
+double ParseBaseScore(const char *config_json) {
+	// XGBoost's default if we cannot find it
+	double base_score = 0.5;
+	if (!config_json) {
+		return base_score;
+	}
+	auto doc = yyjson_read(config_json, strlen(config_json), 0);
+	if (!doc) {
+		return base_score;
+	}
+	auto learner = yyjson_obj_get(yyjson_doc_get_root(doc), "learner");
+	auto model_param = yyjson_obj_get(learner, "learner_model_param");
+	auto base_score_val = yyjson_obj_get(model_param, "base_score");
+	if (base_score_val) {
+		if (yyjson_is_str(base_score_val)) {
+			base_score = std::atof(yyjson_get_str(base_score_val));
+		} else if (yyjson_is_num(base_score_val)) {
+			base_score = yyjson_get_num(base_score_val);
+		}
+	}
+	yyjson_doc_free(doc);
+	return base_score;
+}
+
+} // namespace
+
+int8_t RLQuantizedEnsemble::QuantizeFeature(idx_t feature, double value) const {
+	auto scaled = std::llround((value - feature_offset[feature]) * feature_scale[feature]);
+	scaled = std::max<long long>(-127, std::min<long long>(127, scaled));
+	return int8_t(scaled);
+}
+
+unique_ptr<RLQuantizedEnsemble> RLQuantizedEnsemble::Build(const char **tree_dumps, idx_t tree_count,
+                                                           const char *config_json) {
+	if (!tree_dumps || tree_count == 0) {
+		return nullptr;
+	}
+
+	// First pass: parse every tree into a full-precision node pool
+	vector<RawEnsembleNode> raw_nodes;
+	vector<uint32_t> raw_roots;
+	raw_roots.reserve(tree_count);
+	for (idx_t tree_idx = 0; tree_idx < tree_count; tree_idx++) {
+		auto doc = yyjson_read(tree_dumps[tree_idx], strlen(tree_dumps[tree_idx]), 0);
+		if (!doc) {
+			return nullptr;
+		}
+		uint32_t root_index;
+		auto parsed = ParseDumpNode(yyjson_doc_get_root(doc), raw_nodes, root_index);
+		yyjson_doc_free(doc);
+		if (!parsed) {
+			return nullptr;
+		}
+		raw_roots.push_back(root_index);
+	}
+
+	auto result = unique_ptr<RLQuantizedEnsemble>(new RLQuantizedEnsemble());
+	result->base_score = ParseBaseScore(config_json);
+
+	// Derive the per-feature affine mapping from the range of thresholds the ensemble actually splits on:
+	// the quantized domain only needs to order feature values relative to those thresholds
+	double min_threshold[FEATURE_COUNT];
+	double max_threshold[FEATURE_COUNT];
+	bool feature_seen[FEATURE_COUNT];
+	for (idx_t i = 0; i < FEATURE_COUNT; i++) {
+		feature_seen[i] = false;
+		min_threshold[i] = 0.0;
+		max_threshold[i] = 0.0;
+	}
+	for (const auto &node : raw_nodes) {
+		if (node.feature < 0) {
+			continue;
+		}
+		auto feature = idx_t(node.feature);
+		if (!feature_seen[feature]) {
+			feature_seen[feature] = true;
+			min_threshold[feature] = node.threshold;
+			max_threshold[feature] = node.threshold;
+		} else {
+			min_threshold[feature] = std::min(min_threshold[feature], node.threshold);
+			max_threshold[feature] = std::max(max_threshold[feature], node.threshold);
+		}
+	}
+	for (idx_t i = 0; i < FEATURE_COUNT; i++) {
+		if (!feature_seen[i]) {
+			// Unused feature - map everything to zero
+			result->feature_offset[i] = 0.0;
+			result->feature_scale[i] = 0.0;
+		} else if (max_threshold[i] > min_threshold[i]) {
+			// Spread the thresholds over most of the int8 range, centered on zero
+			result->feature_offset[i] = (min_threshold[i] + max_threshold[i]) * 0.5;
+			result->feature_scale[i] = 252.0 / (max_threshold[i] - min_threshold[i]);
+		} else {
+			// Single distinct threshold - any finite scale orders values around it
+			result->feature_offset[i] = min_threshold[i];
+			result->feature_scale[i] = 1.0;
+		}
+	}
+
+	// Second pass: emit the quantized SoA pool
+	auto node_count = raw_nodes.size();
+	result->node_feature.reserve(node_count);
+	result->node_threshold.reserve(node_count);
+	result->node_left.reserve(node_count);
+	result->node_right.reserve(node_count);
+	result->node_leaf_value.reserve(node_count);
+	for (const auto &node : raw_nodes) {
+		if (node.feature < 0) {
+			result->node_feature.push_back(LEAF_MARKER);
+			result->node_threshold.push_back(0);
+			result->node_left.push_back(0);
+			result->node_right.push_back(0);
+			result->node_leaf_value.push_back(float(node.leaf_value));
+		} else {
+			result->node_feature.push_back(uint8_t(node.feature));
+			result->node_threshold.push_back(result->QuantizeFeature(idx_t(node.feature), node.threshold));
+			result->node_left.push_back(node.left);
+			result->node_right.push_back(node.right);
+			result->node_leaf_value.push_back(0.0f);
+		}
+	}
+	result->tree_roots = std::move(raw_roots);
+	return result;
+}
+
+double RLQuantizedEnsemble::Predict(const vector<double> &features) const {
+	double log_spread;
+	return PredictWithSpread(features, log_spread);
+}
+
+double RLQuantizedEnsemble::PredictWithSpread(const vector<double> &features, double &log_spread) const {
+	log_spread = 0.0;
+	if (features.size() != FEATURE_COUNT) {
+		return 0.0;
+	}
+
+	// Quantize the feature vector once; every tree then compares int8 against int8
+	int8_t quantized[FEATURE_COUNT];
+	for (idx_t i = 0; i < FEATURE_COUNT; i++) {
+		quantized[i] = QuantizeFeature(i, features[i]);
+	}
+
+	double log_cardinality = base_score;
+	double leaf_sum = 0.0;
+	double leaf_sum_sq = 0.0;
+	for (const auto root : tree_roots) {
+		uint32_t node = root;
+		auto feature = node_feature[node];
+		while (feature != LEAF_MARKER) {
+			// Branchless descent: the comparison selects the child index (compiles to a conditional move)
+			node = quantized[feature] < node_threshold[node] ? node_left[node] : node_right[node];
+			feature = node_feature[node];
+		}
+		auto leaf = double(node_leaf_value[node]);
+		log_cardinality += leaf;
+		leaf_sum += leaf;
+		leaf_sum_sq += leaf * leaf;
+	}
+
+	// Dispersion of the per-tree contributions, scaled to the magnitude of the summed
+	// log prediction: stddev(leaf) * sqrt(n) - a heuristic ensemble-disagreement measure
+	auto tree_count = double(tree_roots.size());
+	if (tree_count > 1) {
+		double mean = leaf_sum / tree_count;
+		double variance = std::max(0.0, leaf_sum_sq / tree_count - mean * mean);
+		log_spread = std::sqrt(variance * tree_count);
+	}
+
+	// Same post-processing as the full model: clamp the log prediction and convert to cardinality
+	log_cardinality = std::max(0.0, log_cardinality);
+	double cardinality = std::exp(log_cardinality);
+	if (cardinality < 1.0) {
+		cardinality = 1.0;
+	}
+	return cardinality;
+}
+
+} // namespace duckdb
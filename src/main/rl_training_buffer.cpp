@@ -14,46 +14,112 @@
 namespace duckdb {
 
 RLTrainingBuffer::RLTrainingBuffer(idx_t max_size)
-    : max_size(max_size), running_q_error_sum(0.0), sample_count(0) {
+    : max_size(max_size), ring(new RingSlot[RING_CAPACITY]), enqueue_pos(0), dequeue_pos(0), dropped_samples(0),
+      running_q_error_sum(0.0), sample_count(0) {
+	static_assert((RING_CAPACITY & (RING_CAPACITY - 1)) == 0, "ring capacity must be a power of two");
+	for (idx_t i = 0; i < RING_CAPACITY; i++) {
+		ring[i].sequence.store(i, std::memory_order_relaxed);
+		ring[i].sample = nullptr;
+	}
 	// Printer::Print("[RL TRAINING BUFFER] Initialized with capacity: " + std::to_string(max_size) + "\n");
 }
 
 RLTrainingBuffer::~RLTrainingBuffer() {
+	// Free anything still sitting in the ingest ring
+	while (auto sample = TryDequeue()) {
+		delete sample;
+	}
 }
 
-void RLTrainingBuffer::AddSample(const vector<double> &features, idx_t actual_cardinality,
-                                   idx_t predicted_cardinality) {
-	lock_guard<mutex> lock(buffer_lock);
+bool RLTrainingBuffer::TryEnqueue(RLTrainingSample *sample) {
+	constexpr idx_t MASK = RING_CAPACITY - 1;
+	auto pos = enqueue_pos.load(std::memory_order_relaxed);
+	while (true) {
+		auto &slot = ring[pos & MASK];
+		auto seq = slot.sequence.load(std::memory_order_acquire);
+		auto diff = (int64_t)seq - (int64_t)pos;
+		if (diff == 0) {
+			if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				slot.sample = sample;
+				slot.sequence.store(pos + 1, std::memory_order_release);
+				return true;
+			}
+			// CAS failed: pos was reloaded, retry
+		} else if (diff < 0) {
+			// ring is full
+			return false;
+		} else {
+			pos = enqueue_pos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+RLTrainingSample *RLTrainingBuffer::TryDequeue() {
+	constexpr idx_t MASK = RING_CAPACITY - 1;
+	auto pos = dequeue_pos.load(std::memory_order_relaxed);
+	while (true) {
+		auto &slot = ring[pos & MASK];
+		auto seq = slot.sequence.load(std::memory_order_acquire);
+		auto diff = (int64_t)seq - (int64_t)(pos + 1);
+		if (diff == 0) {
+			if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+				auto result = slot.sample;
+				slot.sample = nullptr;
+				slot.sequence.store(pos + RING_CAPACITY, std::memory_order_release);
+				return result;
+			}
+		} else if (diff < 0) {
+			// ring is empty
+			return nullptr;
+		} else {
+			pos = dequeue_pos.load(std::memory_order_relaxed);
+		}
+	}
+}
 
+void RLTrainingBuffer::DrainRingUnlocked() {
+	while (auto sample_ptr = TryDequeue()) {
+		// Move into the replay window (circular buffer behavior)
+		if (buffer.size() >= max_size) {
+			// Remove oldest sample
+			auto &oldest = buffer.front();
+			running_q_error_sum -= oldest.q_error;
+			buffer.pop_front();
+			sample_count--;
+		}
+		buffer.push_back(std::move(*sample_ptr));
+		running_q_error_sum += buffer.back().q_error;
+		sample_count++;
+		delete sample_ptr;
+	}
+}
+
+void RLTrainingBuffer::AddSample(const vector<double> &features, idx_t actual_cardinality,
+                                   idx_t predicted_cardinality, idx_t duckdb_estimated_cardinality) {
 	// Normalize feature length to match the current model input size (defensive against version mismatches)
 	vector<double> normalized = features;
 	normalized.resize(RLBoostingModel::FEATURE_VECTOR_SIZE, 0.0);
 
 	// Create training sample
-	RLTrainingSample sample(std::move(normalized), actual_cardinality, predicted_cardinality);
+	auto sample = new RLTrainingSample(std::move(normalized), actual_cardinality, predicted_cardinality,
+	                                   duckdb_estimated_cardinality);
 
 	// Add timestamp
 	auto now = std::chrono::system_clock::now();
 	auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch());
-	sample.timestamp_ms = ms.count();
-
-	// Add to buffer (circular buffer behavior)
-	if (buffer.size() >= max_size) {
-		// Remove oldest sample
-		auto &oldest = buffer.front();
-		running_q_error_sum -= oldest.q_error;
-		buffer.pop_front();
-		sample_count--;
-	}
+	sample->timestamp_ms = ms.count();
 
-	// Add new sample
-	buffer.push_back(std::move(sample));
-	running_q_error_sum += sample.q_error;
-	sample_count++;
+	// Wait-free handoff to the trainer: if the trainer has fallen behind and the ring is
+	// full, drop the sample rather than blocking the query thread
+	if (!TryEnqueue(sample)) {
+		delete sample;
+		dropped_samples.fetch_add(1, std::memory_order_relaxed);
+	}
 }
 
 vector<RLTrainingSample> RLTrainingBuffer::GetBatch(idx_t batch_size) {
 	lock_guard<mutex> lock(buffer_lock);
+	DrainRingUnlocked();
 
 	if (buffer.empty()) {
 		return {};
@@ -77,6 +143,7 @@ vector<RLTrainingSample> RLTrainingBuffer::GetBatch(idx_t batch_size) {
 
 vector<RLTrainingSample> RLTrainingBuffer::GetRecentSamples(idx_t count) {
 	lock_guard<mutex> lock(buffer_lock);
+	DrainRingUnlocked();
 
 	if (buffer.empty()) {
 		return {};
@@ -98,6 +165,7 @@ vector<RLTrainingSample> RLTrainingBuffer::GetRecentSamples(idx_t count) {
 
 idx_t RLTrainingBuffer::Size() const {
 	lock_guard<mutex> lock(buffer_lock);
+	const_cast<RLTrainingBuffer *>(this)->DrainRingUnlocked();
 	return buffer.size();
 }
 
@@ -106,16 +174,20 @@ idx_t RLTrainingBuffer::Capacity() const {
 }
 
 bool RLTrainingBuffer::IsEmpty() const {
-	lock_guard<mutex> lock(buffer_lock);
-	return buffer.empty();
+	return Size() == 0;
 }
 
 double RLTrainingBuffer::AverageQError() const {
 	lock_guard<mutex> lock(buffer_lock);
+	const_cast<RLTrainingBuffer *>(this)->DrainRingUnlocked();
 	if (sample_count == 0) {
 		return 0.0;
 	}
 	return running_q_error_sum / sample_count;
 }
 
+idx_t RLTrainingBuffer::DroppedSamples() const {
+	return dropped_samples.load(std::memory_order_relaxed);
+}
+
 } // namespace duckdb
@@ -0,0 +1,87 @@
+#include "duckdb/main/rl_training_task.hpp"
+
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/main/rl_boosting_model.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+
+#include <atomic>
+#include <cstdlib>
+
+namespace duckdb {
+
+//! At most one training task may be queued or running at a time
+static std::atomic<bool> training_task_in_flight {false};
+
+static int EnvInt(const char *name, int default_value) {
+	auto val = std::getenv(name);
+	if (!val) {
+		return default_value;
+	}
+	try {
+		return std::stoi(val);
+	} catch (...) {
+		return default_value;
+	}
+}
+
+RLTrainingTask::RLTrainingTask(DatabaseInstance &db, vector<RLTrainingSample> samples_p)
+    : db(db), samples(std::move(samples_p)) {
+	// Runtime overrides:
+	// - RL_TRAIN_MINI_BATCH (int, 0 = train the whole window in one batch)
+	// - RL_TRAIN_QUEUE_THRESHOLD (int, defer while this many tasks are pending; 0 = never defer)
+	// - RL_TRAIN_MAX_DEFERRALS (int, train regardless of load after this many deferrals)
+	mini_batch_size = (idx_t)EnvInt("RL_TRAIN_MINI_BATCH", 250);
+	queue_threshold = (idx_t)EnvInt("RL_TRAIN_QUEUE_THRESHOLD", 1);
+	max_deferrals = (idx_t)EnvInt("RL_TRAIN_MAX_DEFERRALS", 100);
+}
+
+bool RLTrainingTask::Schedule(DatabaseInstance &db, vector<RLTrainingSample> samples) {
+	bool expected = false;
+	if (!training_task_in_flight.compare_exchange_strong(expected, true)) {
+		// A training task is already in flight - drop this window, the samples stay in the
+		// training buffer and will be part of the next one
+		return false;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db);
+	auto task = make_shared_ptr<RLTrainingTask>(db, std::move(samples));
+	auto producer = scheduler.CreateProducer();
+	scheduler.ScheduleTask(*producer, std::move(task));
+	return true;
+}
+
+bool RLTrainingTask::SchedulerBusy() const {
+	if (queue_threshold == 0) {
+		return false;
+	}
+	// Pending tasks in the queue mean every worker is occupied and queries are waiting:
+	// training should not compete for those cores
+	return TaskScheduler::GetScheduler(db).GetNumberOfTasks() >= queue_threshold;
+}
+
+void RLTrainingTask::Defer() {
+	deferral_count++;
+	auto &scheduler = TaskScheduler::GetScheduler(db);
+	auto producer = scheduler.CreateProducer();
+	scheduler.ScheduleTask(*producer, shared_from_this());
+}
+
+TaskExecutionResult RLTrainingTask::Execute(TaskExecutionMode mode) {
+	auto &model = RLBoostingModel::Get();
+	while (batch_offset < samples.size()) {
+		// Preemption point: before every mini-batch, yield the core if query tasks are waiting
+		if (SchedulerBusy() && deferral_count < max_deferrals) {
+			Defer();
+			return TaskExecutionResult::TASK_FINISHED;
+		}
+		auto batch_size = mini_batch_size == 0 ? samples.size() : mini_batch_size;
+		auto batch_end = MinValue<idx_t>(samples.size(), batch_offset + batch_size);
+		vector<RLTrainingSample> mini_batch(samples.begin() + NumericCast<int64_t>(batch_offset),
+		                                    samples.begin() + NumericCast<int64_t>(batch_end));
+		model.UpdateIncremental(mini_batch);
+		batch_offset = batch_end;
+	}
+	training_task_in_flight.store(false);
+	return TaskExecutionResult::TASK_FINISHED;
+}
+
+} // namespace duckdb
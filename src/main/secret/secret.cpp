@@ -148,10 +148,12 @@ void KeyValueSecretReader::Initialize(const char **secret_types, idx_t secret_ty
 	auto transaction = context ? CatalogTransaction::GetSystemCatalogTransaction(*context)
 	                           : CatalogTransaction::GetSystemTransaction(*db);
 
-	SecretMatch secret_match;
+	// readers are constructed per request (e.g. for every remote file access) - go through the lookup
+	// cache so repeated requests do not re-scan the secret storages and clone the secret every time
+	CachedSecretMatch secret_match;
 	for (idx_t i = 0; i < secret_types_len; i++) {
 		auto &secret_type = secret_types[i];
-		secret_match = secret_manager.LookupSecret(transaction, path, secret_type);
+		secret_match = secret_manager.LookupSecretCached(transaction, path, secret_type);
 		if (secret_match.HasMatch()) {
 			break;
 		}
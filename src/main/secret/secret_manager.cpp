@@ -197,7 +197,10 @@ unique_ptr<SecretEntry> SecretManager::RegisterSecretInternal(CatalogTransaction
 			throw InvalidInputException("Cannot create temporary secrets in a persistent secret storage!");
 		}
 	}
-	return backend->StoreSecret(std::move(secret), on_conflict, &transaction);
+	auto result = backend->StoreSecret(std::move(secret), on_conflict, &transaction);
+	// the set of secrets changed - cached lookups may now resolve differently
+	InvalidateSecretLookupCache();
+	return result;
 }
 
 optional_ptr<CreateSecretFunction> SecretManager::LookupFunctionInternal(const string &type, const string &provider) {
@@ -331,6 +334,39 @@ SecretMatch SecretManager::LookupSecret(CatalogTransaction transaction, const st
 	return SecretMatch();
 }
 
+CachedSecretMatch SecretManager::LookupSecretCached(CatalogTransaction transaction, const string &path,
+                                                    const string &type) {
+	auto cache_key = StringUtil::Lower(type) + "\n" + path;
+	{
+		lock_guard<mutex> guard(lookup_cache_lock);
+		auto entry = lookup_cache.find(cache_key);
+		if (entry != lookup_cache.end()) {
+			auto age = duration_cast<std::chrono::seconds>(steady_clock::now() - entry->second.resolved_at);
+			if (age.count() < NumericCast<int64_t>(SECRET_LOOKUP_CACHE_TTL_SECONDS)) {
+				return entry->second;
+			}
+			// the entry has expired - re-resolve it below
+			lookup_cache.erase(entry);
+		}
+	}
+
+	// not cached (or expired) - resolve through the secret storages and cache the immutable snapshot
+	auto match = LookupSecret(transaction, path, type);
+	CachedSecretMatch result;
+	result.secret_entry = shared_ptr<const SecretEntry>(std::move(match.secret_entry));
+	result.score = match.score;
+	result.resolved_at = steady_clock::now();
+
+	lock_guard<mutex> guard(lookup_cache_lock);
+	lookup_cache[cache_key] = result;
+	return result;
+}
+
+void SecretManager::InvalidateSecretLookupCache() {
+	lock_guard<mutex> guard(lookup_cache_lock);
+	lookup_cache.clear();
+}
+
 unique_ptr<SecretEntry> SecretManager::GetSecretByName(CatalogTransaction transaction, const string &name,
                                                        const string &storage) {
 	InitializeSecrets(transaction);
@@ -418,6 +454,8 @@ void SecretManager::DropSecretByName(CatalogTransaction transaction, const strin
 		// Do nothing on OnEntryNotFound::RETURN_NULL...
 	} else {
 		matches[0].get().DropSecretByName(name, on_entry_not_found, &transaction);
+		// the set of secrets changed - cached lookups may now resolve differently
+		InvalidateSecretLookupCache();
 	}
 }
 
@@ -199,6 +199,38 @@ Value AutoloadKnownExtensionsSetting::GetSetting(const ClientContext &context) {
 	return Value::BOOLEAN(config.options.autoload_known_extensions);
 }
 
+//===----------------------------------------------------------------------===//
+// Background Checkpoint
+//===----------------------------------------------------------------------===//
+void BackgroundCheckpointSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_checkpoint = input.GetValue<bool>();
+}
+
+void BackgroundCheckpointSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_checkpoint = DBConfigOptions().background_checkpoint;
+}
+
+Value BackgroundCheckpointSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_checkpoint);
+}
+
+//===----------------------------------------------------------------------===//
+// Background Cleanup
+//===----------------------------------------------------------------------===//
+void BackgroundCleanupSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.background_cleanup = input.GetValue<bool>();
+}
+
+void BackgroundCleanupSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.background_cleanup = DBConfigOptions().background_cleanup;
+}
+
+Value BackgroundCleanupSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.background_cleanup);
+}
+
 //===----------------------------------------------------------------------===//
 // Checkpoint Threshold
 //===----------------------------------------------------------------------===//
@@ -268,6 +300,28 @@ void DebugWindowModeSetting::OnSet(SettingCallbackInfo &info, Value &parameter)
 	EnumUtil::FromString<WindowAggregationMode>(StringValue::Get(parameter));
 }
 
+//===----------------------------------------------------------------------===//
+// Direct IO
+//===----------------------------------------------------------------------===//
+void DirectIOSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (!OnGlobalSet(db, config, input)) {
+		return;
+	}
+	config.options.use_direct_io = input.GetValue<bool>();
+}
+
+void DirectIOSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	if (!OnGlobalReset(db, config)) {
+		return;
+	}
+	config.options.use_direct_io = DBConfigOptions().use_direct_io;
+}
+
+Value DirectIOSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.use_direct_io);
+}
+
 //===----------------------------------------------------------------------===//
 // Disable Database Invalidation
 //===----------------------------------------------------------------------===//
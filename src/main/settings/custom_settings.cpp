@@ -21,6 +21,7 @@
 #include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/query_profiler.hpp"
+#include "duckdb/main/query_result_cache.hpp"
 #include "duckdb/main/secret/secret_manager.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parser.hpp"
@@ -37,6 +38,7 @@ namespace duckdb {
 constexpr const char *LoggingMode::Name;
 constexpr const char *LoggingLevel::Name;
 constexpr const char *EnableLogging::Name;
+constexpr const char *EnableLoggingAsync::Name;
 constexpr const char *LoggingStorage::Name;
 constexpr const char *EnabledLogTypes::Name;
 constexpr const char *DisabledLogTypes::Name;
@@ -112,6 +114,28 @@ Value AllocatorBulkDeallocationFlushThresholdSetting::GetSetting(const ClientCon
 	return Value(StringUtil::BytesToHumanReadableString(config.options.allocator_bulk_deallocation_flush_threshold));
 }
 
+//===----------------------------------------------------------------------===//
+// Allocator Dirty Decay Ms
+//===----------------------------------------------------------------------===//
+void AllocatorDirtyDecayMsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto decay_ms = input.GetValue<int64_t>();
+	if (decay_ms < -1) {
+		throw InvalidInputException("allocator_dirty_decay_ms must be -1 (allocator default) or non-negative");
+	}
+	config.options.allocator_dirty_decay_ms = decay_ms;
+	Allocator::SetDecay(decay_ms, config.options.allocator_muzzy_decay_ms);
+}
+
+void AllocatorDirtyDecayMsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.allocator_dirty_decay_ms = DBConfigOptions().allocator_dirty_decay_ms;
+	Allocator::SetDecay(config.options.allocator_dirty_decay_ms, config.options.allocator_muzzy_decay_ms);
+}
+
+Value AllocatorDirtyDecayMsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BIGINT(config.options.allocator_dirty_decay_ms);
+}
+
 //===----------------------------------------------------------------------===//
 // Allocator Flush Threshold
 //===----------------------------------------------------------------------===//
@@ -134,6 +158,80 @@ Value AllocatorFlushThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.allocator_flush_threshold));
 }
 
+//===----------------------------------------------------------------------===//
+// Allocator Memory Profile
+//===----------------------------------------------------------------------===//
+static void ApplyAllocatorMemoryProfile(DatabaseInstance *db, DBConfig &config, const string &profile) {
+	int64_t dirty_decay_ms;
+	int64_t muzzy_decay_ms;
+	bool background_threads;
+	if (profile == "default") {
+		dirty_decay_ms = DBConfigOptions().allocator_dirty_decay_ms;
+		muzzy_decay_ms = DBConfigOptions().allocator_muzzy_decay_ms;
+		background_threads = DBConfigOptions().allocator_background_threads;
+	} else if (profile == "latency") {
+		// keep freed pages around so repeated large queries avoid re-faulting them in
+		dirty_decay_ms = 30000;
+		muzzy_decay_ms = 30000;
+		background_threads = false;
+	} else if (profile == "footprint") {
+		// aggressively return freed pages to the OS to keep RSS close to the live heap
+		dirty_decay_ms = 500;
+		muzzy_decay_ms = 0;
+		background_threads = true;
+	} else {
+		throw InvalidInputException(
+		    "Unknown allocator memory profile '%s' - expected DEFAULT, LATENCY or FOOTPRINT", profile);
+	}
+	config.options.allocator_memory_profile = profile;
+	config.options.allocator_dirty_decay_ms = dirty_decay_ms;
+	config.options.allocator_muzzy_decay_ms = muzzy_decay_ms;
+	config.options.allocator_background_threads = background_threads;
+	Allocator::SetDecay(dirty_decay_ms, muzzy_decay_ms);
+	if (db) {
+		TaskScheduler::GetScheduler(*db).SetAllocatorBackgroundThreads(background_threads);
+	}
+	if (profile == "footprint") {
+		// also purge what has accumulated up to this point
+		Allocator::FlushAll();
+	}
+}
+
+void AllocatorMemoryProfileSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	ApplyAllocatorMemoryProfile(db, config, StringUtil::Lower(input.ToString()));
+}
+
+void AllocatorMemoryProfileSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	ApplyAllocatorMemoryProfile(db, config, DBConfigOptions().allocator_memory_profile);
+}
+
+Value AllocatorMemoryProfileSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value(config.options.allocator_memory_profile);
+}
+
+//===----------------------------------------------------------------------===//
+// Allocator Muzzy Decay Ms
+//===----------------------------------------------------------------------===//
+void AllocatorMuzzyDecayMsSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	auto decay_ms = input.GetValue<int64_t>();
+	if (decay_ms < -1) {
+		throw InvalidInputException("allocator_muzzy_decay_ms must be -1 (allocator default) or non-negative");
+	}
+	config.options.allocator_muzzy_decay_ms = decay_ms;
+	Allocator::SetDecay(config.options.allocator_dirty_decay_ms, decay_ms);
+}
+
+void AllocatorMuzzyDecayMsSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.allocator_muzzy_decay_ms = DBConfigOptions().allocator_muzzy_decay_ms;
+	Allocator::SetDecay(config.options.allocator_dirty_decay_ms, config.options.allocator_muzzy_decay_ms);
+}
+
+Value AllocatorMuzzyDecayMsSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BIGINT(config.options.allocator_muzzy_decay_ms);
+}
+
 //===----------------------------------------------------------------------===//
 // Allow Community Extensions
 //===----------------------------------------------------------------------===//
@@ -210,6 +308,25 @@ bool AllowUnredactedSecretsSetting::OnGlobalReset(DatabaseInstance *db, DBConfig
 	return true;
 }
 
+//===----------------------------------------------------------------------===//
+// Direct IO
+//===----------------------------------------------------------------------===//
+bool DirectIOSetting::OnGlobalSet(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	if (db) {
+		throw InvalidInputException("Cannot change direct_io setting while database is running - it must be set when "
+		                            "opening the database");
+	}
+	return true;
+}
+
+bool DirectIOSetting::OnGlobalReset(DatabaseInstance *db, DBConfig &config) {
+	if (db) {
+		throw InvalidInputException("Cannot change direct_io setting while database is running - it must be set when "
+		                            "opening the database");
+	}
+	return true;
+}
+
 //===----------------------------------------------------------------------===//
 // Disable Database Invalidation
 //===----------------------------------------------------------------------===//
@@ -324,6 +441,34 @@ Value CheckpointThresholdSetting::GetSetting(const ClientContext &context) {
 	return Value(StringUtil::BytesToHumanReadableString(config.options.checkpoint_wal_size));
 }
 
+//===----------------------------------------------------------------------===//
+// Compress Streaming Buffer
+//===----------------------------------------------------------------------===//
+void CompressStreamingBufferSetting::SetLocal(ClientContext &context, const Value &input) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.compress_streaming_buffer = input.GetValue<bool>();
+}
+
+void CompressStreamingBufferSetting::ResetLocal(ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	config.compress_streaming_buffer = ClientConfig().compress_streaming_buffer;
+}
+
+Value CompressStreamingBufferSetting::GetSetting(const ClientContext &context) {
+	auto &config = ClientConfig::GetConfig(context);
+	return Value::BOOLEAN(config.compress_streaming_buffer);
+}
+
+//===----------------------------------------------------------------------===//
+// Compression Scan Bias
+//===----------------------------------------------------------------------===//
+void CompressionScanBiasSetting::OnSet(SettingCallbackInfo &, Value &input) {
+	auto compression_scan_bias = input.GetValue<double>();
+	if (compression_scan_bias < 0 || compression_scan_bias > 1.0) {
+		throw InvalidInputException("the compression scan bias must be within [0, 1]");
+	}
+}
+
 //===----------------------------------------------------------------------===//
 // Custom Profiling Settings
 //===----------------------------------------------------------------------===//
@@ -707,6 +852,22 @@ void EnableLogging::ResetGlobal(DatabaseInstance *db_p, DBConfig &config) {
 	db.GetLogManager().SetEnableLogging(false);
 }
 
+//===----------------------------------------------------------------------===//
+// Enable Logging Async
+//===----------------------------------------------------------------------===//
+Value EnableLoggingAsync::GetSetting(const ClientContext &context) {
+	return context.db->GetLogManager().AsyncLoggingEnabled();
+}
+void EnableLoggingAsync::SetGlobal(DatabaseInstance *db_p, DBConfig &config, const Value &parameter) {
+	auto &db = GetDB<EnableLoggingAsync>(db_p);
+	db.GetLogManager().SetEnableAsyncLogging(parameter.GetValue<bool>());
+}
+
+void EnableLoggingAsync::ResetGlobal(DatabaseInstance *db_p, DBConfig &config) {
+	auto &db = GetDB<EnableLoggingAsync>(db_p);
+	db.GetLogManager().SetEnableAsyncLogging(false);
+}
+
 //===----------------------------------------------------------------------===//
 // Logging Mode
 //===----------------------------------------------------------------------===//
@@ -915,6 +1076,29 @@ bool EnableProgressBarSetting::OnLocalReset(ClientContext &context) {
 	return true;
 }
 
+//===----------------------------------------------------------------------===//
+// Enable Result Cache
+//===----------------------------------------------------------------------===//
+void EnableResultCacheSetting::SetGlobal(DatabaseInstance *db, DBConfig &config, const Value &input) {
+	config.options.enable_result_cache = input.GetValue<bool>();
+	if (db && !config.options.enable_result_cache) {
+		// drop any cached results when the cache is disabled
+		db->GetQueryResultCache().Clear();
+	}
+}
+
+void EnableResultCacheSetting::ResetGlobal(DatabaseInstance *db, DBConfig &config) {
+	config.options.enable_result_cache = DBConfigOptions().enable_result_cache;
+	if (db && !config.options.enable_result_cache) {
+		db->GetQueryResultCache().Clear();
+	}
+}
+
+Value EnableResultCacheSetting::GetSetting(const ClientContext &context) {
+	auto &config = DBConfig::GetConfig(context);
+	return Value::BOOLEAN(config.options.enable_result_cache);
+}
+
 //===----------------------------------------------------------------------===//
 // External Threads
 //===----------------------------------------------------------------------===//
@@ -1221,8 +1405,8 @@ Value PasswordSetting::GetSetting(const ClientContext &context) {
 //===----------------------------------------------------------------------===//
 void PerfectHtThresholdSetting::OnSet(SettingCallbackInfo &info, Value &input) {
 	auto bits = input.GetValue<int64_t>();
-	if (bits < 0 || bits > 32) {
-		throw ParserException("Perfect HT threshold out of range: should be within range 0 - 32");
+	if (bits < 0 || bits > 40) {
+		throw ParserException("Perfect HT threshold out of range: should be within range 0 - 40");
 	}
 }
 
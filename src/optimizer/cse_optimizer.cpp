@@ -2,6 +2,7 @@
 
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_filter.hpp"
 #include "duckdb/planner/operator/logical_projection.hpp"
 #include "duckdb/planner/column_binding_map.hpp"
 #include "duckdb/planner/binder.hpp"
@@ -37,6 +38,13 @@ struct CSEReplacementState {
 void CommonSubExpressionOptimizer::VisitOperator(LogicalOperator &op) {
 	switch (op.type) {
 	case LogicalOperatorType::LOGICAL_PROJECTION:
+		if (op.children[0]->type == LogicalOperatorType::LOGICAL_FILTER) {
+			// subexpressions shared between a filter and the projection above it are evaluated twice -
+			// extract those first, below the filter, so both operators can reference them
+			ExtractCrossOperatorCSEs(op, *op.children[0]);
+		}
+		ExtractCommonSubExpresions(op);
+		break;
 	case LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY:
 		ExtractCommonSubExpresions(op);
 		break;
@@ -173,4 +181,53 @@ void CommonSubExpressionOptimizer::ExtractCommonSubExpresions(LogicalOperator &o
 	op.children[0] = std::move(projection);
 }
 
+void CommonSubExpressionOptimizer::ExtractCrossOperatorCSEs(LogicalOperator &op, LogicalOperator &filter) {
+	D_ASSERT(filter.type == LogicalOperatorType::LOGICAL_FILTER);
+	if (filter.Cast<LogicalFilter>().HasProjectionMap()) {
+		// the filter prunes columns positionally - inserting a projection below it would shift the positions
+		return;
+	}
+	// count the expressions of the filter separately, so we can restrict extraction to subtrees the filter shares
+	// with the projection - expressions the filter doesn't use should not be computed before the filter runs
+	CSEReplacementState filter_state;
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    filter, [&](unique_ptr<Expression> *child) { CountExpressions(**child, filter_state); });
+	if (filter_state.expression_count.empty()) {
+		return;
+	}
+	// now count across both operators combined
+	CSEReplacementState state;
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    filter, [&](unique_ptr<Expression> *child) { CountExpressions(**child, state); });
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { CountExpressions(**child, state); });
+	bool perform_replacement = false;
+	for (auto &expr : state.expression_count) {
+		if (expr.second.count > 1 &&
+		    filter_state.expression_count.find(expr.first) != filter_state.expression_count.end()) {
+			perform_replacement = true;
+		} else {
+			// either not repeated, or not used by the filter - mark it ineligible for this pass
+			expr.second.count = 1;
+		}
+	}
+	if (!perform_replacement) {
+		return;
+	}
+	state.projection_index = binder.GenerateTableIndex();
+	// replace the shared subtrees in both operators with references to the new projection
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    filter, [&](unique_ptr<Expression> *child) { PerformCSEReplacement(*child, state); });
+	LogicalOperatorVisitor::EnumerateExpressions(
+	    op, [&](unique_ptr<Expression> *child) { PerformCSEReplacement(*child, state); });
+	D_ASSERT(state.expressions.size() > 0);
+	// the shared projection goes below the filter, so the computed columns flow through it to the projection above
+	auto projection = make_uniq<LogicalProjection>(state.projection_index, std::move(state.expressions));
+	if (filter.children[0]->has_estimated_cardinality) {
+		projection->SetEstimatedCardinality(filter.children[0]->estimated_cardinality);
+	}
+	projection->children.push_back(std::move(filter.children[0]));
+	filter.children[0] = std::move(projection);
+}
+
 } // namespace duckdb
@@ -425,69 +425,7 @@ double CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set
 	double effective_result = duckdb_result;
 	if (client_context) {
 		RLModelInterface rl_model(*client_context);
-		OperatorFeatures features;
-		features.operator_type = "JOIN_ORDER_SET";
-		features.operator_name = "JoinOrderSet";
-		features.estimated_cardinality =
-		    LossyNumericCast<idx_t>(MinValue<double>(duckdb_result, (double)NumericLimits<idx_t>::Maximum()));
-
-		// Populate join features (minimal but stable for relation-set inference)
-		features.join_type = "INNER";
-		features.join_relation_set = new_set.ToString();
-		features.num_relations = new_set.count;
-		features.numerator = numerator;
-		features.denominator = denom.denominator;
-
-		// Representative TDOM: min across edges in the set (if any)
-		auto edges = GetEdges(relations_to_tdoms, new_set);
-		idx_t min_tdom = 0;
-		bool any_hll = false;
-		bool any_eq = false;
-		for (auto &edge : edges) {
-			auto tdom_value = edge.has_tdom_hll ? edge.tdom_hll : edge.tdom_no_hll;
-			if (tdom_value > 0) {
-				min_tdom = min_tdom == 0 ? tdom_value : MinValue(min_tdom, tdom_value);
-			}
-			any_hll = any_hll || edge.has_tdom_hll;
-
-			// Try to detect equality join predicates
-			if (edge.filter_info && edge.filter_info->filter) {
-				ExpressionIterator::EnumerateExpression(edge.filter_info->filter, [&](Expression &expr) {
-					if (expr.GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
-						return;
-					}
-					auto et = expr.GetExpressionType();
-					if (et == ExpressionType::COMPARE_EQUAL || et == ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
-						any_eq = true;
-					}
-				});
-			}
-		}
-		features.tdom_value = min_tdom;
-		features.tdom_from_hll = any_hll;
-		features.comparison_type_join = any_eq ? "EQUAL" : "";
-
-		// Provide stable left/right context: top-2 leaf cardinalities in the set
-		idx_t max1 = 0;
-		idx_t max2 = 0;
-		for (idx_t i = 0; i < new_set.count; i++) {
-			auto &single_node_set = set_manager.GetJoinRelation(new_set.relations[i]);
-			auto it = relation_set_2_cardinality.find(single_node_set.ToString());
-			if (it == relation_set_2_cardinality.end()) {
-				continue;
-			}
-			auto c = LossyNumericCast<idx_t>(
-			    MinValue<double>(it->second.cardinality_before_filters, (double)NumericLimits<idx_t>::Maximum()));
-			if (c >= max1) {
-				max2 = max1;
-				max1 = c;
-			} else if (c > max2) {
-				max2 = c;
-			}
-		}
-		features.left_cardinality = max1;
-		features.right_cardinality = max2 > 0 ? max2 : max1;
-
+		auto features = BuildJoinSetFeatures(new_set, numerator, denom.denominator);
 		const auto rl_pred = rl_model.PredictPlanningCardinality(features);
 		if (rl_pred > 0) {
 			effective_result = (double)rl_pred;
@@ -499,6 +437,106 @@ double CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set
 	return effective_result;
 }
 
+OperatorFeatures CardinalityEstimator::BuildJoinSetFeatures(JoinRelationSet &new_set, double numerator,
+                                                            double denominator) {
+	double duckdb_result = denominator != 0 ? numerator / denominator : numerator;
+	OperatorFeatures features;
+	features.operator_type = "JOIN_ORDER_SET";
+	features.operator_name = "JoinOrderSet";
+	features.estimated_cardinality =
+	    LossyNumericCast<idx_t>(MinValue<double>(duckdb_result, (double)NumericLimits<idx_t>::Maximum()));
+
+	// Populate join features (minimal but stable for relation-set inference)
+	features.join_type = "INNER";
+	features.join_relation_set = new_set.ToString();
+	features.num_relations = new_set.count;
+	features.numerator = numerator;
+	features.denominator = denominator;
+
+	// Representative TDOM: min across edges in the set (if any)
+	auto edges = GetEdges(relations_to_tdoms, new_set);
+	idx_t min_tdom = 0;
+	bool any_hll = false;
+	bool any_eq = false;
+	for (auto &edge : edges) {
+		auto tdom_value = edge.has_tdom_hll ? edge.tdom_hll : edge.tdom_no_hll;
+		if (tdom_value > 0) {
+			min_tdom = min_tdom == 0 ? tdom_value : MinValue(min_tdom, tdom_value);
+		}
+		any_hll = any_hll || edge.has_tdom_hll;
+
+		// Try to detect equality join predicates
+		if (edge.filter_info && edge.filter_info->filter) {
+			ExpressionIterator::EnumerateExpression(edge.filter_info->filter, [&](Expression &expr) {
+				if (expr.GetExpressionClass() != ExpressionClass::BOUND_COMPARISON) {
+					return;
+				}
+				auto et = expr.GetExpressionType();
+				if (et == ExpressionType::COMPARE_EQUAL || et == ExpressionType::COMPARE_NOT_DISTINCT_FROM) {
+					any_eq = true;
+				}
+			});
+		}
+	}
+	features.tdom_value = min_tdom;
+	features.tdom_from_hll = any_hll;
+	features.comparison_type_join = any_eq ? "EQUAL" : "";
+
+	// Provide stable left/right context: top-2 leaf cardinalities in the set
+	idx_t max1 = 0;
+	idx_t max2 = 0;
+	for (idx_t i = 0; i < new_set.count; i++) {
+		auto &single_node_set = set_manager.GetJoinRelation(new_set.relations[i]);
+		auto it = relation_set_2_cardinality.find(single_node_set.ToString());
+		if (it == relation_set_2_cardinality.end()) {
+			continue;
+		}
+		auto c = LossyNumericCast<idx_t>(
+		    MinValue<double>(it->second.cardinality_before_filters, (double)NumericLimits<idx_t>::Maximum()));
+		if (c >= max1) {
+			max2 = max1;
+			max1 = c;
+		} else if (c > max2) {
+			max2 = c;
+		}
+	}
+	features.left_cardinality = max1;
+	features.right_cardinality = max2 > 0 ? max2 : max1;
+	return features;
+}
+
+void CardinalityEstimator::PrimeCardinalityEstimates(const vector<reference<JoinRelationSet>> &sets) {
+	if (!client_context || sets.empty()) {
+		return;
+	}
+	// Gather all sets that are not cached yet and build their feature vectors, then run the
+	// model once over the whole batch instead of once per emitted pair.
+	vector<reference<JoinRelationSet>> miss_sets;
+	vector<OperatorFeatures> miss_features;
+	vector<double> duckdb_results;
+	for (auto &set_ref : sets) {
+		auto &new_set = set_ref.get();
+		if (relation_set_2_cardinality.find(new_set.ToString()) != relation_set_2_cardinality.end()) {
+			continue;
+		}
+		auto denom = GetDenominator(new_set);
+		auto numerator = GetNumerator(denom.numerator_relations);
+		miss_sets.push_back(new_set);
+		miss_features.push_back(BuildJoinSetFeatures(new_set, numerator, denom.denominator));
+		duckdb_results.push_back(denom.denominator != 0 ? numerator / denom.denominator : numerator);
+	}
+	if (miss_sets.empty()) {
+		return;
+	}
+
+	RLModelInterface rl_model(*client_context);
+	auto predictions = rl_model.PredictPlanningCardinalityBatch(miss_features);
+	for (idx_t i = 0; i < miss_sets.size(); i++) {
+		double effective_result = predictions[i] > 0 ? (double)predictions[i] : duckdb_results[i];
+		relation_set_2_cardinality[miss_sets[i].get().ToString()] = CardinalityHelper(effective_result);
+	}
+}
+
 template <>
 idx_t CardinalityEstimator::EstimateCardinalityWithSet(JoinRelationSet &new_set) {
 	auto cardinality_as_double = EstimateCardinalityWithSet<double>(new_set);
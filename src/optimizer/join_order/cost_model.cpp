@@ -1,3 +1,4 @@
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/optimizer/join_order/join_node.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
 #include "duckdb/optimizer/join_order/cost_model.hpp"
@@ -8,12 +9,22 @@ CostModel::CostModel(QueryGraphManager &query_graph_manager)
     : query_graph_manager(query_graph_manager), cardinality_estimator() {
 	// Allow join-order DP to use RL predictions (cached) via the cardinality estimator
 	cardinality_estimator.SetClientContext(query_graph_manager.context);
+	cost_constants = CostCalibration::Get(FileSystem::GetFileSystem(query_graph_manager.context));
 }
 
 double CostModel::ComputeCost(DPJoinNode &left, DPJoinNode &right) {
 	auto &combination = query_graph_manager.set_manager.Union(left.set, right.set);
 	auto join_card = cardinality_estimator.EstimateCardinalityWithSet<double>(combination);
 	auto join_cost = join_card;
+	if (cost_constants.calibrated && cost_constants.materialization_ns_per_tuple > 0) {
+		// weight the build and probe work against producing an output tuple, using the per-tuple
+		// costs measured on this machine (the right child is the build side of a hash join)
+		auto build_card = cardinality_estimator.EstimateCardinalityWithSet<double>(right.set);
+		auto probe_card = cardinality_estimator.EstimateCardinalityWithSet<double>(left.set);
+		join_cost += (build_card * cost_constants.hash_build_ns_per_tuple +
+		              probe_card * cost_constants.hash_probe_ns_per_tuple) /
+		             cost_constants.materialization_ns_per_tuple;
+	}
 	return join_cost + left.cost + right.cost;
 }
 
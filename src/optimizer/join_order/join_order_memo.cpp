@@ -0,0 +1,30 @@
+#include "duckdb/optimizer/join_order/join_order_memo.hpp"
+
+namespace duckdb {
+
+void JoinOrderMemo::Record(uint64_t fingerprint, JoinOrderMemoEntry entry) {
+	lock_guard<mutex> guard(lock);
+	auto existing = entries.find(fingerprint);
+	if (existing != entries.end()) {
+		// the most recent enumeration wins - the statistics may have shifted since the first run
+		existing->second = std::move(entry);
+		return;
+	}
+	if (entries.size() >= MAXIMUM_ENTRIES) {
+		// full - drop the entry rather than growing without bound
+		return;
+	}
+	entries.emplace(fingerprint, std::move(entry));
+}
+
+bool JoinOrderMemo::TryGet(uint64_t fingerprint, JoinOrderMemoEntry &entry) const {
+	lock_guard<mutex> guard(lock);
+	auto existing = entries.find(fingerprint);
+	if (existing == entries.end()) {
+		return false;
+	}
+	entry = existing->second;
+	return true;
+}
+
+} // namespace duckdb
@@ -3,6 +3,7 @@
 #include "duckdb/common/enums/join_type.hpp"
 #include "duckdb/common/limits.hpp"
 #include "duckdb/common/pair.hpp"
+#include "duckdb/main/database.hpp"
 #include "duckdb/optimizer/join_order/cost_model.hpp"
 #include "duckdb/optimizer/join_order/plan_enumerator.hpp"
 #include "duckdb/planner/expression/list.hpp"
@@ -53,7 +54,30 @@ unique_ptr<LogicalOperator> JoinOrderOptimizer::Optimize(unique_ptr<LogicalOpera
 
 		// Initialize the leaf/single node plans
 		plan_enumerator.InitLeafPlans();
-		plan_enumerator.SolveJoinOrder();
+
+		// structurally identical queries (same relations, join edges and predicate shapes - only the
+		// literals differ) hit the join order memo: we replay the memoized merge sequence and re-cost it
+		// against the current statistics instead of enumerating the search space again
+		auto &memo = context.db->GetJoinOrderMemo();
+		const bool use_memo = query_graph_manager.relation_manager.NumRelations() > 2;
+		uint64_t fingerprint = 0;
+		bool replayed = false;
+		if (use_memo) {
+			fingerprint = query_graph_manager.ComputeStructuralFingerprint();
+			JoinOrderMemoEntry memo_entry;
+			if (memo.TryGet(fingerprint, memo_entry)) {
+				replayed = plan_enumerator.ReplayJoinOrder(memo_entry);
+			}
+		}
+		if (!replayed) {
+			plan_enumerator.SolveJoinOrder();
+			if (use_memo) {
+				JoinOrderMemoEntry memo_entry;
+				if (plan_enumerator.ExtractJoinOrder(memo_entry)) {
+					memo.Record(fingerprint, std::move(memo_entry));
+				}
+			}
+		}
 		// now reconstruct a logical plan from the query graph plan
 		query_graph_manager.plans = &plan_enumerator.GetPlans();
 
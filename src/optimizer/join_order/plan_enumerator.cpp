@@ -172,10 +172,8 @@ bool PlanEnumerator::TryEmitPair(JoinRelationSet &left, JoinRelationSet &right,
 	// If a full plan is created, it's possible a node in the plan gets updated. When this happens, make sure you keep
 	// emitting pairs until you emit another final plan. Another final plan is guaranteed to be produced because of
 	// our symmetry guarantees.
-	if (pairs >= 10000) {
+	if (pairs >= DP_PAIR_BUDGET) {
 		// when the amount of pairs gets too large we exit the dynamic programming and resort to a greedy algorithm
-		// FIXME: simple heuristic currently
-		// at 10K pairs stop searching exactly and switch to heuristic
 		return false;
 	}
 	EmitPair(left, right, info);
@@ -214,6 +212,20 @@ bool PlanEnumerator::EmitCSG(JoinRelationSet &node) {
 		new_exclusion_set.insert(neighbors[i]);
 	}
 
+	// batch-prime cardinality estimates for the whole neighbor frontier so the cardinality
+	// model runs once over all candidate sets instead of once per emitted pair
+	vector<reference<JoinRelationSet>> candidate_sets;
+	candidate_sets.reserve(neighbors.size());
+	for (auto neighbor : neighbors) {
+		auto &neighbor_relation = query_graph_manager.set_manager.GetJoinRelation(neighbor);
+		if (!query_graph.GetConnections(node, neighbor_relation).empty()) {
+			candidate_sets.push_back(query_graph_manager.set_manager.Union(node, neighbor_relation));
+		}
+	}
+	if (candidate_sets.size() > 1) {
+		cost_model.cardinality_estimator.PrimeCardinalityEstimates(candidate_sets);
+	}
+
 	for (auto neighbor : neighbors) {
 		// since the GetNeighbors only returns the smallest element in a list, the entry might not be connected to
 		// (only!) this neighbor,  hence we have to do a connectedness check before we can emit it
@@ -339,6 +351,65 @@ bool PlanEnumerator::SolveJoinOrderExactly() {
 	return true;
 }
 
+void PlanEnumerator::SeedSmallSubgraphPlans() {
+	// The greedy algorithm builds the final plan bottom-up out of whatever the DP table contains. For queries with
+	// too many relations to enumerate exhaustively, spend the DP budget on the small connected subgraphs instead:
+	// their optimal plans are cheap to compute, and every greedy merge that touches one reuses it as-is.
+	const idx_t num_relations = query_graph_manager.relation_manager.NumRelations();
+	// collect all connected pairs of base relations and batch-prime their cardinality estimates, so the
+	// prediction model scores the whole frontier in one call
+	vector<reference<JoinRelationSet>> pair_sets;
+	for (idx_t i = 0; i < num_relations; i++) {
+		auto &left = query_graph_manager.set_manager.GetJoinRelation(i);
+		for (idx_t j = i + 1; j < num_relations; j++) {
+			auto &right = query_graph_manager.set_manager.GetJoinRelation(j);
+			if (!query_graph.GetConnections(left, right).empty()) {
+				pair_sets.push_back(query_graph_manager.set_manager.Union(left, right));
+			}
+		}
+	}
+	if (pair_sets.size() > 1) {
+		cost_model.cardinality_estimator.PrimeCardinalityEstimates(pair_sets);
+	}
+	for (idx_t i = 0; i < num_relations; i++) {
+		auto &left = query_graph_manager.set_manager.GetJoinRelation(i);
+		for (idx_t j = i + 1; j < num_relations; j++) {
+			auto &right = query_graph_manager.set_manager.GetJoinRelation(j);
+			auto connections = query_graph.GetConnections(left, right);
+			if (connections.empty()) {
+				continue;
+			}
+			if (!TryEmitPair(left, right, connections)) {
+				return;
+			}
+		}
+	}
+	// extend every connected pair with a third relation where the graph allows it
+	for (auto &pair_set : pair_sets) {
+		auto &pair_relations = pair_set.get();
+		for (idx_t k = 0; k < num_relations; k++) {
+			bool in_pair = false;
+			for (idx_t r = 0; r < pair_relations.count; r++) {
+				if (pair_relations.relations[r] == k) {
+					in_pair = true;
+					break;
+				}
+			}
+			if (in_pair) {
+				continue;
+			}
+			auto &third = query_graph_manager.set_manager.GetJoinRelation(k);
+			auto connections = query_graph.GetConnections(pair_relations, third);
+			if (connections.empty()) {
+				continue;
+			}
+			if (!TryEmitPair(pair_relations, third, connections)) {
+				return;
+			}
+		}
+	}
+}
+
 void PlanEnumerator::SolveJoinOrderApproximately() {
 	// at this point, we exited the dynamic programming but did not compute the final join order because it took too
 	// long instead, we use a greedy heuristic to obtain a join ordering now we use Greedy Operator Ordering to
@@ -355,29 +426,84 @@ void PlanEnumerator::SolveJoinOrderApproximately() {
 		// is unsigned.
 		idx_t best_left = 0, best_right = 0;
 		optional_ptr<DPJoinNode> best_connection;
+		// first collect all connected candidate merges for this step and batch-prime their cardinality
+		// estimates, so the prediction model scores the whole frontier before we commit to any merge
+		struct CandidateMerge {
+			idx_t left;
+			idx_t right;
+			double cost;
+		};
+		vector<CandidateMerge> candidates;
+		vector<reference<JoinRelationSet>> candidate_sets;
 		for (idx_t i = 0; i < join_relations.size(); i++) {
 			auto left = join_relations[i];
 			for (idx_t j = i + 1; j < join_relations.size(); j++) {
 				auto right = join_relations[j];
 				// check if we can connect these two relations
-				auto connection = query_graph.GetConnections(left, right);
-				if (!connection.empty()) {
-					// we can check the cost of this connection
-					auto node = EmitPair(left, right, connection);
-
-					// update the DP tree in case a plan created by the DP algorithm uses the node
-					// that was potentially just updated by EmitPair. You will get a use-after-free
-					// error if future plans rely on the old node that was just replaced.
-					// if node in FullPath, then updateDP tree.
-
-					if (!best_connection || node.cost < best_connection->cost) {
-						// best pair found so far
-						best_connection = &EmitPair(left, right, connection);
-						best_left = i;
-						best_right = j;
+				if (!query_graph.GetConnections(left, right).empty()) {
+					candidate_sets.push_back(query_graph_manager.set_manager.Union(left, right));
+					candidates.push_back(CandidateMerge {i, j, 0});
+				}
+			}
+		}
+		if (candidate_sets.size() > 1) {
+			cost_model.cardinality_estimator.PrimeCardinalityEstimates(candidate_sets);
+		}
+		for (auto &candidate : candidates) {
+			auto left = join_relations[candidate.left];
+			auto right = join_relations[candidate.right];
+			auto connection = query_graph.GetConnections(left, right);
+			// we can check the cost of this connection
+			// note that we don't hold on to the emitted node here: a later EmitPair can replace the entry
+			// in the DP table, and you will get a use-after-free error if you rely on the old node
+			candidate.cost = EmitPair(left, right, connection).cost;
+		}
+		if (!candidates.empty()) {
+			// keep a beam of the cheapest candidate merges and look one merge ahead for each of them -
+			// the locally cheapest merge can force an expensive follow-up join that a slightly more
+			// expensive merge would have avoided
+			std::sort(candidates.begin(), candidates.end(),
+			          [](const CandidateMerge &a, const CandidateMerge &b) { return a.cost < b.cost; });
+			if (candidates.size() > APPROXIMATE_BEAM_WIDTH) {
+				candidates.resize(APPROXIMATE_BEAM_WIDTH);
+			}
+			idx_t chosen = 0;
+			if (candidates.size() > 1 && join_relations.size() > 2) {
+				auto best_score = NumericLimits<double>::Maximum();
+				for (idx_t candidate_idx = 0; candidate_idx < candidates.size(); candidate_idx++) {
+					auto &candidate = candidates[candidate_idx];
+					auto left = join_relations[candidate.left];
+					auto right = join_relations[candidate.right];
+					auto &combined_set = query_graph_manager.set_manager.Union(left, right);
+					// score the candidate by the cheapest join that can follow it; if nothing connects to
+					// the merged set we fall back to the candidate's own cost
+					auto score = candidate.cost;
+					auto best_next = NumericLimits<double>::Maximum();
+					for (idx_t k = 0; k < join_relations.size(); k++) {
+						if (k == candidate.left || k == candidate.right) {
+							continue;
+						}
+						auto next_connection = query_graph.GetConnections(combined_set, join_relations[k]);
+						if (next_connection.empty()) {
+							continue;
+						}
+						auto next_cost = EmitPair(combined_set, join_relations[k], next_connection).cost;
+						best_next = MinValue(best_next, next_cost);
+					}
+					if (best_next < NumericLimits<double>::Maximum()) {
+						score = best_next;
+					}
+					if (score < best_score) {
+						best_score = score;
+						chosen = candidate_idx;
 					}
 				}
 			}
+			best_left = candidates[chosen].left;
+			best_right = candidates[chosen].right;
+			auto left = join_relations[best_left];
+			auto right = join_relations[best_right];
+			best_connection = &EmitPair(left, right, query_graph.GetConnections(left, right));
 		}
 		if (!best_connection) {
 			// could not find a connection, but we were not done with finding a completed plan
@@ -468,6 +594,91 @@ void PlanEnumerator::InitLeafPlans() {
 	}
 }
 
+bool PlanEnumerator::ReplayJoinOrder(const JoinOrderMemoEntry &memo) {
+	const idx_t num_relations = query_graph_manager.relation_manager.NumRelations();
+	if (memo.merges.size() != num_relations - 1) {
+		// the memoized order was found for a different relation count - fingerprint collision
+		return false;
+	}
+	for (auto &merge : memo.merges) {
+		unordered_set<idx_t> left_bindings;
+		unordered_set<idx_t> right_bindings;
+		for (auto relation : merge.left) {
+			if (relation >= num_relations) {
+				return false;
+			}
+			left_bindings.insert(relation);
+		}
+		for (auto relation : merge.right) {
+			if (relation >= num_relations) {
+				return false;
+			}
+			right_bindings.insert(relation);
+		}
+		auto &left = query_graph_manager.set_manager.GetJoinRelation(left_bindings);
+		auto &right = query_graph_manager.set_manager.GetJoinRelation(right_bindings);
+		if (plans.find(left) == plans.end() || plans.find(right) == plans.end()) {
+			// the merge references a subplan the sequence never produced - fall back to enumeration
+			return false;
+		}
+		auto connections = query_graph.GetConnections(left, right);
+		if (connections.empty()) {
+			// the memoized order resolved this merge with a cross product - recreate the edge
+			query_graph_manager.CreateQueryGraphCrossProduct(left, right);
+			connections = query_graph.GetConnections(left, right);
+			if (connections.empty()) {
+				return false;
+			}
+		}
+		// re-cost the merge against the current statistics
+		EmitPair(left, right, connections);
+	}
+	// the replay must end in a plan covering every relation
+	unordered_set<idx_t> all_bindings;
+	for (idx_t i = 0; i < num_relations; i++) {
+		all_bindings.insert(i);
+	}
+	auto &total_relation = query_graph_manager.set_manager.GetJoinRelation(all_bindings);
+	return plans.find(total_relation) != plans.end();
+}
+
+static bool CollectMerges(const reference_map_t<JoinRelationSet, unique_ptr<DPJoinNode>> &plans,
+                          const DPJoinNode &node, vector<JoinOrderMemoMerge> &merges) {
+	if (node.is_leaf) {
+		return true;
+	}
+	auto left = plans.find(node.left_set);
+	auto right = plans.find(node.right_set);
+	if (left == plans.end() || right == plans.end()) {
+		return false;
+	}
+	if (!CollectMerges(plans, *left->second, merges) || !CollectMerges(plans, *right->second, merges)) {
+		return false;
+	}
+	JoinOrderMemoMerge merge;
+	for (idx_t i = 0; i < node.left_set.count; i++) {
+		merge.left.push_back(node.left_set.relations[i]);
+	}
+	for (idx_t i = 0; i < node.right_set.count; i++) {
+		merge.right.push_back(node.right_set.relations[i]);
+	}
+	merges.push_back(std::move(merge));
+	return true;
+}
+
+bool PlanEnumerator::ExtractJoinOrder(JoinOrderMemoEntry &memo) const {
+	unordered_set<idx_t> all_bindings;
+	for (idx_t i = 0; i < query_graph_manager.relation_manager.NumRelations(); i++) {
+		all_bindings.insert(i);
+	}
+	auto &total_relation = query_graph_manager.set_manager.GetJoinRelation(all_bindings);
+	auto final_plan = plans.find(total_relation);
+	if (final_plan == plans.end()) {
+		return false;
+	}
+	return CollectMerges(plans, *final_plan->second, memo.merges);
+}
+
 // the plan enumeration is a straight implementation of the paper "Dynamic Programming Strikes Back" by Guido
 // Moerkotte and Thomas Neumannn, see that paper for additional info/documentation bonus slides:
 // https://db.in.tum.de/teaching/ws1415/queryopt/chapter3.pdf?lang=de
@@ -475,6 +686,9 @@ void PlanEnumerator::SolveJoinOrder() {
 	bool force_no_cross_product = DBConfig::GetSetting<DebugForceNoCrossProductSetting>(query_graph_manager.context);
 	// first try to solve the join order exactly
 	if (query_graph_manager.relation_manager.NumRelations() >= THRESHOLD_TO_SWAP_TO_APPROXIMATE) {
+		// too many relations to enumerate exhaustively - spend the DP budget on the small connected
+		// subgraphs instead, then let the greedy algorithm stitch the seeded optima together
+		SeedSmallSubgraphPlans();
 		SolveJoinOrderApproximately();
 	} else if (!SolveJoinOrderExactly()) {
 		// otherwise, if that times out we resort to a greedy algorithm
@@ -2,7 +2,9 @@
 
 #include "duckdb/common/assert.hpp"
 #include "duckdb/common/enums/join_type.hpp"
+#include "duckdb/common/types/hash.hpp"
 #include "duckdb/optimizer/join_order/join_relation.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_conjunction_expression.hpp"
 #include "duckdb/planner/expression/bound_comparison_expression.hpp"
 #include "duckdb/planner/expression_iterator.hpp"
@@ -408,4 +410,41 @@ void QueryGraphManager::CreateQueryGraphCrossProduct(JoinRelationSet &left, Join
 	query_graph.CreateEdge(right, left, nullptr);
 }
 
+//! Hash the shape of an expression, deliberately ignoring literal values: structurally identical
+//! predicates that differ only in their constants hash to the same value
+static uint64_t StructuralExpressionHash(Expression &expr) {
+	auto hash = CombineHash(Hash<uint64_t>(static_cast<uint64_t>(expr.GetExpressionClass())),
+	                        Hash<uint64_t>(static_cast<uint64_t>(expr.GetExpressionType())));
+	hash = CombineHash(hash, Hash<uint64_t>(static_cast<uint64_t>(expr.return_type.id())));
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		// the table index is assigned per bind and is not stable across queries - the column index is
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		hash = CombineHash(hash, Hash<idx_t>(colref.binding.column_index));
+	}
+	ExpressionIterator::EnumerateChildren(
+	    expr, [&](Expression &child) { hash = CombineHash(hash, StructuralExpressionHash(child)); });
+	return hash;
+}
+
+uint64_t QueryGraphManager::ComputeStructuralFingerprint() {
+	uint64_t fingerprint = Hash<idx_t>(relation_manager.NumRelations());
+	// the relations, in extraction order
+	auto relation_stats = relation_manager.GetRelationStats();
+	for (auto &stats : relation_stats) {
+		fingerprint = CombineHash(fingerprint, Hash(stats.table_name.c_str(), stats.table_name.size()));
+	}
+	// the join filters: which relations they span, their join type and their predicate shape
+	for (auto &filter_info : filters_and_bindings) {
+		auto &set = filter_info->set.get();
+		for (idx_t i = 0; i < set.count; i++) {
+			fingerprint = CombineHash(fingerprint, Hash<idx_t>(set.relations[i]));
+		}
+		fingerprint = CombineHash(fingerprint, Hash<uint64_t>(static_cast<uint64_t>(filter_info->join_type)));
+		if (filter_info->filter) {
+			fingerprint = CombineHash(fingerprint, StructuralExpressionHash(*filter_info->filter));
+		}
+	}
+	return fingerprint;
+}
+
 } // namespace duckdb
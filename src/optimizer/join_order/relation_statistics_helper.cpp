@@ -10,6 +10,7 @@
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/common/printer.hpp"
 #include "duckdb/optimizer/rl_feature_collector.hpp"
+#include "duckdb/main/rl_feature_recorder.hpp"
 
 #include <math.h>
 
@@ -73,6 +74,7 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 
 	auto base_table_cardinality = get.EstimateCardinality(context);
 	auto cardinality_after_filters = base_table_cardinality;
+	bool used_default_selectivity = false;
 	unique_ptr<BaseStatistics> column_statistics;
 
 	auto catalog_table = get.GetTable();
@@ -147,6 +149,7 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 			cardinality_after_filters = MaxValue<idx_t>(
 			    LossyNumericCast<idx_t>(double(base_table_cardinality) * RelationStatisticsHelper::DEFAULT_SELECTIVITY),
 			    1U);
+			used_default_selectivity = true;
 			// FEATURE LOGGING: Default selectivity used
 			// Printer::Print("[RL FEATURE] Using DEFAULT_SELECTIVITY: " +
 			//                to_string(RelationStatisticsHelper::DEFAULT_SELECTIVITY));
@@ -165,7 +168,10 @@ RelationStats RelationStatisticsHelper::ExtractGetStats(LogicalGet &get, ClientC
 		// Printer::Print("[RL FEATURE] Filter Selectivity Ratio: " + to_string(selectivity));
 	}
 
-	// Printer::Print("[RL FEATURE] ===== END TABLE SCAN STATS =====\n");
+	// Structured feature capture (replaces the old [RL FEATURE] log lines above)
+	RLFeatureRecorder::Get().RecordTableScan(name, base_table_cardinality, cardinality_after_filters,
+	                                         get.table_filters.filters.size(), used_default_selectivity);
+
 	return_stats.cardinality = cardinality_after_filters;
 	// update the estimated cardinality of the get as well.
 	// This is not updated during plan reconstruction.
@@ -0,0 +1,139 @@
+#include "duckdb/optimizer/join_pre_aggregation.hpp"
+
+#include "duckdb/optimizer/column_binding_replacer.hpp"
+#include "duckdb/optimizer/optimizer.hpp"
+#include "duckdb/planner/expression/bound_aggregate_expression.hpp"
+#include "duckdb/planner/expression/bound_columnref_expression.hpp"
+#include "duckdb/planner/binder.hpp"
+#include "duckdb/planner/expression_iterator.hpp"
+#include "duckdb/planner/operator/logical_aggregate.hpp"
+#include "duckdb/planner/operator/logical_comparison_join.hpp"
+
+namespace duckdb {
+
+JoinPreAggregation::JoinPreAggregation(Optimizer &optimizer) : optimizer(optimizer) {
+}
+
+unique_ptr<LogicalOperator> JoinPreAggregation::Optimize(unique_ptr<LogicalOperator> op) {
+	if (op->type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY &&
+	    op->children[0]->type == LogicalOperatorType::LOGICAL_COMPARISON_JOIN) {
+		auto &aggr = op->Cast<LogicalAggregate>();
+		auto &join = op->children[0]->Cast<LogicalComparisonJoin>();
+		if (join.join_type == JoinType::INNER && CanPreAggregate(aggr)) {
+			for (idx_t child_idx = 0; child_idx < join.children.size(); child_idx++) {
+				TryInsertPreAggregation(aggr, join, child_idx);
+			}
+		}
+	}
+	for (auto &child : op->children) {
+		child = Optimize(std::move(child));
+	}
+	return op;
+}
+
+bool JoinPreAggregation::CanPreAggregate(const LogicalAggregate &aggr) const {
+	if (!aggr.grouping_functions.empty()) {
+		return false;
+	}
+	for (auto &expr : aggr.expressions) {
+		if (expr->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE) {
+			return false;
+		}
+		auto &aggregate = expr->Cast<BoundAggregateExpression>();
+		if (aggregate.IsDistinct()) {
+			// DISTINCT aggregates cannot observe row multiplicities
+			continue;
+		}
+		if (aggregate.order_bys) {
+			return false;
+		}
+		if (aggregate.function.name != "min" && aggregate.function.name != "max") {
+			// e.g., COUNT/SUM would change if we collapsed duplicate rows
+			return false;
+		}
+	}
+	return true;
+}
+
+void JoinPreAggregation::TryInsertPreAggregation(LogicalAggregate &aggr, LogicalComparisonJoin &join, idx_t child_idx) {
+	auto &child = *join.children[child_idx];
+	if (child.type == LogicalOperatorType::LOGICAL_AGGREGATE_AND_GROUP_BY ||
+	    child.type == LogicalOperatorType::LOGICAL_DISTINCT) {
+		// the input is already duplicate-free
+		return;
+	}
+	if (!child.has_estimated_cardinality || child.estimated_cardinality < MINIMUM_INPUT_CARDINALITY) {
+		return;
+	}
+	auto &projection_map = child_idx == 0 ? join.left_projection_map : join.right_projection_map;
+	if (!projection_map.empty()) {
+		// the projection map indexes into the child bindings, which the pre-aggregation replaces
+		return;
+	}
+
+	column_binding_set_t child_bindings;
+	for (auto &binding : child.GetColumnBindings()) {
+		child_bindings.insert(binding);
+	}
+
+	// collect the columns of this child that are referenced above it - the aggregate is the only consumer of the
+	// join, so the groups, the aggregates, the join conditions, and the join predicate cover all references
+	column_binding_set_t seen;
+	vector<ColumnBinding> references;
+	vector<LogicalType> types;
+	for (auto &group : aggr.groups) {
+		CollectChildReferences(*group, child_bindings, seen, references, types);
+	}
+	for (auto &expr : aggr.expressions) {
+		CollectChildReferences(*expr, child_bindings, seen, references, types);
+	}
+	for (auto &condition : join.conditions) {
+		auto &side = child_idx == 0 ? *condition.left : *condition.right;
+		CollectChildReferences(side, child_bindings, seen, references, types);
+	}
+	if (join.predicate) {
+		CollectChildReferences(*join.predicate, child_bindings, seen, references, types);
+	}
+	if (references.empty() || references.size() > MAXIMUM_KEY_COLUMNS) {
+		return;
+	}
+
+	// group the child on all referenced columns - rows that agree on all of them are indistinguishable
+	// above the join, so collapsing them cannot change the result
+	auto group_index = optimizer.binder.GenerateTableIndex();
+	auto aggregate_index = optimizer.binder.GenerateTableIndex();
+	auto pre_aggr = make_uniq<LogicalAggregate>(group_index, aggregate_index, vector<unique_ptr<Expression>>());
+	for (idx_t i = 0; i < references.size(); i++) {
+		pre_aggr->groups.push_back(make_uniq<BoundColumnRefExpression>(types[i], references[i]));
+	}
+	pre_aggr->children.push_back(std::move(join.children[child_idx]));
+	pre_aggr->ResolveOperatorTypes();
+
+	// redirect all references to the child through the pre-aggregation
+	ColumnBindingReplacer replacer;
+	for (idx_t i = 0; i < references.size(); i++) {
+		replacer.replacement_bindings.emplace_back(references[i], ColumnBinding(group_index, i));
+	}
+	replacer.stop_operator = pre_aggr.get();
+	join.children[child_idx] = std::move(pre_aggr);
+	replacer.VisitOperator(aggr);
+}
+
+void JoinPreAggregation::CollectChildReferences(Expression &expr, const column_binding_set_t &child_bindings,
+                                                column_binding_set_t &seen, vector<ColumnBinding> &references,
+                                                vector<LogicalType> &types) const {
+	if (expr.GetExpressionClass() == ExpressionClass::BOUND_COLUMN_REF) {
+		auto &colref = expr.Cast<BoundColumnRefExpression>();
+		if (child_bindings.find(colref.binding) != child_bindings.end() && seen.find(colref.binding) == seen.end()) {
+			seen.insert(colref.binding);
+			references.push_back(colref.binding);
+			types.push_back(colref.return_type);
+		}
+		return;
+	}
+	ExpressionIterator::EnumerateChildren(expr, [&](Expression &child) {
+		CollectChildReferences(child, child_bindings, seen, references, types);
+	});
+}
+
+} // namespace duckdb
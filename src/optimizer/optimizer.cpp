@@ -19,6 +19,7 @@
 #include "duckdb/optimizer/in_clause_rewriter.hpp"
 #include "duckdb/optimizer/join_filter_pushdown_optimizer.hpp"
 #include "duckdb/optimizer/join_order/join_order_optimizer.hpp"
+#include "duckdb/optimizer/join_pre_aggregation.hpp"
 #include "duckdb/optimizer/limit_pushdown.hpp"
 #include "duckdb/optimizer/regex_range_filter.hpp"
 #include "duckdb/optimizer/remove_duplicate_groups.hpp"
@@ -215,6 +216,12 @@ void Optimizer::RunBuiltInOptimizers() {
 		remove.VisitOperator(*plan);
 	});
 
+	// push duplicate-collapsing pre-aggregations below joins that feed into duplicate-insensitive aggregates
+	RunOptimizer(OptimizerType::JOIN_PRE_AGGREGATION, [&]() {
+		JoinPreAggregation join_pre_aggregation(*this);
+		plan = join_pre_aggregation.Optimize(std::move(plan));
+	});
+
 	// then we extract common subexpressions inside the different operators
 	RunOptimizer(OptimizerType::COMMON_SUBEXPRESSIONS, [&]() {
 		CommonSubExpressionOptimizer cse_optimizer(binder);
@@ -8,6 +8,8 @@
 
 #include "duckdb/optimizer/rl_cardinality_optimizer.hpp"
 #include "duckdb/common/helper.hpp"
+#include "duckdb/main/cardinality_feedback.hpp"
+#include "duckdb/main/database.hpp"
 
 namespace duckdb {
 
@@ -35,6 +37,16 @@ void RLCardinalityOptimizer::ApplyToOperator(LogicalOperator &op) {
 		features.child_cardinality = op.children[0]->estimated_cardinality;
 	}
 
+	// Feedback from previous executions beats any prediction: if this exact plan node has
+	// run before, the feedback store knows its true cardinality
+	idx_t observed;
+	auto &feedback = DatabaseInstance::GetDatabase(context).GetCardinalityFeedbackStore();
+	if (feedback.TryGetObservation(CardinalityFeedbackStore::Fingerprint(features), observed)) {
+		op.estimated_cardinality = MaxValue<idx_t>(observed, 1);
+		op.has_estimated_cardinality = true;
+		return;
+	}
+
 	const auto rl_pred = rl_model.PredictPlanningCardinality(features);
 	const auto fallback = features.estimated_cardinality;
 	const auto effective = rl_pred > 0 ? rl_pred : fallback;
@@ -8,6 +8,7 @@
 #include "duckdb/planner/expression/bound_columnref_expression.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
 #include "duckdb/common/printer.hpp"
+#include "duckdb/storage/statistics/numeric_stats.hpp"
 
 namespace duckdb {
 
@@ -34,21 +35,47 @@ void StatisticsPropagator::TryExecuteAggregates(LogicalAggregate &aggr, unique_p
 		// we cannot do this if the GET has filters
 		return;
 	}
-	// check if all aggregates are COUNT(*)
+	// check if all aggregates are COUNT(*), or MIN/MAX on a bare column of the GET
+	bool has_min_max = false;
 	for (auto &aggr_ref : aggr.expressions) {
 		if (aggr_ref->GetExpressionClass() != ExpressionClass::BOUND_AGGREGATE) {
 			// not an aggregate
 			return;
 		}
 		auto &aggr_expr = aggr_ref->Cast<BoundAggregateExpression>();
-		if (aggr_expr.function.name != "count_star") {
-			// aggregate is not count star - bail
-			return;
-		}
 		if (aggr_expr.filter) {
 			// aggregate has a filter - bail
 			return;
 		}
+		if (aggr_expr.function.name == "count_star") {
+			continue;
+		}
+		if (aggr_expr.function.name != "min" && aggr_expr.function.name != "max") {
+			// aggregate is not count star or min/max - bail
+			return;
+		}
+		if (aggr_expr.children.size() != 1 ||
+		    aggr_expr.children[0]->GetExpressionClass() != ExpressionClass::BOUND_COLUMN_REF) {
+			// min/max is not computed over a bare column reference - bail
+			return;
+		}
+		auto &col_ref = aggr_expr.children[0]->Cast<BoundColumnRefExpression>();
+		if (col_ref.binding.table_index != get.table_index) {
+			// min/max column does not reference the GET directly - bail
+			return;
+		}
+		has_min_max = true;
+	}
+	if (has_min_max) {
+		// min/max can only be answered from the statistics if the bounds are exact values present in the table
+		if (!get.function.statistics || !get.function.statistics_exact) {
+			// GET cannot tell us whether the statistics are exact - bail
+			return;
+		}
+		if (!get.function.statistics_exact(context, get.bind_data.get())) {
+			// there are outstanding updates or deletes - the statistics may hold values no longer in the table
+			return;
+		}
 	}
 	// we can do the rewrite! get the stats
 	GetPartitionStatsInput input(get.function, get.bind_data.get());
@@ -67,17 +94,36 @@ void StatisticsPropagator::TryExecuteAggregates(LogicalAggregate &aggr, unique_p
 	}
 	// we got an exact count - replace the entire aggregate with a scan of the result
 	vector<LogicalType> types;
-	vector<unique_ptr<Expression>> count_results;
+	vector<unique_ptr<Expression>> aggregate_results;
 	for (idx_t aggregate_index = 0; aggregate_index < aggr.expressions.size(); ++aggregate_index) {
-		auto count_result = make_uniq<BoundConstantExpression>(Value::BIGINT(NumericCast<int64_t>(count)));
-		count_result->SetAlias(aggr.expressions[aggregate_index]->GetName());
-		count_results.push_back(std::move(count_result));
-
-		types.push_back(LogicalType::BIGINT);
+		auto &aggr_expr = aggr.expressions[aggregate_index]->Cast<BoundAggregateExpression>();
+		Value aggregate_value;
+		if (aggr_expr.function.name == "count_star") {
+			aggregate_value = Value::BIGINT(NumericCast<int64_t>(count));
+		} else if (count == 0) {
+			// min/max of an empty table is NULL
+			aggregate_value = Value(aggr_expr.return_type);
+		} else {
+			auto &col_ref = aggr_expr.children[0]->Cast<BoundColumnRefExpression>();
+			const auto column_id = get.GetColumnIds()[col_ref.binding.column_index].GetPrimaryIndex();
+			auto stats = get.function.statistics(context, get.bind_data.get(), column_id);
+			if (!stats || stats->GetStatsType() != StatisticsType::NUMERIC_STATS || !NumericStats::HasMinMax(*stats)) {
+				// only numeric statistics hold exact min/max values (e.g. string statistics are truncated) - bail
+				return;
+			}
+			aggregate_value = aggr_expr.function.name == "min" ? NumericStats::Min(*stats) : NumericStats::Max(*stats);
+			if (aggregate_value.type() != aggr_expr.return_type) {
+				return;
+			}
+		}
+		auto aggregate_result = make_uniq<BoundConstantExpression>(std::move(aggregate_value));
+		aggregate_result->SetAlias(aggr.expressions[aggregate_index]->GetName());
+		types.push_back(aggregate_result->return_type);
+		aggregate_results.push_back(std::move(aggregate_result));
 	}
 
 	vector<vector<unique_ptr<Expression>>> expressions;
-	expressions.push_back(std::move(count_results));
+	expressions.push_back(std::move(aggregate_results));
 	auto expression_get =
 	    make_uniq<LogicalExpressionGet>(aggr.aggregate_index, std::move(types), std::move(expressions));
 	expression_get->children.push_back(make_uniq<LogicalDummyScan>(aggr.group_index));
@@ -1,4 +1,5 @@
 #include "duckdb/execution/expression_executor.hpp"
+#include "duckdb/main/rl_feature_recorder.hpp"
 #include "duckdb/function/scalar/generic_common.hpp"
 #include "duckdb/optimizer/statistics_propagator.hpp"
 #include "duckdb/planner/expression/bound_between_expression.hpp"
@@ -49,6 +50,8 @@ void StatisticsPropagator::SetStatisticsNotNull(ColumnBinding binding) {
 
 void StatisticsPropagator::UpdateFilterStatistics(BaseStatistics &stats, ExpressionType comparison_type,
                                                   const Value &constant) {
+	// Structured feature capture (replaces the old [RL FEATURE] log lines below)
+	RLFeatureRecorder::Get().RecordFilterStatistics(ExpressionTypeToString(comparison_type));
 	// FEATURE LOGGING: Filter statistics update
 	// Printer::Print("\n[RL FEATURE] ===== FILTER STATISTICS UPDATE =====");
 	// Printer::Print("[RL FEATURE] Comparison Type: " + ExpressionTypeToString(comparison_type));
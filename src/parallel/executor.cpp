@@ -17,6 +17,7 @@
 #include "duckdb/parallel/pipeline_prepare_finish_event.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parallel/thread_context.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -175,6 +176,21 @@ void Executor::SchedulePipeline(const shared_ptr<MetaPipeline> &meta_pipeline, S
 	}
 }
 
+//! The fraction of the memory limit that concurrently admitted join builds may be predicted to use
+static constexpr double PIPELINE_ADMISSION_MEMORY_RATIO = 0.5;
+
+//! Predict the peak sink memory of a join build pipeline from the cardinality estimate of the operator
+//! that feeds the sink (which reflects the RL model's estimates where that is enabled)
+static idx_t PredictSinkMemory(Pipeline &pipeline) {
+	auto operators = pipeline.GetOperators();
+	auto &feeding_op = operators.empty() ? *pipeline.GetSource() : operators.back().get();
+	idx_t row_width = 0;
+	for (auto &type : feeding_op.GetTypes()) {
+		row_width += GetTypeIdSize(type.InternalType());
+	}
+	return feeding_op.estimated_cardinality * MaxValue<idx_t>(row_width, 1);
+}
+
 void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 	auto &events = event_data.events;
 	D_ASSERT(events.empty());
@@ -218,39 +234,73 @@ void Executor::ScheduleEventsInternal(ScheduleEventData &event_data) {
 	}
 
 	// these dependencies make it so that things happen in this order:
-	// 1. all join build child pipelines run until Combine
-	// 2. all join build child pipeline PrepareFinalize
-	// 3. all join build child pipelines Finalize
+	// 1. all co-scheduled join build child pipelines run until Combine
+	// 2. all co-scheduled join build child pipeline PrepareFinalize
+	// 3. all co-scheduled join build child pipelines Finalize
 	// operators communicate their memory usage through the TemporaryMemoryManger (TMM) in PrepareFinalize
 	// then, when the child pipelines Finalize, all required memory is known, and TMM can make an informed decision
+	// sibling join builds are admission-controlled: we predict the peak sink memory of every build from its
+	// cardinality estimates and only co-schedule builds while the combined prediction fits in the memory budget -
+	// the remainder is queued behind the previous batch, because concurrently spilling builds are collectively
+	// slower than running them back-to-back
+	auto memory_budget = LossyNumericCast<idx_t>(
+	    PIPELINE_ADMISSION_MEMORY_RATIO * static_cast<double>(BufferManager::GetBufferManager(context).GetMaxMemory()));
 	for (auto &meta_pipeline : event_data.meta_pipelines) {
 		vector<shared_ptr<MetaPipeline>> children;
 		meta_pipeline->GetMetaPipelines(children, false, true);
-		for (auto &child1 : children) {
-			if (child1->Type() != MetaPipelineType::JOIN_BUILD) {
+
+		// collect the join builds per parent pipeline - only sibling builds can run concurrently
+		reference_map_t<Pipeline, vector<shared_ptr<MetaPipeline>>> sibling_builds;
+		for (auto &child : children) {
+			if (child->Type() != MetaPipelineType::JOIN_BUILD) {
 				continue; // We only want to do this for join builds
 			}
-			auto &child1_base = *child1->GetBasePipeline();
-			auto child1_entry = event_map.find(child1_base);
-			D_ASSERT(child1_entry != event_map.end());
+			sibling_builds[*child->GetParent()].push_back(child);
+		}
 
-			for (auto &child2 : children) {
-				if (child2->Type() != MetaPipelineType::JOIN_BUILD || RefersToSameObject(*child1, *child2)) {
-					continue; // We don't want to depend on itself
-				}
-				if (!RefersToSameObject(*child1->GetParent(), *child2->GetParent())) {
-					continue; // Different parents, skip
+		for (auto &sibling_entry : sibling_builds) {
+			auto &siblings = sibling_entry.second;
+			if (siblings.size() < 2) {
+				continue;
+			}
+			// assign every build to an admission batch - builds are co-scheduled while their combined predicted
+			// memory fits in the budget, subsequent builds go into the next batch
+			vector<idx_t> batches(siblings.size());
+			idx_t current_batch = 0;
+			idx_t batch_memory = 0;
+			for (idx_t i = 0; i < siblings.size(); i++) {
+				const auto predicted = PredictSinkMemory(*siblings[i]->GetBasePipeline());
+				if (batch_memory != 0 && batch_memory + predicted > memory_budget) {
+					// admitting this build would force the whole batch to spill - queue it in the next batch
+					current_batch++;
+					batch_memory = 0;
 				}
+				batches[i] = current_batch;
+				batch_memory += predicted;
+			}
 
-				auto &child2_base = *child2->GetBasePipeline();
-				auto child2_entry = event_map.find(child2_base);
-				D_ASSERT(child2_entry != event_map.end());
-
-				// all children PrepareFinalize must wait until all Combine
-				child1_entry->second.pipeline_prepare_finish_event.AddDependency(child2_entry->second.pipeline_event);
-				// all children Finalize must wait until all PrepareFinalize
-				child1_entry->second.pipeline_finish_event.AddDependency(
-				    child2_entry->second.pipeline_prepare_finish_event);
+			for (idx_t i = 0; i < siblings.size(); i++) {
+				auto sibling_i_entry = event_map.find(*siblings[i]->GetBasePipeline());
+				D_ASSERT(sibling_i_entry != event_map.end());
+				for (idx_t j = 0; j < siblings.size(); j++) {
+					if (i == j) {
+						continue; // We don't want to depend on itself
+					}
+					auto sibling_j_entry = event_map.find(*siblings[j]->GetBasePipeline());
+					D_ASSERT(sibling_j_entry != event_map.end());
+					if (batches[i] == batches[j]) {
+						// co-scheduled: all children PrepareFinalize must wait until all Combine
+						sibling_i_entry->second.pipeline_prepare_finish_event.AddDependency(
+						    sibling_j_entry->second.pipeline_event);
+						// all children Finalize must wait until all PrepareFinalize
+						sibling_i_entry->second.pipeline_finish_event.AddDependency(
+						    sibling_j_entry->second.pipeline_prepare_finish_event);
+					} else if (batches[j] + 1 == batches[i]) {
+						// queued: this build may only start once the previous batch has finalized
+						sibling_i_entry->second.pipeline_event.AddDependency(
+						    sibling_j_entry->second.pipeline_finish_event);
+					}
+				}
 			}
 		}
 	}
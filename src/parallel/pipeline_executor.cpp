@@ -1,8 +1,10 @@
 #include "duckdb/parallel/pipeline_executor.hpp"
 
 #include "duckdb/common/limits.hpp"
+#include "duckdb/main/cardinality_feedback.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
+#include "duckdb/main/database.hpp"
 #include "duckdb/main/rl_feature_tracker.hpp"
 #include "duckdb/common/printer.hpp"
 
@@ -188,6 +190,8 @@ SinkNextBatchType PipelineExecutor::NextBatch(DataChunk &source_chunk) {
 
 PipelineExecuteResult PipelineExecutor::Execute(idx_t max_chunks) {
 	D_ASSERT(pipeline.sink);
+	// If we are resuming after an interrupt, attribute the time we were suspended.
+	FinishBlocked();
 	auto &source_chunk = pipeline.operators.empty() ? final_chunk : *intermediate_chunks[0];
 	ExecutionBudget chunk_budget(max_chunks);
 	do {
@@ -217,6 +221,7 @@ PipelineExecuteResult PipelineExecutor::Execute(idx_t max_chunks) {
 				break;
 			} else {
 				if (remaining_sink_chunk) {
+					MarkBlocked(*pipeline.sink);
 					return PipelineExecuteResult::INTERRUPTED;
 				} else {
 					D_ASSERT(chunk_budget.IsDepleted());
@@ -230,6 +235,7 @@ PipelineExecuteResult PipelineExecutor::Execute(idx_t max_chunks) {
 				source_chunk.Reset();
 				source_result = FetchFromSource(source_chunk);
 				if (source_result == SourceResultType::BLOCKED) {
+					MarkBlocked(*pipeline.source);
 					return PipelineExecuteResult::INTERRUPTED;
 				}
 				if (source_result == SourceResultType::FINISHED) {
@@ -241,6 +247,7 @@ PipelineExecuteResult PipelineExecutor::Execute(idx_t max_chunks) {
 				auto next_batch_result = NextBatch(source_chunk);
 				next_batch_blocked = next_batch_result == SinkNextBatchType::BLOCKED;
 				if (next_batch_blocked) {
+					MarkBlocked(*pipeline.sink);
 					return PipelineExecuteResult::INTERRUPTED;
 				}
 			}
@@ -258,6 +265,7 @@ PipelineExecuteResult PipelineExecutor::Execute(idx_t max_chunks) {
 		// SINK INTERRUPT
 		if (result == OperatorResultType::BLOCKED) {
 			remaining_sink_chunk = true;
+			MarkBlocked(*pipeline.sink);
 			return PipelineExecuteResult::INTERRUPTED;
 		}
 
@@ -277,6 +285,20 @@ bool PipelineExecutor::RemainingSinkChunk() const {
 	return remaining_sink_chunk;
 }
 
+void PipelineExecutor::MarkBlocked(const PhysicalOperator &op) {
+	blocked_operator = &op;
+	wait_timer.Start();
+}
+
+void PipelineExecutor::FinishBlocked() {
+	if (!blocked_operator) {
+		return;
+	}
+	wait_timer.End();
+	thread.profiler.AddWaitTime(*blocked_operator, wait_timer.Elapsed());
+	blocked_operator = nullptr;
+}
+
 PipelineExecuteResult PipelineExecutor::Execute() {
 	return Execute(NumericLimits<idx_t>::Maximum());
 }
@@ -377,6 +399,7 @@ PipelineExecuteResult PipelineExecutor::PushFinalize() {
 	auto result = pipeline.sink->Combine(context, combine_input);
 
 	if (result == SinkCombineResultType::BLOCKED) {
+		MarkBlocked(*pipeline.sink);
 		return PipelineExecuteResult::INTERRUPTED;
 	}
 
@@ -571,6 +594,7 @@ void PipelineExecutor::EndOperator(PhysicalOperator &op, optional_ptr<DataChunk>
 	// RL TRAINING: Track actual cardinality for operators with RL state
 	if (chunk && op.rl_state && op.rl_state->has_rl_prediction) {
 		op.rl_state->AddRows(chunk->size());
+		PublishRuntimeMisestimate(op);
 	}
 
 	if (chunk) {
@@ -578,4 +602,35 @@ void PipelineExecutor::EndOperator(PhysicalOperator &op, optional_ptr<DataChunk>
 	}
 }
 
+void PipelineExecutor::PublishRuntimeMisestimate(PhysicalOperator &op) {
+	//! How far the observed count must exceed the prediction before we publish mid-execution
+	static constexpr idx_t RUNTIME_MISESTIMATE_FACTOR = 100;
+
+	auto &rl_state = *op.rl_state;
+	if (rl_state.feature_fingerprint == 0) {
+		return;
+	}
+	auto actual = rl_state.GetActualCardinality();
+	auto predicted = MaxValue<idx_t>(rl_state.rl_predicted_cardinality, 1);
+	auto published = rl_state.published_cardinality.load(std::memory_order_relaxed);
+	if (published == 0) {
+		// not published yet - wait until the observed count crosses the misestimate threshold
+		if (actual / RUNTIME_MISESTIMATE_FACTOR < predicted) {
+			return;
+		}
+	} else if (actual < published * 2) {
+		// already published - refresh on every doubling so long-running operators stay current
+		return;
+	}
+	if (!rl_state.published_cardinality.compare_exchange_strong(published, actual, std::memory_order_relaxed)) {
+		// another thread published concurrently
+		return;
+	}
+	// while the query is still running this is only a lower bound on the true cardinality,
+	// but it already beats the estimate by orders of magnitude; the exact count recorded
+	// after execution overwrites it
+	auto &feedback = DatabaseInstance::GetDatabase(context.client).GetCardinalityFeedbackStore();
+	feedback.RecordObservation(rl_state.feature_fingerprint, actual);
+}
+
 } // namespace duckdb
@@ -3,15 +3,19 @@
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/exception.hpp"
 #include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/database.hpp"
 #ifndef DUCKDB_NO_THREADS
 #include "concurrentqueue.h"
+#include <deque>
+#include <fstream>
 #include "duckdb/common/thread.hpp"
 #include "lightweightsemaphore.h"
 
 #include <thread>
 #else
+#include <deque>
 #include <queue>
 #endif
 
@@ -35,6 +39,35 @@ struct SchedulerThread {
 #endif
 };
 
+static int64_t CurrentTimeMicros() {
+	return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+SchedulerTaskTiming::SchedulerTaskTiming() {
+	for (idx_t i = 0; i < BUCKET_COUNT; i++) {
+		queue_wait_count[i] = 0;
+		run_time_count[i] = 0;
+	}
+}
+
+idx_t SchedulerTaskTiming::BucketIndex(int64_t micros) {
+	auto value = UnsafeNumericCast<uint64_t>(MaxValue<int64_t>(micros, 0));
+	idx_t bucket = 0;
+	while (value > 0 && bucket < BUCKET_COUNT - 1) {
+		value >>= 1;
+		bucket++;
+	}
+	return bucket;
+}
+
+void SchedulerTaskTiming::RecordQueueWait(int64_t micros) {
+	++queue_wait_count[BucketIndex(micros)];
+}
+
+void SchedulerTaskTiming::RecordRunTime(int64_t micros) {
+	++run_time_count[BucketIndex(micros)];
+}
+
 #ifndef DUCKDB_NO_THREADS
 typedef duckdb_moodycamel::ConcurrentQueue<shared_ptr<Task>> concurrent_queue_t;
 typedef duckdb_moodycamel::LightweightSemaphore lightweight_semaphore_t;
@@ -44,6 +77,9 @@ struct ConcurrentQueue {
 	}
 
 	lightweight_semaphore_t semaphore;
+	//! Parked (deep-idle) workers wait here instead of on the task semaphore, so they are only
+	//! woken when the backlog actually calls for more capacity
+	lightweight_semaphore_t park_semaphore;
 
 	void Enqueue(ProducerToken &token, shared_ptr<Task> task);
 	void EnqueueBulk(ProducerToken &token, vector<shared_ptr<Task>> &tasks);
@@ -72,6 +108,7 @@ struct QueueProducerToken {
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> producer_lock(token.producer_lock);
 	task->token = token;
+	task->scheduled_time_us = CurrentTimeMicros();
 	if (q.enqueue(token.token->queue_token, std::move(task))) {
 		++tasks_in_queue;
 		semaphore.signal();
@@ -83,8 +120,10 @@ void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 void ConcurrentQueue::EnqueueBulk(ProducerToken &token, vector<shared_ptr<Task>> &tasks) {
 	typedef std::make_signed<std::size_t>::type ssize_t;
 	lock_guard<mutex> producer_lock(token.producer_lock);
+	const auto scheduled_time_us = CurrentTimeMicros();
 	for (auto &task : tasks) {
 		task->token = token;
+		task->scheduled_time_us = scheduled_time_us;
 	}
 	if (q.enqueue_bulk(token.token->queue_token, std::make_move_iterator(tasks.begin()), tasks.size())) {
 		tasks_in_queue += tasks.size();
@@ -144,13 +183,16 @@ struct ConcurrentQueue {
 void ConcurrentQueue::Enqueue(ProducerToken &token, shared_ptr<Task> task) {
 	lock_guard<mutex> lock(qlock);
 	task->token = token;
+	task->scheduled_time_us = CurrentTimeMicros();
 	q[std::ref(*token.token)].push(std::move(task));
 }
 
 void ConcurrentQueue::EnqueueBulk(ProducerToken &token, vector<shared_ptr<Task>> &tasks) {
 	lock_guard<mutex> lock(qlock);
+	const auto scheduled_time_us = CurrentTimeMicros();
 	for (auto &task : tasks) {
 		task->token = token;
+		task->scheduled_time_us = scheduled_time_us;
 		q[std::ref(*token.token)].push(std::move(task));
 	}
 }
@@ -215,6 +257,69 @@ private:
 };
 #endif
 
+//! Per-worker task queue. The owning worker pushes/pops at the back (LIFO, cache-hot);
+//! thieves take from the front (FIFO, oldest task first). A plain mutex suffices here:
+//! the owner only touches the lock briefly and stealing is the cold path.
+struct WorkerLocalQueue {
+	mutex lock;
+	std::deque<shared_ptr<Task>> tasks;
+
+	void Push(shared_ptr<Task> task) {
+		lock_guard<mutex> guard(lock);
+		// requeued tasks start a new queue wait
+		task->scheduled_time_us = CurrentTimeMicros();
+		tasks.push_back(std::move(task));
+	}
+
+	bool Pop(shared_ptr<Task> &task) {
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.back());
+		tasks.pop_back();
+		return true;
+	}
+
+	bool Steal(shared_ptr<Task> &task) {
+		lock_guard<mutex> guard(lock);
+		if (tasks.empty()) {
+			return false;
+		}
+		task = std::move(tasks.front());
+		tasks.pop_front();
+		return true;
+	}
+};
+
+void TaskScheduler::RegisterWorkerQueue(WorkerLocalQueue &local_queue) {
+	lock_guard<mutex> guard(worker_queue_lock);
+	worker_queues.push_back(local_queue);
+}
+
+void TaskScheduler::DeregisterWorkerQueue(WorkerLocalQueue &local_queue) {
+	lock_guard<mutex> guard(worker_queue_lock);
+	for (idx_t i = 0; i < worker_queues.size(); i++) {
+		if (RefersToSameObject(worker_queues[i].get(), local_queue)) {
+			worker_queues.erase(worker_queues.begin() + NumericCast<int64_t>(i));
+			break;
+		}
+	}
+}
+
+bool TaskScheduler::TryStealTask(const WorkerLocalQueue &thief, shared_ptr<Task> &task) {
+	lock_guard<mutex> guard(worker_queue_lock);
+	for (auto &victim : worker_queues) {
+		if (RefersToSameObject<const WorkerLocalQueue>(victim.get(), thief)) {
+			continue;
+		}
+		if (victim.get().Steal(task)) {
+			return true;
+		}
+	}
+	return false;
+}
+
 ProducerToken::ProducerToken(TaskScheduler &scheduler, unique_ptr<QueueProducerToken> token)
     : scheduler(scheduler), token(std::move(token)) {
 }
@@ -226,7 +331,7 @@ TaskScheduler::TaskScheduler(DatabaseInstance &db)
     : db(db), queue(make_uniq<ConcurrentQueue>()),
       allocator_flush_threshold(db.config.options.allocator_flush_threshold),
       allocator_background_threads(db.config.options.allocator_background_threads), requested_thread_count(0),
-      current_thread_count(1) {
+      current_thread_count(1), parked_workers(0) {
 	SetAllocatorBackgroundThreads(db.config.options.allocator_background_threads);
 }
 
@@ -256,14 +361,61 @@ unique_ptr<ProducerToken> TaskScheduler::CreateProducer() {
 void TaskScheduler::ScheduleTask(ProducerToken &token, shared_ptr<Task> task) {
 	// Enqueue a task for the given producer token and signal any sleeping threads
 	queue->Enqueue(token, std::move(task));
+	WakeParkedWorkers();
 }
 
 void TaskScheduler::ScheduleTasks(ProducerToken &producer, vector<shared_ptr<Task>> &tasks) {
 	queue->EnqueueBulk(producer, tasks);
+	WakeParkedWorkers();
+}
+
+void TaskScheduler::ParkWorker() {
+#ifndef DUCKDB_NO_THREADS
+	++parked_workers;
+	// re-check the queue after announcing ourselves: an enqueue racing with parking either sees
+	// our increment and signals the park semaphore, or we see its task here and bail out
+	if (queue->GetTasksInQueue() > 0) {
+		--parked_workers;
+		return;
+	}
+	queue->park_semaphore.wait();
+	--parked_workers;
+#endif
+}
+
+void TaskScheduler::WakeParkedWorkers() {
+#ifndef DUCKDB_NO_THREADS
+	typedef std::make_signed<std::size_t>::type ssize_t;
+	auto parked = parked_workers.load();
+	if (parked <= 0) {
+		return;
+	}
+	// wake only enough parked workers to cover the part of the backlog the unparked workers
+	// cannot absorb: a burst of small queries should not spin up every worker on the node.
+	// current_thread_count includes external threads, which errs on the side of waking fewer.
+	auto queued = queue->GetTasksInQueue();
+	auto unparked = NumericCast<idx_t>(MaxValue<int32_t>(current_thread_count.load() - parked, 0));
+	if (queued <= unparked) {
+		return;
+	}
+	auto wake_count = MinValue<idx_t>(NumericCast<idx_t>(parked), queued - unparked);
+	queue->park_semaphore.signal(NumericCast<ssize_t>(wake_count));
+#endif
 }
 
 bool TaskScheduler::GetTaskFromProducer(ProducerToken &token, shared_ptr<Task> &task) {
-	return queue->DequeueFromProducer(token, task);
+	if (!queue->DequeueFromProducer(token, task)) {
+		return false;
+	}
+	if (task->scheduled_time_us != 0) {
+		task_timing.RecordQueueWait(CurrentTimeMicros() - task->scheduled_time_us);
+		task->scheduled_time_us = 0;
+	}
+	return true;
+}
+
+const SchedulerTaskTiming &TaskScheduler::GetTaskTiming() const {
+	return task_timing;
 }
 
 void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
@@ -272,33 +424,48 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 
 	auto &config = DBConfig::GetConfig(db);
 	shared_ptr<Task> task;
+	// register this worker's local queue so other workers can steal from it
+	WorkerLocalQueue local_queue;
+	RegisterWorkerQueue(local_queue);
 	// loop until the marker is set to false
 	while (*marker) {
-		if (!Allocator::SupportsFlush()) {
-			// allocator can't flush, just start an untimed wait
-			queue->semaphore.wait();
+		// drain the local queue first: rescheduled tasks stay with the worker that ran them
+		if (local_queue.Pop(task)) {
+			// fall through to execution below without touching the shared queue
+		} else if (!Allocator::SupportsFlush()) {
+			// allocator can't flush - after the initial idle period, park instead of an untimed wait
+			if (!queue->semaphore.wait(INITIAL_FLUSH_WAIT)) {
+				ParkWorker();
+			}
 		} else if (!queue->semaphore.wait(INITIAL_FLUSH_WAIT)) {
 			// allocator can flush, we flush this threads outstanding allocations after it was idle for 0.5s
 			Allocator::ThreadFlush(allocator_background_threads, allocator_flush_threshold,
 			                       NumericCast<idx_t>(requested_thread_count.load()));
 			auto decay_delay = Allocator::DecayDelay();
 			if (!decay_delay.IsValid()) {
-				// no decay delay specified - just wait
-				queue->semaphore.wait();
+				// no decay delay specified - the thread already sat out the initial idle period, park it
+				ParkWorker();
 			} else {
 				if (!queue->semaphore.wait(UnsafeNumericCast<int64_t>(decay_delay.GetIndex()) * 1000000 -
 				                           INITIAL_FLUSH_WAIT)) {
 					// in total, the thread was idle for the entire decay delay (note: seconds converted to mus)
-					// mark it as idle and start an untimed wait
+					// mark it as idle and park it: parked workers stop contending for task signals
+					// until the queue backlog calls for extra capacity again
 					Allocator::ThreadIdle();
-					queue->semaphore.wait();
+					ParkWorker();
 				}
 			}
 		}
-		if (queue->Dequeue(task)) {
+		if (task || queue->Dequeue(task) || TryStealTask(local_queue, task)) {
 			auto process_mode = config.options.scheduler_process_partial ? TaskExecutionMode::PROCESS_PARTIAL
 			                                                             : TaskExecutionMode::PROCESS_ALL;
+			const auto start_time_us = CurrentTimeMicros();
+			if (task->scheduled_time_us != 0) {
+				task_timing.RecordQueueWait(start_time_us - task->scheduled_time_us);
+				task->scheduled_time_us = 0;
+			}
 			auto execute_result = task->Execute(process_mode);
+			task_timing.RecordRunTime(CurrentTimeMicros() - start_time_us);
 
 			switch (execute_result) {
 			case TaskExecutionResult::TASK_FINISHED:
@@ -306,9 +473,10 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 				task.reset();
 				break;
 			case TaskExecutionResult::TASK_NOT_FINISHED: {
-				// task is not finished - reschedule immediately
-				auto &token = *task->token;
-				queue->Enqueue(token, std::move(task));
+				// task is not finished - keep it on this worker's local queue so it stays
+				// cache-hot; signal once so an idle worker can steal it if we get stuck
+				local_queue.Push(std::move(task));
+				queue->semaphore.signal();
 				break;
 			}
 			case TaskExecutionResult::TASK_BLOCKED:
@@ -321,6 +489,13 @@ void TaskScheduler::ExecuteForever(atomic<bool> *marker) {
 			queue->semaphore.signal(1);
 		}
 	}
+	// this thread will exit: push any leftover local tasks back to the shared queue and
+	// deregister from the steal registry
+	while (local_queue.Pop(task)) {
+		auto &token = *task->token;
+		queue->Enqueue(token, std::move(task));
+	}
+	DeregisterWorkerQueue(local_queue);
 	// this thread will exit, flush all of its outstanding allocations
 	if (Allocator::SupportsFlush()) {
 		Allocator::ThreadFlush(allocator_background_threads, 0, NumericCast<idx_t>(requested_thread_count.load()));
@@ -340,7 +515,13 @@ idx_t TaskScheduler::ExecuteTasks(atomic<bool> *marker, idx_t max_tasks) {
 		if (!queue->Dequeue(task)) {
 			return completed_tasks;
 		}
+		const auto start_time_us = CurrentTimeMicros();
+		if (task->scheduled_time_us != 0) {
+			task_timing.RecordQueueWait(start_time_us - task->scheduled_time_us);
+			task->scheduled_time_us = 0;
+		}
 		auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
+		task_timing.RecordRunTime(CurrentTimeMicros() - start_time_us);
 
 		switch (execute_result) {
 		case TaskExecutionResult::TASK_FINISHED:
@@ -371,7 +552,13 @@ void TaskScheduler::ExecuteTasks(idx_t max_tasks) {
 			return;
 		}
 		try {
+			const auto start_time_us = CurrentTimeMicros();
+			if (task->scheduled_time_us != 0) {
+				task_timing.RecordQueueWait(start_time_us - task->scheduled_time_us);
+				task->scheduled_time_us = 0;
+			}
 			auto execute_result = task->Execute(TaskExecutionMode::PROCESS_ALL);
+			task_timing.RecordRunTime(CurrentTimeMicros() - start_time_us);
 			switch (execute_result) {
 			case TaskExecutionResult::TASK_FINISHED:
 			case TaskExecutionResult::TASK_ERROR:
@@ -509,6 +696,53 @@ static void SetThreadAffinity(thread &thread, const int &cpu_id) {
 	pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuset);
 #endif
 }
+
+#if defined(__GLIBC__)
+//! Read the CPU set of every NUMA node from sysfs (Linux only).
+//! Returns an empty vector when the topology cannot be read or there is only one node,
+//! in which case NUMA pinning falls back to regular per-core pinning.
+static vector<cpu_set_t> GetNumaNodeCpuSets() {
+	vector<cpu_set_t> result;
+	for (idx_t node = 0;; node++) {
+		auto path = "/sys/devices/system/node/node" + std::to_string(node) + "/cpulist";
+		std::ifstream in(path.c_str());
+		if (!in.is_open()) {
+			break;
+		}
+		string cpulist;
+		std::getline(in, cpulist);
+		// parse a list like "0-15,32-47"
+		cpu_set_t cpuset;
+		CPU_ZERO(&cpuset);
+		bool any_cpu = false;
+		for (auto &range : StringUtil::Split(cpulist, ',')) {
+			auto dash = range.find('-');
+			try {
+				int lo = std::stoi(range.substr(0, dash));
+				int hi = dash == string::npos ? lo : std::stoi(range.substr(dash + 1));
+				for (int cpu = lo; cpu <= hi; cpu++) {
+					CPU_SET(cpu, &cpuset);
+					any_cpu = true;
+				}
+			} catch (...) {
+				// unparseable entry: skip it
+			}
+		}
+		if (any_cpu) {
+			result.push_back(cpuset);
+		}
+	}
+	if (result.size() <= 1) {
+		result.clear();
+	}
+	return result;
+}
+
+static void SetThreadNodeAffinity(thread &thread, const cpu_set_t &cpuset) {
+	// as above: failing to set affinity is not an error
+	pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuset);
+}
+#endif
 #endif
 
 void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
@@ -525,6 +759,10 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 			*markers[i] = false;
 		}
 		Signal(threads.size());
+		// also wake any parked workers so they observe their marker and exit; leftover park
+		// credits are harmless, a spuriously woken worker just parks again once idle
+		typedef std::make_signed<std::size_t>::type ssize_t;
+		queue->park_semaphore.signal(NumericCast<ssize_t>(threads.size()));
 		// now join the threads to ensure they are fully stopped before erasing them
 		for (idx_t i = 0; i < threads.size(); i++) {
 			threads[i]->internal_thread->join();
@@ -539,18 +777,36 @@ void TaskScheduler::RelaunchThreadsInternal(int32_t n) {
 
 		// Whether to pin threads to cores
 		static constexpr idx_t THREAD_PIN_THRESHOLD = 64;
-		const auto pin_threads = db.config.options.pin_threads == ThreadPinMode::ON ||
+		const auto numa_mode = db.config.options.pin_threads == ThreadPinMode::NUMA;
+		const auto pin_threads = numa_mode || db.config.options.pin_threads == ThreadPinMode::ON ||
 		                         (db.config.options.pin_threads == ThreadPinMode::AUTO &&
 		                          std::thread::hardware_concurrency() > THREAD_PIN_THRESHOLD);
+#if defined(__GLIBC__)
+		// in NUMA mode, bind workers round-robin to whole NUMA nodes instead of single cores:
+		// with the kernel's first-touch policy, buffers a worker allocates and scans stay on
+		// its node, which keeps hot-table scans node-local
+		vector<cpu_set_t> numa_node_sets;
+		if (numa_mode) {
+			numa_node_sets = GetNumaNodeCpuSets();
+		}
+#endif
 		for (idx_t i = 0; i < create_new_threads; i++) {
 			// launch a thread and assign it a cancellation marker
 			auto marker = unique_ptr<atomic<bool>>(new atomic<bool>(true));
 			unique_ptr<thread> worker_thread;
 			try {
 				worker_thread = make_uniq<thread>(ThreadExecuteTasks, this, marker.get());
+#if defined(__GLIBC__)
+				if (numa_mode && !numa_node_sets.empty()) {
+					SetThreadNodeAffinity(*worker_thread, numa_node_sets[threads.size() % numa_node_sets.size()]);
+				} else if (pin_threads) {
+					SetThreadAffinity(*worker_thread, NumericCast<int>(threads.size()));
+				}
+#else
 				if (pin_threads) {
 					SetThreadAffinity(*worker_thread, NumericCast<int>(threads.size()));
 				}
+#endif
 			} catch (std::exception &ex) {
 				// thread constructor failed - this can happen when the system has too many threads allocated
 				// in this case we cannot allocate more threads - stop launching them
@@ -20,6 +20,8 @@
 
 namespace duckdb {
 
+void ReorderTableEntries(catalog_entry_vector_t &tables);
+
 unique_ptr<LogicalOperator> Binder::BindCopyDatabaseSchema(Catalog &from_database, const string &target_database_name) {
 
 	catalog_entry_vector_t catalog_entries;
@@ -53,6 +55,25 @@ unique_ptr<LogicalOperator> Binder::BindCopyDatabaseData(Catalog &source_catalog
 	ExportEntries entries;
 	PhysicalExport::ExtractEntries(context, source_schemas, entries);
 
+	// check if any of the tables carry foreign keys: FK verification on append checks the
+	// referenced table mid-copy, so those copies must run one after the other, parents first
+	bool has_foreign_keys = false;
+	for (auto &table_ref : entries.tables) {
+		auto &table = table_ref.get().Cast<TableCatalogEntry>();
+		for (auto &constraint : table.GetConstraints()) {
+			if (constraint->type == ConstraintType::FOREIGN_KEY) {
+				has_foreign_keys = true;
+				break;
+			}
+		}
+		if (has_foreign_keys) {
+			break;
+		}
+	}
+	if (has_foreign_keys) {
+		ReorderTableEntries(entries.tables);
+	}
+
 	vector<unique_ptr<LogicalOperator>> insert_nodes;
 	for (auto &table_ref : entries.tables) {
 		auto &table = table_ref.get().Cast<TableCatalogEntry>();
@@ -95,7 +116,10 @@ unique_ptr<LogicalOperator> Binder::BindCopyDatabaseData(Catalog &source_catalog
 		result->children.push_back(make_uniq<LogicalDummyScan>(GenerateTableIndex()));
 	} else {
 		// use UNION ALL to combine the individual copy statements into a single node
-		result = UnionOperators(std::move(insert_nodes));
+		// without foreign keys the tables can be copied in parallel: the inserts target different
+		// tables, so only FK verification (which checks referenced tables mid-append) requires
+		// the dependency order that ordered execution provides
+		result = UnionOperators(std::move(insert_nodes), !has_foreign_keys);
 	}
 	return result;
 }
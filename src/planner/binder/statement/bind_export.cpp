@@ -136,7 +136,7 @@ static unique_ptr<QueryNode> CreateSelectStatement(CopyStatement &stmt, child_li
 	return std::move(statement);
 }
 
-unique_ptr<LogicalOperator> Binder::UnionOperators(vector<unique_ptr<LogicalOperator>> nodes) {
+unique_ptr<LogicalOperator> Binder::UnionOperators(vector<unique_ptr<LogicalOperator>> nodes, bool allow_out_of_order) {
 	if (nodes.empty()) {
 		return nullptr;
 	}
@@ -144,7 +144,7 @@ unique_ptr<LogicalOperator> Binder::UnionOperators(vector<unique_ptr<LogicalOper
 		return std::move(nodes[0]);
 	}
 	return make_uniq<LogicalSetOperation>(GenerateTableIndex(), 1U, std::move(nodes),
-	                                      LogicalOperatorType::LOGICAL_UNION, true, false);
+	                                      LogicalOperatorType::LOGICAL_UNION, true, allow_out_of_order);
 }
 
 BoundStatement Binder::Bind(ExportStatement &stmt) {
@@ -249,7 +249,10 @@ BoundStatement Binder::Bind(ExportStatement &stmt) {
 
 		export_nodes.push_back(std::move(plan));
 	}
-	auto child_operator = UnionOperators(std::move(export_nodes));
+	// the tables can be exported in any order: every COPY writes to its own file, and the
+	// foreign key ordering only constrains load.sql, which is generated separately.
+	// allowing out-of-order execution lets the union pipelines run in parallel across tables
+	auto child_operator = UnionOperators(std::move(export_nodes), true);
 
 	// try to create the directory, if it doesn't exist yet
 	// a bit hacky to do it here, but we need to create the directory BEFORE the copy statements run
@@ -0,0 +1,61 @@
+#include "duckdb/planner/filter/bloom_filter.hpp"
+#include "duckdb/common/types/vector.hpp"
+#include "duckdb/planner/expression/bound_constant_expression.hpp"
+
+namespace duckdb {
+
+BloomFilterData::BloomFilterData(idx_t expected_count) {
+	block_count = NextPowerOfTwo(MaxValue<idx_t>(expected_count / KEYS_PER_BLOCK, MINIMUM_BLOCK_COUNT));
+	blocks = make_unsafe_uniq_array<uint64_t>(block_count);
+	memset(blocks.get(), 0, block_count * sizeof(uint64_t));
+}
+
+void BloomFilterData::Insert(Vector &hashes, idx_t count) {
+	UnifiedVectorFormat hdata;
+	hashes.ToUnifiedFormat(count, hdata);
+	auto hash_values = UnifiedVectorFormat::GetData<hash_t>(hdata);
+	for (idx_t i = 0; i < count; i++) {
+		const auto hash = hash_values[hdata.sel->get_index(i)];
+		blocks[BlockIndex(hash)] |= BlockMask(hash);
+	}
+}
+
+BloomFilter::BloomFilter() : TableFilter(TableFilterType::BLOOM_FILTER) {
+}
+
+BloomFilter::BloomFilter(shared_ptr<BloomFilterData> filter_data_p)
+    : TableFilter(TableFilterType::BLOOM_FILTER), filter_data(std::move(filter_data_p)) {
+}
+
+FilterPropagateResult BloomFilter::CheckStatistics(BaseStatistics &stats) const {
+	// the filter is over hashes - we cannot prune based on min/max statistics
+	return FilterPropagateResult::NO_PRUNING_POSSIBLE;
+}
+
+string BloomFilter::ToString(const string &column_name) const {
+	if (filter_data) {
+		return "Bloom Filter (" + column_name + ")";
+	} else {
+		return "Empty Bloom Filter (" + column_name + ")";
+	}
+}
+
+unique_ptr<Expression> BloomFilter::ToExpression(const Expression &column) const {
+	// the filter cannot be expressed as an expression over the column - it is an optimization only
+	auto bound_constant = make_uniq<BoundConstantExpression>(Value(true));
+	return std::move(bound_constant);
+}
+
+bool BloomFilter::Equals(const TableFilter &other_p) const {
+	if (!TableFilter::Equals(other_p)) {
+		return false;
+	}
+	auto &other = other_p.Cast<BloomFilter>();
+	return other.filter_data.get() == filter_data.get();
+}
+
+unique_ptr<TableFilter> BloomFilter::Copy() const {
+	return make_uniq<BloomFilter>(filter_data);
+}
+
+} // namespace duckdb
@@ -3,6 +3,7 @@
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/null_filter.hpp"
+#include "duckdb/planner/filter/optional_filter.hpp"
 #include "duckdb/execution/operator/scan/physical_table_scan.hpp"
 
 namespace duckdb {
@@ -31,6 +32,37 @@ string TableFilter::DebugToString() const {
 	return ToString("c0");
 }
 
+bool TableFilter::HasDynamicFilters() const {
+	switch (filter_type) {
+	case TableFilterType::DYNAMIC_FILTER:
+		return true;
+	case TableFilterType::OPTIONAL_FILTER: {
+		auto &optional_filter = Cast<OptionalFilter>();
+		return optional_filter.child_filter && optional_filter.child_filter->HasDynamicFilters();
+	}
+	case TableFilterType::CONJUNCTION_AND: {
+		auto &conjunction = Cast<ConjunctionAndFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (child_filter->HasDynamicFilters()) {
+				return true;
+			}
+		}
+		return false;
+	}
+	case TableFilterType::CONJUNCTION_OR: {
+		auto &conjunction = Cast<ConjunctionOrFilter>();
+		for (auto &child_filter : conjunction.child_filters) {
+			if (child_filter->HasDynamicFilters()) {
+				return true;
+			}
+		}
+		return false;
+	}
+	default:
+		return false;
+	}
+}
+
 void DynamicTableFilterSet::ClearFilters(const PhysicalOperator &op) {
 	lock_guard<mutex> l(lock);
 	filters.erase(op);
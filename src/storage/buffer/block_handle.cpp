@@ -18,6 +18,8 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, Mem
 	eviction_seq_num = 0;
 	state = BlockState::BLOCK_UNLOADED;
 	memory_usage = block_manager.GetBlockAllocSize();
+	eviction_temperature = 0;
+	memory_pinned = false;
 }
 
 BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, MemoryTag tag,
@@ -31,6 +33,8 @@ BlockHandle::BlockHandle(BlockManager &block_manager, block_id_t block_id_p, Mem
 	state = BlockState::BLOCK_LOADED;
 	memory_usage = block_size;
 	memory_charge = std::move(reservation);
+	eviction_temperature = 0;
+	memory_pinned = false;
 }
 
 BlockHandle::~BlockHandle() { // NOLINT: allow internal exceptions
@@ -178,6 +182,8 @@ unique_ptr<FileBuffer> BlockHandle::UnloadAndTakeBlock(BlockLock &lock) {
 	}
 	memory_charge.Resize(0);
 	state = BlockState::BLOCK_UNLOADED;
+	// any accumulated eviction temperature is lost: a reloaded block has to earn its second chances again
+	eviction_temperature = 0;
 	return std::move(buffer);
 }
 
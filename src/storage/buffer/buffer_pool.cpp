@@ -339,7 +339,21 @@ BufferPool::EvictionResult BufferPool::EvictBlocksInternal(EvictionQueue &queue,
 		return {true, std::move(r)};
 	}
 
-	queue.IterateUnloadableBlocks([&](BufferEvictionNode &, const shared_ptr<BlockHandle> &handle, BlockLock &lock) {
+	// bound the number of second chances we hand out, so that eviction always terminates,
+	// even if every block in the queue is warm or pinned
+	idx_t requeue_budget = queue.q.size_approx();
+
+	queue.IterateUnloadableBlocks([&](BufferEvictionNode &node, const shared_ptr<BlockHandle> &handle,
+	                                  BlockLock &lock) {
+		// scan-resistant eviction: blocks that were re-pinned since they were loaded, as well as blocks that were
+		// explicitly pinned through PRAGMA pin_table_blocks, get a second chance at the back of the queue, so that
+		// a single bulk scan cannot flush the working set
+		if (requeue_budget > 0 && (handle->IsMemoryPinned() || handle->CoolDown())) {
+			requeue_budget--;
+			queue.AddToEvictionQueue(std::move(node));
+			return true;
+		}
+
 		// hooray, we can unload the block
 		if (buffer && handle->GetBuffer(lock)->AllocSize() == extra_memory) {
 			// we can re-use the memory directly
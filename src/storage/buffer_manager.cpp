@@ -73,6 +73,11 @@ void BufferManager::SetSwapLimit(optional_idx limit) {
 	throw NotImplementedException("This type of BufferManager can not set a swap limit");
 }
 
+idx_t BufferManager::GetTotalSpilledBytes() const {
+	// this type of BufferManager never spills to disk
+	return 0;
+}
+
 vector<TemporaryFileInformation> BufferManager::GetTemporaryFiles() {
 	throw InternalException("This type of BufferManager does not allow temporary files");
 }
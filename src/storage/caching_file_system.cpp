@@ -1,5 +1,6 @@
 #include "duckdb/storage/caching_file_system.hpp"
 
+#include "duckdb/common/algorithm.hpp"
 #include "duckdb/common/chrono.hpp"
 #include "duckdb/common/file_system.hpp"
 #include "duckdb/common/enums/memory_tag.hpp"
@@ -183,6 +184,49 @@ BufferHandle CachingFileHandle::Read(data_ptr_t &buffer, idx_t &nr_bytes) {
 	return result;
 }
 
+void CachingFileHandle::RegisterPrefetch(const idx_t nr_bytes, const idx_t location) {
+	if (nr_bytes == 0) {
+		return;
+	}
+	prefetch_ranges.emplace_back(location, nr_bytes);
+}
+
+void CachingFileHandle::Prefetch() {
+	if (prefetch_ranges.empty()) {
+		return;
+	}
+	if (!external_file_cache.IsEnabled()) {
+		// Without the cache the prefetched buffers could not outlive this call
+		prefetch_ranges.clear();
+		return;
+	}
+
+	// Plan the reads: sort the registered ranges by location and coalesce overlapping/adjacent ones,
+	// filling gaps between ranges with the same heuristic that Read uses
+	std::sort(prefetch_ranges.begin(), prefetch_ranges.end());
+	vector<pair<idx_t, idx_t>> coalesced;
+	for (const auto &range : prefetch_ranges) {
+		if (!coalesced.empty()) {
+			auto &previous = coalesced.back();
+			const auto previous_end = previous.first + previous.second;
+			const auto range_end = range.first + range.second;
+			if (range.first <= previous_end || ShouldExpandToFillGap(previous.second, range.first - previous_end)) {
+				previous.second = MaxValue(previous_end, range_end) - previous.first;
+				continue;
+			}
+		}
+		coalesced.push_back(range);
+	}
+	prefetch_ranges.clear();
+
+	// Issue the coalesced reads; Read inserts each range into the external file cache,
+	// so the buffers remain available (until evicted) for the upcoming actual reads
+	for (const auto &range : coalesced) {
+		data_ptr_t buffer;
+		Read(buffer, range.second, range.first);
+	}
+}
+
 string CachingFileHandle::GetPath() const {
 	return cached_file.path;
 }
@@ -22,6 +22,8 @@
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/block_manager.hpp"
 #include "duckdb/storage/checkpoint/table_data_reader.hpp"
 #include "duckdb/storage/checkpoint/table_data_writer.hpp"
@@ -254,15 +256,76 @@ void SingleFileCheckpointWriter::CreateCheckpoint() {
 	}
 }
 
+//! Loads the metadata (statistics and row group pointers) of a single table at checkpoint load
+class TableMetadataLoadTask : public BaseExecutorTask {
+public:
+	TableMetadataLoadTask(TaskExecutor &executor, MetadataManager &metadata_manager, MetaBlockPointer table_pointer,
+	                      BoundCreateTableInfo &bound_info, idx_t total_rows)
+	    : BaseExecutorTask(executor), metadata_manager(metadata_manager), table_pointer(table_pointer),
+	      bound_info(bound_info), total_rows(total_rows) {
+	}
+
+	void ExecuteTask() override {
+		MetadataReader table_data_reader(metadata_manager, table_pointer);
+		TableDataReader data_reader(table_data_reader, bound_info, table_pointer);
+		data_reader.ReadTableData();
+		bound_info.data->total_rows = total_rows;
+	}
+
+	string TaskType() const override {
+		return "TableMetadataLoadTask";
+	}
+
+private:
+	MetadataManager &metadata_manager;
+	MetaBlockPointer table_pointer;
+	BoundCreateTableInfo &bound_info;
+	idx_t total_rows;
+};
+
 void CheckpointReader::LoadCheckpoint(CatalogTransaction transaction, MetadataReader &reader) {
-	BinaryDeserializer deserializer(reader);
-	deserializer.Set<Catalog &>(catalog);
-	deserializer.Begin();
-	deserializer.ReadList(100, "catalog_entries", [&](Deserializer::List &list, idx_t i) {
-		return list.ReadObject([&](Deserializer &obj) { ReadEntry(transaction, obj); });
-	});
-	deserializer.End();
-	deserializer.Unset<Catalog>();
+	// table metadata is loaded in the background while we keep reading catalog entries
+	TaskExecutor executor(TaskScheduler::GetScheduler(catalog.GetDatabase()));
+	load_executor = executor;
+
+	ErrorData load_error;
+	try {
+		BinaryDeserializer deserializer(reader);
+		deserializer.Set<Catalog &>(catalog);
+		deserializer.Begin();
+		deserializer.ReadList(100, "catalog_entries", [&](Deserializer::List &list, idx_t i) {
+			return list.ReadObject([&](Deserializer &obj) { ReadEntry(transaction, obj); });
+		});
+		deserializer.End();
+		deserializer.Unset<Catalog>();
+	} catch (std::exception &ex) {
+		// remember the error, but wait for the scheduled metadata loads before rethrowing -
+		// the tasks reference state owned by this reader
+		load_error = ErrorData(ex);
+	}
+
+	// wait for the background metadata loads to finish
+	load_executor = nullptr;
+	executor.WorkOnTasks();
+	if (load_error.HasError()) {
+		load_error.Throw();
+	}
+
+	CreateDeferredEntries(transaction);
+}
+
+void CheckpointReader::CreateDeferredEntries(CatalogTransaction transaction) {
+	// create the tables in checkpoint order, now that their metadata has been loaded
+	for (auto &bound_info : deferred_tables) {
+		catalog.CreateTable(transaction, *bound_info);
+	}
+	deferred_tables.clear();
+
+	// create the index entries - the tables they are attached to all exist now
+	for (auto &deferred_index : deferred_indexes) {
+		CreateIndex(transaction, deferred_index);
+	}
+	deferred_indexes.clear();
 }
 
 MetadataManager &SingleFileCheckpointReader::GetMetadataManager() {
@@ -437,14 +500,23 @@ void CheckpointWriter::WriteIndex(IndexCatalogEntry &index_catalog_entry, Serial
 
 void CheckpointReader::ReadIndex(CatalogTransaction transaction, Deserializer &deserializer) {
 	// we need to keep the tag "index", even though it is slightly misleading.
-	auto create_info = deserializer.ReadProperty<unique_ptr<CreateInfo>>(100, "index");
-	auto &info = create_info->Cast<CreateIndexInfo>();
+	DeferredIndexInfo deferred;
+	deferred.create_info = deserializer.ReadProperty<unique_ptr<CreateInfo>>(100, "index");
 
 	// also, we have to read the root_block_pointer, which will not be valid for newer storage versions.
 	// This leads to different code paths in this function.
-	auto root_block_pointer =
+	deferred.root_block_pointer =
 	    deserializer.ReadPropertyWithExplicitDefault<BlockPointer>(101, "root_block_pointer", BlockPointer());
 
+	// defer creating the index until the (also deferred) table it is attached to has been created
+	deferred_indexes.push_back(std::move(deferred));
+}
+
+void CheckpointReader::CreateIndex(CatalogTransaction transaction, DeferredIndexInfo &deferred) {
+	auto create_info = std::move(deferred.create_info);
+	auto &info = create_info->Cast<CreateIndexInfo>();
+	auto root_block_pointer = deferred.root_block_pointer;
+
 	// create the index in the catalog
 
 	// look for the table in the catalog
@@ -559,8 +631,8 @@ void CheckpointReader::ReadTable(CatalogTransaction transaction, Deserializer &d
 	// now read the actual table data and place it into the CreateTableInfo
 	ReadTableData(transaction, deserializer, *bound_info);
 
-	// finally create the table in the catalog
-	catalog.CreateTable(transaction, *bound_info);
+	// defer creating the table in the catalog until all table metadata has been loaded
+	deferred_tables.push_back(std::move(bound_info));
 }
 
 void CheckpointReader::ReadTableData(CatalogTransaction transaction, Deserializer &deserializer,
@@ -592,8 +664,16 @@ void CheckpointReader::ReadTableData(CatalogTransaction transaction, Deserialize
 	// FIXME: icky downcast to get the underlying MetadataReader
 	auto &binary_deserializer = dynamic_cast<BinaryDeserializer &>(deserializer);
 	auto &reader = dynamic_cast<MetadataReader &>(binary_deserializer.GetStream());
+	auto &metadata_manager = reader.GetMetadataManager();
+
+	if (load_executor) {
+		// the table metadata lives at its own metadata pointer - load it in the background
+		load_executor->ScheduleTask(
+		    make_uniq<TableMetadataLoadTask>(*load_executor, metadata_manager, table_pointer, bound_info, total_rows));
+		return;
+	}
 
-	MetadataReader table_data_reader(reader.GetMetadataManager(), table_pointer);
+	MetadataReader table_data_reader(metadata_manager, table_pointer);
 	TableDataReader data_reader(table_data_reader, bound_info, table_pointer);
 	data_reader.ReadTableData();
 
@@ -20,10 +20,17 @@ DictFSSTCompressionState::~DictFSSTCompressionState() {
 		auto fsst_encoder = reinterpret_cast<duckdb_fsst_encoder_t *>(encoder);
 		duckdb_fsst_destroy(fsst_encoder);
 	}
+	if (retained_encoder) {
+		auto fsst_encoder = reinterpret_cast<duckdb_fsst_encoder_t *>(retained_encoder);
+		duckdb_fsst_destroy(fsst_encoder);
+	}
 }
 
 static constexpr uint16_t FSST_SYMBOL_TABLE_SIZE = sizeof(duckdb_fsst_decoder_t);
 static constexpr idx_t DICTIONARY_ENCODE_THRESHOLD = 4096;
+//! If a reused symbol table compresses the dictionary this much worse (relative to the ratio it achieved when
+//  it was trained), we consider the data to have drifted and retrain it on the current dictionary
+static constexpr double ENCODER_RETRAIN_THRESHOLD = 1.2;
 
 static inline bool IsEncoded(DictionaryAppendState state) {
 	return state == DictionaryAppendState::ENCODED || state == DictionaryAppendState::ENCODED_ALL_UNIQUE;
@@ -288,8 +295,13 @@ void DictFSSTCompressionState::Flush(bool final) {
 	string_lengths.clear();
 	dictionary_indices.clear();
 	if (encoder) {
-		auto fsst_encoder = reinterpret_cast<duckdb_fsst_encoder_t *>(encoder);
-		duckdb_fsst_destroy(fsst_encoder);
+		// retain the encoder instead of destroying it - the next segment of this column can reuse the
+		// symbol table and skip training
+		if (retained_encoder) {
+			auto fsst_encoder = reinterpret_cast<duckdb_fsst_encoder_t *>(retained_encoder);
+			duckdb_fsst_destroy(fsst_encoder);
+		}
+		retained_encoder = encoder;
 		encoder = nullptr;
 		symbol_table_size = DConstants::INVALID_INDEX;
 	}
@@ -490,8 +502,17 @@ bool DictFSSTCompressionState::CompressInternal(UnifiedVectorFormat &vector_form
 	if (append_state == DictionaryAppendState::ENCODED_ALL_UNIQUE || is_null) {
 		lookup = 0;
 	} else {
-		auto it = current_string_map.find(str);
-		lookup = it == current_string_map.end() ? DConstants::INVALID_INDEX : it->second;
+		auto input_idx = vector_format.sel->get_index(i);
+		if (input_idx < input_lookup_cache.size() && input_lookup_cache[input_idx] != DConstants::INVALID_INDEX) {
+			//! We already resolved this input dictionary entry before
+			lookup = input_lookup_cache[input_idx];
+		} else {
+			auto it = current_string_map.find(str);
+			lookup = it == current_string_map.end() ? DConstants::INVALID_INDEX : it->second;
+			if (lookup != DConstants::INVALID_INDEX && input_idx < input_lookup_cache.size()) {
+				input_lookup_cache[input_idx] = lookup;
+			}
+		}
 	}
 
 	switch (append_state) {
@@ -690,31 +711,33 @@ DictionaryAppendState DictFSSTCompressionState::TryEncode() {
 	}
 	D_ASSERT(offset == dictionary_offset);
 
-	// Create the encoder
+	// Reuse the encoder retained from the previous segment (if any), otherwise train a new one
 	auto string_count = string_lengths.size() - 1;
-	encoder = reinterpret_cast<void *>(
-	    duckdb_fsst_create(string_count, fsst_string_sizes.data(), fsst_string_ptrs.data(), 0));
+	bool reused_encoder = retained_encoder != nullptr;
+	if (reused_encoder) {
+		encoder = retained_encoder;
+		retained_encoder = nullptr;
+	} else {
+		encoder = reinterpret_cast<void *>(
+		    duckdb_fsst_create(string_count, fsst_string_sizes.data(), fsst_string_ptrs.data(), 0));
+	}
 	auto fsst_encoder = reinterpret_cast<duckdb_fsst_encoder_t *>(encoder);
 
 	auto compressed_ptrs = vector<unsigned char *>(string_count, nullptr);
 	auto compressed_sizes = vector<size_t>(string_count, 0);
 
-	// Compress the dictionary, straight to the segment
-	auto res = duckdb_fsst_compress(fsst_encoder, string_count, fsst_string_sizes.data(), fsst_string_ptrs.data(),
-	                                dictionary_offset, (unsigned char *)dictionary_start, compressed_sizes.data(),
-	                                compressed_ptrs.data());
-
-	bool can_use_encoding = true;
 	idx_t new_size = 0;
-	bitpacking_width_t new_string_lengths_width;
-	idx_t new_string_lengths_space;
-	//! Check that the compressed dictionary can fit on the block
-	do {
+	uint32_t max_length = 0;
+	// Compresses the dictionary, straight to the segment, and measures the result
+	auto compress_dictionary = [&]() {
+		auto res = duckdb_fsst_compress(fsst_encoder, string_count, fsst_string_sizes.data(), fsst_string_ptrs.data(),
+		                                dictionary_offset, (unsigned char *)dictionary_start, compressed_sizes.data(),
+		                                compressed_ptrs.data());
+		new_size = 0;
+		max_length = 0;
 		if (res != string_count) {
-			can_use_encoding = false;
-			break;
+			return false;
 		}
-		uint32_t max_length = 0;
 		for (idx_t i = 0; i < string_count; i++) {
 			auto str_len = UnsafeNumericCast<uint32_t>(compressed_sizes[i]);
 			new_size += str_len;
@@ -722,6 +745,34 @@ DictionaryAppendState DictFSSTCompressionState::TryEncode() {
 				max_length = str_len;
 			}
 		}
+		return true;
+	};
+
+	bool compressed_fits = compress_dictionary();
+	if (reused_encoder &&
+	    (!compressed_fits || new_size + DICTIONARY_ENCODE_THRESHOLD > dictionary_offset ||
+	     double(new_size) > trained_compression_ratio * ENCODER_RETRAIN_THRESHOLD * double(dictionary_offset))) {
+		// the reused symbol table no longer fits the data - retrain it on the current dictionary
+		duckdb_fsst_destroy(fsst_encoder);
+		encoder = reinterpret_cast<void *>(
+		    duckdb_fsst_create(string_count, fsst_string_sizes.data(), fsst_string_ptrs.data(), 0));
+		fsst_encoder = reinterpret_cast<duckdb_fsst_encoder_t *>(encoder);
+		reused_encoder = false;
+		compressed_fits = compress_dictionary();
+	}
+	if (!reused_encoder && compressed_fits && dictionary_offset > 0) {
+		trained_compression_ratio = double(new_size) / double(dictionary_offset);
+	}
+
+	bool can_use_encoding = true;
+	bitpacking_width_t new_string_lengths_width;
+	idx_t new_string_lengths_space;
+	//! Check that the compressed dictionary can fit on the block
+	do {
+		if (!compressed_fits) {
+			can_use_encoding = false;
+			break;
+		}
 		if (new_size + DICTIONARY_ENCODE_THRESHOLD > dictionary_offset) {
 			can_use_encoding = false;
 			break;
@@ -837,6 +888,17 @@ void DictFSSTCompressionState::Compress(Vector &scan_vector, idx_t count) {
 	scan_vector.ToUnifiedFormat(count, vector_format);
 	auto strings = UnifiedVectorFormat::GetData<string_t>(vector_format);
 
+	//! Dictionary input (e.g. strings scanned from a parquet dictionary page) references the same underlying
+	//  entries many times - memoize the dictionary index each entry resolves to, so every unique string is
+	//  hashed once per vector instead of once per row
+	input_lookup_cache.clear();
+	if (scan_vector.GetVectorType() == VectorType::DICTIONARY_VECTOR) {
+		auto dictionary_size = DictionaryVector::DictionarySize(scan_vector);
+		if (dictionary_size.IsValid()) {
+			input_lookup_cache.resize(dictionary_size.GetIndex(), DConstants::INVALID_INDEX);
+		}
+	}
+
 	EncodedInput encoded_input;
 	for (idx_t i = 0; i < count; i++) {
 		auto idx = vector_format.sel->get_index(i);
@@ -855,6 +917,8 @@ void DictFSSTCompressionState::Compress(Vector &scan_vector, idx_t count) {
 				}
 			}
 			Flush(false);
+			//! The flush started a fresh segment dictionary, all memoized lookups are stale
+			input_lookup_cache.assign(input_lookup_cache.size(), DConstants::INVALID_INDEX);
 			encoded_input.data.clear();
 			encoded_input.offset = 0;
 			if (!CompressInternal(vector_format, str, is_null, encoded_input, i, count, true)) {
@@ -209,7 +209,7 @@ bool CompressedStringScanState::AllowDictionaryScan(idx_t scan_count) {
 	if (mode == DictFSSTMode::FSST_ONLY) {
 		return false;
 	}
-	if (scan_count != STANDARD_VECTOR_SIZE) {
+	if (scan_count > STANDARD_VECTOR_SIZE) {
 		return false;
 	}
 	if (!dictionary) {
@@ -220,7 +220,7 @@ bool CompressedStringScanState::AllowDictionaryScan(idx_t scan_count) {
 
 void CompressedStringScanState::ScanToDictionaryVector(ColumnSegment &segment, Vector &result, idx_t result_offset,
                                                        idx_t start, idx_t scan_count) {
-	D_ASSERT(scan_count == STANDARD_VECTOR_SIZE);
+	D_ASSERT(scan_count <= STANDARD_VECTOR_SIZE);
 	D_ASSERT(result_offset == 0);
 
 	auto &selvec = GetSelVec(start, scan_count);
@@ -90,7 +90,7 @@ void CompressedStringScanState::ScanToFlatVector(Vector &result, idx_t result_of
 
 void CompressedStringScanState::ScanToDictionaryVector(ColumnSegment &segment, Vector &result, idx_t result_offset,
                                                        idx_t start, idx_t scan_count) {
-	D_ASSERT(scan_count == STANDARD_VECTOR_SIZE);
+	D_ASSERT(scan_count <= STANDARD_VECTOR_SIZE);
 	D_ASSERT(result_offset == 0);
 
 	idx_t start_offset = start % BitpackingPrimitives::BITPACKING_ALGORITHM_GROUP_SIZE;
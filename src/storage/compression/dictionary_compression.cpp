@@ -136,7 +136,9 @@ void DictionaryCompressionStorage::StringScanPartial(ColumnSegment &segment, Col
 	auto &scan_state = state.scan_state->Cast<CompressedStringScanState>();
 
 	auto start = segment.GetRelativeIndex(state.row_index);
-	if (!ALLOW_DICT_VECTORS || scan_count != STANDARD_VECTOR_SIZE) {
+	// entire-vector scans can emit a dictionary vector even for short vectors (e.g. row group tails):
+	// the scan covers the caller's complete request, so nothing is appended to the result afterwards
+	if (!ALLOW_DICT_VECTORS || result_offset != 0) {
 		scan_state.ScanToFlatVector(result, result_offset, start, scan_count);
 	} else {
 		scan_state.ScanToDictionaryVector(segment, result, result_offset, start, scan_count);
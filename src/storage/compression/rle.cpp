@@ -480,6 +480,23 @@ void RLEFilter(ColumnSegment &segment, ColumnScanState &state, idx_t vector_coun
 		sel_count = 0;
 		return;
 	}
+	// If the entire Vector is covered by a single run we can resolve the filter per-run instead of per-row:
+	// either every row passes and we emit the run as a ConstantVector, or none do and we skip the run entirely
+	if (!sel.IsSet() && sel_count == vector_count &&
+	    CanEmitConstantVector<true>(scan_state.position_in_entry, index_pointer[scan_state.entry_pos], vector_count)) {
+		if (!scan_state.matching_runs[scan_state.entry_pos]) {
+			// the run is filtered out in its entirety - skip it without materializing anything
+			scan_state.position_in_entry += vector_count;
+			if (scan_state.ExhaustedRun(index_pointer)) {
+				scan_state.ForwardToNextRun();
+			}
+			sel_count = 0;
+			return;
+		}
+		// every row in the Vector passes the filter
+		RLEScanConstant<T>(scan_state, index_pointer, data_pointer, vector_count, result);
+		return;
+	}
 	// scan (the subset of) the matching runs AND set the output selection vector with the rows that match
 	auto result_data = FlatVector::GetData<T>(result);
 	result.SetVectorType(VectorType::FLAT_VECTOR);
@@ -268,6 +268,12 @@ ContainerMetadata RoaringScanState::GetContainerMetadata(idx_t container_index)
 	return container_metadata[container_index];
 }
 
+idx_t RoaringScanState::GetContainerSize(idx_t container_index) {
+	auto segment_count = segment.count.load();
+	auto start_of_container = container_index * ROARING_CONTAINER_SIZE;
+	return MinValue<idx_t>(segment_count - start_of_container, ROARING_CONTAINER_SIZE);
+}
+
 data_ptr_t RoaringScanState::GetStartOfContainerData(idx_t container_index) {
 	return data_ptr + data_start_position[container_index];
 }
@@ -279,9 +285,7 @@ ContainerScanState &RoaringScanState::LoadContainer(idx_t container_index, idx_t
 	auto metadata = GetContainerMetadata(container_index);
 	auto data_ptr = GetStartOfContainerData(container_index);
 
-	auto segment_count = segment.count.load();
-	auto start_of_container = container_index * ROARING_CONTAINER_SIZE;
-	auto container_size = MinValue<idx_t>(segment_count - start_of_container, ROARING_CONTAINER_SIZE);
+	auto container_size = GetContainerSize(container_index);
 	if (metadata.IsUncompressed()) {
 		current_container = make_uniq<BitsetContainerScanState>(container_index, container_size,
 		                                                        reinterpret_cast<validity_t *>(data_ptr));
@@ -348,6 +352,16 @@ void RoaringScanState::ScanPartial(idx_t start_idx, Vector &result, idx_t offset
 	while (remaining) {
 		idx_t internal_offset;
 		idx_t container_idx = GetContainerIndex(start_idx + scanned, internal_offset);
+		if (GetContainerMetadata(container_idx).IsAllValid()) {
+			// the metadata tells us this container holds no nulls at all - leave the result
+			// mask untouched (its all-valid representation) without loading the container,
+			// so downstream kernels keep taking their all-valid fast paths
+			idx_t remaining_in_container = GetContainerSize(container_idx) - internal_offset;
+			idx_t to_scan = MinValue<idx_t>(remaining, remaining_in_container);
+			remaining -= to_scan;
+			scanned += to_scan;
+			continue;
+		}
 		auto &scan_state = LoadContainer(container_idx, internal_offset);
 		idx_t remaining_in_container = scan_state.container_size - scan_state.scanned_count;
 		idx_t to_scan = MinValue<idx_t>(remaining, remaining_in_container);
@@ -6,10 +6,12 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/common/constants.hpp"
 #include "duckdb/common/allocator.hpp"
+#include "duckdb/common/serializer/serializer.hpp"
 #include "duckdb/common/serializer/deserializer.hpp"
 #include "duckdb/storage/segment/uncompressed.hpp"
 
 #include "zstd.h"
+#include "zdict.h"
 
 /*
 Data layout per segment:
@@ -44,8 +46,55 @@ static int32_t GetCompressionLevel() {
 
 static constexpr idx_t ZSTD_VECTOR_SIZE = STANDARD_VECTOR_SIZE > 2048 ? STANDARD_VECTOR_SIZE : 2048;
 
+//! Capacity of a trained compression dictionary
+static constexpr idx_t ZSTD_DICTIONARY_SIZE = 16384;
+//! Cap on the total amount of sample data gathered for dictionary training
+static constexpr idx_t ZSTD_DICTIONARY_SAMPLE_LIMIT = 2 * 1024 * 1024;
+//! We sample every Nth (non-empty) string during analyze
+static constexpr idx_t ZSTD_DICTIONARY_SAMPLE_STRIDE = 4;
+//! Minimum amount of samples required before we attempt to train a dictionary
+static constexpr idx_t ZSTD_DICTIONARY_MIN_SAMPLES = 512;
+//! Dictionaries only pay off for short values - above this average sample length the zstd window
+//! already covers enough context by itself and we skip training
+static constexpr idx_t ZSTD_DICTIONARY_MAX_AVERAGE_LENGTH = 512;
+
 namespace duckdb {
 
+//===--------------------------------------------------------------------===//
+// Segment state
+//===--------------------------------------------------------------------===//
+
+//! Runtime state of a zstd segment - tracks the extra pages plus the (optional) compression dictionary
+struct ZSTDSegmentState : public UncompressedStringSegmentState {
+	~ZSTDSegmentState() override {
+		if (ddict) {
+			duckdb_zstd::ZSTD_freeDDict(ddict);
+		}
+	}
+
+	void SetDictionary(string dictionary_p) {
+		D_ASSERT(!ddict);
+		dictionary = std::move(dictionary_p);
+		ddict = duckdb_zstd::ZSTD_createDDict(dictionary.data(), dictionary.size());
+	}
+
+	//! The dictionary shared by all vectors in this segment (empty if the segment has none)
+	string dictionary;
+	//! The digested form of the dictionary, used for decompression
+	duckdb_zstd::ZSTD_DDict *ddict = nullptr;
+};
+
+//! On-disk state of a zstd segment - the set of extra pages plus the compression dictionary
+struct SerializedZSTDSegmentState : public ColumnSegmentState {
+	void Serialize(Serializer &serializer) const override {
+		serializer.WriteProperty(1, "overflow_blocks", blocks);
+		serializer.WritePropertyWithDefault<string>(2, "dictionary", dictionary, string());
+	}
+
+	//! The compression dictionary (empty if the segment was written without one)
+	string dictionary;
+};
+
 static idx_t GetWritableSpace(const CompressionInfo &info) {
 	return info.GetBlockSize() - sizeof(block_id_t);
 }
@@ -124,6 +173,12 @@ public:
 	DBConfig &config;
 
 	duckdb_zstd::ZSTD_CCtx *context;
+	//! Whether we are allowed to train a compression dictionary (requires a recent enough storage version)
+	bool enable_dictionary = false;
+	//! Sampled string data used to train the compression dictionary
+	string sample_buffer;
+	//! Sizes of the individual samples in the sample buffer
+	vector<size_t> sample_sizes;
 	//! The combined string lengths for all values in the segment
 	idx_t total_size = 0;
 	//! The total amount of values in the segment
@@ -151,7 +206,11 @@ unique_ptr<AnalyzeState> ZSTDStorage::StringInitAnalyze(ColumnData &col_data, Ph
 	auto &attached_db = data_table_info.GetDB();
 	auto &config = DBConfig::Get(attached_db);
 
-	return make_uniq<ZSTDAnalyzeState>(info, config);
+	auto result = make_uniq<ZSTDAnalyzeState>(info, config);
+	// the serialized dictionary requires a reader that knows about it - released readers up to v1.5.0
+	// (serialization version 7) do not, so only write dictionaries from v1.6.0 onwards
+	result->enable_dictionary = storage.GetStorageVersion() >= 8;
+	return std::move(result);
 }
 
 bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t count) {
@@ -167,6 +226,11 @@ bool ZSTDStorage::StringAnalyze(AnalyzeState &state_p, Vector &input, idx_t coun
 		}
 		auto &str = data[idx];
 		auto string_size = str.GetSize();
+		if (state.enable_dictionary && string_size != 0 && (state.count + i) % ZSTD_DICTIONARY_SAMPLE_STRIDE == 0 &&
+		    state.sample_buffer.size() < ZSTD_DICTIONARY_SAMPLE_LIMIT) {
+			state.sample_buffer.append(str.GetData(), string_size);
+			state.sample_sizes.push_back(string_size);
+		}
 		state.total_size += string_size;
 	}
 	state.values_in_vector += count;
@@ -241,13 +305,47 @@ public:
 		vector_in_segment_count = 0;
 		tuple_count = 0;
 
+		TrainDictionary();
+
 		idx_t offset = NewSegment();
 		SetCurrentBuffer(segment_handle);
 		current_buffer_ptr = segment_handle.Ptr() + offset;
 		D_ASSERT(GetCurrentOffset() <= GetWritableSpace(info));
 	}
 
+	~ZSTDCompressionState() override {
+		if (cdict) {
+			duckdb_zstd::ZSTD_freeCDict(cdict);
+		}
+	}
+
 public:
+	//! Train a compression dictionary on the sample gathered during analyze
+	//! On any failure we simply leave the dictionary empty and compress plain, as before
+	void TrainDictionary() {
+		auto &samples = analyze_state->sample_sizes;
+		if (samples.size() < ZSTD_DICTIONARY_MIN_SAMPLES) {
+			return;
+		}
+		auto &sample_buffer = analyze_state->sample_buffer;
+		if (sample_buffer.size() / samples.size() > ZSTD_DICTIONARY_MAX_AVERAGE_LENGTH) {
+			return;
+		}
+		dictionary.resize(ZSTD_DICTIONARY_SIZE);
+		auto res = duckdb_zstd::ZDICT_trainFromBuffer(&dictionary[0], dictionary.size(), sample_buffer.data(),
+		                                              samples.data(), NumericCast<unsigned>(samples.size()));
+		if (duckdb_zstd::ZDICT_isError(res)) {
+			// not enough (or too repetitive) sample data to produce a useful dictionary
+			dictionary.clear();
+			return;
+		}
+		dictionary.resize(res);
+		cdict = duckdb_zstd::ZSTD_createCDict(dictionary.data(), dictionary.size(), GetCompressionLevel());
+		if (!cdict) {
+			dictionary.clear();
+		}
+	}
+
 	void ResetOutBuffer() {
 		out_buffer.dst = current_buffer_ptr;
 		out_buffer.pos = 0;
@@ -381,9 +479,14 @@ public:
 
 		// Initialize the context for streaming compression
 		duckdb_zstd::ZSTD_CCtx_reset(analyze_state->context, duckdb_zstd::ZSTD_reset_session_only);
-		duckdb_zstd::ZSTD_CCtx_refCDict(analyze_state->context, nullptr);
-		duckdb_zstd::ZSTD_CCtx_setParameter(analyze_state->context, duckdb_zstd::ZSTD_c_compressionLevel,
-		                                    GetCompressionLevel());
+		if (cdict) {
+			// compress against the trained dictionary (carries the compression level)
+			duckdb_zstd::ZSTD_CCtx_refCDict(analyze_state->context, cdict);
+		} else {
+			duckdb_zstd::ZSTD_CCtx_refCDict(analyze_state->context, nullptr);
+			duckdb_zstd::ZSTD_CCtx_setParameter(analyze_state->context, duckdb_zstd::ZSTD_c_compressionLevel,
+			                                    GetCompressionLevel());
+		}
 		in_vector = true;
 	}
 
@@ -528,6 +631,12 @@ public:
 		                                                                info.GetBlockSize(), info.GetBlockManager());
 		segment = std::move(compressed_segment);
 
+		if (!dictionary.empty()) {
+			// attach the dictionary to the segment so scans (and serialization) can find it
+			auto &state = segment->GetSegmentState()->Cast<ZSTDSegmentState>();
+			state.SetDictionary(dictionary);
+		}
+
 		auto &buffer_manager = BufferManager::GetBufferManager(checkpoint_data.GetDatabase());
 		segment_handle = buffer_manager.Pin(segment->block);
 	}
@@ -614,6 +723,11 @@ public:
 	idx_t tuple_count = 0;
 	//! The expected size of this vector (ZSTD_VECTOR_SIZE except for the last one)
 	idx_t vector_size;
+
+	//! The dictionary trained on the sampled input (empty if we compress without one)
+	string dictionary;
+	//! The digested form of the dictionary, referenced when compressing each vector
+	duckdb_zstd::ZSTD_CDict *cdict = nullptr;
 };
 
 unique_ptr<CompressionState> ZSTDStorage::InitCompression(ColumnDataCheckpointData &checkpoint_data,
@@ -689,7 +803,7 @@ public:
 struct ZSTDScanState : public SegmentScanState {
 public:
 	explicit ZSTDScanState(ColumnSegment &segment)
-	    : state(segment.GetSegmentState()->Cast<UncompressedStringSegmentState>()),
+	    : state(segment.GetSegmentState()->Cast<ZSTDSegmentState>()),
 	      block_manager(segment.GetBlockManager()), buffer_manager(BufferManager::GetBufferManager(segment.db)),
 	      segment_block_offset(segment.GetBlockOffset()) {
 		decompression_context = duckdb_zstd::ZSTD_createDCtx();
@@ -802,7 +916,8 @@ public:
 
 		// Initialize the context for streaming decompression
 		duckdb_zstd::ZSTD_DCtx_reset(decompression_context, duckdb_zstd::ZSTD_reset_session_only);
-		duckdb_zstd::ZSTD_DCtx_refDDict(decompression_context, nullptr);
+		// reference the segment's dictionary (if any - 'ddict' is null for segments written without one)
+		duckdb_zstd::ZSTD_DCtx_refDDict(decompression_context, state.ddict);
 
 		if (internal_offset) {
 			Skip(scan_state, internal_offset);
@@ -932,7 +1047,7 @@ public:
 	}
 
 public:
-	UncompressedStringSegmentState &state;
+	ZSTDSegmentState &state;
 	BlockManager &block_manager;
 	BufferManager &buffer_manager;
 
@@ -996,26 +1111,33 @@ void ZSTDStorage::StringFetchRow(ColumnSegment &segment, ColumnFetchState &state
 
 unique_ptr<CompressedSegmentState> ZSTDStorage::StringInitSegment(ColumnSegment &segment, block_id_t block_id,
                                                                   optional_ptr<ColumnSegmentState> segment_state) {
-	auto result = make_uniq<UncompressedStringSegmentState>();
+	auto result = make_uniq<ZSTDSegmentState>();
 	if (segment_state) {
-		auto &serialized_state = segment_state->Cast<SerializedStringSegmentState>();
+		auto &serialized_state = segment_state->Cast<SerializedZSTDSegmentState>();
 		result->on_disk_blocks = std::move(serialized_state.blocks);
+		if (!serialized_state.dictionary.empty()) {
+			result->SetDictionary(std::move(serialized_state.dictionary));
+		}
 	}
 	return std::move(result);
 }
 
 unique_ptr<ColumnSegmentState> ZSTDStorage::SerializeState(ColumnSegment &segment) {
-	auto &state = segment.GetSegmentState()->Cast<UncompressedStringSegmentState>();
-	if (state.on_disk_blocks.empty()) {
-		// no on-disk blocks - nothing to write
+	auto &state = segment.GetSegmentState()->Cast<ZSTDSegmentState>();
+	if (state.on_disk_blocks.empty() && state.dictionary.empty()) {
+		// no on-disk blocks and no dictionary - nothing to write
 		return nullptr;
 	}
-	return make_uniq<SerializedStringSegmentState>(state.on_disk_blocks);
+	auto result = make_uniq<SerializedZSTDSegmentState>();
+	result->blocks = state.on_disk_blocks;
+	result->dictionary = state.dictionary;
+	return std::move(result);
 }
 
 unique_ptr<ColumnSegmentState> ZSTDStorage::DeserializeState(Deserializer &deserializer) {
-	auto result = make_uniq<SerializedStringSegmentState>();
+	auto result = make_uniq<SerializedZSTDSegmentState>();
 	deserializer.ReadProperty(1, "overflow_blocks", result->blocks);
+	deserializer.ReadPropertyWithExplicitDefault<string>(2, "dictionary", result->dictionary, string());
 	return std::move(result);
 }
 
@@ -12,6 +12,7 @@
 #include "duckdb/execution/index/unbound_index.hpp"
 #include "duckdb/main/attached_database.hpp"
 #include "duckdb/main/client_context.hpp"
+#include "duckdb/main/settings.hpp"
 #include "duckdb/parser/constraints/list.hpp"
 #include "duckdb/planner/constraints/list.hpp"
 #include "duckdb/planner/expression/bound_constant_expression.hpp"
@@ -268,6 +269,10 @@ vector<PartitionStatistics> DataTable::GetPartitionStats(ClientContext &context)
 	return result;
 }
 
+bool DataTable::HasChanges() const {
+	return row_groups->HasChanges();
+}
+
 idx_t DataTable::MaxThreads(ClientContext &context) const {
 	idx_t row_group_size = GetRowGroupSize();
 	idx_t parallel_scan_vector_count = row_group_size / STANDARD_VECTOR_SIZE;
@@ -282,12 +287,19 @@ void DataTable::InitializeParallelScan(ClientContext &context, ParallelTableScan
 	auto &local_storage = LocalStorage::Get(context, db);
 	auto &transaction = DuckTransaction::Get(context, db);
 	state.checkpoint_lock = transaction.SharedLockTable(*info);
-	row_groups->InitializeParallelScan(state.scan_state);
+	// if insertion order does not have to be preserved, attach to any in-flight pass over the same collection,
+	// so that concurrent queries share the hot row groups instead of each churning through the buffer pool
+	const bool attach_to_shared_scan = !DBConfig::GetSetting<PreserveInsertionOrderSetting>(context);
+	row_groups->InitializeParallelScan(state.scan_state, attach_to_shared_scan);
 
 	local_storage.InitializeParallelScan(*this, state.local_state);
 }
 
 bool DataTable::NextParallelScan(ClientContext &context, ParallelTableScanState &state, TableScanState &scan_state) {
+	if (!state.HasRowBudgetRemaining()) {
+		// a LIMIT pushed into this scan has been fully produced - stop handing out units of work
+		return false;
+	}
 	if (row_groups->NextParallelScan(context, state.scan_state, scan_state.table_state)) {
 		return true;
 	}
@@ -1586,6 +1598,11 @@ void DataTable::SetDistinct(column_t column_id, unique_ptr<DistinctStatistics> d
 	row_groups->SetDistinct(column_id, std::move(distinct_stats));
 }
 
+void DataTable::SetStatistics(column_t column_id, const BaseStatistics &new_stats) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	row_groups->SetStatistics(column_id, new_stats);
+}
+
 unique_ptr<BlockingSample> DataTable::GetSample() {
 	return row_groups->GetSample();
 }
@@ -1654,6 +1671,11 @@ vector<ColumnSegmentInfo> DataTable::GetColumnSegmentInfo(const QueryContext &co
 	return row_groups->GetColumnSegmentInfo(context);
 }
 
+void DataTable::SetBlocksMemoryPinned(bool pinned) {
+	auto lock = GetSharedCheckpointLock();
+	row_groups->SetBlocksMemoryPinned(pinned);
+}
+
 //===--------------------------------------------------------------------===//
 // Index Constraint Creation
 //===--------------------------------------------------------------------===//
@@ -14,6 +14,7 @@
 #include "duckdb/planner/filter/in_filter.hpp"
 #include "duckdb/planner/filter/dynamic_filter.hpp"
 #include "duckdb/planner/filter/expression_filter.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 
 namespace duckdb {
 
@@ -25,6 +26,9 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	auto filter_type = deserializer.ReadProperty<TableFilterType>(100, "filter_type");
 	unique_ptr<TableFilter> result;
 	switch (filter_type) {
+	case TableFilterType::BLOOM_FILTER:
+		result = BloomFilter::Deserialize(deserializer);
+		break;
 	case TableFilterType::CONJUNCTION_AND:
 		result = ConjunctionAndFilter::Deserialize(deserializer);
 		break;
@@ -61,6 +65,15 @@ unique_ptr<TableFilter> TableFilter::Deserialize(Deserializer &deserializer) {
 	return result;
 }
 
+void BloomFilter::Serialize(Serializer &serializer) const {
+	TableFilter::Serialize(serializer);
+}
+
+unique_ptr<TableFilter> BloomFilter::Deserialize(Deserializer &deserializer) {
+	auto result = duckdb::unique_ptr<BloomFilter>(new BloomFilter());
+	return std::move(result);
+}
+
 void ConjunctionAndFilter::Serialize(Serializer &serializer) const {
 	TableFilter::Serialize(serializer);
 	serializer.WritePropertyWithDefault<vector<unique_ptr<TableFilter>>>(200, "child_filters", child_filters);
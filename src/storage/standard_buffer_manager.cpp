@@ -13,6 +13,9 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 #include "duckdb/common/encryption_functions.hpp"
 #include "duckdb/main/settings.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "zstd.h"
 
 namespace duckdb {
 
@@ -96,6 +99,14 @@ idx_t StandardBufferManager::GetUsedSwap() const {
 	return temporary_directory.size_on_disk.load(std::memory_order_relaxed);
 }
 
+idx_t StandardBufferManager::GetTotalSpilledBytes() const {
+	idx_t total = 0;
+	for (idx_t tag = 0; tag < MEMORY_TAG_COUNT; tag++) {
+		total += evicted_data_per_tag[tag].load(std::memory_order_relaxed);
+	}
+	return total;
+}
+
 optional_idx StandardBufferManager::GetMaxSwap() const {
 	lock_guard<mutex> guard(temporary_directory.lock);
 	if (!temporary_directory.handle) {
@@ -295,6 +306,32 @@ void StandardBufferManager::BatchRead(vector<shared_ptr<BlockHandle>> &handles,
 	}
 }
 
+//! Task that performs a single contiguous batch read of a prefetch
+class PrefetchBatchTask : public BaseExecutorTask {
+public:
+	PrefetchBatchTask(TaskExecutor &executor, StandardBufferManager &buffer_manager,
+	                  vector<shared_ptr<BlockHandle>> &handles, const map<block_id_t, idx_t> &load_map,
+	                  block_id_t first_block, block_id_t last_block)
+	    : BaseExecutorTask(executor), buffer_manager(buffer_manager), handles(handles), load_map(load_map),
+	      first_block(first_block), last_block(last_block) {
+	}
+
+	void ExecuteTask() override {
+		buffer_manager.BatchRead(handles, load_map, first_block, last_block);
+	}
+
+	string TaskType() const override {
+		return "PrefetchBatchTask";
+	}
+
+private:
+	StandardBufferManager &buffer_manager;
+	vector<shared_ptr<BlockHandle>> &handles;
+	const map<block_id_t, idx_t> &load_map;
+	block_id_t first_block;
+	block_id_t last_block;
+};
+
 void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 	// figure out which set of blocks we should load
 	map<block_id_t, idx_t> to_be_loaded;
@@ -309,7 +346,8 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 		// nothing to fetch
 		return;
 	}
-	// iterate over the blocks and perform bulk reads
+	// iterate over the blocks and collect the contiguous batches
+	vector<pair<block_id_t, block_id_t>> batches;
 	block_id_t first_block = -1;
 	block_id_t previous_block_id = -1;
 	for (auto &entry : to_be_loaded) {
@@ -321,17 +359,33 @@ void StandardBufferManager::Prefetch(vector<shared_ptr<BlockHandle>> &handles) {
 			// this block is adjacent to the previous block - add it to the batch read
 			previous_block_id = entry.first;
 		} else {
-			// this block is not adjacent to the previous block
-			// perform the batch read for the previous batch
-			BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+			// this block is not adjacent to the previous block - close off the current batch
+			batches.emplace_back(first_block, previous_block_id);
 
 			// set the first_block and previous_block_id to the current block
 			first_block = entry.first;
 			previous_block_id = entry.first;
 		}
 	}
-	// batch read the final batch
-	BatchRead(handles, to_be_loaded, first_block, previous_block_id);
+	// add the final batch
+	batches.emplace_back(first_block, previous_block_id);
+
+	auto &scheduler = TaskScheduler::GetScheduler(db);
+	if (batches.size() == 1 || scheduler.NumberOfThreads() <= 1) {
+		// a single contiguous read (or no worker threads) - read synchronously
+		for (auto &batch : batches) {
+			BatchRead(handles, to_be_loaded, batch.first, batch.second);
+		}
+		return;
+	}
+	// multiple non-adjacent ranges - issue the batch reads concurrently so the reads can be in flight
+	// simultaneously, keeping the disks bandwidth-bound instead of latency-bound on cold scans
+	TaskExecutor executor(scheduler);
+	for (auto &batch : batches) {
+		executor.ScheduleTask(make_uniq<PrefetchBatchTask>(executor, *this, handles, to_be_loaded, batch.first,
+		                                                   batch.second));
+	}
+	executor.WorkOnTasks();
 }
 
 BufferHandle StandardBufferManager::Pin(shared_ptr<BlockHandle> &handle) {
@@ -351,6 +405,8 @@ BufferHandle StandardBufferManager::Pin(const QueryContext &context, shared_ptr<
 		// check if the block is already loaded
 		if (handle->GetState() == BlockState::BLOCK_LOADED) {
 			// the block is loaded, increment the reader count and set the BufferHandle
+			// this is a re-reference of a cached block: heat it up so the eviction policy favors keeping it
+			handle->BumpEvictionTemperature();
 			buf = handle->Load(context);
 		}
 		required_memory = handle->GetMemoryUsage();
@@ -510,33 +566,61 @@ void StandardBufferManager::WriteTemporaryBuffer(MemoryTag tag, block_id_t block
 	// These files are .block, and variable sized (larger then 256kb), as opposed to .tmp
 	auto path = GetTemporaryPath(block_id);
 
-	idx_t header_size = sizeof(idx_t) * 2;
+	idx_t header_size = sizeof(idx_t) * 3;
 	if (db.config.options.temp_file_encryption) {
 		header_size += DEFAULT_ENCRYPTED_BUFFER_HEADER_SIZE;
 	}
 
 	evicted_data_per_tag[uint8_t(tag)] += buffer.AllocSize();
 
+	// Try to compress the buffer before it hits disk - these buffers are large, so spilling them raw is
+	// usually disk-bandwidth-bound. We use a fast compression level and fall back to writing the buffer
+	// uncompressed if it does not shrink.
+	idx_t compressed_size = DConstants::INVALID_INDEX;
+	AllocatedData compressed_buffer;
+	const auto zstd_bound = duckdb_zstd::ZSTD_compressBound(buffer.AllocSize());
+	compressed_buffer = Allocator::Get(db).Allocate(zstd_bound);
+	const auto zstd_size =
+	    duckdb_zstd::ZSTD_compress(compressed_buffer.get(), zstd_bound, buffer.InternalBuffer(), buffer.AllocSize(),
+	                               static_cast<int>(TemporaryCompressionLevel::ZSTD_MINUS_THREE));
+	if (!duckdb_zstd::ZSTD_isError(zstd_size) && zstd_size < buffer.AllocSize()) {
+		compressed_size = zstd_size;
+	}
+	const bool is_compressed = compressed_size != DConstants::INVALID_INDEX;
+	const idx_t payload_size = is_compressed ? compressed_size : buffer.AllocSize();
+
 	// Create the file and write the size followed by the buffer contents.
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_WRITE | FileFlags::FILE_FLAGS_FILE_CREATE);
-	temporary_directory.handle->GetTempFile().IncreaseSizeOnDisk(buffer.AllocSize() + sizeof(idx_t) * 2 + header_size);
+	temporary_directory.handle->GetTempFile().IncreaseSizeOnDisk(payload_size + header_size);
 	//! for very large buffers, we store the size of the buffer in plaintext.
 	idx_t block_header_size = buffer.GetHeaderSize();
 	handle->Write(QueryContext(), &buffer.size, sizeof(idx_t), 0);
 	handle->Write(QueryContext(), &block_header_size, sizeof(idx_t), sizeof(idx_t));
+	//! the compressed size (INVALID_INDEX if the buffer is stored uncompressed)
+	handle->Write(QueryContext(), &compressed_size, sizeof(idx_t), sizeof(idx_t) * 2);
 
-	idx_t offset = sizeof(idx_t) * 2;
+	idx_t offset = sizeof(idx_t) * 3;
 
 	if (db.config.options.temp_file_encryption) {
 		uint8_t encryption_metadata[DEFAULT_ENCRYPTED_BUFFER_HEADER_SIZE];
-		EncryptionEngine::EncryptTemporaryBuffer(db, buffer.InternalBuffer(), buffer.AllocSize(), encryption_metadata);
+		if (is_compressed) {
+			EncryptionEngine::EncryptTemporaryBuffer(db, compressed_buffer.get(), compressed_size,
+			                                         encryption_metadata);
+		} else {
+			EncryptionEngine::EncryptTemporaryBuffer(db, buffer.InternalBuffer(), buffer.AllocSize(),
+			                                         encryption_metadata);
+		}
 		//! Write the nonce (and tag for GCM).
 		handle->Write(QueryContext(), encryption_metadata, DEFAULT_ENCRYPTED_BUFFER_HEADER_SIZE, offset);
 		offset += DEFAULT_ENCRYPTED_BUFFER_HEADER_SIZE;
 	}
 
-	buffer.Write(QueryContext(), *handle, offset);
+	if (is_compressed) {
+		handle->Write(QueryContext(), compressed_buffer.get(), compressed_size, offset);
+	} else {
+		buffer.Write(QueryContext(), *handle, offset);
+	}
 }
 
 unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(QueryContext context, MemoryTag tag,
@@ -555,18 +639,42 @@ unique_ptr<FileBuffer> StandardBufferManager::ReadTemporaryBuffer(QueryContext c
 	// This block contains data of variable size so we need to open it and read it to get its size.
 	idx_t block_size;
 	idx_t block_header_size;
+	idx_t compressed_size;
 	auto path = GetTemporaryPath(id);
 	auto &fs = FileSystem::GetFileSystem(db);
 	auto handle = fs.OpenFile(path, FileFlags::FILE_FLAGS_READ);
 	handle->Read(context, &block_size, sizeof(idx_t), 0);
 	handle->Read(context, &block_header_size, sizeof(idx_t), sizeof(idx_t));
+	handle->Read(context, &compressed_size, sizeof(idx_t), sizeof(idx_t) * 2);
 
-	idx_t offset = sizeof(idx_t) * 2;
+	idx_t offset = sizeof(idx_t) * 3;
+	const bool is_compressed = compressed_size != DConstants::INVALID_INDEX;
 
 	// Allocate a buffer of the file's size and read the data into that buffer.
 	auto buffer = ConstructManagedBuffer(block_size, block_header_size, std::move(reusable_buffer));
 
-	if (db.config.options.temp_file_encryption) {
+	if (is_compressed) {
+		// compressed: read into a separate buffer first, then decompress into the block buffer
+		auto compressed_buffer = Allocator::Get(db).Allocate(compressed_size);
+		if (db.config.options.temp_file_encryption) {
+			//! Read nonce and tag from file.
+			uint8_t encryption_metadata[DEFAULT_ENCRYPTED_BUFFER_HEADER_SIZE];
+			handle->Read(context, encryption_metadata, DEFAULT_ENCRYPTED_BUFFER_HEADER_SIZE, offset);
+			offset += DEFAULT_ENCRYPTED_BUFFER_HEADER_SIZE;
+
+			//! Read and decrypt the compressed buffer.
+			handle->Read(context, compressed_buffer.get(), compressed_size, offset);
+			EncryptionEngine::DecryptTemporaryBuffer(GetDatabase(), compressed_buffer.get(), compressed_size,
+			                                         encryption_metadata);
+		} else {
+			handle->Read(context, compressed_buffer.get(), compressed_size, offset);
+		}
+		const auto decompressed_size = duckdb_zstd::ZSTD_decompress(buffer->InternalBuffer(), buffer->AllocSize(),
+		                                                            compressed_buffer.get(), compressed_size);
+		(void)decompressed_size;
+		D_ASSERT(!duckdb_zstd::ZSTD_isError(decompressed_size));
+		D_ASSERT(decompressed_size == buffer->AllocSize());
+	} else if (db.config.options.temp_file_encryption) {
 		// encrypted
 		//! Read nonce and tag from file.
 		uint8_t encryption_metadata[DEFAULT_ENCRYPTED_BUFFER_HEADER_SIZE];
@@ -94,7 +94,7 @@ static const StorageVersionInfo storage_version_info[] = {
 static_assert(DEFAULT_STORAGE_VERSION_INFO == VERSION_NUMBER, "Check on VERSION_INFO");
 
 // START OF SERIALIZATION VERSION INFO
-const uint64_t LATEST_SERIALIZATION_VERSION_INFO = 7;
+const uint64_t LATEST_SERIALIZATION_VERSION_INFO = 8;
 const uint64_t DEFAULT_SERIALIZATION_VERSION_INFO = 1;
 static const SerializationVersionInfo serialization_version_info[] = {
 	{"v0.10.0", 1},
@@ -114,7 +114,8 @@ static const SerializationVersionInfo serialization_version_info[] = {
 	{"v1.3.2", 5},
 	{"v1.4.0", 6},
 	{"v1.5.0", 7},
-	{"latest", 7},
+	{"v1.6.0", 8},
+	{"latest", 8},
 	{nullptr, 0}
 };
 // END OF SERIALIZATION VERSION INFO
@@ -7,6 +7,7 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/client_data.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/main/settings.hpp"
 #include "duckdb/storage/checkpoint_manager.hpp"
 #include "duckdb/storage/in_memory_block_manager.hpp"
 #include "duckdb/storage/object_cache.hpp"
@@ -437,7 +438,13 @@ void SingleFileStorageCommitState::FlushCommit() {
 	if (state != WALCommitState::IN_PROGRESS) {
 		return;
 	}
-	wal.Flush();
+	if (DBConfig::GetSetting<WALGroupCommitWaitSetting>(wal.GetDatabase().GetDatabase()) > 0) {
+		// group commit: write the flush marker here, the fsync covering it is batched with other
+		// committing transactions by the transaction manager
+		wal.WriteFlushMarker();
+	} else {
+		wal.Flush();
+	}
 	state = WALCommitState::FLUSHED;
 }
 
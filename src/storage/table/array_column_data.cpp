@@ -37,6 +37,15 @@ void ArrayColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnSc
 	child_column->InitializePrefetch(prefetch_state, scan_state.child_states[1], rows * array_size);
 }
 
+void ArrayColumnData::InitializeFetchPrefetch(PrefetchState &prefetch_state, row_t row_id) {
+	ColumnData::InitializeFetchPrefetch(prefetch_state, row_id);
+	validity.InitializeFetchPrefetch(prefetch_state, row_id);
+	// the child rows of an array start at a fixed offset from the array row
+	auto array_size = ArrayType::GetSize(type);
+	const auto child_offset = start + (UnsafeNumericCast<idx_t>(row_id) - start) * array_size;
+	child_column->InitializeFetchPrefetch(prefetch_state, UnsafeNumericCast<row_t>(child_offset));
+}
+
 void ArrayColumnData::InitializeScan(ColumnScanState &state) {
 	// initialize the validity segment
 	D_ASSERT(state.child_states.size() == 2);
@@ -341,6 +350,11 @@ void ArrayColumnData::GetColumnSegmentInfo(const QueryContext &context, idx_t ro
 	child_column->GetColumnSegmentInfo(context, row_group_index, col_path, result);
 }
 
+void ArrayColumnData::SetBlocksMemoryPinned(bool pinned) {
+	validity.SetBlocksMemoryPinned(pinned);
+	child_column->SetBlocksMemoryPinned(pinned);
+}
+
 void ArrayColumnData::Verify(RowGroup &parent) {
 #ifdef DEBUG
 	ColumnData::Verify(parent);
@@ -2,6 +2,7 @@
 #include "duckdb/common/exception/transaction_exception.hpp"
 #include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/function/compression_function.hpp"
+#include "duckdb/main/config.hpp"
 #include "duckdb/planner/table_filter.hpp"
 #include "duckdb/storage/data_pointer.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -173,6 +174,12 @@ void ColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanSta
 	}
 }
 
+void ColumnData::InitializeFetchPrefetch(PrefetchState &prefetch_state, row_t row_id) {
+	auto segment = data.GetSegment(UnsafeNumericCast<idx_t>(row_id));
+	ColumnScanState dummy_state;
+	segment->InitializePrefetch(prefetch_state, dummy_state);
+}
+
 void ColumnData::BeginScanVectorInternal(ColumnScanState &state) {
 	state.previous_states.clear();
 	if (!state.initialized) {
@@ -408,6 +415,32 @@ void ColumnData::Append(ColumnAppendState &state, Vector &vector, idx_t append_c
 	Append(stats->statistics, state, vector, append_count);
 }
 
+void ColumnData::AppendConstantSegment(const Value &value, idx_t append_count) {
+	D_ASSERT(value.IsNull() || value.type() == type);
+	// construct statistics describing the constant value - the segment synthesizes its values from these at scan time
+	auto segment_stats = BaseStatistics::CreateEmpty(type);
+	if (value.IsNull()) {
+		segment_stats.Set(StatsInfo::CAN_HAVE_NULL_VALUES);
+		segment_stats.Set(StatsInfo::CANNOT_HAVE_VALID_VALUES);
+	} else if (type.InternalType() != PhysicalType::BIT) {
+		NumericStats::SetMin(segment_stats, value);
+		NumericStats::SetMax(segment_stats, value);
+	}
+	// create a zero-storage constant segment - identical to what reading back a constant-compressed segment produces
+	auto &config = DBConfig::GetConfig(GetDatabase());
+	auto &function = *config.GetCompressionFunction(CompressionType::COMPRESSION_CONSTANT, type.InternalType());
+	auto segment = make_uniq<ColumnSegment>(GetDatabase(), nullptr, type, ColumnSegmentType::PERSISTENT, start + count,
+	                                        append_count, function, segment_stats.Copy(), INVALID_BLOCK, 0U,
+	                                        block_manager.GetBlockSize());
+	auto l = data.Lock();
+	AppendSegment(l, std::move(segment));
+	count += append_count;
+	if (stats) {
+		lock_guard<mutex> stats_guard(stats_lock);
+		stats->statistics.Merge(segment_stats);
+	}
+}
+
 FilterPropagateResult ColumnData::CheckZonemap(ColumnScanState &state, TableFilter &filter) {
 	if (state.segment_checked) {
 		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
@@ -415,8 +448,9 @@ FilterPropagateResult ColumnData::CheckZonemap(ColumnScanState &state, TableFilt
 	if (!state.current) {
 		return FilterPropagateResult::NO_PRUNING_POSSIBLE;
 	}
-	// for dynamic filters we never consider the segment being "checked" as it can always change
-	state.segment_checked = filter.filter_type != TableFilterType::DYNAMIC_FILTER;
+	// for dynamic filters (also wrapped ones, e.g. the optional Top-N boundary filter)
+	// we never consider the segment being "checked" as they can always change
+	state.segment_checked = !filter.HasDynamicFilters();
 	FilterPropagateResult prune_result;
 	{
 		lock_guard<mutex> l(stats_lock);
@@ -976,6 +1010,14 @@ void ColumnData::GetColumnSegmentInfo(const QueryContext &context, idx_t row_gro
 	}
 }
 
+void ColumnData::SetBlocksMemoryPinned(bool pinned) {
+	for (auto segment = data.GetRootSegment(); segment; segment = data.GetNextSegment(segment)) {
+		if (segment->block) {
+			segment->block->SetMemoryPinned(pinned);
+		}
+	}
+}
+
 void ColumnData::Verify(RowGroup &parent) {
 #ifdef DEBUG
 	D_ASSERT(this->start == parent.start);
@@ -1,5 +1,6 @@
 #include "duckdb/storage/table/column_data_checkpointer.hpp"
 #include "duckdb/main/config.hpp"
+#include "duckdb/main/settings.hpp"
 #include "duckdb/storage/table/update_segment.hpp"
 #include "duckdb/storage/compression/empty_validity.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -162,6 +163,33 @@ void ColumnDataCheckpointer::InitAnalyze() {
 	}
 }
 
+//! Relative cost of decoding a vector with each compression method, normalized to a plain memcpy-style scan.
+//! Used to penalize decode-heavy encodings when compression_scan_bias is set for read-heavy workloads.
+static double DecodeCostWeight(CompressionType type) {
+	switch (type) {
+	case CompressionType::COMPRESSION_RLE:
+	case CompressionType::COMPRESSION_BITPACKING:
+	case CompressionType::COMPRESSION_ROARING:
+		return 1.1;
+	case CompressionType::COMPRESSION_DICTIONARY:
+	case CompressionType::COMPRESSION_DICT_FSST:
+		return 1.3;
+	case CompressionType::COMPRESSION_FSST:
+		return 1.6;
+	case CompressionType::COMPRESSION_ALP:
+	case CompressionType::COMPRESSION_ALPRD:
+		return 1.8;
+	case CompressionType::COMPRESSION_CHIMP:
+	case CompressionType::COMPRESSION_PATAS:
+		return 2.5;
+	case CompressionType::COMPRESSION_ZSTD:
+		return 3.0;
+	default:
+		// constant/uncompressed/empty decode at copy speed
+		return 1.0;
+	}
+}
+
 vector<CheckpointAnalyzeResult> ColumnDataCheckpointer::DetectBestCompressionMethod() {
 	D_ASSERT(!compression_functions.empty());
 	auto &db = storage_manager.GetDatabase();
@@ -218,7 +246,9 @@ vector<CheckpointAnalyzeResult> ColumnDataCheckpointer::DetectBestCompressionMet
 		auto &forced_method = forced_methods[i];
 
 		unique_ptr<AnalyzeState> chosen_state;
+		auto scan_bias = DBConfig::GetSetting<CompressionScanBiasSetting>(db);
 		idx_t best_score = NumericLimits<idx_t>::Maximum();
+		double best_weighted_score = NumericLimits<double>::Maximum();
 		idx_t compression_idx = DConstants::INVALID_INDEX;
 
 		D_ASSERT(functions.size() == states.size());
@@ -241,9 +271,13 @@ vector<CheckpointAnalyzeResult> ColumnDataCheckpointer::DetectBestCompressionMet
 				continue;
 			}
 
-			if (score < best_score || forced_method_found) {
+			// weigh the size estimate by the relative decode cost of the method, scaled by the configured bias
+			auto weighted_score =
+			    static_cast<double>(score) * (1.0 + scan_bias * (DecodeCostWeight(function->type) - 1.0));
+			if (weighted_score < best_weighted_score || forced_method_found) {
 				compression_idx = j;
 				best_score = score;
+				best_weighted_score = weighted_score;
 				chosen_state = std::move(state);
 			}
 			//! If we have found the forced method, we're done
@@ -3,8 +3,10 @@
 #include "duckdb/common/limits.hpp"
 #include "duckdb/common/types/null_value.hpp"
 #include "duckdb/common/types/vector.hpp"
+#include "duckdb/common/vector_operations/vector_operations.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/planner/filter/bloom_filter.hpp"
 #include "duckdb/planner/filter/conjunction_filter.hpp"
 #include "duckdb/planner/filter/constant_filter.hpp"
 #include "duckdb/planner/filter/struct_filter.hpp"
@@ -543,6 +545,34 @@ idx_t ColumnSegment::FilterSelection(SelectionVector &sel, Vector &vector, Unifi
 		}
 		return approved_tuple_count;
 	}
+	case TableFilterType::BLOOM_FILTER: {
+		auto &bloom_filter = filter.Cast<BloomFilter>();
+		if (!bloom_filter.filter_data) {
+			return approved_tuple_count;
+		}
+		auto &bloom_data = *bloom_filter.filter_data;
+		// hash the (selected) values and probe the bloom filter with the hashes
+		Vector hashes(LogicalType::HASH, scan_count);
+		VectorOperations::Hash(vector, hashes, sel, approved_tuple_count);
+		if (hashes.GetVectorType() == VectorType::CONSTANT_VECTOR) {
+			if (!bloom_data.Contains(*ConstantVector::GetData<hash_t>(hashes))) {
+				approved_tuple_count = 0;
+			}
+			return approved_tuple_count;
+		}
+		auto hash_data = FlatVector::GetData<hash_t>(hashes);
+		SelectionVector result_sel(approved_tuple_count);
+		idx_t result_count = 0;
+		for (idx_t i = 0; i < approved_tuple_count; i++) {
+			auto idx = sel.get_index(i);
+			if (bloom_data.Contains(hash_data[idx])) {
+				result_sel.set_index(result_count++, idx);
+			}
+		}
+		sel.Initialize(result_sel);
+		approved_tuple_count = result_count;
+		return result_count;
+	}
 	case TableFilterType::IS_NULL: {
 		return TemplatedNullSelection<true>(vdata, sel, approved_tuple_count);
 	}
@@ -43,6 +43,13 @@ void ListColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnSca
 	child_column->InitializePrefetch(prefetch_state, scan_state.child_states[1], rows * rows_per_list);
 }
 
+void ListColumnData::InitializeFetchPrefetch(PrefetchState &prefetch_state, row_t row_id) {
+	// prefetch the list offsets and validity; the child rows this list points into are only known
+	// after the offsets have actually been read, so we cannot prefetch them here
+	ColumnData::InitializeFetchPrefetch(prefetch_state, row_id);
+	validity.InitializeFetchPrefetch(prefetch_state, row_id);
+}
+
 void ListColumnData::InitializeScan(ColumnScanState &state) {
 	ColumnData::InitializeScan(state);
 
@@ -109,19 +116,17 @@ idx_t ListColumnData::ScanCount(ColumnScanState &state, Vector &result, idx_t co
 	D_ASSERT(scan_count > 0);
 	validity.ScanCount(state.child_states[0], result, count);
 
-	UnifiedVectorFormat offsets;
-	offset_vector.ToUnifiedFormat(scan_count, offsets);
-	auto data = UnifiedVectorFormat::GetData<uint64_t>(offsets);
-	auto last_entry = data[offsets.sel->get_index(scan_count - 1)];
+	// we scanned a flat vector of end offsets (no selection indirection needed)
+	auto data = FlatVector::GetData<uint64_t>(offset_vector);
+	auto last_entry = data[scan_count - 1];
 
 	// shift all offsets so they are 0 at the first entry
 	auto result_data = FlatVector::GetData<list_entry_t>(result);
 	auto base_offset = state.last_offset;
 	idx_t current_offset = 0;
 	for (idx_t i = 0; i < scan_count; i++) {
-		auto offset_index = offsets.sel->get_index(i);
 		result_data[i].offset = current_offset;
-		result_data[i].length = data[offset_index] - current_offset - base_offset;
+		result_data[i].length = data[i] - current_offset - base_offset;
 		current_offset += result_data[i].length;
 	}
 
@@ -148,17 +153,15 @@ void ListColumnData::Skip(ColumnScanState &state, idx_t count) {
 	// skip inside the validity segment
 	validity.Skip(state.child_states[0], count);
 
-	// we need to read the list entries/offsets to figure out how much to skip
-	// note that we only need to read the first and last entry
-	// however, let's just read all "count" entries for now
-	Vector offset_vector(LogicalType::UBIGINT, count);
-	idx_t scan_count = ScanVector(state, offset_vector, count, ScanVectorType::SCAN_FLAT_VECTOR);
-	D_ASSERT(scan_count > 0);
+	// we only need to read the last offset to figure out how much to skip in the child,
+	// so skip over the preceding offsets without decoding them
+	// (NextInternal only advances this column's cursor, not the child states)
+	state.NextInternal(count - 1);
+	Vector offset_vector(LogicalType::UBIGINT, 1);
+	idx_t scan_count = ScanVector(state, offset_vector, 1, ScanVectorType::SCAN_FLAT_VECTOR);
+	D_ASSERT(scan_count == 1);
 
-	UnifiedVectorFormat offsets;
-	offset_vector.ToUnifiedFormat(scan_count, offsets);
-	auto data = UnifiedVectorFormat::GetData<uint64_t>(offsets);
-	auto last_entry = data[offsets.sel->get_index(scan_count - 1)];
+	auto last_entry = FlatVector::GetData<uint64_t>(offset_vector)[scan_count - 1];
 	idx_t child_scan_count = last_entry - state.last_offset;
 	if (child_scan_count == 0) {
 		return;
@@ -401,4 +404,10 @@ void ListColumnData::GetColumnSegmentInfo(const QueryContext &context, idx_t row
 	child_column->GetColumnSegmentInfo(context, row_group_index, col_path, result);
 }
 
+void ListColumnData::SetBlocksMemoryPinned(bool pinned) {
+	ColumnData::SetBlocksMemoryPinned(pinned);
+	validity.SetBlocksMemoryPinned(pinned);
+	child_column->SetBlocksMemoryPinned(pinned);
+}
+
 } // namespace duckdb
@@ -257,6 +257,9 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 	if (!CheckZonemap(filters)) {
 		return false;
 	}
+	if (!CheckRowGroupSample(state)) {
+		return false;
+	}
 
 	state.row_group = this;
 	state.vector_index = vector_offset;
@@ -277,12 +280,25 @@ bool RowGroup::InitializeScanWithOffset(CollectionScanState &state, idx_t vector
 	return true;
 }
 
+bool RowGroup::CheckRowGroupSample(CollectionScanState &state) {
+	auto &sampling = state.GetSamplingInfo();
+	if (!sampling.do_system_sample || sampling.row_group_rate >= 1.0) {
+		return true;
+	}
+	// two-stage system sample: probabilistically admit the entire row group into the sample,
+	// so that the scan skips most row groups entirely at low sampling rates
+	return state.random.NextRandom() <= sampling.row_group_rate;
+}
+
 bool RowGroup::InitializeScan(CollectionScanState &state) {
 	auto &column_ids = state.GetColumnIds();
 	auto &filters = state.GetFilterInfo();
 	if (!CheckZonemap(filters)) {
 		return false;
 	}
+	if (!CheckRowGroupSample(state)) {
+		return false;
+	}
 	state.row_group = this;
 	state.vector_index = 0;
 	state.max_row_group_row =
@@ -352,7 +368,8 @@ unique_ptr<RowGroup> RowGroup::AlterType(RowGroupCollection &new_collection, con
 }
 
 unique_ptr<RowGroup> RowGroup::AddColumn(RowGroupCollection &new_collection, ColumnDefinition &new_column,
-                                         ExpressionExecutor &executor, Vector &result) {
+                                         ExpressionExecutor &executor, Vector &result,
+                                         optional_ptr<const Value> constant_default) {
 	Verify();
 
 	// construct a new column data for the new column
@@ -360,7 +377,13 @@ unique_ptr<RowGroup> RowGroup::AddColumn(RowGroupCollection &new_collection, Col
 	    ColumnData::CreateColumn(GetBlockManager(), GetTableInfo(), GetColumnCount(), start, new_column.Type());
 
 	idx_t rows_to_write = this->count;
-	if (rows_to_write > 0) {
+	if (constant_default) {
+		// the default is a constant - fill the column with a zero-storage constant segment that synthesizes the
+		// default at scan time, making the column addition a metadata-only operation
+		if (rows_to_write > 0) {
+			added_column->AppendConstantSegment(*constant_default, rows_to_write);
+		}
+	} else if (rows_to_write > 0) {
 		DataChunk dummy_chunk;
 
 		ColumnAppendState state;
@@ -434,10 +457,13 @@ FilterPropagateResult RowGroup::CheckRowIdFilter(const TableFilter &filter, idx_
 
 bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 	auto &filter_list = filters.GetFilterList();
+	auto adaptive_filter = filters.GetAdaptiveFilter();
 	// new row group - label all filters as up for grabs again
 	filters.CheckAllFilters();
 	for (idx_t i = 0; i < filter_list.size(); i++) {
-		auto &entry = filter_list[i];
+		// follow the adaptive filter permutation so the most selective filter prunes the row group first
+		auto filter_idx = adaptive_filter ? adaptive_filter->permutation[i] : i;
+		auto &entry = filter_list[filter_idx];
 		auto &filter = entry.filter;
 		auto base_column_index = entry.table_column_index;
 
@@ -447,11 +473,11 @@ bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 		}
 		if (filter.filter_type == TableFilterType::OPTIONAL_FILTER) {
 			// these are only for row group checking, set as always true so we don't check it
-			filters.SetFilterAlwaysTrue(i);
+			filters.SetFilterAlwaysTrue(filter_idx);
 		} else if (prune_result == FilterPropagateResult::FILTER_ALWAYS_TRUE) {
 			// filter is always true - no need to check it
 			// label the filter as always true so we don't need to check it anymore
-			filters.SetFilterAlwaysTrue(i);
+			filters.SetFilterAlwaysTrue(filter_idx);
 		}
 	}
 	return true;
@@ -459,9 +485,16 @@ bool RowGroup::CheckZonemap(ScanFilterInfo &filters) {
 
 bool RowGroup::CheckZonemapSegments(CollectionScanState &state) {
 	auto &filters = state.GetFilterInfo();
-	for (auto &entry : filters.GetFilterList()) {
-		if (entry.IsAlwaysTrue()) {
+	auto &filter_list = filters.GetFilterList();
+	auto adaptive_filter = filters.GetAdaptiveFilter();
+	for (idx_t i = 0; i < filter_list.size(); i++) {
+		// follow the adaptive filter permutation so the most selective filter gets to skip vectors first
+		auto filter_idx = adaptive_filter ? adaptive_filter->permutation[i] : i;
+		auto &entry = filter_list[filter_idx];
+		if (entry.IsAlwaysTrue() && !entry.has_dynamic_filter) {
 			// filter is always true - avoid checking
+			// dynamic filters are the exception: they can tighten while the scan runs (e.g. a Top-N boundary),
+			// so we keep probing the zone maps with them even when they are excluded from row-level filtering
 			continue;
 		}
 		auto column_idx = entry.scan_column_index;
@@ -522,7 +555,7 @@ void RowGroup::TemplatedScan(TransactionData transaction, CollectionScanState &s
 
 		// check the sampling info if we have to sample this chunk
 		if (state.GetSamplingInfo().do_system_sample &&
-		    state.random.NextRandom() > state.GetSamplingInfo().sample_rate) {
+		    state.random.NextRandom() > state.GetSamplingInfo().vector_rate) {
 			NextVector(state);
 			continue;
 		}
@@ -775,6 +808,13 @@ bool RowGroup::Fetch(TransactionData transaction, idx_t row) {
 	return vinfo->Fetch(transaction, row);
 }
 
+void RowGroup::InitializeFetchPrefetch(PrefetchState &prefetch_state, const vector<StorageIndex> &column_ids,
+                                       row_t row_id) {
+	for (auto &column : column_ids) {
+		GetColumn(column).InitializeFetchPrefetch(prefetch_state, row_id);
+	}
+}
+
 void RowGroup::FetchRow(TransactionData transaction, ColumnFetchState &state, const vector<StorageIndex> &column_ids,
                         row_t row_id, DataChunk &result, idx_t result_idx) {
 	for (idx_t col_idx = 0; col_idx < column_ids.size(); col_idx++) {
@@ -1259,6 +1299,12 @@ void RowGroup::GetColumnSegmentInfo(const QueryContext &context, idx_t row_group
 	}
 }
 
+void RowGroup::SetBlocksMemoryPinned(bool pinned) {
+	for (idx_t col_idx = 0; col_idx < GetColumnCount(); col_idx++) {
+		GetColumn(col_idx).SetBlocksMemoryPinned(pinned);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Version Delete Information
 //===--------------------------------------------------------------------===//
@@ -1,9 +1,11 @@
 #include "duckdb/storage/table/row_group_collection.hpp"
 
+#include "duckdb/common/chrono.hpp"
 #include "duckdb/common/serializer/binary_deserializer.hpp"
 #include "duckdb/execution/expression_executor.hpp"
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/execution/task_error_manager.hpp"
+#include "duckdb/function/compression/compression.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/parallel/task_executor.hpp"
 #include "duckdb/planner/constraints/bound_not_null_constraint.hpp"
@@ -66,7 +68,8 @@ RowGroupCollection::RowGroupCollection(shared_ptr<DataTableInfo> info_p, BlockMa
                                        vector<LogicalType> types_p, idx_t row_start_p, idx_t total_rows_p,
                                        idx_t row_group_size_p)
     : block_manager(block_manager), row_group_size(row_group_size_p), total_rows(total_rows_p), info(std::move(info_p)),
-      types(std::move(types_p)), row_start(row_start_p), allocation_size(0), requires_new_row_group(false) {
+      types(std::move(types_p)), row_start(row_start_p), allocation_size(0), shared_scan_cursor(0),
+      requires_new_row_group(false) {
 	row_groups = make_shared_ptr<RowGroupSegmentTree>(*this);
 }
 
@@ -162,11 +165,37 @@ void RowGroupCollection::InitializeScan(const QueryContext &context, CollectionS
 	state.row_groups = row_groups.get();
 	state.max_row = row_start + total_rows;
 	state.Initialize(context, GetTypes());
+	if (!CheckZonemap(state.GetFilterInfo())) {
+		// the filters can never match any row in this collection - leave the scan empty
+		return;
+	}
 	while (row_group && !row_group->InitializeScan(state)) {
 		row_group = row_groups->GetNextSegment(row_group);
 	}
 }
 
+bool RowGroupCollection::CheckZonemap(ScanFilterInfo &filters) {
+	auto &filter_list = filters.GetFilterList();
+	if (filter_list.empty()) {
+		return true;
+	}
+	// check the filters against the table-wide statistics before looking at any row group:
+	// a filter that falls entirely outside the table-level bounds prunes the whole collection at once
+	auto stats_guard = stats.GetLock();
+	for (auto &entry : filter_list) {
+		if (entry.table_column_index == COLUMN_IDENTIFIER_ROW_ID) {
+			// row ids are bounded by max_row already - there is nothing to check at the table level
+			continue;
+		}
+		auto &column_stats = stats.GetStats(*stats_guard, entry.table_column_index);
+		auto prune_result = entry.filter.CheckStatistics(column_stats.Statistics());
+		if (prune_result == FilterPropagateResult::FILTER_ALWAYS_FALSE) {
+			return false;
+		}
+	}
+	return true;
+}
+
 void RowGroupCollection::InitializeCreateIndexScan(CreateIndexScanState &state) {
 	state.segment_lock = row_groups->Lock();
 }
@@ -197,15 +226,37 @@ bool RowGroupCollection::InitializeScanInRowGroup(const QueryContext &context, C
 	return row_group.InitializeScanWithOffset(state, vector_index);
 }
 
-void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &state) {
+void RowGroupCollection::InitializeParallelScan(ParallelCollectionScanState &state, bool attach_to_shared_scan) {
 	state.collection = this;
 	state.current_row_group = row_groups->GetRootSegment();
+	state.start_row_group = nullptr;
+	state.wrapped = false;
+	if (attach_to_shared_scan && state.current_row_group) {
+		// attach to the in-flight pass over this collection: start at the row group that concurrent scans
+		// are currently reading, so that the hot blocks are shared, and wrap around to cover the rest
+		const auto cursor = shared_scan_cursor.load(std::memory_order_relaxed);
+		if (cursor >= row_start && cursor < row_start + total_rows) {
+			auto attach_row_group = row_groups->GetSegment(cursor);
+			if (attach_row_group && attach_row_group != state.current_row_group) {
+				state.current_row_group = attach_row_group;
+				state.start_row_group = attach_row_group;
+			}
+		}
+	}
 	state.vector_index = 0;
 	state.max_row = row_start + total_rows;
 	state.batch_index = 0;
+	state.morsel_row_groups = 1;
+	state.checked_zonemap = false;
 	state.processed_rows = 0;
 }
 
+static int64_t GetMorselTimeNanos() {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(
+	           std::chrono::high_resolution_clock::now().time_since_epoch())
+	    .count();
+}
+
 bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollectionScanState &state,
                                           CollectionScanState &scan_state) {
 	while (true) {
@@ -216,6 +267,24 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 		{
 			// select the next row group to scan from the parallel state
 			lock_guard<mutex> l(state.lock);
+			if (!state.checked_zonemap) {
+				// all threads share the same filters - check them against the table-wide statistics once
+				state.checked_zonemap = true;
+				if (!CheckZonemap(scan_state.GetFilterInfo())) {
+					// the filters can never match any row in this collection - skip it wholesale
+					state.current_row_group = nullptr;
+					state.start_row_group = nullptr;
+				}
+			}
+			if (!state.current_row_group && state.start_row_group && !state.wrapped) {
+				// an attached scan reached the end of the collection -
+				// wrap around to scan the row groups before the attach point
+				state.wrapped = true;
+				state.current_row_group = row_groups->GetRootSegment();
+				if (state.current_row_group == state.start_row_group) {
+					state.current_row_group = nullptr;
+				}
+			}
 			if (!state.current_row_group || state.current_row_group->count == 0) {
 				// no more data left to scan
 				break;
@@ -232,12 +301,47 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 				if (state.vector_index * STANDARD_VECTOR_SIZE >= state.current_row_group->count) {
 					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
 					state.vector_index = 0;
+					if (state.wrapped && state.current_row_group == state.start_row_group) {
+						// an attached scan is done once it reaches its attach point again
+						state.current_row_group = nullptr;
+					}
 				}
 			} else {
-				state.processed_rows += state.current_row_group->count;
+				// publish where this scan is reading so that new scans can attach to the in-flight pass
+				shared_scan_cursor.store(state.current_row_group->start, std::memory_order_relaxed);
+
+				// adapt the unit of work based on how long this thread took to drain its previous unit:
+				// if morsels complete too quickly, scheduling overhead dominates and we hand out more
+				// row groups at a time; if they run long, we shrink back for better load balancing
+				static constexpr idx_t MAXIMUM_MORSEL_ROW_GROUPS = 8;
+				static constexpr int64_t MORSEL_GROW_THRESHOLD_NS = 1000000;    // grow if under 1ms
+				static constexpr int64_t MORSEL_SHRINK_THRESHOLD_NS = 50000000; // shrink if over 50ms
+				const auto now = GetMorselTimeNanos();
+				if (scan_state.last_morsel_start_ns != 0) {
+					const auto duration = now - scan_state.last_morsel_start_ns;
+					if (duration < MORSEL_GROW_THRESHOLD_NS) {
+						state.morsel_row_groups =
+						    MinValue<idx_t>(state.morsel_row_groups * 2, MAXIMUM_MORSEL_ROW_GROUPS);
+					} else if (duration > MORSEL_SHRINK_THRESHOLD_NS && state.morsel_row_groups > 1) {
+						state.morsel_row_groups /= 2;
+					}
+				}
+				scan_state.last_morsel_start_ns = now;
+
+				// hand out up to 'state.morsel_row_groups' row groups as a single unit of work
+				auto last_row_group = state.current_row_group;
+				for (idx_t group_idx = 0; state.current_row_group && group_idx < state.morsel_row_groups;
+				     group_idx++) {
+					last_row_group = state.current_row_group;
+					state.processed_rows += last_row_group->count;
+					state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+					if (state.wrapped && state.current_row_group == state.start_row_group) {
+						// an attached scan is done once it reaches its attach point again
+						state.current_row_group = nullptr;
+					}
+				}
 				vector_index = 0;
-				max_row = state.current_row_group->start + state.current_row_group->count;
-				state.current_row_group = row_groups->GetNextSegment(state.current_row_group);
+				max_row = last_row_group->start + last_row_group->count;
 			}
 			max_row = MinValue<idx_t>(max_row, state.max_row);
 			scan_state.batch_index = ++state.batch_index;
@@ -245,11 +349,20 @@ bool RowGroupCollection::NextParallelScan(ClientContext &context, ParallelCollec
 		D_ASSERT(collection);
 		D_ASSERT(row_group);
 
-		// initialize the scan for this row group
+		// initialize the scan for this unit of work
 		bool need_to_scan =
 		    InitializeScanInRowGroup(context, scan_state, *collection, *row_group, vector_index, max_row);
+		while (!need_to_scan && row_group) {
+			// the first row group of this unit was pruned (e.g. by the zone maps) -
+			// try the remaining row groups within the unit before moving on
+			auto next_row_group = collection->row_groups->GetNextSegment(row_group);
+			row_group = (next_row_group && next_row_group->start < max_row) ? next_row_group : nullptr;
+			if (row_group) {
+				need_to_scan = InitializeScanInRowGroup(context, scan_state, *collection, *row_group, 0, max_row);
+			}
+		}
 		if (!need_to_scan) {
-			// skip this row group
+			// skip this unit of work
 			continue;
 		}
 		return true;
@@ -301,19 +414,41 @@ void RowGroupCollection::Fetch(TransactionData transaction, DataChunk &result, c
                                const Vector &row_identifiers, idx_t fetch_count, ColumnFetchState &state) {
 	// figure out which row_group to fetch from
 	auto row_ids = FlatVector::GetData<row_t>(row_identifiers);
-	idx_t count = 0;
+	vector<RowGroup *> fetch_row_groups;
+	fetch_row_groups.reserve(fetch_count);
 	for (idx_t i = 0; i < fetch_count; i++) {
 		auto row_id = row_ids[i];
-		RowGroup *row_group;
+		RowGroup *row_group = nullptr;
 		{
 			idx_t segment_index;
 			auto l = row_groups->Lock();
-			if (!row_groups->TryGetSegmentIndex(l, UnsafeNumericCast<idx_t>(row_id), segment_index)) {
-				// in parallel append scenarios it is possible for the row_id
-				continue;
+			if (row_groups->TryGetSegmentIndex(l, UnsafeNumericCast<idx_t>(row_id), segment_index)) {
+				row_group = row_groups->GetSegmentByIndex(l, UnsafeNumericCast<int64_t>(segment_index));
+			}
+			// if not: in parallel append scenarios it is possible for the row_id to not exist yet
+		}
+		fetch_row_groups.push_back(row_group);
+	}
+	auto &block_manager = GetBlockManager();
+	if (block_manager.Prefetch() && fetch_count > 0) {
+		// index scans fetch rows in random order: batch the I/O for the entire row id vector up
+		// front so the per-row fetches below hit loaded blocks instead of stalling per row group
+		PrefetchState prefetch_state;
+		for (idx_t i = 0; i < fetch_count; i++) {
+			if (fetch_row_groups[i]) {
+				fetch_row_groups[i]->InitializeFetchPrefetch(prefetch_state, column_ids, row_ids[i]);
 			}
-			row_group = row_groups->GetSegmentByIndex(l, UnsafeNumericCast<int64_t>(segment_index));
 		}
+		auto &buffer_manager = block_manager.buffer_manager;
+		buffer_manager.Prefetch(prefetch_state.blocks);
+	}
+	idx_t count = 0;
+	for (idx_t i = 0; i < fetch_count; i++) {
+		auto row_group = fetch_row_groups[i];
+		if (!row_group) {
+			continue;
+		}
+		auto row_id = row_ids[i];
 		if (!row_group->Fetch(transaction, UnsafeNumericCast<idx_t>(row_id) - row_group->start)) {
 			continue;
 		}
@@ -665,6 +800,15 @@ void RowGroupCollection::Update(TransactionData transaction, DataTable &data_tab
 			stats.MergeStats(*l, column_id.index, *row_group->GetStatistics(column_id.index));
 		}
 	} while (pos < updates.size());
+
+	// updates write new values into existing rows - also fold these into the distinct statistics,
+	// so that update-heavy workloads do not leave the distinct counts stale until the next full scan
+	Vector hashes(LogicalType::HASH);
+	auto l = stats.GetLock();
+	for (idx_t i = 0; i < column_ids.size(); i++) {
+		auto &column_stats = stats.GetStats(*l, column_ids[i].index);
+		column_stats.UpdateDistinctStatistics(updates.data[i], updates.size(), hashes);
+	}
 }
 
 void RowGroupCollection::RemoveFromIndexes(const QueryContext &context, TableIndexList &indexes,
@@ -784,6 +928,15 @@ void RowGroupCollection::UpdateColumn(TransactionData transaction, DataTable &da
 		auto primary_column_idx = column_path[0];
 		row_group->MergeIntoStatistics(primary_column_idx, stats.GetStats(*lock, primary_column_idx).Statistics());
 	} while (pos < updates.size());
+
+	if (column_path.size() == 1) {
+		// a plain (non-nested) column update - fold the new values into the distinct statistics as well
+		// nested updates need not be considered here, as we do not keep distinct statistics for nested types
+		Vector hashes(LogicalType::HASH);
+		auto lock = stats.GetLock();
+		auto &column_stats = stats.GetStats(*lock, column_path[0]);
+		column_stats.UpdateDistinctStatistics(updates.data[0], updates.size(), hashes);
+	}
 }
 
 //===--------------------------------------------------------------------===//
@@ -1064,7 +1217,25 @@ bool RowGroupCollection::ScheduleVacuumTasks(CollectionCheckpointState &checkpoi
 		}
 	}
 	if (!perform_merge) {
-		return false;
+		// no neighboring merge is possible - check if this row group is sparse enough that a
+		// standalone rewrite pays off: after large DELETEs a mostly-empty row group wastes I/O
+		// on every scan and keeps its version masks pinned in memory
+		// we rewrite a row group by itself once less than half of its rows are still alive
+		static constexpr const double SPARSE_REWRITE_LIVENESS_THRESHOLD = 0.5;
+		auto live_rows = state.row_group_counts[segment_idx];
+		idx_t total_rows = checkpoint_state.segments[segment_idx].node->count;
+		if (live_rows < STANDARD_VECTOR_SIZE || total_rows == 0 ||
+		    double(live_rows) / double(total_rows) >= SPARSE_REWRITE_LIVENESS_THRESHOLD) {
+			return false;
+		}
+		DUCKDB_LOG(checkpoint_state.writer.GetDatabase(), CheckpointLogType, GetAttached(), *info, segment_idx, 1, 1,
+		           live_rows, state.row_start);
+		auto rewrite_task = make_uniq<VacuumTask>(checkpoint_state, state, segment_idx, 1, 1, live_rows,
+		                                          state.row_start);
+		checkpoint_state.executor->ScheduleTask(std::move(rewrite_task));
+		state.next_vacuum_idx = segment_idx + 1;
+		state.row_start += live_rows;
+		return true;
 	}
 	// schedule the vacuum task
 	DUCKDB_LOG(checkpoint_state.writer.GetDatabase(), CheckpointLogType, GetAttached(), *info, segment_idx, merge_count,
@@ -1251,6 +1422,17 @@ vector<PartitionStatistics> RowGroupCollection::GetPartitionStats() const {
 	return result;
 }
 
+bool RowGroupCollection::HasChanges() const {
+	for (auto &row_group : row_groups->Segments()) {
+		// an approximate partition count indicates (possibly unloaded) deletes,
+		// HasChanges additionally covers outstanding column updates
+		if (row_group.GetPartitionStats().count_type != CountType::COUNT_EXACT || row_group.HasChanges()) {
+			return true;
+		}
+	}
+	return false;
+}
+
 //===--------------------------------------------------------------------===//
 // GetColumnSegmentInfo
 //===--------------------------------------------------------------------===//
@@ -1263,6 +1445,13 @@ vector<ColumnSegmentInfo> RowGroupCollection::GetColumnSegmentInfo(const QueryCo
 	return result;
 }
 
+void RowGroupCollection::SetBlocksMemoryPinned(bool pinned) {
+	auto lock = row_groups->Lock();
+	for (auto &row_group : row_groups->Segments(lock)) {
+		row_group.SetBlocksMemoryPinned(pinned);
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Alter
 //===--------------------------------------------------------------------===//
@@ -1281,10 +1470,23 @@ shared_ptr<RowGroupCollection> RowGroupCollection::AddColumn(ClientContext &cont
 	auto lock = result->stats.GetLock();
 	auto &new_column_stats = result->stats.GetStats(*lock, new_column_idx);
 
+	// check if the default folds to a constant that constant segments can represent - if so we fill the column with
+	// zero-storage constant segments that synthesize the default at scan time instead of materializing it per row
+	optional_ptr<const Value> constant_default;
+	Value constant_default_value;
+	auto &default_expr = *default_executor.expressions[0];
+	if (ConstantFun::TypeIsSupported(new_column.GetType().InternalType()) && default_expr.IsFoldable() &&
+	    ExpressionExecutor::TryEvaluateScalar(context, default_expr, constant_default_value)) {
+		if (constant_default_value.IsNull() || constant_default_value.type() == new_column.GetType()) {
+			constant_default = &constant_default_value;
+		}
+	}
+
 	// fill the column with its DEFAULT value, or NULL if none is specified
 	auto new_stats = make_uniq<SegmentStatistics>(new_column.GetType());
 	for (auto &current_row_group : row_groups->Segments()) {
-		auto new_row_group = current_row_group.AddColumn(*result, new_column, default_executor, default_vector);
+		auto new_row_group =
+		    current_row_group.AddColumn(*result, new_column, default_executor, default_vector, constant_default);
 		// merge in the statistics
 		new_row_group->MergeIntoStatistics(new_column_idx, new_column_stats.Statistics());
 
@@ -1418,4 +1620,10 @@ void RowGroupCollection::SetDistinct(column_t column_id, unique_ptr<DistinctStat
 	stats.GetStats(*stats_lock, column_id).SetDistinct(std::move(distinct_stats));
 }
 
+void RowGroupCollection::SetStatistics(column_t column_id, const BaseStatistics &new_stats) {
+	D_ASSERT(column_id != COLUMN_IDENTIFIER_ROW_ID);
+	auto stats_lock = stats.GetLock();
+	stats.GetStats(*stats_lock, column_id).Statistics().Copy(new_stats);
+}
+
 } // namespace duckdb
@@ -17,6 +17,9 @@ FilterPropagateResult RowIdColumnData::CheckZonemap(ColumnScanState &state, Tabl
 void RowIdColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnScanState &scan_state, idx_t rows) {
 }
 
+void RowIdColumnData::InitializeFetchPrefetch(PrefetchState &prefetch_state, row_t row_id) {
+}
+
 void RowIdColumnData::InitializeScan(ColumnScanState &state) {
 	InitializeScanWithOffset(state, start);
 }
@@ -8,6 +8,8 @@
 #include "duckdb/storage/table/row_group_segment_tree.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
 
+#include <cmath>
+
 namespace duckdb {
 
 TableScanState::TableScanState() : table_state(*this), local_state(*this) {
@@ -26,6 +28,15 @@ void TableScanState::Initialize(vector<StorageIndex> column_ids_p, optional_ptr<
 	if (table_sampling) {
 		sampling_info.do_system_sample = table_sampling->method == SampleMethod::SYSTEM_SAMPLE;
 		sampling_info.sample_rate = table_sampling->sample_size.GetValue<double>() / 100.0;
+		if (sampling_info.do_system_sample && sampling_info.sample_rate < 0.25) {
+			// for small sampling rates we sample at two granularities: whole row groups are admitted with
+			// probability sqrt(rate) and vectors within admitted row groups with probability sqrt(rate),
+			// so the number of row groups touched shrinks along with the sampling rate
+			sampling_info.row_group_rate = std::sqrt(sampling_info.sample_rate);
+			sampling_info.vector_rate = sampling_info.sample_rate / sampling_info.row_group_rate;
+		} else {
+			sampling_info.vector_rate = sampling_info.sample_rate;
+		}
 		if (table_sampling->seed.IsValid()) {
 			table_state.random.SetSeed(table_sampling->seed.GetIndex());
 		}
@@ -50,7 +61,7 @@ ScanSamplingInfo &TableScanState::GetSamplingInfo() {
 
 ScanFilter::ScanFilter(ClientContext &context, idx_t index, const vector<StorageIndex> &column_ids, TableFilter &filter)
     : scan_column_index(index), table_column_index(column_ids[index].GetPrimaryIndex()), filter(filter),
-      always_true(false) {
+      always_true(false), has_dynamic_filter(filter.HasDynamicFilters()) {
 	filter_state = TableFilterState::Initialize(context, filter);
 }
 
@@ -171,7 +182,23 @@ TableScanOptions &CollectionScanState::GetOptions() {
 }
 
 ParallelCollectionScanState::ParallelCollectionScanState()
-    : collection(nullptr), current_row_group(nullptr), processed_rows(0) {
+    : collection(nullptr), current_row_group(nullptr), morsel_row_groups(1), start_row_group(nullptr), wrapped(false),
+      checked_zonemap(false), processed_rows(0) {
+}
+
+bool ParallelTableScanState::HasRowBudgetRemaining() const {
+	// unbounded scans have a budget of DConstants::INVALID_INDEX, which always compares greater than zero
+	return row_budget.load() > 0;
+}
+
+void ParallelTableScanState::ConsumeRowBudget(idx_t count) {
+	auto remaining = row_budget.load();
+	while (remaining != DConstants::INVALID_INDEX) {
+		auto new_remaining = remaining - MinValue<idx_t>(count, remaining);
+		if (row_budget.compare_exchange_weak(remaining, new_remaining)) {
+			break;
+		}
+	}
 }
 
 CollectionScanState::CollectionScanState(TableScanState &parent_p)
@@ -39,6 +39,11 @@ void StandardColumnData::InitializePrefetch(PrefetchState &prefetch_state, Colum
 	validity.InitializePrefetch(prefetch_state, scan_state.child_states[0], rows);
 }
 
+void StandardColumnData::InitializeFetchPrefetch(PrefetchState &prefetch_state, row_t row_id) {
+	ColumnData::InitializeFetchPrefetch(prefetch_state, row_id);
+	validity.InitializeFetchPrefetch(prefetch_state, row_id);
+}
+
 void StandardColumnData::InitializeScan(ColumnScanState &state) {
 	ColumnData::InitializeScan(state);
 
@@ -134,6 +139,11 @@ void StandardColumnData::AppendData(BaseStatistics &stats, ColumnAppendState &st
 	validity.AppendData(stats, state.child_appends[0], vdata, count);
 }
 
+void StandardColumnData::AppendConstantSegment(const Value &value, idx_t count) {
+	ColumnData::AppendConstantSegment(value, count);
+	validity.AppendConstantSegment(value, count);
+}
+
 void StandardColumnData::RevertAppend(row_t start_row) {
 	ColumnData::RevertAppend(start_row);
 
@@ -304,6 +314,11 @@ void StandardColumnData::GetColumnSegmentInfo(const QueryContext &context, duckd
 	validity.GetColumnSegmentInfo(context, row_group_index, std::move(col_path), result);
 }
 
+void StandardColumnData::SetBlocksMemoryPinned(bool pinned) {
+	ColumnData::SetBlocksMemoryPinned(pinned);
+	validity.SetBlocksMemoryPinned(pinned);
+}
+
 void StandardColumnData::Verify(RowGroup &parent) {
 #ifdef DEBUG
 	ColumnData::Verify(parent);
@@ -53,6 +53,13 @@ void StructColumnData::InitializePrefetch(PrefetchState &prefetch_state, ColumnS
 	}
 }
 
+void StructColumnData::InitializeFetchPrefetch(PrefetchState &prefetch_state, row_t row_id) {
+	validity.InitializeFetchPrefetch(prefetch_state, row_id);
+	for (auto &sub_column : sub_columns) {
+		sub_column->InitializeFetchPrefetch(prefetch_state, row_id);
+	}
+}
+
 void StructColumnData::InitializeScan(ColumnScanState &state) {
 	D_ASSERT(state.child_states.size() == sub_columns.size() + 1);
 	state.row_index = 0;
@@ -373,6 +380,13 @@ void StructColumnData::GetColumnSegmentInfo(const QueryContext &context, idx_t r
 	}
 }
 
+void StructColumnData::SetBlocksMemoryPinned(bool pinned) {
+	validity.SetBlocksMemoryPinned(pinned);
+	for (auto &sub_column : sub_columns) {
+		sub_column->SetBlocksMemoryPinned(pinned);
+	}
+}
+
 void StructColumnData::Verify(RowGroup &parent) {
 #ifdef DEBUG
 	ColumnData::Verify(parent);
@@ -5,6 +5,7 @@
 #include "duckdb/storage/statistics/distinct_statistics.hpp"
 #include "duckdb/storage/table/column_data.hpp"
 #include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/duck_transaction_manager.hpp"
 #include "duckdb/transaction/update_info.hpp"
 #include "duckdb/transaction/undo_buffer.hpp"
 #include "duckdb/storage/data_table.hpp"
@@ -596,6 +597,45 @@ void UpdateSegment::CleanupUpdate(UpdateInfo &info) {
 	CleanupUpdateInternal(*lock_handle, info);
 }
 
+//===--------------------------------------------------------------------===//
+// Consolidate Update Chain
+//===--------------------------------------------------------------------===//
+void UpdateSegment::ConsolidateUpdateChain(const StorageLockKey &lock, DataTable &data_table, UpdateInfo &base_info) {
+	// the base info at the root of the chain always carries the latest committed values - the entries behind it only
+	// exist so that older snapshots can reconstruct the versions they saw
+	// once a committed entry's version is at or below the lowest active start time no present or future transaction
+	// can apply it anymore, yet every scan still walks over it until the undo buffer cleanup eventually unlinks it
+	// under sustained updates to the same vector these dead entries pile up, so once the chain grows past
+	// CHAIN_CONSOLIDATION_THRESHOLD we prune them eagerly here instead of waiting for the cleanup
+	idx_t chain_length = 0;
+	auto chain_ptr = base_info.next;
+	while (chain_ptr.IsSet()) {
+		auto pin = chain_ptr.Pin();
+		chain_ptr = UpdateInfo::Get(pin).next;
+		chain_length++;
+	}
+	if (chain_length < CHAIN_CONSOLIDATION_THRESHOLD) {
+		return;
+	}
+	auto &transaction_manager = DuckTransactionManager::Get(data_table.GetAttached());
+	auto lowest_active_start = transaction_manager.LowestActiveStart();
+	chain_ptr = base_info.next;
+	while (chain_ptr.IsSet()) {
+		auto pin = chain_ptr.Pin();
+		auto &info = UpdateInfo::Get(pin);
+		chain_ptr = info.next;
+		if (info.version_number >= TRANSACTION_ID_START || info.version_number > lowest_active_start) {
+			// either still in-flight, or some active snapshot can still see this entry
+			continue;
+		}
+		// unlink the entry - the undo buffer still owns the allocation, and clearing the links here turns the
+		// eventual CleanupUpdate call for this entry into a no-op
+		CleanupUpdateInternal(lock, info);
+		info.prev = UndoBufferPointer();
+		info.next = UndoBufferPointer();
+	}
+}
+
 //===--------------------------------------------------------------------===//
 // Check for conflicts in update
 //===--------------------------------------------------------------------===//
@@ -1355,6 +1395,10 @@ void UpdateSegment::Update(TransactionData transaction, DataTable &data_table, i
 
 		base_info.Verify();
 		node->Verify();
+
+		// repeated updates to a hot vector keep growing the version chain - prune entries that no transaction can
+		// see anymore once it gets long
+		ConsolidateUpdateChain(*write_lock, data_table, base_info);
 	} else {
 
 		// there is no version info yet: create the top level update info and fill it with the updates
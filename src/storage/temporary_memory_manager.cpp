@@ -1,7 +1,9 @@
 #include "duckdb/storage/temporary_memory_manager.hpp"
 
+#include "duckdb/common/file_system.hpp"
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
+#include "duckdb/main/cost_calibration.hpp"
 #include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/storage/buffer_manager.hpp"
 
@@ -99,6 +101,14 @@ void TemporaryMemoryManager::UpdateConfiguration(ClientContext &context) {
 	num_threads = NumericCast<idx_t>(task_scheduler.NumberOfThreads());
 	num_connections = ConnectionManager::Get(context).GetConnectionCount();
 	query_max_memory = buffer_manager.GetQueryMaxMemory();
+
+	const auto cost_constants = CostCalibration::Get(FileSystem::GetFileSystem(context));
+	if (cost_constants.calibrated && cost_constants.scan_ns_per_tuple > 0) {
+		// On machines where re-materializing spilled data is expensive relative to scanning,
+		// weigh the materialization penalties of the states more heavily (and vice versa)
+		const auto ratio = cost_constants.materialization_ns_per_tuple / cost_constants.scan_ns_per_tuple;
+		materialization_cost_multiplier = MinValue(MaxValue(ratio, 0.25), 4.0);
+	}
 }
 
 TemporaryMemoryManager &TemporaryMemoryManager::Get(ClientContext &context) {
@@ -186,7 +196,7 @@ static idx_t ComputeInitialReservation(const TemporaryMemoryState &temporary_mem
 }
 
 static void ComputeDerivatives(const vector<reference<const TemporaryMemoryState>> &states, const vector<idx_t> &res,
-                               vector<double> &der, const idx_t n) {
+                               vector<double> &der, const idx_t n, const double penalty_multiplier) {
 	// Cost function takes "throughput" (reservation / size) of each operator as its principal input
 	double prod_siz = 1;
 	double prod_res = 1;
@@ -195,7 +205,7 @@ static void ComputeDerivatives(const vector<reference<const TemporaryMemoryState
 		auto &state = states[i].get();
 		const auto resd = static_cast<double>(res[i]);
 		const auto sizd = static_cast<double>(MaxValue<idx_t>(state.GetRemainingSize(), 1));
-		const auto pend = static_cast<double>(state.GetMaterializationPenalty());
+		const auto pend = penalty_multiplier * static_cast<double>(state.GetMaterializationPenalty());
 		prod_res *= resd;
 		prod_siz *= sizd;
 		mat_cost += pend * (1 - resd / sizd); // Materialization cost: sum of (1 - throughput)
@@ -212,7 +222,7 @@ static void ComputeDerivatives(const vector<reference<const TemporaryMemoryState
 		auto &state = states[i].get();
 		const auto resd = static_cast<double>(res[i]);
 		const auto sizd = static_cast<double>(MaxValue<idx_t>(state.GetRemainingSize(), 1));
-		const auto pend = static_cast<double>(state.GetMaterializationPenalty());
+		const auto pend = penalty_multiplier * static_cast<double>(state.GetMaterializationPenalty());
 		der[i] = intermediate / resd - pend * tp_mult / sizd;
 	}
 }
@@ -253,7 +263,7 @@ idx_t TemporaryMemoryManager::ComputeReservation(const TemporaryMemoryState &tem
 	const idx_t optimization_iterations = OPTIMIZATION_ITERATIONS_MULTIPLIER * n;
 	for (idx_t opt_idx = 0; opt_idx < optimization_iterations; opt_idx++) {
 		D_ASSERT(remaining_memory != 0);
-		ComputeDerivatives(states, res, der, n);
+		ComputeDerivatives(states, res, der, n, materialization_cost_multiplier);
 
 		// Find the index of the state with the lowest derivative
 		idx_t min_idx = 0;
@@ -304,7 +314,7 @@ idx_t TemporaryMemoryManager::ComputeReservation(const TemporaryMemoryState &tem
 		idxs[i] = i;
 		max_res[i] = states[i].get().GetRemainingSize() - 1;
 	}
-	ComputeDerivatives(states, max_res, der, n);
+	ComputeDerivatives(states, max_res, der, n, materialization_cost_multiplier);
 	std::sort(idxs.begin(), idxs.end(), [&](const idx_t &lhs, const idx_t &rhs) { return der[lhs] < der[rhs]; });
 
 	// Loop through sorted indices until we encounter the state index
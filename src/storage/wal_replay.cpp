@@ -19,6 +19,8 @@
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/connection.hpp"
 #include "duckdb/main/database.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
 #include "duckdb/parser/parsed_data/create_schema_info.hpp"
 #include "duckdb/parser/parsed_data/create_view_info.hpp"
@@ -26,6 +28,7 @@
 #include "duckdb/planner/binder.hpp"
 #include "duckdb/planner/expression_binder/index_binder.hpp"
 #include "duckdb/planner/parsed_data/bound_create_table_info.hpp"
+#include "zstd.h"
 #include "duckdb/storage/single_file_block_manager.hpp"
 #include "duckdb/storage/storage_manager.hpp"
 #include "duckdb/storage/table/column_data.hpp"
@@ -111,6 +114,49 @@ public:
 			return WriteAheadLogDeserializer(state_p, std::move(buffer), size, deserialize_only);
 		}
 
+		if (state_p.wal_version == 4) {
+			// version 4 frames entries like version 2, with an extra uncompressed-size field:
+			// a non-zero value means the payload is zstd-compressed
+			auto size = stream.Read<uint64_t>();
+			auto stored_checksum = stream.Read<uint64_t>();
+			auto uncompressed_size = stream.Read<uint64_t>();
+			auto offset = stream.CurrentOffset();
+			auto file_size = stream.FileSize();
+
+			if (offset + size > file_size) {
+				throw SerializationException(
+				    "Corrupt WAL file: entry size exceeded remaining data in file at byte position %llu "
+				    "(found entry with size %llu bytes, file size %llu bytes)",
+				    offset, size, file_size);
+			}
+
+			// allocate a buffer and read data into the buffer
+			auto buffer = unique_ptr<data_t[]>(new data_t[size]);
+			stream.ReadData(buffer.get(), size);
+
+			// compute and verify the checksum over the stored payload
+			auto computed_checksum = Checksum(buffer.get(), size);
+			if (stored_checksum != computed_checksum) {
+				throw IOException("Corrupt WAL file: entry at byte position %llu computed checksum %llu does not match "
+				                  "stored checksum %llu",
+				                  offset, computed_checksum, stored_checksum);
+			}
+
+			if (uncompressed_size != 0) {
+				// the payload is compressed: decompress it
+				auto decompressed = unique_ptr<data_t[]>(new data_t[uncompressed_size]);
+				auto result =
+				    duckdb_zstd::ZSTD_decompress(decompressed.get(), uncompressed_size, buffer.get(), size);
+				if (duckdb_zstd::ZSTD_isError(result) || result != uncompressed_size) {
+					throw IOException("Corrupt WAL file: failed to decompress entry at byte position %llu", offset);
+				}
+				buffer = std::move(decompressed);
+				size = uncompressed_size;
+			}
+
+			return WriteAheadLogDeserializer(state_p, std::move(buffer), size, deserialize_only);
+		}
+
 		if (state_p.wal_version == 3) {
 			auto &database = state_p.db.GetDatabase();
 			//! Version 3 means that the WAL is encrypted
@@ -178,8 +224,9 @@ public:
 			return WriteAheadLogDeserializer(state_p, std::move(out_buffer), size, deserialize_only);
 		}
 
-		throw IOException("Failed to read WAL of version %llu - can only read version 1, 2 and 3 (encrypted)",
-		                  state_p.wal_version);
+		throw IOException(
+		    "Failed to read WAL of version %llu - can only read version 1, 2, 3 (encrypted) and 4 (compressed)",
+		    state_p.wal_version);
 	}
 
 	bool ReplayEntry() {
@@ -253,6 +300,80 @@ private:
 	optional_idx expected_checkpoint_id;
 };
 
+//===--------------------------------------------------------------------===//
+// Parallel checksum verification
+//===--------------------------------------------------------------------===//
+//! A raw, length-prefixed WAL entry (WAL version 2 or 4) that has been read but not yet verified
+struct WALEntryFrame {
+	unique_ptr<data_t[]> data;
+	idx_t size = 0;
+	uint64_t stored_checksum = 0;
+	idx_t offset = 0;
+	//! Decompressed payload size for compressed version 4 entries - zero means the payload is raw
+	uint64_t uncompressed_size = 0;
+};
+
+//! How many payload bytes we read per batch before verifying the checksums of the batch
+static constexpr idx_t WAL_CHECKSUM_BATCH_SIZE = 32ULL * 1024 * 1024;
+
+//! Task that verifies the checksums of a range of WAL entry frames
+class WALChecksumTask : public BaseExecutorTask {
+public:
+	WALChecksumTask(TaskExecutor &executor, vector<WALEntryFrame> &frames, idx_t frame_start, idx_t frame_end)
+	    : BaseExecutorTask(executor), frames(frames), frame_start(frame_start), frame_end(frame_end) {
+	}
+
+	void ExecuteTask() override {
+		for (idx_t i = frame_start; i < frame_end; i++) {
+			auto &frame = frames[i];
+			auto computed_checksum = Checksum(frame.data.get(), frame.size);
+			if (frame.stored_checksum != computed_checksum) {
+				throw IOException("Corrupt WAL file: entry at byte position %llu computed checksum %llu does not "
+				                  "match stored checksum %llu",
+				                  frame.offset, computed_checksum, frame.stored_checksum);
+			}
+			if (frame.uncompressed_size != 0) {
+				// decompress the verified payload within the task, so decompression parallelizes as well
+				auto decompressed = unique_ptr<data_t[]>(new data_t[frame.uncompressed_size]);
+				auto result = duckdb_zstd::ZSTD_decompress(decompressed.get(), frame.uncompressed_size,
+				                                           frame.data.get(), frame.size);
+				if (duckdb_zstd::ZSTD_isError(result) || result != frame.uncompressed_size) {
+					throw IOException("Corrupt WAL file: failed to decompress entry at byte position %llu",
+					                  frame.offset);
+				}
+				frame.data = std::move(decompressed);
+				frame.size = frame.uncompressed_size;
+			}
+		}
+	}
+
+	string TaskType() const override {
+		return "WALChecksumTask";
+	}
+
+private:
+	vector<WALEntryFrame> &frames;
+	idx_t frame_start;
+	idx_t frame_end;
+};
+
+static void ReadWALEntryFrame(BufferedFileReader &stream, WALEntryFrame &frame, bool has_compression) {
+	frame.size = stream.Read<uint64_t>();
+	frame.stored_checksum = stream.Read<uint64_t>();
+	if (has_compression) {
+		frame.uncompressed_size = stream.Read<uint64_t>();
+	}
+	frame.offset = stream.CurrentOffset();
+	auto file_size = stream.FileSize();
+	if (frame.offset + frame.size > file_size) {
+		throw SerializationException("Corrupt WAL file: entry size exceeded remaining data in file at byte position "
+		                             "%llu (found entry with size %llu bytes, file size %llu bytes)",
+		                             frame.offset, frame.size, file_size);
+	}
+	frame.data = unique_ptr<data_t[]>(new data_t[frame.size]);
+	stream.ReadData(frame.data.get(), frame.size);
+}
+
 //===--------------------------------------------------------------------===//
 // Replay
 //===--------------------------------------------------------------------===//
@@ -288,16 +409,61 @@ unique_ptr<WriteAheadLog> WriteAheadLog::ReplayInternal(AttachedDatabase &databa
 	// first deserialize the WAL to look for a checkpoint flag
 	// if there is a checkpoint flag, we might have already flushed the contents of the WAL to disk
 	ReplayState checkpoint_state(database, *con.context);
+	auto &scheduler = TaskScheduler::GetScheduler(database.GetDatabase());
 	try {
 		while (true) {
-			// read the current entry (deserialize only)
-			auto deserializer = WriteAheadLogDeserializer::Open(checkpoint_state, reader, true);
-			if (deserializer.ReplayEntry()) {
-				// check if the file is exhausted
-				if (reader.Finished()) {
-					// we finished reading the file: break
-					break;
+			if ((checkpoint_state.wal_version != 2 && checkpoint_state.wal_version != 4) ||
+			    scheduler.NumberOfThreads() <= 1) {
+				// unframed (version 1) or encrypted (version 3) entries, or no worker threads:
+				// read the current entry (deserialize only)
+				auto deserializer = WriteAheadLogDeserializer::Open(checkpoint_state, reader, true);
+				if (deserializer.ReplayEntry()) {
+					// check if the file is exhausted
+					if (reader.Finished()) {
+						// we finished reading the file: break
+						break;
+					}
+				}
+				continue;
+			}
+			// version 2 and 4 entries are length-prefixed and checksummed: read a batch of raw entries,
+			// verify their checksums (and decompress version 4 payloads) in parallel, then deserialize in order
+			vector<WALEntryFrame> frames;
+			ErrorData read_error;
+			try {
+				idx_t batch_bytes = 0;
+				while (batch_bytes < WAL_CHECKSUM_BATCH_SIZE && !reader.Finished()) {
+					WALEntryFrame frame;
+					ReadWALEntryFrame(reader, frame, checkpoint_state.wal_version == 4);
+					batch_bytes += frame.size;
+					frames.push_back(std::move(frame));
 				}
+			} catch (std::exception &ex) {
+				// remember the error, but still deserialize the complete frames of this batch -
+				// the apply phase relies on every entry it will replay having been deserialized here
+				// (e.g. to mark the on-disk blocks it references as used)
+				read_error = ErrorData(ex);
+			}
+			// verify the checksums of the batch in parallel
+			TaskExecutor executor(scheduler);
+			auto thread_count = NumericCast<idx_t>(scheduler.NumberOfThreads());
+			auto frames_per_task = MaxValue<idx_t>((frames.size() + thread_count - 1) / thread_count, 1);
+			for (idx_t frame_idx = 0; frame_idx < frames.size(); frame_idx += frames_per_task) {
+				auto frame_end = MinValue<idx_t>(frame_idx + frames_per_task, frames.size());
+				executor.ScheduleTask(make_uniq<WALChecksumTask>(executor, frames, frame_idx, frame_end));
+			}
+			executor.WorkOnTasks();
+			// deserialize the verified entries in order
+			for (auto &frame : frames) {
+				WriteAheadLogDeserializer deserializer(checkpoint_state, std::move(frame.data), frame.size, true);
+				deserializer.ReplayEntry();
+			}
+			if (read_error.HasError()) {
+				read_error.Throw();
+			}
+			if (reader.Finished()) {
+				// we finished reading the file: break
+				break;
 			}
 		}
 	} catch (std::exception &ex) { // LCOV_EXCL_START
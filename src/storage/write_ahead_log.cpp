@@ -13,6 +13,7 @@
 #include "duckdb/common/encryption_key_manager.hpp"
 #include "duckdb/common/serializer/binary_serializer.hpp"
 #include "duckdb/common/serializer/memory_stream.hpp"
+#include "zstd.h"
 #include "duckdb/execution/index/bound_index.hpp"
 #include "duckdb/parser/constraints/unique_constraint.hpp"
 #include "duckdb/parser/parsed_data/alter_table_info.hpp"
@@ -27,6 +28,13 @@ namespace duckdb {
 
 constexpr uint64_t WAL_VERSION_NUMBER = 2;
 constexpr uint64_t WAL_ENCRYPTED_VERSION_NUMBER = 3;
+//! Version 4 frames entries like version 2, but adds an uncompressed-size field so large
+//! entry payloads (bulk inserts in particular) can be zstd-compressed before the write
+constexpr uint64_t WAL_COMPRESSED_VERSION_NUMBER = 4;
+//! Entries smaller than this are not worth compressing and are stored raw
+constexpr idx_t WAL_COMPRESSION_THRESHOLD = 4096;
+//! We use the lowest zstd level: WAL writes sit on the commit path, so speed beats ratio
+constexpr int WAL_COMPRESSION_LEVEL = 1;
 
 WriteAheadLog::WriteAheadLog(AttachedDatabase &database, const string &wal_path, idx_t wal_size,
                              WALInitState init_state)
@@ -131,13 +139,30 @@ public:
 
 		auto data = memory_stream.GetData();
 		auto size = memory_stream.GetPosition();
-		// compute the checksum over the entry
+		// try to compress large entries - bulk insert payloads dominate WAL volume and compress well
+		uint64_t uncompressed_size = 0;
+		if (size >= WAL_COMPRESSION_THRESHOLD) {
+			auto bound = duckdb_zstd::ZSTD_compressBound(size);
+			if (!compression_buffer.IsSet() || compression_buffer.GetSize() < bound) {
+				compression_buffer = Allocator::Get(wal.GetDatabase()).Allocate(bound);
+			}
+			auto compressed_size =
+			    duckdb_zstd::ZSTD_compress(compression_buffer.get(), bound, data, size, WAL_COMPRESSION_LEVEL);
+			if (!duckdb_zstd::ZSTD_isError(compressed_size) && compressed_size < size) {
+				uncompressed_size = size;
+				data = compression_buffer.get();
+				size = compressed_size;
+			}
+		}
+		// compute the checksum over the stored payload
 		auto checksum = Checksum(data, size);
-		// write the checksum and the length of the entry
+		// write the length of the stored payload, the checksum and the uncompressed size
+		// (zero means the payload is stored raw)
 		stream->Write<uint64_t>(size);
 		stream->Write<uint64_t>(checksum);
+		stream->Write<uint64_t>(uncompressed_size);
 		// write data to the underlying stream
-		stream->WriteData(memory_stream.GetData(), memory_stream.GetPosition());
+		stream->WriteData(data, size);
 		// rewind the buffer
 		memory_stream.Rewind();
 	}
@@ -198,6 +223,8 @@ private:
 	WriteAheadLog &wal;
 	optional_ptr<WriteStream> stream;
 	MemoryStream memory_stream;
+	//! Scratch buffer for compressing entry payloads, grown to the largest bound seen
+	AllocatedData compression_buffer;
 };
 
 class WriteAheadLogSerializer {
@@ -255,9 +282,9 @@ void WriteAheadLog::WriteHeader() {
 	serializer.WriteProperty(100, "wal_type", WALType::WAL_VERSION);
 
 	auto &catalog = database.GetCatalog().Cast<DuckCatalog>();
-	auto encryption_version_number =
-	    catalog.GetIsEncrypted() ? idx_t(WAL_ENCRYPTED_VERSION_NUMBER) : idx_t(WAL_VERSION_NUMBER);
-	serializer.WriteProperty(101, "version", encryption_version_number);
+	auto version_number =
+	    catalog.GetIsEncrypted() ? idx_t(WAL_ENCRYPTED_VERSION_NUMBER) : idx_t(WAL_COMPRESSED_VERSION_NUMBER);
+	serializer.WriteProperty(101, "version", version_number);
 
 	auto &single_file_block_manager = database.GetStorageManager().GetBlockManager().Cast<SingleFileBlockManager>();
 	auto file_version_number = single_file_block_manager.GetVersionNumber();
@@ -528,18 +555,37 @@ void WriteAheadLog::WriteAlter(CatalogEntry &entry, const AlterInfo &info) {
 //===--------------------------------------------------------------------===//
 // FLUSH
 //===--------------------------------------------------------------------===//
-void WriteAheadLog::Flush() {
+idx_t WriteAheadLog::WriteFlushMarker() {
 	if (!writer) {
-		return;
+		return flush_generation.load();
 	}
 
 	// write an empty entry
 	WriteAheadLogSerializer serializer(*this, WALType::WAL_FLUSH);
 	serializer.End();
+	return ++flush_generation;
+}
+
+idx_t WriteAheadLog::SyncFlush() {
+	if (!writer) {
+		return flush_generation.load();
+	}
+	// capture the generation before syncing - any marker written up to here is covered
+	auto covered_generation = flush_generation.load();
 
 	// flushes all changes made to the WAL to disk
 	writer->Sync();
 	wal_size = writer->GetFileSize();
+	synced_flush_generation = covered_generation;
+	return covered_generation;
+}
+
+void WriteAheadLog::Flush() {
+	if (!writer) {
+		return;
+	}
+	WriteFlushMarker();
+	SyncFlush();
 }
 
 } // namespace duckdb
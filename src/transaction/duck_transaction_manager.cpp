@@ -12,9 +12,15 @@
 #include "duckdb/main/client_context.hpp"
 #include "duckdb/main/connection_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database.hpp"
 #include "duckdb/main/database_manager.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
 #include "duckdb/transaction/meta_transaction.hpp"
 #include "duckdb/main/settings.hpp"
+#include "duckdb/storage/write_ahead_log.hpp"
+#include "duckdb/common/chrono.hpp"
+#include "duckdb/common/numeric_utils.hpp"
+#include "duckdb/common/thread.hpp"
 
 namespace duckdb {
 
@@ -172,6 +178,147 @@ DuckTransactionManager::CanCheckpoint(DuckTransaction &transaction, unique_ptr<S
 	return CheckpointDecision(checkpoint_type);
 }
 
+//! Runs an automatic checkpoint on a scheduler worker thread,
+//! so the committing transaction does not have to wait for the checkpoint to finish.
+class BackgroundCheckpointTask : public Task {
+public:
+	BackgroundCheckpointTask(DatabaseInstance &db_instance, string db_name_p)
+	    : db_instance(db_instance.shared_from_this()), db_name(std::move(db_name_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		try {
+			// re-resolve the database: it may have been detached since the task was scheduled
+			auto database = DatabaseManager::Get(*db_instance).GetDatabase(db_name);
+			if (database) {
+				auto context = make_shared_ptr<ClientContext>(db_instance);
+				database->GetTransactionManager().Checkpoint(*context, false);
+			}
+		} catch (...) { // NOLINT: a failed automatic checkpoint is not an error
+			// the WAL stays intact, and the next commit that crosses the threshold re-triggers the checkpoint
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+	string TaskType() const override {
+		return "BackgroundCheckpointTask";
+	}
+
+private:
+	shared_ptr<DatabaseInstance> db_instance;
+	string db_name;
+};
+
+void DuckTransactionManager::ScheduleBackgroundCheckpoint() {
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	lock_guard<mutex> guard(background_checkpoint_lock);
+	if (!background_checkpoint_producer) {
+		background_checkpoint_producer = scheduler.CreateProducer();
+	}
+	shared_ptr<Task> task = make_shared_ptr<BackgroundCheckpointTask>(db.GetDatabase(), db.GetName());
+	scheduler.ScheduleTask(*background_checkpoint_producer, std::move(task));
+}
+
+//! Runs version cleanup on a scheduler worker thread, so large transactions do not have to
+//! pay for cleaning up their own undo buffers at commit time.
+class BackgroundCleanupTask : public Task {
+public:
+	BackgroundCleanupTask(DatabaseInstance &db_instance, string db_name_p)
+	    : db_instance(db_instance.shared_from_this()), db_name(std::move(db_name_p)) {
+	}
+
+	TaskExecutionResult Execute(TaskExecutionMode mode) override {
+		// re-resolve the database: it may have been detached since the task was scheduled
+		auto database = DatabaseManager::Get(*db_instance).GetDatabase(db_name);
+		if (database && database->GetTransactionManager().IsDuckTransactionManager()) {
+			DuckTransactionManager::Get(*database).RunBackgroundCleanup();
+		}
+		return TaskExecutionResult::TASK_FINISHED;
+	}
+
+	string TaskType() const override {
+		return "BackgroundCleanupTask";
+	}
+
+private:
+	shared_ptr<DatabaseInstance> db_instance;
+	string db_name;
+};
+
+void DuckTransactionManager::CleanupPendingTransactions(bool drain_all) {
+	lock_guard<mutex> c_lock(cleanup_lock);
+	do {
+		unique_ptr<DuckCleanupInfo> top_cleanup_info;
+		{
+			lock_guard<mutex> q_lock(cleanup_queue_lock);
+			if (cleanup_queue.empty()) {
+				return;
+			}
+			top_cleanup_info = std::move(cleanup_queue.front());
+			cleanup_queue.pop();
+		}
+		top_cleanup_info->Cleanup();
+	} while (drain_all);
+}
+
+void DuckTransactionManager::RunBackgroundCleanup() {
+	// clear the pending flag before draining: entries enqueued while we drain could otherwise
+	// be missed until the next commit schedules a task again
+	background_cleanup_pending = false;
+	CleanupPendingTransactions(true);
+}
+
+void DuckTransactionManager::ScheduleBackgroundCleanup() {
+	if (background_cleanup_pending.exchange(true)) {
+		// a scheduled task has not started draining yet - it will pick up the new entry
+		return;
+	}
+	auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+	lock_guard<mutex> guard(background_cleanup_lock);
+	if (!background_cleanup_producer) {
+		background_cleanup_producer = scheduler.CreateProducer();
+	}
+	shared_ptr<Task> task = make_shared_ptr<BackgroundCleanupTask>(db.GetDatabase(), db.GetName());
+	scheduler.ScheduleTask(*background_cleanup_producer, std::move(task));
+}
+
+void DuckTransactionManager::GroupWALSync(WriteAheadLog &wal, idx_t target_generation) {
+	auto wait_us = DBConfig::GetSetting<WALGroupCommitWaitSetting>(db.GetDatabase());
+	unique_lock<mutex> sync_guard(wal_sync_lock);
+	while (wal.GetSyncedFlushGeneration() < target_generation) {
+		if (wal_sync_in_progress) {
+			// another committer is already performing a sync - wait for it to cover our entries
+			wal_sync_cv.wait(sync_guard);
+			continue;
+		}
+		// we become the sync leader
+		wal_sync_in_progress = true;
+		sync_guard.unlock();
+		// bounded wait: give concurrently committing transactions a chance to write their WAL
+		// entries and flush markers, so that a single fsync covers all of them
+		if (wait_us > 0) {
+			std::this_thread::sleep_for(std::chrono::microseconds(UnsafeNumericCast<int64_t>(wait_us)));
+		}
+		ErrorData sync_error;
+		{
+			// the sync must be mutually exclusive with WAL writes
+			lock_guard<mutex> wal_guard(wal_lock);
+			try {
+				wal.SyncFlush();
+			} catch (std::exception &ex) {
+				sync_error = ErrorData(ex);
+			}
+		}
+		sync_guard.lock();
+		wal_sync_in_progress = false;
+		wal_sync_cv.notify_all();
+		if (sync_error.HasError()) {
+			// our own sync failed - report the error; waiting committers retry the sync themselves
+			sync_error.Throw();
+		}
+	}
+}
+
 void DuckTransactionManager::Checkpoint(ClientContext &context, bool force) {
 	auto &storage_manager = db.GetStorageManager();
 	auto current = Transaction::TryGet(context, db);
@@ -287,6 +434,18 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 		error = transaction.Commit(db, commit_id, std::move(commit_state));
 	}
 
+	// if group commit is enabled, flushing the commit only wrote the WAL flush marker - record the
+	// generation we must sync up to before returning control to the client
+	idx_t group_sync_generation = 0;
+	optional_ptr<WriteAheadLog> group_sync_wal;
+	if (!error.HasError() && held_wal_lock) {
+		auto wal = db.GetStorageManager().GetWAL();
+		if (wal && wal->GetSyncedFlushGeneration() < wal->GetFlushGeneration()) {
+			group_sync_wal = wal;
+			group_sync_generation = wal->GetFlushGeneration();
+		}
+	}
+
 	if (error.HasError()) {
 		// COMMIT not successful: ROLLBACK.
 		checkpoint_decision = CheckpointDecision(error.Message());
@@ -327,35 +486,49 @@ ErrorData DuckTransactionManager::CommitTransaction(ClientContext &context, Tran
 	// as they (1) have been removed, or (2) enter cleanup_info.
 	t_lock.unlock();
 
-	{
-		lock_guard<mutex> c_lock(cleanup_lock);
-		unique_ptr<DuckCleanupInfo> top_cleanup_info;
-		{
-			lock_guard<mutex> q_lock(cleanup_queue_lock);
-			if (!cleanup_queue.empty()) {
-				top_cleanup_info = std::move(cleanup_queue.front());
-				cleanup_queue.pop();
-			}
-		}
-		if (top_cleanup_info) {
-			top_cleanup_info->Cleanup();
+	if (group_sync_wal) {
+		// group commit: release the WAL lock so other committers can append their entries, then
+		// batch our fsync with theirs - the commit is not durable until this returns
+		held_wal_lock.reset();
+		try {
+			GroupWALSync(*group_sync_wal, group_sync_generation);
+		} catch (std::exception &ex) {
+			error.Merge(ErrorData(ex));
 		}
 	}
 
+	// cleanup scales with the size of the transactions awaiting it - for bulk writes this dominates
+	// commit latency, so optionally hand it to a scheduler worker instead of cleaning up here
+	// cleanups remain ordered regardless of who drains them, as they go through the cleanup queue
+	if (DBConfig::GetConfig(context).options.background_cleanup &&
+	    TaskScheduler::GetScheduler(db.GetDatabase()).NumberOfThreads() > 1) {
+		ScheduleBackgroundCleanup();
+	} else {
+		CleanupPendingTransactions(false);
+	}
+
 	// now perform a checkpoint if (1) we are able to checkpoint, and (2) the WAL has reached sufficient size to
 	// checkpoint
 	if (checkpoint_decision.can_checkpoint) {
 		D_ASSERT(lock);
-		// we can unlock the transaction lock while checkpointing
-		// checkpoint the database to disk
-		CheckpointOptions options;
-		options.action = CheckpointAction::ALWAYS_CHECKPOINT;
-		options.type = checkpoint_decision.type;
-		auto &storage_manager = db.GetStorageManager();
-		try {
-			storage_manager.CreateCheckpoint(context, options);
-		} catch (std::exception &ex) {
-			error.Merge(ErrorData(ex));
+		auto &scheduler = TaskScheduler::GetScheduler(db.GetDatabase());
+		if (DBConfig::GetConfig(context).options.background_checkpoint && scheduler.NumberOfThreads() > 1) {
+			// hand the checkpoint off to a background task: release the checkpoint lock here,
+			// the task re-acquires it (or bails out, if another writer got there first)
+			lock.reset();
+			ScheduleBackgroundCheckpoint();
+		} else {
+			// we can unlock the transaction lock while checkpointing
+			// checkpoint the database to disk
+			CheckpointOptions options;
+			options.action = CheckpointAction::ALWAYS_CHECKPOINT;
+			options.type = checkpoint_decision.type;
+			auto &storage_manager = db.GetStorageManager();
+			try {
+				storage_manager.CreateCheckpoint(context, options);
+			} catch (std::exception &ex) {
+				error.Merge(ErrorData(ex));
+			}
 		}
 	}
 
@@ -379,19 +552,11 @@ void DuckTransactionManager::RollbackTransaction(Transaction &transaction_p) {
 		}
 	}
 
-	{
-		lock_guard<mutex> c_lock(cleanup_lock);
-		unique_ptr<DuckCleanupInfo> top_cleanup_info;
-		{
-			lock_guard<mutex> q_lock(cleanup_queue_lock);
-			if (!cleanup_queue.empty()) {
-				top_cleanup_info = std::move(cleanup_queue.front());
-				cleanup_queue.pop();
-			}
-		}
-		if (top_cleanup_info) {
-			top_cleanup_info->Cleanup();
-		}
+	if (DBConfig::GetConfig(db.GetDatabase()).options.background_cleanup &&
+	    TaskScheduler::GetScheduler(db.GetDatabase()).NumberOfThreads() > 1) {
+		ScheduleBackgroundCleanup();
+	} else {
+		CleanupPendingTransactions(false);
 	}
 
 	if (error.HasError()) {
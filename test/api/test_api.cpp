@@ -755,3 +755,25 @@ TEST_CASE("Test SqlStatement::ToString for UPDATE, INSERT, DELETE statements wit
 	stmts = con.ExtractStatements(sql);
 	REQUIRE(stmts[0]->ToString() == sql);
 }
+
+TEST_CASE("Test multi statement batches respect the session search path", "[api]") {
+	duckdb::unique_ptr<QueryResult> result;
+	DuckDB db(nullptr);
+	Connection con(db);
+
+	REQUIRE_NO_FAIL(con.Query("CREATE SCHEMA s1"));
+	REQUIRE_NO_FAIL(con.Query("CREATE SCHEMA s2"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE s1.tbl AS SELECT 1 AS i"));
+	REQUIRE_NO_FAIL(con.Query("CREATE TABLE s2.tbl AS SELECT 2 AS i"));
+	REQUIRE_NO_FAIL(con.Query("SET search_path='s2'"));
+
+	// every statement in the batch must bind under the session search path - including later ones,
+	// which are pre-bound on a background thread while the previous statement executes
+	result = con.Query("SELECT i FROM tbl; SELECT i + 10 FROM tbl; SELECT i + 20 FROM tbl");
+	REQUIRE(CHECK_COLUMN(result, 0, {2}));
+	result = std::move(result->next);
+	REQUIRE(CHECK_COLUMN(result, 0, {12}));
+	result = std::move(result->next);
+	REQUIRE(CHECK_COLUMN(result, 0, {22}));
+	REQUIRE(!result->next);
+}
@@ -115,3 +115,40 @@ TEST_CASE("Test user_agent", "[api]") {
 		REQUIRE_THAT(res->GetValue(0, 0).ToString(), Catch::Matchers::Matches("duckdb/.*(.*) go"));
 	}
 }
+
+TEST_CASE("Test direct_io database round trip", "[api]") {
+	auto path = TestCreatePath("direct_io_round_trip.db");
+	DeleteDatabase(path);
+	{
+		DBConfig config;
+		config.SetOptionByName("direct_io", Value::BOOLEAN(true));
+		DuckDB db(path, &config);
+		Connection con(db);
+		REQUIRE(db.instance->config.options.use_direct_io);
+		REQUIRE_NO_FAIL(con.Query("CREATE TABLE integers AS SELECT range AS i FROM range(10000)"));
+		REQUIRE_NO_FAIL(con.Query("CHECKPOINT"));
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {10000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(49995000)}));
+		// direct_io cannot be toggled on a running database
+		REQUIRE_FAIL(con.Query("SET direct_io=false"));
+	}
+	{
+		// re-open with direct I/O and read the checkpointed data back
+		DBConfig config;
+		config.SetOptionByName("direct_io", Value::BOOLEAN(true));
+		DuckDB db(path, &config);
+		Connection con(db);
+		auto result = con.Query("SELECT COUNT(*), SUM(i) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {10000}));
+		REQUIRE(CHECK_COLUMN(result, 1, {Value::BIGINT(49995000)}));
+	}
+	{
+		// a database written with direct I/O opens fine without it
+		DuckDB db(path);
+		Connection con(db);
+		auto result = con.Query("SELECT COUNT(*) FROM integers");
+		REQUIRE(CHECK_COLUMN(result, 0, {10000}));
+	}
+	DeleteDatabase(path);
+}
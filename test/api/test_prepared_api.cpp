@@ -540,3 +540,80 @@ TEST_CASE("Test prepared statements with extension that can request a rebind", "
 	// SetVariableStatement
 	REQUIRE_NO_FAIL(con.Prepare("SET VARIABLE test_var = ?")->Execute(42));
 }
+
+TEST_CASE("Test shared plan cache respects the session search path", "[api]") {
+	DuckDB db(nullptr);
+	Connection con1(db);
+	Connection con2(db);
+	duckdb::unique_ptr<QueryResult> result;
+
+	REQUIRE_NO_FAIL(con1.Query("CREATE SCHEMA s1"));
+	REQUIRE_NO_FAIL(con1.Query("CREATE SCHEMA s2"));
+	REQUIRE_NO_FAIL(con1.Query("CREATE TABLE s1.tbl AS SELECT 1 AS i"));
+	REQUIRE_NO_FAIL(con1.Query("CREATE TABLE s2.tbl AS SELECT 2 AS i"));
+	REQUIRE_NO_FAIL(con1.Query("SET search_path='s1'"));
+	REQUIRE_NO_FAIL(con2.Query("SET search_path='s2'"));
+
+	// prepare, execute and destroy the statement on con1 - its plan lands in the shared cache
+	{
+		auto prepared = con1.Prepare("SELECT i FROM tbl");
+		REQUIRE(!prepared->HasError());
+		result = prepared->Execute();
+		REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	}
+	// the identical text on con2 must not pick up con1's plan - it binds under a different search path
+	{
+		auto prepared = con2.Prepare("SELECT i FROM tbl");
+		REQUIRE(!prepared->HasError());
+		result = prepared->Execute();
+		REQUIRE(CHECK_COLUMN(result, 0, {2}));
+	}
+	// re-preparing on con1 still resolves s1.tbl
+	{
+		auto prepared = con1.Prepare("SELECT i FROM tbl");
+		REQUIRE(!prepared->HasError());
+		result = prepared->Execute();
+		REQUIRE(CHECK_COLUMN(result, 0, {1}));
+	}
+	// after switching the search path the cached con1 plan must not be reused either
+	REQUIRE_NO_FAIL(con1.Query("SET search_path='s2'"));
+	{
+		auto prepared = con1.Prepare("SELECT i FROM tbl");
+		REQUIRE(!prepared->HasError());
+		result = prepared->Execute();
+		REQUIRE(CHECK_COLUMN(result, 0, {2}));
+	}
+}
+
+TEST_CASE("Test shared plan cache respects session settings", "[api]") {
+	DuckDB db(nullptr);
+	Connection con1(db);
+	Connection con2(db);
+	duckdb::unique_ptr<QueryResult> result;
+
+	// integer_division is session-local and changes what "/" binds to
+	REQUIRE_NO_FAIL(con1.Query("SET integer_division=true"));
+
+	// prepare, execute and destroy the statement on con1 - its plan lands in the shared cache
+	{
+		auto prepared = con1.Prepare("SELECT 1/2");
+		REQUIRE(!prepared->HasError());
+		result = prepared->Execute();
+		REQUIRE(CHECK_COLUMN(result, 0, {0}));
+	}
+	// con2 runs with the default setting - it must not be served con1's integer-division plan
+	{
+		auto prepared = con2.Prepare("SELECT 1/2");
+		REQUIRE(!prepared->HasError());
+		result = prepared->Execute();
+		REQUIRE(CHECK_COLUMN(result, 0, {0.5}));
+	}
+	// resetting the setting on con1 must stop matching its previously cached plan as well
+	REQUIRE_NO_FAIL(con1.Query("RESET integer_division"));
+	{
+		auto prepared = con1.Prepare("SELECT 1/2");
+		REQUIRE(!prepared->HasError());
+		result = prepared->Execute();
+		REQUIRE(CHECK_COLUMN(result, 0, {0.5}));
+	}
+}